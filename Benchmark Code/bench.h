@@ -0,0 +1,300 @@
+/// @file bench.h
+/// @brief Minimal timing harness shared by the benchmark programs
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Provides an optimisation barrier, a best-of-N wall clock timer and reproducible random interval data so that every benchmark reports comparable ns/op figures.
+/// @details bench::measure also reads the cycle, instruction and cache miss counters of the processor through perf_event_open on Linux. Counters the kernel refuses are reported as missing; cycles then fall back to the time stamp counter on x86.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace bench
+{
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 optimisation barriers
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Prevents the compiler from discarding a value that is only computed for timing
+    /// @param value the value that must be materialised
+    template <class T>
+    inline void do_not_optimize(T const &value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory"); // force value into a register or memory
+    }
+
+    /// @brief Prevents the compiler from caching memory across the barrier
+    inline void clobber()
+    {
+        asm volatile("" : : : "memory"); // tell the compiler all memory may have changed
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 timing
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Times a callable and returns the best nanoseconds per operation over several repeats
+    /// @param ops the number of operations one call of fn performs
+    /// @param fn the callable to time
+    /// @param repeats the number of timed repeats, the fastest is kept
+    /// @return the best observed nanoseconds per operation
+    template <class Fn>
+    double time_ns_per_op(std::size_t ops, Fn &&fn, int repeats = 7)
+    {
+        using clock = std::chrono::steady_clock;
+        fn(); // warm caches and branch predictors
+        double best = 1e300;
+        for (int r = 0; r < repeats; ++r)
+        {
+            auto start = clock::now();
+            fn();
+            auto stop = clock::now();
+            double ns = std::chrono::duration<double, std::nano>(stop - start).count() / double(ops);
+            if (ns < best)
+                best = ns; // keep the fastest repeat
+        }
+        return best;
+    }
+
+    /// @brief Prints one result line in a fixed column layout
+    /// @param name the benchmark name
+    /// @param ns_per_op the measured nanoseconds per operation
+    inline void report(char const *name, double ns_per_op)
+    {
+        std::printf("%-40s %10.3f ns/op\n", name, ns_per_op);
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 hardware counters
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Counter totals over one timed region, negative when a counter is unavailable
+    struct sample
+    {
+        double cycles = -1.0;       ///< core clock cycles, or time stamp counter ticks if #cycle_source is "tsc"
+        double instructions = -1.0; ///< instructions retired
+        double cache_misses = -1.0; ///< last level cache misses
+    };
+
+    /// @brief The user space cycle, instruction and last level cache miss counters of the calling thread
+    /// @details Each counter is opened on its own so that one the kernel refuses, as in most containers and virtual machines, does not disable the others.
+    class counters
+    {
+    public:
+        /// @brief Opens every counter the kernel allows
+        counters() noexcept
+        {
+#if defined(__linux__)
+            std::uint64_t const config[3] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES};
+            for (int k = 0; k < 3; ++k)
+            {
+                perf_event_attr attr;
+                std::memset(&attr, 0, sizeof(attr));
+                attr.size = sizeof(attr);
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = config[k];
+                attr.disabled = 1;       // started by start()
+                attr.exclude_kernel = 1; // allowed at the default paranoid level
+                attr.exclude_hv = 1;
+                Fd[k] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0)); // this thread, any processor
+            }
+#endif
+        }
+
+        /// @brief Closes the counters
+        ~counters()
+        {
+#if defined(__linux__)
+            for (int fd : Fd)
+                if (fd >= 0)
+                    close(fd);
+#endif
+        }
+
+        counters(counters const &) = delete;            ///< counters cannot be copied
+        counters &operator=(counters const &) = delete; ///< counters cannot be assigned
+
+        /// @brief Gets where cycle counts come from
+        /// @return "perf" for core cycles, "tsc" for time stamp counter ticks, or "none"
+        char const *cycle_source() const noexcept
+        {
+            if (Fd[0] >= 0)
+                return "perf";
+#if defined(__x86_64__) || defined(__i386__)
+            return "tsc";
+#else
+            return "none";
+#endif
+        }
+
+        /// @brief Zeroes and starts every open counter
+        void start() noexcept
+        {
+#if defined(__linux__)
+            for (int fd : Fd)
+                if (fd >= 0)
+                {
+                    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+                }
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+            Tsc = __rdtsc();
+#endif
+        }
+
+        /// @brief Stops every open counter and reads the totals since start()
+        /// @return the totals, negative for counters that are not open
+        sample stop() noexcept
+        {
+            sample s;
+#if defined(__x86_64__) || defined(__i386__)
+            s.cycles = double(__rdtsc() - Tsc); // replaced below when the core cycle counter is open
+#endif
+#if defined(__linux__)
+            double *out[3] = {&s.cycles, &s.instructions, &s.cache_misses};
+            for (int k = 0; k < 3; ++k)
+            {
+                std::uint64_t value;
+                if (Fd[k] >= 0 && ioctl(Fd[k], PERF_EVENT_IOC_DISABLE, 0) == 0 && read(Fd[k], &value, sizeof(value)) == sizeof(value))
+                    *out[k] = double(value);
+            }
+#endif
+            return s;
+        }
+
+    private:
+        int Fd[3] = {-1, -1, -1}; ///< cycles, instructions and cache misses, -1 if not open
+        std::uint64_t Tsc = 0;    ///< time stamp counter at start()
+    };
+
+    /// @brief Gets the counters shared by every measurement of the process
+    /// @return the counters, opened on first use
+    inline counters &hardware_counters()
+    {
+        static counters c; // opening costs a system call per counter
+        return c;
+    }
+
+    /// @brief The cost of one operation, from the fastest of several repeats
+    struct measurement
+    {
+        double ns_per_op = 0.0;            ///< wall clock nanoseconds per operation
+        double cycles_per_op = -1.0;       ///< cycles per operation, negative if unknown
+        double instructions_per_op = -1.0; ///< instructions per operation, negative if unknown
+        double cache_misses_per_op = -1.0; ///< last level cache misses per operation, negative if unknown
+    };
+
+    /// @brief Times a callable and reads the hardware counters over its fastest repeat
+    /// @param ops the number of operations one call of fn performs
+    /// @param fn the callable to time
+    /// @param repeats the number of timed repeats, the fastest is kept
+    /// @return the cost per operation of the fastest repeat
+    template <class Fn>
+    measurement measure(std::size_t ops, Fn &&fn, int repeats = 7)
+    {
+        using clock = std::chrono::steady_clock;
+        counters &hw = hardware_counters();
+        fn(); // warm caches and branch predictors
+        measurement best;
+        best.ns_per_op = 1e300;
+        for (int r = 0; r < repeats; ++r)
+        {
+            hw.start();
+            auto start = clock::now();
+            fn();
+            auto stop = clock::now();
+            sample s = hw.stop();
+            double ns = std::chrono::duration<double, std::nano>(stop - start).count() / double(ops);
+            if (ns < best.ns_per_op) // keep the fastest repeat with its own counts
+            {
+                best.ns_per_op = ns;
+                best.cycles_per_op = s.cycles < 0 ? -1.0 : s.cycles / double(ops);
+                best.instructions_per_op = s.instructions < 0 ? -1.0 : s.instructions / double(ops);
+                best.cache_misses_per_op = s.cache_misses < 0 ? -1.0 : s.cache_misses / double(ops);
+            }
+        }
+        return best;
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 JSON output
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Formats a number for JSON, null when it is negative and so unknown
+    /// @param value the number
+    /// @return the JSON text of the number
+    inline std::string json_number(double value)
+    {
+        if (value < 0 || value != value)
+            return "null";
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "%.6g", value);
+        return buf;
+    }
+
+    /// @brief Formats a string for JSON, escaping quotes, backslashes and control characters
+    /// @param text the string
+    /// @return the quoted JSON text of the string
+    inline std::string json_string(std::string const &text)
+    {
+        std::string out = "\"";
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+                out += '\\';
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                out += buf;
+                continue;
+            }
+            out += c;
+        }
+        return out + "\"";
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 data generation
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Generates reproducible random interval endpoints
+    /// @param n the number of intervals
+    /// @param lo the smallest value an endpoint may take
+    /// @param hi the largest value an endpoint may take
+    /// @param seed the random seed
+    /// @return a vector of 2n values where element 2i is the lower and 2i+1 the upper endpoint
+    inline std::vector<double> random_endpoints(std::size_t n, double lo, double hi, unsigned seed)
+    {
+        std::mt19937_64 gen(seed);
+        std::uniform_real_distribution<double> dist(lo, hi);
+        std::vector<double> out(2 * n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            double a = dist(gen), b = dist(gen);
+            out[2 * i] = a < b ? a : b;     // lower endpoint
+            out[2 * i + 1] = a < b ? b : a; // upper endpoint
+        }
+        return out;
+    }
+} // namespace bench
@@ -0,0 +1,176 @@
+/// @file bench_affine.cpp
+/// @brief Affine forms against intervals: operation throughput, the dependency problem and the bisections saved in branch and bound
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Times +, *, / and sqr on #affine_form operands of about ten terms sharing eight symbols, against #interval on the ranges of the same operands, and reports the slab memory of the term arenas before and after, which must not grow once the arenas are warm. Repeats the p += a; p -= a; of Example.cpp with both types.
+/// @details Then minimises three test functions with minimize on one worker, evaluating the function in interval arithmetic, in affine arithmetic converted back to an interval, and in both with the enclosures intersected, and prints the boxes each search evaluated, its time and how many times fewer boxes than the interval search it needed. Affine forms are tighter over narrow boxes but their linear terms can take a square below zero over wide ones, which the intersection avoids. Every run must enclose the known minimum of its function.
+/// @details Usage: bench_affine [operations]
+/// @details Build: g++ -std=c++20 -O2 -pthread -I.. bench_affine.cpp ../affine_form.cpp ../parallel.cpp ../interval_math.cpp ../interval_array.cpp ../interval.cpp -o bench_affine
+#include "bench.h"
+#include "affine_form.h"
+#include "optimize.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+using box = std::span<interval const>; ///< the argument of every test function
+
+/// @brief The six-hump camel function of two variables, minimum -1.0316284534898774
+template <class V>
+V camel(V const *x)
+{
+    V x2 = sqr(x[0]), y2 = sqr(x[1]);
+    return (4.0 - 2.1 * x2 + sqr(x2) / 3.0) * x2 + x[0] * x[1] + (-4.0 + 4.0 * y2) * y2;
+}
+
+/// @brief The Matyas function of two variables, minimum 0; its two terms cancel along x = y
+template <class V>
+V matyas(V const *x)
+{
+    return 0.26 * (sqr(x[0]) + sqr(x[1])) - 0.48 * x[0] * x[1];
+}
+
+/// @brief The Rosenbrock function of four variables, minimum 0
+template <class V>
+V rosenbrock(V const *x)
+{
+    V sum(0.0);
+    for (std::size_t i = 0; i + 1 < 4; ++i)
+        sum += 100.0 * sqr(x[i + 1] - sqr(x[i])) + sqr(1.0 - x[i]);
+    return sum;
+}
+
+/// @brief A test function with its search box and known minimum
+struct problem
+{
+    char const *name;                         ///< the printed name
+    std::function<interval(box)> by_interval; ///< the function in interval arithmetic
+    std::function<interval(box)> by_affine;   ///< the function in affine arithmetic, one new symbol per side of the box
+    std::function<interval(box)> by_both;     ///< the intersection of both enclosures
+    std::vector<interval> domain;             ///< the search box
+    double minimum;                           ///< the known global minimum
+    minimize_options options;                 ///< the stopping rules
+};
+
+/// @brief Wraps a test function of at most four variables for both arithmetics
+template <class F>
+problem make(char const *name, F f, std::vector<interval> domain, double minimum, minimize_options options)
+{
+    auto by_affine = [f](box x)
+    {
+        std::array<affine_form, 4> a;
+        for (std::size_t i = 0; i < x.size(); ++i)
+            a[i] = affine_form(x[i]);
+        return f(a.data()).to_interval();
+    };
+    auto by_both = [f, by_affine](box x)
+    {
+        interval a = by_affine(x), b = f(x.data());
+        return interval(std::max(a.min(), b.min()), std::min(a.max(), b.max()));
+    };
+    return {name, [f](box x) { return f(x.data()); }, by_affine, by_both, std::move(domain), minimum, options};
+}
+
+/// @brief Builds the three test problems
+std::vector<problem> problems()
+{
+    std::vector<problem> out;
+    out.push_back(make("six-hump camel", [](auto const *x) { return camel(x); }, {interval(-3.0, 3.0), interval(-2.0, 2.0)},
+                       -1.0316284534898774, {1e-5, 1e-6, 20000000}));
+    out.push_back(make("matyas", [](auto const *x) { return matyas(x); }, {interval(-10.0, 10.0), interval(-10.0, 10.0)}, 0.0,
+                       {1e-5, 1e-6, 20000000}));
+    out.push_back(make("rosenbrock 4d", [](auto const *x) { return rosenbrock(x); }, std::vector<interval>(4, interval(-5.0, 10.0)), 0.0,
+                       {1e-4, 1e-6, 20000000}));
+    return out;
+}
+
+/// @brief Times the operators of both types on operands of about ten terms
+/// @param n the number of operand pairs
+void throughput(std::size_t n)
+{
+    std::vector<double> ends = bench::random_endpoints(8 + 2 * n, 1.0, 2.0, 7);
+    std::array<affine_form, 8> v;
+    for (std::size_t j = 0; j < 8; ++j)
+        v[j] = affine_form(interval(ends[2 * j], ends[2 * j] + 0.01));
+    std::vector<affine_form> x(n), y(n);
+    std::vector<interval> xi(n), yi(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        double p = ends[16 + 2 * i], q = ends[17 + 2 * i];
+        x[i] = v[i % 8] * p + v[(i + 3) % 8] - v[(i + 5) % 8] * q;
+        y[i] = v[(i + 1) % 8] + v[(i + 2) % 8] * q + 4.0;
+        xi[i] = x[i].to_interval();
+        yi[i] = y[i].to_interval();
+    }
+
+    std::printf("%-8s %14s %14s %8s   operands of %zu and %zu terms\n", "op", "interval ns/op", "affine ns/op", "ratio", x[0].size(), y[0].size());
+    auto row = [&](char const *name, auto by_interval, auto by_affine)
+    {
+        double ti = bench::time_ns_per_op(n, [&]
+                                          {
+                                              for (std::size_t i = 0; i < n; ++i)
+                                                  bench::do_not_optimize(by_interval(xi[i], yi[i])); }, 5);
+        double ta = bench::time_ns_per_op(n, [&]
+                                          {
+                                              for (std::size_t i = 0; i < n; ++i)
+                                                  bench::do_not_optimize(by_affine(x[i], y[i]).center()); }, 5);
+        std::printf("%-8s %14.2f %14.2f %7.1fx\n", name, ti, ta, ta / ti);
+    };
+    std::size_t before = affine_detail::arena_bytes();
+    row("+", [](interval const &a, interval const &b) { return a + b; }, [](affine_form const &a, affine_form const &b) { return a + b; });
+    row("*", [](interval const &a, interval const &b) { return a * b; }, [](affine_form const &a, affine_form const &b) { return a * b; });
+    row("/", [](interval const &a, interval const &b) { return a / b; }, [](affine_form const &a, affine_form const &b) { return a / b; });
+    row("sqr", [](interval const &a, interval const &) { return sqr(a); }, [](affine_form const &a, affine_form const &) { return sqr(a); });
+    std::printf("arena slabs: %zu bytes before timing, %zu after\n\n", before, affine_detail::arena_bytes());
+}
+
+/// @brief Runs the affine arithmetic benchmark
+/// @param argc 1, or 2 with a size
+/// @param argv the optional number of operand pairs, by default 2^16
+int main(int argc, char **argv)
+{
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t(1) << 16;
+    throughput(n);
+
+    // the dependency problem of Example.cpp
+    interval xi(3.0, 3.1), pi(xi), ai = xi + 7.0;
+    pi += ai;
+    pi -= ai;
+    affine_form xa(xi), pa(xa), aa = xa + 7.0;
+    pa += aa;
+    pa -= aa;
+    interval pr = pa.to_interval();
+    std::printf("p += a; p -= a;   interval [%.17g, %.17g]   affine [%.17g, %.17g]\n\n", pi.min(), pi.max(), pr.min(), pr.max());
+    bool ok = pr.min() <= 3.0 && pr.max() >= 3.1 && pr.max() - pr.min() < 0.1 + 1e-12;
+
+    // bisections saved
+    thread_pool one(1);
+    std::printf("%-16s %-9s %25s %10s %10s %12s\n", "function", "arith", "minimum", "boxes", "seconds", "vs interval");
+    for (problem const &p : problems())
+    {
+        std::size_t base = 0;
+        for (auto [arith, f] : {std::pair{"interval", &p.by_interval}, std::pair{"affine", &p.by_affine}, std::pair{"both", &p.by_both}})
+        {
+            minimize_result<interval> r = minimize(*f, p.domain, p.options, one);
+            if (r.minimum.min() > p.minimum || r.minimum.max() < p.minimum - 1e-9)
+            {
+                std::printf("%s: [%.12g, %.12g] misses the minimum %.12g\n", p.name, r.minimum.min(), r.minimum.max(), p.minimum);
+                ok = false;
+            }
+            base = base ? base : r.boxes;
+            std::printf("%-16s %-9s [%11.8f, %11.8f] %10zu %10.3f %10.2fx%s\n", p.name, arith, r.minimum.min(), r.minimum.max(), r.boxes, r.seconds,
+                        double(base) / double(r.boxes), r.complete ? "" : "  stopped at max_boxes");
+        }
+    }
+    std::printf("arena slabs: %zu bytes\n", affine_detail::arena_bytes());
+    if (!ok)
+    {
+        std::printf("an affine enclosure is wrong\n");
+        return 1;
+    }
+}
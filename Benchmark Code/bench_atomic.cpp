@@ -0,0 +1,144 @@
+/// @file bench_atomic.cpp
+/// @brief Shared interval bounds under contention: atomic_interval and the sharded accumulator against a mutex guarded interval
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Threads, from 1 to 64, fold a fixed total of intervals into one shared result: a sum with fetch_add and a hull with fetch_hull. Each fold is timed with an #interval behind a std::mutex, with an #atomic_interval, and with a basic_interval_accumulator of one shard per thread. Prints ns per operation over all threads, so a flat line is perfect scaling of throughput, and the speed of each against the mutex.
+/// @details The intervals have small integer end points, so every sum is exact and every method must give the same result as a serial loop. A reader thread loads the atomic interval throughout its hull run and checks that it never sees a lower end point of one value with the upper end point of another: the lower end point only falls and the upper only rises, and both come from the same step of one writer.
+/// @details Usage: bench_atomic [operations]
+/// @details Build: g++ -std=c++20 -O2 -pthread -I.. bench_atomic.cpp ../atomic_interval.cpp ../interval.cpp -o bench_atomic
+#include "bench.h"
+#include "atomic_interval.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// @brief The interval thread t folds at step k; sums stay exact and hulls widen by one at a time
+interval item(std::size_t t, std::size_t k)
+{
+    double c = double((t * 7 + k) % 64);
+    return interval(-c, c + 1.0);
+}
+
+/// @brief Runs fn(t, begin, end) on each of several threads and times the whole run
+/// @return the nanoseconds per operation over all threads
+template <class Fn>
+double contended(std::size_t threads, std::size_t ops, Fn fn)
+{
+    return bench::time_ns_per_op(ops, [&]
+                                 {
+                                     std::vector<std::thread> pool;
+                                     std::atomic<bool> go{false};
+                                     for (std::size_t t = 0; t < threads; ++t)
+                                         pool.emplace_back([&, t]
+                                                           {
+                                                               while (!go.load(std::memory_order_acquire))
+                                                                   std::this_thread::yield();
+                                                               fn(t, ops / threads); });
+                                     go.store(true, std::memory_order_release);
+                                     for (std::thread &th : pool)
+                                         th.join(); }, 3);
+}
+
+/// @brief Checks that two intervals have the same end points
+bool same(interval const &a, interval const &b) { return a.min() == b.min() && a.max() == b.max(); }
+
+/// @brief Runs the contention benchmark
+/// @param argc 1, or 2 with a size
+/// @param argv the optional number of operations per run over all threads, by default 2^22
+int main(int argc, char **argv)
+{
+    std::size_t total = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t(1) << 22;
+    std::printf("%zu operations per run, %u hardware threads, atomic_interval is %s\n", total, std::thread::hardware_concurrency(),
+                atomic_interval::is_lock_free() ? "lock free (cmpxchg16b)" : "sequence locked");
+    std::printf("%8s %-6s %14s %14s %8s %14s %8s\n", "threads", "fold", "mutex ns/op", "atomic ns/op", "speed", "sharded ns/op", "speed");
+
+    bool ok = true;
+    for (std::size_t threads : {1, 2, 4, 8, 16, 32, 64})
+    {
+        std::size_t ops = total / threads * threads;
+        interval sum_expect(0.0), hull_expect(0.0, 1.0);
+        for (std::size_t t = 0; t < threads; ++t)
+            for (std::size_t k = 0; k < ops / threads; ++k)
+            {
+                sum_expect += item(t, k);
+                interval x = item(t, k);
+                hull_expect = interval(std::min(hull_expect.min(), x.min()), std::max(hull_expect.max(), x.max()));
+            }
+
+        // sums
+        std::mutex m;
+        interval guarded(0.0);
+        double t_mutex = contended(threads, ops, [&](std::size_t t, std::size_t n)
+                                   {
+                                       for (std::size_t k = 0; k < n; ++k)
+                                       {
+                                           std::lock_guard<std::mutex> lock(m);
+                                           guarded += item(t, k);
+                                       } });
+        atomic_interval shared;
+        double t_atomic = contended(threads, ops, [&](std::size_t t, std::size_t n)
+                                    {
+                                        for (std::size_t k = 0; k < n; ++k)
+                                            shared.fetch_add(item(t, k)); });
+        interval_sum_accumulator sums(threads);
+        double t_sharded = contended(threads, ops, [&](std::size_t t, std::size_t n)
+                                     {
+                                         for (std::size_t k = 0; k < n; ++k)
+                                             sums.accumulate(item(t, k)); });
+        std::printf("%8zu %-6s %14.2f %14.2f %7.2fx %14.2f %7.2fx\n", threads, "add", t_mutex, t_atomic, t_mutex / t_atomic, t_sharded,
+                    t_mutex / t_sharded);
+        // every timed run folded the same intervals once more, four runs in all
+        interval four = sum_expect * 4.0;
+        ok = same(guarded, four) && same(shared.load(), four) && same(sums.load(), four) && ok;
+
+        // hulls, with a reader checking the pairs it sees while the atomic interval is updated
+        guarded = interval(0.0, 1.0);
+        t_mutex = contended(threads, ops, [&](std::size_t t, std::size_t n)
+                            {
+                                for (std::size_t k = 0; k < n; ++k)
+                                {
+                                    interval x = item(t, k);
+                                    std::lock_guard<std::mutex> lock(m);
+                                    guarded = interval(std::min(guarded.min(), x.min()), std::max(guarded.max(), x.max()));
+                                } });
+        std::atomic<bool> done{false}, torn{false};
+        atomic_interval bounds(interval(0.0, 1.0)); // every hull of the items is [-c, c + 1]
+        std::thread reader([&]
+                           {
+                               interval last = bounds.load();
+                               while (!done.load(std::memory_order_acquire))
+                               {
+                                   interval now = bounds.load();
+                                   if (now.min() > last.min() || now.max() < last.max() || now.max() != 1.0 - now.min())
+                                       torn.store(true);
+                                   last = now;
+                               } });
+        t_atomic = contended(threads, ops, [&](std::size_t t, std::size_t n)
+                             {
+                                 for (std::size_t k = 0; k < n; ++k)
+                                     bounds.fetch_hull(item(t, k)); });
+        done.store(true, std::memory_order_release);
+        reader.join();
+        interval_hull_accumulator hulls(threads);
+        t_sharded = contended(threads, ops, [&](std::size_t t, std::size_t n)
+                              {
+                                  for (std::size_t k = 0; k < n; ++k)
+                                      hulls.accumulate(item(t, k)); });
+        std::printf("%8zu %-6s %14.2f %14.2f %7.2fx %14.2f %7.2fx\n", threads, "hull", t_mutex, t_atomic, t_mutex / t_atomic, t_sharded,
+                    t_mutex / t_sharded);
+        ok = same(guarded, hull_expect) && same(bounds.load(), hull_expect) && same(hulls.load(), hull_expect) && ok;
+        if (torn.load())
+        {
+            std::printf("a reader saw a torn or shrinking pair\n");
+            ok = false;
+        }
+    }
+    if (!ok)
+    {
+        std::printf("a concurrent result differs from the serial one\n");
+        return 1;
+    }
+}
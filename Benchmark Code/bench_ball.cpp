@@ -0,0 +1,203 @@
+/// @file bench_ball.cpp
+/// @brief Multiplication heavy kernels in infimum supremum and midpoint radius form, and the width each form gives
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Runs two kernels over arrays of n elements: a product of eight factors and a degree 12 Horner polynomial with point coefficients. Each kernel runs with the batch interval operators, the batch ball operators, a scalar loop over basic_interval with rounding::widen, which like the ball is rigorous in any rounding mode, and a scalar loop over basic_ball. Prints ns per element and operation and the speedup of each ball loop over its interval counterpart.
+/// @details The arguments are balls of relative radius 1e-12, 1e-6, 1e-3 and 0.1 around midpoints of both signs between 0.5 and 1.5, and intervals converted from them. For each radius the mean radius of the ball results over the half width of the batch interval results is printed: the price of ball multiplication, near 1 for narrow arguments and growing towards 1.5 per product as they widen. Every ball result must meet the rigorous scalar interval result.
+/// @details Usage: bench_ball [elements]
+/// @details Build: g++ -std=c++20 -O2 -I.. bench_ball.cpp ../ball_array.cpp ../interval_array.cpp ../interval.cpp -o bench_ball
+#include "bench.h"
+#include "ball_array.h"
+
+#include <cstdlib>
+#include <vector>
+
+/// @brief The number of factors of the product kernel
+constexpr int factors = 8;
+
+/// @brief The degree of the Horner kernel
+constexpr int degree = 12;
+
+/// @brief Rigorous interval type of the scalar interval loops
+using widened = basic_interval<double, rounding::widen>;
+
+/// @brief The arguments of both kernels in both forms
+struct operands
+{
+    std::vector<ball_array> balls;         ///< the factors, the first also the Horner argument
+    std::vector<interval_array> intervals; ///< the same factors as intervals
+    double coef[degree + 1];               ///< the Horner coefficients, highest first
+};
+
+/// @brief Makes the factors for one relative radius
+/// @param n the number of elements
+/// @param rel the radius over the magnitude of the midpoint
+/// @return the operands
+operands make_operands(std::size_t n, double rel)
+{
+    operands o;
+    for (int k = 0; k < factors; ++k)
+    {
+        std::vector<double> e = bench::random_endpoints(n, -1.0, 1.0, 40 + k);
+        ball_array b = ball_array::for_overwrite(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            double m = e[2 * i] < 0 ? e[2 * i] - 0.5 : e[2 * i] + 0.5; // both signs, away from zero
+            b.set(i, ball(m, std::fabs(m) * rel));
+        }
+        interval_array a;
+        to_interval(b, a);
+        o.balls.push_back(std::move(b));
+        o.intervals.push_back(std::move(a));
+    }
+    for (int k = 0; k <= degree; ++k)
+        o.coef[k] = (k % 2 ? -1.0 : 1.0) / double(k + 1);
+    return o;
+}
+
+/// @brief Multiplies the factors with the batch operators of either form
+template <class Array>
+void product(std::vector<Array> const &x, Array &out)
+{
+    mul(x[0], x[1], out);
+    for (int k = 2; k < factors; ++k)
+        mul(out, x[k], out);
+}
+
+/// @brief Evaluates the polynomial with the batch operators of either form
+template <class Array>
+void horner(Array const &x, double const *coef, Array &out)
+{
+    mul(x, coef[0], out);
+    for (int k = 1; k < degree; ++k)
+    {
+        add(out, coef[k], out);
+        mul(out, x, out);
+    }
+    add(out, coef[degree], out);
+}
+
+/// @brief Multiplies the factors of one element with the scalar operators of either form
+template <class Scalar, class Get>
+Scalar product_one(Get &&get, std::size_t i)
+{
+    Scalar p = get(0, i);
+    for (int k = 1; k < factors; ++k)
+        p *= get(k, i);
+    return p;
+}
+
+/// @brief Evaluates the polynomial at one element with the scalar operators of either form
+template <class Scalar>
+Scalar horner_one(Scalar const &x, double const *coef)
+{
+    Scalar p = x * coef[0];
+    for (int k = 1; k < degree; ++k)
+        p = (p + coef[k]) * x;
+    return p + coef[degree];
+}
+
+/// @brief Prints one result line
+/// @param name what was timed
+/// @param ns the nanoseconds per element and operation
+/// @param base the nanoseconds of the interval counterpart, or 0 for an interval loop
+void report(char const *name, double ns, double base)
+{
+    std::printf("  %-22s %8.3f ns/op", name, ns);
+    if (base > 0.0)
+        std::printf("  %6.2fx", base / ns);
+    std::printf("\n");
+}
+
+/// @brief Checks that a ball meets an interval
+bool meets(ball const &b, widened const &x)
+{
+    interval c = b.to_interval();
+    return c.min() <= x.max() && x.min() <= c.max();
+}
+
+/// @brief Times both kernels in both forms for one relative radius and reports the widths
+/// @param n the number of elements
+/// @param rel the relative radius of the arguments
+/// @return false if a ball result misses the rigorous interval result
+bool run(std::size_t n, double rel)
+{
+    operands o = make_operands(n, rel);
+    std::printf("relative radius %g\n", rel);
+    bool ok = true;
+
+    // product of eight factors, seven multiplications per element
+    {
+        interval_array ip;
+        ball_array bp;
+        double ops = double(n) * (factors - 1);
+        double t_ia = bench::time_ns_per_op(1, [&] { product(o.intervals, ip); }) / ops;
+        double t_ba = bench::time_ns_per_op(1, [&] { product(o.balls, bp); }) / ops;
+        auto get_i = [&](int k, std::size_t i) { return widened(o.intervals[k][i]); };
+        auto get_b = [&](int k, std::size_t i) { return o.balls[k][i]; };
+        double sink = 0.0;
+        double t_is = bench::time_ns_per_op(1, [&]
+                                            { for (std::size_t i = 0; i < n; ++i) sink += product_one<widened>(get_i, i).max(); }) / ops;
+        double t_bs = bench::time_ns_per_op(1, [&]
+                                            { for (std::size_t i = 0; i < n; ++i) sink += product_one<ball>(get_b, i).rad(); }) / ops;
+        bench::do_not_optimize(sink);
+        report("product interval batch", t_ia, 0.0);
+        report("product ball batch", t_ba, t_ia);
+        report("product interval loop", t_is, 0.0);
+        report("product ball loop", t_bs, t_is);
+
+        double ratio = 0.0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            ratio += bp.rad()[i] / ((ip.hi()[i] - ip.lo()[i]) / 2);
+            ok = ok && meets(bp[i], product_one<widened>(get_i, i)) && meets(product_one<ball>(get_b, i), product_one<widened>(get_i, i));
+        }
+        std::printf("  product ball radius / interval radius %.4f on average\n", ratio / double(n));
+    }
+
+    // Horner polynomial of degree 12, twelve multiplications and twelve additions per element
+    {
+        interval_array ih;
+        ball_array bh;
+        double ops = double(n) * 2 * degree;
+        double t_ia = bench::time_ns_per_op(1, [&] { horner(o.intervals[0], o.coef, ih); }) / ops;
+        double t_ba = bench::time_ns_per_op(1, [&] { horner(o.balls[0], o.coef, bh); }) / ops;
+        double sink = 0.0;
+        double t_is = bench::time_ns_per_op(1, [&]
+                                            { for (std::size_t i = 0; i < n; ++i) sink += horner_one(widened(o.intervals[0][i]), o.coef).max(); }) / ops;
+        double t_bs = bench::time_ns_per_op(1, [&]
+                                            { for (std::size_t i = 0; i < n; ++i) sink += horner_one(o.balls[0][i], o.coef).rad(); }) / ops;
+        bench::do_not_optimize(sink);
+        report("horner interval batch", t_ia, 0.0);
+        report("horner ball batch", t_ba, t_ia);
+        report("horner interval loop", t_is, 0.0);
+        report("horner ball loop", t_bs, t_is);
+
+        double ratio = 0.0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            widened ref = horner_one(widened(o.intervals[0][i]), o.coef);
+            ratio += bh.rad()[i] / ((ih.hi()[i] - ih.lo()[i]) / 2);
+            ok = ok && meets(bh[i], ref) && meets(horner_one(o.balls[0][i], o.coef), ref);
+        }
+        std::printf("  horner ball radius / interval radius %.4f on average\n", ratio / double(n));
+    }
+    return ok;
+}
+
+/// @brief Runs the ball benchmark
+/// @param argc 1, or 2 with a size
+/// @param argv the optional number of elements, by default 2^16
+int main(int argc, char **argv)
+{
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t(1) << 16;
+    std::printf("%zu elements, %s kernels\n", n, simd_level_name(active_simd_level()));
+    bool ok = true;
+    for (double rel : {1e-12, 1e-6, 1e-3, 1e-1})
+        ok = run(n, rel) && ok;
+    if (!ok)
+    {
+        std::printf("a ball result misses the interval result\n");
+        return 1;
+    }
+}
@@ -0,0 +1,190 @@
+/// @file bench_contract.cpp
+/// @brief HC4 contraction of sparse constraint systems with thousands of variables: full propagation and incremental updates
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Builds three systems around a random solution point s, each constraint allowing its value at s plus a relative 1e-9: a chain x_i x_(i+1) + x_(i+2) and random sparse terms x_a + x_b x_c - x_d^2, both with every tenth variable pinned to s, and terms exp(x_a / 2) - atan(x_b) + sqrt(|x_c|) mixing the elementary functions. Every system is recorded on one tape and narrowed by a contractor from domains of width 4 around s. Prints the revisions to the fixpoint, the time, the revisions per second and the mean width of the domains before and after.
+/// @details Then bisects the domain of one variable at a time, keeping the half that holds s as a branch and prune search would, and narrows again twice: from the constraints on the bisected variable only, and from every constraint. Prints the mean revisions and time of each. Every domain must still hold s after every contraction.
+/// @details Usage: bench_contract [variables]
+/// @details Build: g++ -std=c++20 -O2 -pthread -I.. bench_contract.cpp ../interval_contract.cpp ../interval_tape.cpp ../interval_math.cpp ../parallel.cpp ../interval_array.cpp ../interval_instrument.cpp ../interval.cpp -o bench_contract
+#include "bench.h"
+#include "interval_contract.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+/// @brief A constraint system: its tape, its contractor and the point it was built around
+struct constraint_system
+{
+    tape t;                         ///< the recorded constraints
+    contractor c{t};                ///< the constraints on the nodes of t
+    std::vector<double> solution;   ///< the point every constraint holds at
+    std::vector<tape_value> inputs; ///< the handles of the variables
+
+    /// @brief Adds one constraint, allowing the value of a formula at the solution plus a relative 1e-9
+    /// @param f the formula, called with the handles of its variables and with their values at the solution
+    /// @param vars the variables it reads
+    template <class F>
+    void add(F f, std::vector<std::size_t> const &vars)
+    {
+        std::vector<tape_value> h;
+        std::vector<interval> p;
+        for (std::size_t i : vars)
+        {
+            h.push_back(inputs[i]);
+            p.push_back(interval(solution[i]));
+        }
+        interval v = f(p);
+        double slack = 1e-9 * (1.0 + std::max(std::abs(v.min()), std::abs(v.max())));
+        c.add(f(h), interval(v.min() - slack, v.max() + slack));
+    }
+};
+
+/// @brief Makes n variables with a random solution in [1, 2]
+/// @param s the system to fill
+/// @param n the number of variables
+/// @param seed the seed of the solution
+void make_variables(constraint_system &s, std::size_t n, unsigned seed)
+{
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<double> u(1.0, 2.0);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        s.solution.push_back(u(gen));
+        s.inputs.push_back(s.t.input(i));
+    }
+}
+
+/// @brief Pins every tenth variable to its value at the solution, as measured quantities would be
+void pin(constraint_system &s)
+{
+    for (std::size_t i = 0; i < s.inputs.size(); i += 10)
+        s.add([](auto const &x) { return x[0]; }, {i});
+}
+
+/// @brief Builds the chain x_i x_(i+1) + x_(i+2) = c_i
+void chain(constraint_system &s, std::size_t n)
+{
+    make_variables(s, n, 1);
+    pin(s);
+    for (std::size_t i = 0; i + 2 < n; ++i)
+        s.add([](auto const &x) { return x[0] * x[1] + x[2]; }, {i, i + 1, i + 2});
+}
+
+/// @brief Builds n random sparse constraints x_a + x_b x_c - x_d^2 = c
+void sparse(constraint_system &s, std::size_t n)
+{
+    make_variables(s, n, 2);
+    pin(s);
+    std::mt19937_64 gen(3);
+    for (std::size_t k = 0; k < n; ++k)
+        s.add([](auto const &x) { return x[0] + x[1] * x[2] - sqr(x[3]); }, {k, gen() % n, gen() % n, gen() % n});
+}
+
+/// @brief Builds n constraints exp(x_a / 2) - atan(x_b) + sqrt(|x_c|) = c over neighbouring variables
+void functions(constraint_system &s, std::size_t n)
+{
+    make_variables(s, n, 4);
+    for (std::size_t k = 0; k < n; ++k)
+        s.add([](auto const &x) { return exp(x[0] * 0.5) - atan(x[1]) + sqrt(abs(x[2])); }, {k, (k + 1) % n, (k + 7) % n});
+}
+
+/// @brief Gets the mean width of the domains
+double mean_width(std::vector<interval> const &d)
+{
+    double w = 0.0;
+    for (interval const &x : d)
+        w += x.max() - x.min();
+    return w / double(d.size());
+}
+
+/// @brief Checks that every domain holds the solution
+bool holds(std::vector<interval> const &d, std::vector<double> const &s)
+{
+    for (std::size_t i = 0; i < d.size(); ++i)
+        if (!(d[i].min() <= s[i] && s[i] <= d[i].max()))
+            return false;
+    return true;
+}
+
+/// @brief Times one call and returns its seconds
+template <class F>
+double seconds(F &&f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// @brief Runs the contraction benchmark on one system
+/// @param name the system
+/// @param build fills the system with n variables
+/// @param n the number of variables
+/// @return false if a contraction lost the solution
+bool run(char const *name, std::function<void(constraint_system &, std::size_t)> const &build, std::size_t n)
+{
+    constraint_system s;
+    build(s, n);
+    std::vector<interval> start(n);
+    for (std::size_t i = 0; i < n; ++i)
+        start[i] = interval(s.solution[i] - 2.0, s.solution[i] + 2.0);
+
+    // full propagation from the starting box, best of 3
+    std::vector<interval> d;
+    contract_result r;
+    double best = 1e300;
+    for (int rep = 0; rep < 3; ++rep)
+    {
+        d = start;
+        best = std::min(best, seconds([&] { r = s.c.contract(d); }));
+    }
+    bool ok = !r.empty && holds(d, s.solution);
+    std::printf("%-10s %7zu %7zu %9zu %9.2f %9.2f %10.3e %10.3e\n", name, n, s.c.size(), r.revisions, best * 1e3, r.revisions / best / 1e6,
+                mean_width(start), mean_width(d));
+
+    // bisections from the fixpoint, incremental against full
+    std::mt19937_64 gen(5);
+    std::size_t trials = 200, rev_inc = 0, rev_full = 0;
+    double t_inc = 0.0, t_full = 0.0;
+    for (std::size_t k = 0; k < trials; ++k)
+    {
+        std::size_t i = gen() % n;
+        std::vector<interval> a = d;
+        double mid = 0.5 * (a[i].min() + a[i].max());
+        a[i] = s.solution[i] <= mid ? interval(a[i].min(), mid) : interval(mid, a[i].max()); // the half holding the solution
+        std::vector<interval> b = a;
+        std::size_t changed[] = {i};
+        contract_result ri, rf;
+        t_inc += seconds([&] { ri = s.c.contract(a, changed); });
+        t_full += seconds([&] { rf = s.c.contract(b); });
+        rev_inc += ri.revisions;
+        rev_full += rf.revisions;
+        ok = ok && !ri.empty && !rf.empty && holds(a, s.solution) && holds(b, s.solution);
+    }
+    std::printf("%-10s bisection: incremental %9.1f revisions %9.2f us   full %9.1f revisions %9.2f us   %6.1fx\n", "",
+                double(rev_inc) / trials, t_inc / trials * 1e6, double(rev_full) / trials, t_full / trials * 1e6, t_full / t_inc);
+    return ok;
+}
+
+/// @brief Runs the contraction benchmark
+/// @param argc 1, or 2 with a size
+/// @param argv the optional number of variables, by default 10000
+int main(int argc, char **argv)
+{
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000;
+    std::printf("%-10s %7s %7s %9s %9s %9s %10s %10s\n", "system", "vars", "cons", "revisions", "ms", "Mrev/s", "width", "after");
+    bool ok = true;
+    for (std::size_t m : {n / 10, n})
+    {
+        ok &= run("chain", chain, m);
+        ok &= run("sparse", sparse, m);
+        ok &= run("functions", functions, m);
+    }
+    if (!ok)
+    {
+        std::printf("a contraction lost the solution\n");
+        return 1;
+    }
+}
@@ -0,0 +1,136 @@
+/// @file bench_dataset.cpp
+/// @brief Load time and resident memory of the binary interval file against the text stream path
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Writes the same random intervals once as text, two end points per line read back with operator>>, and once as a binary interval file. Times loading each into memory and a full pass over the loaded intervals, and prints the growth of the resident set at every step. The binary file is mapped, so opening it reads nothing and its pages become resident only as the pass reaches them. Both files are read straight after being written, so they come from the page cache; cold disk reads favour the smaller binary file further. Every loaded interval must equal the written one and every chunk checksum must hold.
+/// @details Usage: bench_dataset [intervals] [directory]
+/// @details Build: g++ -std=c++20 -O2 -I.. bench_dataset.cpp ../interval_file.cpp ../interval_array.cpp ../interval.cpp -o bench_dataset
+#include "bench.h"
+#include "interval_file.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+/// @brief Gets the resident set size of this process
+/// @return the resident bytes, or 0 where /proc is missing
+double resident_bytes()
+{
+    std::ifstream statm("/proc/self/statm");
+    std::size_t pages = 0, resident = 0;
+    statm >> pages >> resident;
+    return double(resident) * double(sysconf(_SC_PAGESIZE));
+}
+
+/// @brief Gets the wall clock time since an earlier point
+/// @param start the earlier point
+/// @return the seconds elapsed
+double seconds_since(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// @brief Prints one result line
+/// @param path the loading path
+/// @param step what was timed
+/// @param seconds the time taken
+/// @param rss_growth the growth of the resident set over the step in bytes
+void report(char const *path, char const *step, double seconds, double rss_growth)
+{
+    std::printf("%-8s %-22s %12.3f ms %12.1f MB resident\n", path, step, seconds * 1e3, rss_growth / 1048576.0);
+}
+
+/// @brief Adds the widths of intervals to a running sum so that every end point is read
+template <class Get>
+double total_width(std::size_t n, Get get, double sum = 0.0)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        interval x = get(i);
+        sum += x.max() - x.min();
+    }
+    return sum;
+}
+
+/// @brief Writes, loads and checks both formats
+/// @param n the number of intervals
+/// @param dir the directory for the two files
+void run(std::size_t n, std::string const &dir)
+{
+    std::string text = dir + "/bench_dataset.txt", binary = dir + "/bench_dataset.ivl";
+    std::vector<double> e = bench::random_endpoints(n, -1e6, 1e6, 11);
+    {
+        std::ofstream out(text);
+        out.precision(std::numeric_limits<double>::max_digits10); // round trips exactly
+        for (std::size_t i = 0; i < n; ++i)
+            out << e[2 * i] << ' ' << e[2 * i + 1] << '\n';
+        interval_writer w(binary);
+        for (std::size_t i = 0; i < n; ++i)
+            w.append(interval(e[2 * i], e[2 * i + 1]));
+        w.close();
+    }
+    std::printf("%zu intervals, text %.1f MB, binary %.1f MB\n", n, double(std::ifstream(text, std::ios::ate).tellg()) / 1048576.0,
+                double(std::ifstream(binary, std::ios::ate).tellg()) / 1048576.0);
+
+    bool ok = true;
+    double widths[2];
+    {
+        double rss = resident_bytes();
+        auto start = std::chrono::steady_clock::now();
+        std::ifstream in(text);
+        interval_array a(n);
+        interval x;
+        for (std::size_t i = 0; i < n && in >> x; ++i)
+            a.set(i, x);
+        report("text", "operator>> load", seconds_since(start), resident_bytes() - rss);
+        start = std::chrono::steady_clock::now();
+        widths[0] = total_width(n, [&](std::size_t i) { return a[i]; });
+        report("text", "full pass", seconds_since(start), resident_bytes() - rss);
+        for (std::size_t i = 0; i < n; ++i)
+            ok = ok && a.lo()[i] == e[2 * i] && a.hi()[i] == e[2 * i + 1];
+    }
+    {
+        double rss = resident_bytes();
+        auto start = std::chrono::steady_clock::now();
+        interval_reader r(binary);
+        report("binary", "mapped open", seconds_since(start), resident_bytes() - rss);
+        start = std::chrono::steady_clock::now();
+        double sum = 0.0;
+        for (std::size_t c = 0; c < r.chunk_count(); ++c)
+        {
+            interval_view v = r.chunk(c);
+            sum = total_width(v.size(), [&](std::size_t i) { return v[i]; }, sum); // same order as the text pass
+        }
+        widths[1] = sum;
+        report("binary", "full pass over chunks", seconds_since(start), resident_bytes() - rss);
+        start = std::chrono::steady_clock::now();
+        ok = ok && r.verify();
+        report("binary", "verify checksums", seconds_since(start), resident_bytes() - rss);
+        start = std::chrono::steady_clock::now();
+        interval_array copy = r.to_array();
+        report("binary", "copy to array", seconds_since(start), resident_bytes() - rss);
+        for (std::size_t i = 0; i < n; ++i)
+            ok = ok && r[i].min() == e[2 * i] && r[i].max() == e[2 * i + 1] && copy.lo()[i] == e[2 * i];
+    }
+    std::remove(text.c_str());
+    std::remove(binary.c_str());
+    if (!ok || widths[0] != widths[1])
+    {
+        std::printf("a loaded interval differs from the written one\n");
+        std::exit(1);
+    }
+}
+
+/// @brief Runs the dataset benchmark
+/// @param argc 1 to 3
+/// @param argv the optional number of intervals, by default 2^22, and the directory for the files, by default the current one
+int main(int argc, char **argv)
+{
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t(1) << 22;
+    run(n, argc > 2 ? argv[2] : ".");
+}
@@ -0,0 +1,207 @@
+/// @file bench_dd.cpp
+/// @brief Double-double intervals against double and long double intervals: operation throughput and enclosure width
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Times +, -, *, / in scalar loops over #interval and #intervall, double and long double end points with rounding::widen, and #dd_interval, and the batch operators of interval_array against those of dd_interval_array, on n operand pairs of both signs. Prints ns per operation and the cost of each type relative to #interval.
+/// @details Then measures the width each type gives on two workloads where rounding errors accumulate: the sum of 1/k for k up to n, and the expanded form of (x - 1)^9 evaluated by Horner's rule at points near 1, where the terms cancel down to the tiny true value. #interval and #intervall round to nearest and collapse to points; the three types with rounding::widen must enclose the value computed with double-double, and #dd_interval, with the same policy, must be narrower than the double type, by a factor of about 2^-50.
+/// @details Usage: bench_dd [operations]
+/// @details Build: g++ -std=c++20 -O2 -I.. bench_dd.cpp ../dd_interval_array.cpp ../double_double.cpp ../interval_array.cpp ../interval_instrument.cpp ../interval.cpp -o bench_dd
+#include "bench.h"
+#include "dd_interval_array.h"
+
+#include <cstdlib>
+#include <vector>
+
+/// @brief Rigorous double interval, rounded outward in round to nearest like #dd_interval
+using widened = basic_interval<double, rounding::widen>;
+
+/// @brief Rigorous long double interval, rounded outward in round to nearest
+using widenedl = basic_interval<long double, rounding::widen>;
+
+/// @brief Operand pairs of both signs, away from zero so every quotient is bounded
+/// @param n the number of pairs
+/// @param x set to the left operands
+/// @param y set to the right operands
+void make_operands(std::size_t n, std::vector<interval> &x, std::vector<interval> &y)
+{
+    std::vector<double> e = bench::random_endpoints(2 * n, 0.5, 2.0, 11);
+    x.resize(n);
+    y.resize(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = i % 3 ? interval(e[4 * i], e[4 * i + 1]) : interval(-e[4 * i + 1], -e[4 * i]); // a third of them negative
+        y[i] = interval(e[4 * i + 2], e[4 * i + 3]);
+    }
+}
+
+/// @brief Times the four operators of one interval type in a scalar loop
+/// @param x the left operands, converted to I
+/// @param y the right operands, converted to I
+/// @param ns set to ns per operation of +, -, *, /
+template <class I>
+void time_scalar(std::vector<interval> const &x, std::vector<interval> const &y, double (&ns)[4])
+{
+    std::size_t n = x.size();
+    std::vector<I> a(x.begin(), x.end()), b(y.begin(), y.end()), out(n);
+    auto loop = [&](auto f)
+    {
+        return bench::time_ns_per_op(n, [&]
+                                     {
+                                         for (std::size_t i = 0; i < n; ++i)
+                                             out[i] = f(a[i], b[i]);
+                                         bench::do_not_optimize(out.data()); }, 5);
+    };
+    ns[0] = loop([](I const &p, I const &q) { return p + q; });
+    ns[1] = loop([](I const &p, I const &q) { return p - q; });
+    ns[2] = loop([](I const &p, I const &q) { return p * q; });
+    ns[3] = loop([](I const &p, I const &q) { return p / q; });
+}
+
+/// @brief Times the four batch operators of one array type
+/// @param a the left operands
+/// @param b the right operands
+/// @param ns set to ns per operation of +, -, *, /
+template <class Array>
+void time_batch(Array const &a, Array const &b, double (&ns)[4])
+{
+    std::size_t n = a.size();
+    Array out = Array::for_overwrite(n);
+    auto loop = [&](auto f)
+    {
+        return bench::time_ns_per_op(n, [&]
+                                     {
+                                         f(a, b, out);
+                                         bench::do_not_optimize(out[0]); }, 5);
+    };
+    ns[0] = loop([](Array const &p, Array const &q, Array &o) { add(p, q, o); });
+    ns[1] = loop([](Array const &p, Array const &q, Array &o) { sub(p, q, o); });
+    ns[2] = loop([](Array const &p, Array const &q, Array &o) { mul(p, q, o); });
+    ns[3] = loop([](Array const &p, Array const &q, Array &o) { div(p, q, o); });
+}
+
+/// @brief Times every type and prints the throughput table
+/// @param n the number of operand pairs
+void throughput(std::size_t n)
+{
+    std::vector<interval> x, y;
+    make_operands(n, x, y);
+    interval_array xa(n), ya(n);
+    dd_interval_array xd(n), yd(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        xa.set(i, x[i]);
+        ya.set(i, y[i]);
+        xd.set(i, dd_interval(x[i]));
+        yd.set(i, dd_interval(y[i]));
+    }
+
+    struct row
+    {
+        char const *name; ///< the type and loop
+        double ns[4];     ///< ns per operation of +, -, *, /
+    } rows[] = {{"interval", {}}, {"widened double", {}}, {"intervall", {}}, {"widened long dbl", {}}, {"dd_interval", {}}, {"interval_array", {}}, {"dd_interval_array", {}}};
+    time_scalar<interval>(x, y, rows[0].ns);
+    time_scalar<widened>(x, y, rows[1].ns);
+    time_scalar<intervall>(x, y, rows[2].ns);
+    time_scalar<widenedl>(x, y, rows[3].ns);
+    time_scalar<dd_interval>(x, y, rows[4].ns);
+    time_batch(xa, ya, rows[5].ns);
+    time_batch(xd, yd, rows[6].ns);
+
+    std::printf("%-18s %9s %9s %9s %9s   ns/op, cost vs interval for *   (%zu pairs, SIMD level %d)\n", "type", "+", "-", "*", "/", n,
+                static_cast<int>(active_simd_level()));
+    for (row const &r : rows)
+        std::printf("%-18s %9.2f %9.2f %9.2f %9.2f   %6.1fx\n", r.name, r.ns[0], r.ns[1], r.ns[2], r.ns[3], r.ns[2] / rows[0].ns[2]);
+    std::printf("\n");
+}
+
+/// @brief Sums 1/k for k from 1 to n in interval arithmetic
+/// @param n the number of terms
+/// @return the enclosure of the sum
+template <class I>
+I harmonic(std::size_t n)
+{
+    I sum(0.0), one(1.0);
+    for (std::size_t k = 1; k <= n; ++k)
+        sum += one / I(static_cast<double>(k));
+    return sum;
+}
+
+/// @brief Evaluates the expanded form of (x - 1)^9 by Horner's rule
+/// @param x the argument
+/// @return the enclosure of the polynomial
+template <class I>
+I cancelling(I const &x)
+{
+    static constexpr double coef[10] = {1, -9, 36, -84, 126, -126, 84, -36, 9, -1}; // highest degree first
+    I p(coef[0]);
+    for (int k = 1; k < 10; ++k)
+        p = p * x + coef[k];
+    return p;
+}
+
+/// @brief Prints the widths of one workload for every type and checks the rigorous ones enclose the reference
+/// @param name the workload
+/// @param reference the value computed with double-double
+/// @param f called with a default constructed interval of each type, returns its enclosure converted to #dd_interval
+/// @return false if a rigorous enclosure misses the reference or #dd_interval is not narrower than the double type
+template <class F>
+bool widths(char const *name, double_double reference, F f)
+{
+    dd_interval r[] = {f(interval()), f(widened()), f(intervall()), f(widenedl()), f(dd_interval())};
+    char const *names[] = {"interval", "widened double", "intervall", "widened long dbl", "dd_interval"};
+    std::printf("%-26s", name);
+    bool ok = true;
+    double w[5];
+    for (int t = 0; t < 5; ++t)
+    {
+        w[t] = static_cast<double>(r[t].max() - r[t].min());
+        std::printf(t == 3 ? " %16.3e" : " %14.3e", w[t]);
+        if ((t == 1 || t >= 3) && (reference < r[t].min() || reference > r[t].max())) // the fast policy is not rigorous
+        {
+            std::printf("  %s misses the reference", names[t]);
+            ok = false;
+        }
+    }
+    std::printf("  %9.1e\n", w[4] / w[1]);
+    if (!(w[4] < w[1]))
+    {
+        std::printf("dd_interval is wider than widened double\n");
+        ok = false;
+    }
+    return ok;
+}
+
+/// @brief Runs the double-double interval benchmark
+/// @param argc 1, or 2 with a size
+/// @param argv the optional number of operand pairs, by default 2^16
+int main(int argc, char **argv)
+{
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t(1) << 16;
+    throughput(n);
+
+    std::printf("%-26s %14s %14s %14s %16s %14s  %9s\n", "width of", "interval", "widened double", "intervall", "widened long dbl", "dd_interval", "dd/widened");
+    bool ok = true;
+    for (std::size_t terms : {std::size_t(1000), n})
+    {
+        double_double ref;
+        for (std::size_t k = 1; k <= terms; ++k)
+            ref += double_double(1.0) / double_double(static_cast<double>(terms + 1 - k)); // smallest first, in double-double
+        char name[64];
+        std::snprintf(name, sizeof name, "sum of 1/k, %zu terms", terms);
+        ok &= widths(name, ref, [terms](auto i) { return dd_interval(harmonic<decltype(i)>(terms)); });
+    }
+    for (double x : {1.001, 1.01, 0.95})
+    {
+        double_double d = double_double(x) - 1.0, ref = d * d * d; // (x - 1)^9 in double-double
+        ref = ref * ref * ref;
+        char name[64];
+        std::snprintf(name, sizeof name, "(x - 1)^9 at x = %g", x);
+        ok &= widths(name, ref, [x](auto i) { return dd_interval(cancelling(decltype(i)(x))); });
+    }
+    if (!ok)
+    {
+        std::printf("an enclosure is wrong\n");
+        return 1;
+    }
+}
@@ -0,0 +1,220 @@
+/// @file bench_dual.cpp
+/// @brief Gradient enclosures over batches of boxes: forward mode duals against gradients differentiated by hand
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Encloses the value and gradient of two functions of N = 2, 4, 8 and 16 variables over n random boxes: the extended Rosenbrock function, sums of sqr, and a chain of exp(x_i) sin(x_(i+1)) + x_i x_(i+1). Each runs as a loop over the gradient written out by hand with the interval operators, as code did before dual_interval.h, as a loop over basic_dual_interval with a fixed and with a bounded gradient of 16 components, and through the batch gradient() on the default pool. Prints ns per box and the speed of each against the hand written loop.
+/// @details The boxes have sides of width 1e-3 in [-2, 2]. The value and every component of each dual gradient must meet the hand written enclosure, since both enclose the same gradient.
+/// @details Usage: bench_dual [boxes]
+/// @details Build: g++ -std=c++20 -O2 -pthread -I.. bench_dual.cpp ../interval_math.cpp ../parallel.cpp ../interval_array.cpp ../interval.cpp -o bench_dual
+#include "bench.h"
+#include "dual_interval.h"
+
+#include <array>
+#include <cstdlib>
+#include <vector>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 test functions
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief The extended Rosenbrock function, sum of 100 (x_(i+1) - x_i^2)^2 + (1 - x_i)^2, for any number type
+template <class X, std::size_t N>
+X rosenbrock(std::array<X, N> const &x)
+{
+    X f = sqr(x[1] - sqr(x[0])) * 100.0 + sqr(1.0 - x[0]);
+    for (std::size_t i = 1; i + 1 < N; ++i)
+        f = f + sqr(x[i + 1] - sqr(x[i])) * 100.0 + sqr(1.0 - x[i]);
+    return f;
+}
+
+/// @brief The Rosenbrock function and its gradient differentiated by hand
+/// @param x the box
+/// @param grad set to the gradient
+/// @return the value
+template <std::size_t N>
+interval rosenbrock_by_hand(std::array<interval, N> const &x, std::array<interval, N> &grad)
+{
+    interval f(0.0);
+    grad.fill(interval(0.0));
+    for (std::size_t i = 0; i + 1 < N; ++i)
+    {
+        interval t = x[i + 1] - sqr(x[i]), u = 1.0 - x[i];
+        f += sqr(t) * 100.0 + sqr(u);
+        grad[i] += x[i] * t * -400.0 - u * 2.0;
+        grad[i + 1] += t * 200.0;
+    }
+    return f;
+}
+
+/// @brief The chain sum of exp(x_i) sin(x_(i+1)) + x_i x_(i+1), for any number type
+template <class X, std::size_t N>
+X chain(std::array<X, N> const &x)
+{
+    X f = exp(x[0]) * sin(x[1]) + x[0] * x[1];
+    for (std::size_t i = 1; i + 1 < N; ++i)
+        f = f + exp(x[i]) * sin(x[i + 1]) + x[i] * x[i + 1];
+    return f;
+}
+
+/// @brief The chain function and its gradient differentiated by hand
+/// @param x the box
+/// @param grad set to the gradient
+/// @return the value
+template <std::size_t N>
+interval chain_by_hand(std::array<interval, N> const &x, std::array<interval, N> &grad)
+{
+    interval f(0.0);
+    grad.fill(interval(0.0));
+    for (std::size_t i = 0; i + 1 < N; ++i)
+    {
+        interval e = exp(x[i]), s = sin(x[i + 1]);
+        f += e * s + x[i] * x[i + 1];
+        grad[i] += e * s + x[i + 1];
+        grad[i + 1] += e * cos(x[i + 1]) + x[i];
+    }
+    return f;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 benchmark
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Checks that two intervals meet
+bool meets(interval const &a, interval const &b) { return a.min() <= b.max() && b.min() <= a.max(); }
+
+/// @brief Prints one result line
+/// @param name what was timed
+/// @param ns the nanoseconds per box
+/// @param base the nanoseconds of the hand written loop, or 0 for that loop
+void report(char const *name, double ns, double base)
+{
+    std::printf("  %-16s %9.2f ns/box", name, ns);
+    if (base > 0.0)
+        std::printf("  %6.2fx", base / ns);
+    std::printf("\n");
+}
+
+/// @brief Times every form of one function of N variables and checks the gradients
+/// @param name the name of the function
+/// @param n the number of boxes
+/// @param generic the function for any number type
+/// @param by_hand the function with its gradient written out
+/// @return false if a dual gradient misses the hand written one
+template <std::size_t N, class Generic, class ByHand>
+bool run(char const *name, std::size_t n, Generic &&generic, ByHand &&by_hand)
+{
+    using fixed = dual_interval<N>;
+    using bounded = bounded_dual_interval<16>;
+    std::array<interval_array, N> boxes;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        std::vector<double> e = bench::random_endpoints(n, -2.0, 2.0, 50 + unsigned(i));
+        boxes[i] = interval_array::for_overwrite(n);
+        for (std::size_t k = 0; k < n; ++k)
+            boxes[i].set(k, interval(e[2 * k], e[2 * k] + 1e-3));
+    }
+    std::printf("%s, %zu variables\n", name, N);
+
+    // the reference, by hand
+    interval_array hand_value = interval_array::for_overwrite(n);
+    std::array<interval_array, N> hand_grad;
+    for (interval_array &g : hand_grad)
+        g = interval_array::for_overwrite(n);
+    double t_hand = bench::time_ns_per_op(n, [&]
+                                          {
+                                              std::array<interval, N> x, g;
+                                              for (std::size_t k = 0; k < n; ++k)
+                                              {
+                                                  for (std::size_t i = 0; i < N; ++i)
+                                                      x[i] = boxes[i][k];
+                                                  hand_value.set(k, by_hand(x, g));
+                                                  for (std::size_t i = 0; i < N; ++i)
+                                                      hand_grad[i].set(k, g[i]);
+                                              } });
+
+    bool ok = true;
+    auto check = [&](std::size_t k, interval const &value, auto &&component)
+    {
+        ok = ok && meets(value, hand_value[k]);
+        for (std::size_t i = 0; i < N; ++i)
+            ok = ok && meets(component(i), hand_grad[i][k]);
+    };
+
+    // duals one box at a time
+    double sink = 0.0;
+    double t_fixed = bench::time_ns_per_op(n, [&]
+                                           {
+                                               std::array<fixed, N> x;
+                                               for (std::size_t k = 0; k < n; ++k)
+                                               {
+                                                   for (std::size_t i = 0; i < N; ++i)
+                                                       x[i] = fixed::variable(boxes[i][k], i);
+                                                   fixed y = generic(x);
+                                                   sink += y.value().max() + y.gradient_hi()[N - 1];
+                                               } });
+    double t_bounded = bench::time_ns_per_op(n, [&]
+                                             {
+                                                 std::array<bounded, N> x;
+                                                 for (std::size_t k = 0; k < n; ++k)
+                                                 {
+                                                     for (std::size_t i = 0; i < N; ++i)
+                                                         x[i] = bounded::variable(boxes[i][k], i);
+                                                     bounded y = generic(x);
+                                                     sink += y.value().max() + y.gradient_hi()[N - 1];
+                                                 } });
+    bench::do_not_optimize(sink);
+    for (std::size_t k = 0; k < n; k += 97)
+    {
+        std::array<fixed, N> xf;
+        std::array<bounded, N> xb;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            xf[i] = fixed::variable(boxes[i][k], i);
+            xb[i] = bounded::variable(boxes[i][k], i);
+        }
+        fixed yf = generic(xf);
+        bounded yb = generic(xb);
+        check(k, yf.value(), [&](std::size_t i) { return yf.gradient(i); });
+        check(k, yb.value(), [&](std::size_t i) { return yb.gradient(i); });
+    }
+
+    // the batch on the pool
+    interval_array value;
+    std::array<interval_array, N> grad;
+    double t_batch = bench::time_ns_per_op(n, [&] { gradient([&](std::array<fixed, N> const &x) { return generic(x); }, boxes, value, grad); });
+    for (std::size_t k = 0; k < n; ++k)
+        check(k, value[k], [&](std::size_t i) { return grad[i][k]; });
+
+    report("by hand", t_hand, 0.0);
+    report("fixed dual", t_fixed, t_hand);
+    report("bounded dual", t_bounded, t_hand);
+    report("batch gradient", t_batch, t_hand);
+    return ok;
+}
+
+/// @brief Runs both functions for one number of variables
+/// @return false if a check fails
+template <std::size_t N>
+bool run_all(std::size_t n)
+{
+    bool ok = run<N>("rosenbrock", n, [](auto const &x) { return rosenbrock(x); }, [](auto const &x, auto &g) { return rosenbrock_by_hand<N>(x, g); });
+    return run<N>("exp sin chain", n, [](auto const &x) { return chain(x); }, [](auto const &x, auto &g) { return chain_by_hand<N>(x, g); }) && ok;
+}
+
+/// @brief Runs the dual benchmark
+/// @param argc 1, or 2 with a size
+/// @param argv the optional number of boxes, by default 2^16
+int main(int argc, char **argv)
+{
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t(1) << 16;
+    std::printf("%zu boxes, %zu workers\n", n, default_pool().size());
+    bool ok = run_all<2>(n);
+    ok = run_all<4>(n) && ok;
+    ok = run_all<8>(n) && ok;
+    ok = run_all<16>(n) && ok;
+    if (!ok)
+    {
+        std::printf("a dual gradient misses the gradient by hand\n");
+        return 1;
+    }
+}
@@ -0,0 +1,156 @@
+/// @file bench_expr.cpp
+/// @brief One pass expression evaluation against eager operators on long interval formulas
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Evaluates a * b + c * d - e / f over large arrays four ways: eagerly on interval_array, with one batch kernel per operator and two scratch arrays; eagerly on std::vector<interval>; and through expr::evaluate on both containers. It then repeats the eager and expression forms under rounding::switched, where the expression changes the rounding mode once per array instead of once per operator. The results are checked to be identical to the eager ones. Finally expr::fma is timed and its width compared with the eager a * b + c.
+/// @details Build: g++ -std=c++20 -O2 -frounding-math -I.. bench_expr.cpp ../interval_array.cpp ../interval.cpp -o bench_expr
+/// @details Add -mfma or -march=native to use the FMA instruction; without it std::fma is a library call and expr::fma is several times slower than a * b + c.
+
+#include "bench.h"
+#include "interval_array.h"
+#include "interval_expr.h"
+
+#include <cstdlib>
+#include <vector>
+
+/// @brief The operands of the benchmark formula
+template <class P>
+struct operands
+{
+    std::vector<basic_interval<double, P>> a, b, c, d, e, f; ///< f never contains zero
+};
+
+/// @brief Builds n random intervals per operand
+template <class P>
+operands<P> make(std::size_t n)
+{
+    operands<P> o;
+    std::vector<basic_interval<double, P>> *all[] = {&o.a, &o.b, &o.c, &o.d, &o.e, &o.f};
+    for (unsigned k = 0; k < 6; ++k)
+    {
+        std::vector<double> v = k == 5 ? bench::random_endpoints(n, 0.5, 10.0, k + 1) : bench::random_endpoints(n, -10.0, 10.0, k + 1);
+        all[k]->resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+            (*all[k])[i] = basic_interval<double, P>(v[2 * i], v[2 * i + 1]);
+    }
+    return o;
+}
+
+/// @brief Copies an array of intervals into an interval_array
+interval_array to_array(std::vector<interval> const &v)
+{
+    interval_array out(v.size());
+    for (std::size_t i = 0; i < v.size(); ++i)
+        out.set(i, v[i]);
+    return out;
+}
+
+/// @brief Stops the benchmark if two results differ in any end point
+template <class A, class B>
+void check_same(char const *name, A const &x, B const &y)
+{
+    for (std::size_t i = 0; i < x.size(); ++i)
+        if (x[i].min() != y[i].min() || x[i].max() != y[i].max())
+        {
+            std::printf("%s differs from the eager result at %zu\n", name, i);
+            std::exit(1);
+        }
+}
+
+/// @brief Times every form of the formula on n intervals per operand
+void run(std::size_t n)
+{
+    std::size_t reps = n < 100000 ? 200 : 4; // keep each timing well above the clock resolution
+    std::printf("-- n = %zu, a * b + c * d - e / f\n", n);
+
+    operands<rounding::fast> o = make<rounding::fast>(n);
+    interval_array a = to_array(o.a), b = to_array(o.b), c = to_array(o.c), d = to_array(o.d), e = to_array(o.e), f = to_array(o.f);
+    interval_array t1, t2, out_array, out_expr_array;
+    std::vector<interval> out_vector(n), out_expr_vector(n);
+
+    auto eager_array = [&]
+    {
+        mul(a, b, t1);
+        mul(c, d, t2);
+        add(t1, t2, t1);
+        div(e, f, t2);
+        sub(t1, t2, out_array);
+    };
+    auto eager_vector = [&]
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            out_vector[i] = o.a[i] * o.b[i] + o.c[i] * o.d[i] - o.e[i] / o.f[i];
+    };
+    auto expr_array = [&] { expr::evaluate(expr::lift(a) * b + expr::lift(c) * d - expr::lift(e) / f, out_expr_array); };
+    auto expr_vector = [&] { expr::evaluate(expr::lift(o.a) * o.b + expr::lift(o.c) * o.d - expr::lift(o.e) / o.f, out_expr_vector); };
+
+    eager_array();
+    eager_vector();
+    expr_array();
+    expr_vector();
+    check_same("interval_array expression", out_expr_array, out_array);
+    check_same("vector expression", out_expr_vector, out_vector);
+
+    auto timed = [&](char const *name, auto fn)
+    {
+        bench::report(name, bench::time_ns_per_op(n * reps, [&]
+                                                  {
+                                                      for (std::size_t r = 0; r < reps; ++r)
+                                                      {
+                                                          fn();
+                                                          bench::clobber();
+                                                      } }));
+    };
+    timed("eager interval_array kernels", eager_array);
+    timed("eager std::vector<interval> loop", eager_vector);
+    timed("expr over interval_array", expr_array);
+    timed("expr over std::vector<interval>", expr_vector);
+
+    // rounding::switched changes the mode around every eager operator but only once per expression
+    operands<rounding::switched> s = make<rounding::switched>(n);
+    std::vector<basic_interval<double, rounding::switched>> out_switched(n), out_expr_switched(n);
+    auto eager_switched = [&]
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            out_switched[i] = s.a[i] * s.b[i] + s.c[i] * s.d[i] - s.e[i] / s.f[i];
+    };
+    auto expr_switched = [&] { expr::evaluate(expr::lift(s.a) * s.b + expr::lift(s.c) * s.d - expr::lift(s.e) / s.f, out_expr_switched); };
+    eager_switched();
+    expr_switched();
+    check_same("switched expression", out_expr_switched, out_switched);
+    timed("eager switched loop", eager_switched);
+    timed("expr switched", expr_switched);
+
+    // fused multiply add against a * b + c, both rigorous
+    std::vector<basic_interval<double, rounding::switched>> out_fma(n);
+    auto eager_mac = [&]
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            out_switched[i] = s.a[i] * s.b[i] + s.c[i];
+    };
+    auto expr_mac = [&] { expr::evaluate(expr::lift(s.a) * s.b + s.c, out_expr_switched); };
+    auto expr_fma = [&] { expr::evaluate(expr::fma(s.a, s.b, s.c), out_fma); };
+    eager_mac();
+    expr_fma();
+    std::size_t tighter = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (out_fma[i].min() < out_switched[i].min() || out_fma[i].max() > out_switched[i].max())
+        {
+            std::printf("fma is wider than a * b + c at %zu\n", i);
+            std::exit(1);
+        }
+        tighter += out_fma[i].min() > out_switched[i].min() || out_fma[i].max() < out_switched[i].max();
+    }
+    timed("eager switched a * b + c", eager_mac);
+    timed("expr switched a * b + c", expr_mac);
+    timed("expr switched fma(a, b, c)", expr_fma);
+    std::printf("fma is tighter than a * b + c for %.1f%% of intervals\n", 100.0 * double(tighter) / double(n));
+}
+
+/// @brief Runs the expression benchmarks at an L2 sized and a main memory sized problem
+int main()
+{
+    run(1 << 12);
+    run(1 << 22);
+}
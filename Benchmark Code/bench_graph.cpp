@@ -0,0 +1,175 @@
+/// @file bench_graph.cpp
+/// @brief Incremental re-evaluation of interval graphs of 10^5 and 10^6 nodes against evaluating every node again
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Records three graphs on tapes: blocks of a 50 node formula of three inputs each, summed by a balanced tree; the same blocks each passed through sin(50 b), which a block of any real width turns to [-1, 1], so most changes stop inside their block; and a random local graph where every node is atan(a op b) of two of the 64 nodes before it, with an input every 16 nodes, so the change of one input reaches a long cone. Inputs are boxes of width 1e-3 in [0.5, 2].
+/// @details Times evaluating every node, then sets one random input at a time to a new box and prints the mean latency of an update, the nodes it evaluated and changed, and the speed against evaluating every node. After the updates a full evaluation must change no node, so the incremental results are bit for bit those of evaluating every node again.
+/// @details Usage: bench_graph [nodes]
+/// @details Build: g++ -std=c++20 -O2 -pthread -I.. bench_graph.cpp ../interval_graph.cpp ../interval_tape.cpp ../interval_math.cpp ../parallel.cpp ../interval_array.cpp ../interval.cpp -o bench_graph
+#include "bench.h"
+#include "interval_graph.h"
+#include "interval_math.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+/// @brief A formula of three variables of about 50 operations, as in bench_tape
+template <class X>
+X formula(X const &x, X const &y, X const &z)
+{
+    X xy = x * y, s = sin(z), e = exp(x * 0.5);
+    X u = xy + s;
+    X v = e - y * z;
+    X w = sqr(u) + v * x;
+    X r = sqrt(sqr(z) + 1.0);
+    X t = atan(w) * cos(y) + r;
+    X q = log(sqr(x) + sqr(y) + 1.0) - xy * s;
+    X p = pow(t - q, 3) / (sqr(e) + 2.0);
+    X a = abs(u - v) * (x + y + z) - r / (sqr(x * y) + 1.0);
+    X c = cos(p + a) + sin(p - a) * e;
+    X d = (w + q) * (t - v) / (r + 3.0);
+    return c * d + sqrt(abs(a) + 1.0) - u * v;
+}
+
+/// @brief Sums values by a balanced tree, so a change of one term passes through a logarithmic number of nodes
+tape_value sum_tree(std::vector<tape_value> v)
+{
+    while (v.size() > 1)
+    {
+        std::vector<tape_value> next;
+        for (std::size_t k = 0; k + 1 < v.size(); k += 2)
+            next.push_back(v[k] + v[k + 1]);
+        if (v.size() % 2)
+            next.push_back(v.back());
+        v = std::move(next);
+    }
+    return v[0];
+}
+
+/// @brief Records formula blocks until the tape has n nodes, summed by a tree, optionally each through sin(50 b)
+tape_value blocks(tape &t, std::size_t n, bool saturate)
+{
+    std::vector<tape_value> terms;
+    for (std::size_t i = 0; t.size() < n; i += 3)
+    {
+        tape_value b = formula(t.input(i), t.input(i + 1), t.input(i + 2));
+        terms.push_back(saturate ? sin(b * 50.0) : b);
+    }
+    return sum_tree(terms);
+}
+
+/// @brief Records a random local graph of n nodes: atan(a op b) of two of the 64 nodes before, with an input every 16 nodes
+tape_value random_local(tape &t, std::size_t n)
+{
+    std::mt19937_64 gen(7);
+    std::vector<tape_value> v{t.input(0), t.input(1)};
+    for (std::size_t inputs = 2; t.size() < n;)
+    {
+        if (v.size() % 16 == 0)
+        {
+            v.push_back(t.input(inputs++));
+            continue;
+        }
+        std::size_t w = std::min<std::size_t>(64, v.size());
+        tape_value const &a = v[v.size() - 1 - gen() % w], &b = v[v.size() - 1 - gen() % w];
+        switch (gen() % 4)
+        {
+        case 0:
+            v.push_back(atan(a + b));
+            break;
+        case 1:
+            v.push_back(atan(a - b));
+            break;
+        case 2:
+            v.push_back(atan(a * b));
+            break;
+        default:
+            v.push_back(atan(a / b));
+            break;
+        }
+    }
+    return v.back();
+}
+
+/// @brief Makes a random box of width 1e-3 in [0.5, 2]
+interval box(std::mt19937_64 &gen)
+{
+    double lo = std::uniform_real_distribution<double>(0.5, 2.0 - 1e-3)(gen);
+    return interval(lo, lo + 1e-3);
+}
+
+/// @brief Times one call and returns its seconds
+template <class F>
+double seconds(F &&f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// @brief Runs the update benchmark on one graph
+/// @param name the graph
+/// @param build records the graph with about n nodes and returns its result
+/// @param n the number of nodes
+/// @return false if the incremental results differ from evaluating every node
+bool run(char const *name, std::function<tape_value(tape &, std::size_t)> const &build, std::size_t n)
+{
+    tape t;
+    tape_value root = build(t, n);
+    interval_graph g(t);
+    std::mt19937_64 gen(11);
+    std::vector<interval> inputs(g.inputs());
+    for (interval &x : inputs)
+        x = box(gen);
+    g.evaluate(inputs);
+
+    // every node, best of 3, with one input changed each time as an update would
+    double full = 1e300;
+    for (int rep = 0; rep < 3; ++rep)
+    {
+        inputs[gen() % inputs.size()] = box(gen);
+        full = std::min(full, seconds([&] { g.evaluate(inputs); }));
+    }
+
+    std::size_t updates = 1000, evaluated = 0, changed = 0;
+    double inc = 0.0;
+    for (std::size_t k = 0; k < updates; ++k)
+    {
+        std::size_t i = gen() % inputs.size();
+        inputs[i] = box(gen);
+        graph_update u;
+        inc += seconds([&] { u = g.set(i, inputs[i]); });
+        evaluated += u.evaluated;
+        changed += u.changed;
+    }
+    interval before = g.value(root);
+    graph_update check = g.evaluate(inputs);
+    bool ok = check.changed == 0 && before.min() == g.value(root).min() && before.max() == g.value(root).max();
+    std::printf("%-10s %8zu %8zu %10.3f %10.2f %11.1f %11.1f %9.1fx\n", name, g.size(), g.inputs(), full * 1e3, inc / updates * 1e6,
+                double(evaluated) / updates, double(changed) / updates, full / (inc / updates));
+    return ok;
+}
+
+/// @brief Runs the graph benchmark
+/// @param argc 1, or 2 with a size
+/// @param argv the optional largest number of nodes, by default 10^6
+int main(int argc, char **argv)
+{
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    std::printf("%-10s %8s %8s %10s %10s %11s %11s %10s\n", "graph", "nodes", "inputs", "full ms", "update us", "evaluated", "changed", "speed");
+    bool ok = true;
+    for (std::size_t m : {n / 10, n})
+    {
+        ok &= run("blocks", [](tape &t, std::size_t k) { return blocks(t, k, false); }, m);
+        ok &= run("saturating", [](tape &t, std::size_t k) { return blocks(t, k, true); }, m);
+        ok &= run("random", random_local, m);
+    }
+    if (!ok)
+    {
+        std::printf("an incremental update differs from evaluating every node\n");
+        return 1;
+    }
+}
@@ -0,0 +1,148 @@
+/// @file bench_index.cpp
+/// @brief Interval index: build time and the latency of stabbing and overlap queries against a linear scan
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Indexes n random intervals with lower end points in [0, 1000) and widths up to 2e-4, one in ten thousand widened to 10 so that some intervals reach far past their neighbours. Times the build from the array on the default pool and on one worker, and from the same intervals written to a binary interval file and mapped. Then times single point stabs, single overlap queries of width 1e-3 and batches of each on the default pool, against a linear scan of both end point columns for the same query. Prints ns per query and the mean number of intervals found.
+/// @details Every index must give the same ids, and the ids of every query timed with the scan must be those the scan finds.
+/// @details Usage: bench_index [intervals] [queries] [directory]
+/// @details Build: g++ -std=c++20 -O2 -pthread -I.. bench_index.cpp ../interval_index.cpp ../interval_file.cpp ../parallel.cpp ../interval_array.cpp ../interval.cpp -o bench_index
+#include "bench.h"
+#include "interval_index.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+/// @brief Finds the ids of the intervals overlapping [a, b] by reading every end point
+/// @param x the intervals
+/// @param a the lower end of the query
+/// @param b the upper end of the query
+/// @param out the ids found are appended in order of id
+void scan(interval_array const &x, double a, double b, std::vector<std::uint32_t> &out)
+{
+    double const *lo = x.lo(), *hi = x.hi();
+    for (std::size_t i = 0; i < x.size(); ++i)
+        if (lo[i] <= b && hi[i] >= a)
+            out.push_back(static_cast<std::uint32_t>(i));
+}
+
+/// @brief Gets the wall clock time since an earlier point
+double seconds_since(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// @brief Checks that two lists hold the same ids in any order
+bool same_ids(std::vector<std::uint32_t> a, std::vector<std::uint32_t> b)
+{
+    std::sort(a.begin(), a.end());
+    std::sort(b.begin(), b.end());
+    return a == b;
+}
+
+/// @brief Runs the index benchmark
+/// @param argc 1 to 4
+/// @param argv the optional number of intervals, by default 10^7, of queries, by default 10^6, and the directory of the file, by default /tmp
+int main(int argc, char **argv)
+{
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    std::size_t m = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000000;
+    std::string path = std::string(argc > 3 ? argv[3] : "/tmp") + "/bench_index.ivl";
+    std::printf("%zu intervals, %zu queries, %zu workers\n", n, m, default_pool().size());
+
+    interval_array x = interval_array::for_overwrite(n);
+    std::vector<double> lo = bench::random_endpoints(n, 0.0, 1000.0, 100), width = bench::random_endpoints(n, 0.0, 2e-4, 101);
+    for (std::size_t i = 0; i < n; ++i)
+        x.set(i, interval(lo[2 * i], lo[2 * i] + (i % 10000 == 0 ? 10.0 : width[2 * i])));
+    {
+        interval_writer writer(path);
+        writer.append(x);
+        writer.close();
+    }
+
+    // builds
+    interval_index index;
+    double t_build = bench::time_ns_per_op(n, [&] { index = interval_index(x); }, 3);
+    thread_pool one(1);
+    double t_build1 = bench::time_ns_per_op(n, [&] { bench::do_not_optimize(interval_index(x, one).size()); }, 3);
+    auto start = std::chrono::steady_clock::now();
+    interval_reader file(path);
+    interval_index mapped(file);
+    double t_mapped = seconds_since(start);
+    unlink(path.c_str());
+    std::printf("  %-24s %10.3f ms\n", "build", t_build * 1e-6 * double(n));
+    std::printf("  %-24s %10.3f ms\n", "build, one worker", t_build1 * 1e-6 * double(n));
+    std::printf("  %-24s %10.3f ms\n", "open and build, file", t_mapped * 1e3);
+
+    // queries
+    std::vector<double> points(m);
+    interval_array ranges = interval_array::for_overwrite(m);
+    std::vector<double> q = bench::random_endpoints(m, 0.0, 1000.0, 102);
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        points[i] = q[2 * i];
+        ranges.set(i, interval(q[2 * i + 1], q[2 * i + 1] + 1e-3));
+    }
+
+    std::vector<std::uint32_t> out;
+    out.reserve(1 << 16);
+    std::size_t found_stab = 0, found_range = 0;
+    double t_stab = bench::time_ns_per_op(m, [&]
+                                          {
+                                              found_stab = 0;
+                                              for (std::size_t i = 0; i < m; ++i)
+                                              {
+                                                  out.clear();
+                                                  found_stab += index.stab(points[i], out);
+                                              } }, 3);
+    double t_range = bench::time_ns_per_op(m, [&]
+                                           {
+                                               found_range = 0;
+                                               for (std::size_t i = 0; i < m; ++i)
+                                               {
+                                                   out.clear();
+                                                   found_range += index.overlap(ranges[i], out);
+                                               } }, 3);
+    index_hits stabs, overlaps;
+    double t_bstab = bench::time_ns_per_op(m, [&] { stabs = index.stab(std::span<double const>(points)); }, 3);
+    double t_brange = bench::time_ns_per_op(m, [&] { overlaps = index.overlap(ranges); }, 3);
+
+    // the linear scan, for a few queries only
+    std::size_t k = std::min<std::size_t>(m, 20);
+    double t_scan = bench::time_ns_per_op(k, [&]
+                                          {
+                                              for (std::size_t i = 0; i < k; ++i)
+                                              {
+                                                  out.clear();
+                                                  scan(x, points[i], points[i], out);
+                                              } }, 3);
+
+    auto row = [&](char const *name, double ns, double found)
+    { std::printf("  %-24s %12.1f ns/query  %10.1fx  %6.2f found\n", name, ns, t_scan / ns, found); };
+    row("linear scan", t_scan, -1.0);
+    row("stab", t_stab, double(found_stab) / double(m));
+    row("overlap", t_range, double(found_range) / double(m));
+    row("stab, batch", t_bstab, double(stabs.ids.size()) / double(m));
+    row("overlap, batch", t_brange, double(overlaps.ids.size()) / double(m));
+
+    bool ok = stabs.ids.size() == found_stab && overlaps.ids.size() == found_range;
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        std::vector<std::uint32_t> expect, got(stabs[i].begin(), stabs[i].end());
+        scan(x, points[i], points[i], expect);
+        ok = same_ids(got, expect) && ok;
+        expect.clear();
+        scan(x, ranges[i].min(), ranges[i].max(), expect);
+        ok = same_ids(std::vector<std::uint32_t>(overlaps[i].begin(), overlaps[i].end()), expect) && ok;
+    }
+    index_hits again = mapped.overlap(ranges, one);
+    ok = again.ids == overlaps.ids && again.offsets == overlaps.offsets && ok;
+    if (!ok)
+    {
+        std::printf("the index differs from the linear scan\n");
+        return 1;
+    }
+}
@@ -0,0 +1,165 @@
+/// @file bench_instrument.cpp
+/// @brief Instrumented intervals: the cost of the operator hooks when disabled and when enabled, and the counts they collect
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Runs one pipeline over n random intervals x of width 1e-3 in [-1, 1]: a Horner polynomial of degree 6 in x followed by a division by x - 0.5, which contains zero for some x. The pipeline is timed written out by hand on the end points as the operators computed them before the hooks existed, with #interval, whose hooks are empty, and with #instrumented_interval on one thread and on the default pool. Prints ns per interval and the cost of each against the hand written loop; #interval must match it.
+/// @details The instrumented run on the pool is tagged with one instrument::site per stage, and the counts collected from every worker must equal the operations of the pipeline: 6n multiplications and additions, n subtractions and divisions, and one zero division for each x that contains 0.5. The results of every run must be the same bit for bit. The JSON of the sites is printed, or written to the file given as the second argument.
+/// @details Usage: bench_instrument [intervals] [json file]
+/// @details Build: g++ -std=c++20 -O2 -pthread -I.. bench_instrument.cpp ../interval_instrument.cpp ../parallel.cpp ../interval_array.cpp ../interval.cpp -o bench_instrument
+#include "bench.h"
+#include "interval_array.h"
+#include "parallel.h"
+
+#include <cstdlib>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+static_assert(std::is_empty_v<instrument::operands<rounding::fast, double>>, "the hooks of an uninstrumented interval hold nothing");
+
+/// @brief The coefficients of the polynomial, highest first
+constexpr double coefficients[7] = {0.25, -1.5, 2.0, 0.75, -3.0, 1.25, 0.5};
+
+/// @brief The Horner stage of the pipeline
+template <class I>
+I horner(I const &x)
+{
+    I y(coefficients[0]);
+    for (std::size_t k = 1; k < 7; ++k)
+        y = y * x + coefficients[k];
+    return y;
+}
+
+/// @brief The division stage of the pipeline
+template <class I>
+I divide(I const &y, I const &x) { return y / (x - 0.5); }
+
+/// @brief The pipeline written out on the end points as the operators of #interval compute it
+/// @return the result as [first, second]
+std::pair<double, double> by_hand(double xlo, double xhi)
+{
+    auto min2 = [](double a, double b) { return b < a ? b : a; };
+    auto max2 = [](double a, double b) { return b > a ? b : a; };
+    double lo = coefficients[0], hi = coefficients[0];
+    for (std::size_t k = 1; k < 7; ++k)
+    {
+        double a = lo * xlo, b = lo * xhi, c = hi * xlo, d = hi * xhi;
+        lo = min2(min2(a, b), min2(c, d)) + coefficients[k];
+        hi = max2(max2(a, b), max2(c, d)) + coefficients[k];
+    }
+    double dlo = xlo - 0.5, dhi = xhi - 0.5;
+    bool pos = dlo > 0.0, zero = !pos & !(dhi < 0.0);
+    double lo_n = pos ? lo : hi, lo_d = pos ? (lo >= 0.0 ? dhi : dlo) : (hi <= 0.0 ? dlo : dhi);
+    double hi_n = pos ? hi : lo, hi_d = pos ? (hi <= 0.0 ? dhi : dlo) : (lo >= 0.0 ? dlo : dhi);
+    double min = lo_n / lo_d, max = hi_n / hi_d;
+    return {zero ? -std::numeric_limits<double>::infinity() : min, zero ? std::numeric_limits<double>::infinity() : max};
+}
+
+/// @brief Checks that two arrays hold the same end points bit for bit
+bool same(interval_array const &a, interval_array const &b)
+{
+    return std::memcmp(a.lo(), b.lo(), a.size() * sizeof(double)) == 0 && std::memcmp(a.hi(), b.hi(), a.size() * sizeof(double)) == 0;
+}
+
+/// @brief Runs the instrumentation benchmark
+/// @param argc 1, 2 with a size, or 3 with a size and a file
+/// @param argv the optional number of intervals, by default 10^7, and the optional file for the JSON
+int main(int argc, char **argv)
+{
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    std::printf("%zu intervals, %zu workers\n", n, default_pool().size());
+    interval_array x = interval_array::for_overwrite(n);
+    std::vector<double> e = bench::random_endpoints(n, -1.0, 1.0, 90);
+    std::uint64_t zeros = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x.set(i, interval(e[2 * i], e[2 * i] + 1e-3));
+        zeros += !(x.lo()[i] - 0.5 > 0.0) && !(x.hi()[i] - 0.5 < 0.0);
+    }
+
+    interval_array hand = interval_array::for_overwrite(n), plain = interval_array::for_overwrite(n);
+    interval_array serial = interval_array::for_overwrite(n), pooled = interval_array::for_overwrite(n);
+    double t_hand = bench::time_ns_per_op(n, [&]
+                                          {
+                                              for (std::size_t i = 0; i < n; ++i)
+                                              {
+                                                  auto [lo, hi] = by_hand(x.lo()[i], x.hi()[i]);
+                                                  hand.lo()[i] = lo;
+                                                  hand.hi()[i] = hi;
+                                              } }, 5);
+    double t_plain = bench::time_ns_per_op(n, [&]
+                                           {
+                                               for (std::size_t i = 0; i < n; ++i)
+                                                   plain.set(i, divide(horner(x[i]), x[i])); }, 5);
+    double t_serial = bench::time_ns_per_op(n, [&]
+                                            {
+                                                for (std::size_t i = 0; i < n; ++i)
+                                                {
+                                                    instrumented_interval xi(x.lo()[i], x.hi()[i]);
+                                                    instrumented_interval r = divide(horner(xi), xi);
+                                                    serial.set(i, interval(r.min(), r.max()));
+                                                } }, 5);
+
+    // one timed pass on the pool with a site per stage, counted from a reset
+    auto stages = [&](std::size_t begin, std::size_t end)
+    {
+        std::vector<instrumented_interval> y(end - begin);
+        {
+            instrument::site horner_site;
+            for (std::size_t i = begin; i < end; ++i)
+                y[i - begin] = horner(instrumented_interval(x.lo()[i], x.hi()[i]));
+        }
+        instrument::site divide_site;
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            instrumented_interval r = divide(y[i - begin], instrumented_interval(x.lo()[i], x.hi()[i]));
+            pooled.set(i, interval(r.min(), r.max()));
+        }
+    };
+    double t_pooled = bench::time_ns_per_op(n, [&] { parallel_for(default_pool(), n, 4096, stages); }, 5);
+    instrument::reset();
+    parallel_for(default_pool(), n, 4096, stages);
+    std::vector<instrument::site_report> reports = instrument::collect();
+
+    std::printf("  %-24s %8.3f ns/interval\n", "by hand", t_hand);
+    std::printf("  %-24s %8.3f ns/interval  %+6.1f%%\n", "interval", t_plain, 100.0 * (t_plain / t_hand - 1.0));
+    std::printf("  %-24s %8.3f ns/interval  %+6.1f%%\n", "instrumented", t_serial, 100.0 * (t_serial / t_hand - 1.0));
+    std::printf("  %-24s %8.3f ns/interval  (pool)\n", "instrumented, sites", t_pooled);
+
+    std::array<std::uint64_t, instrument::op_count> total{};
+    std::uint64_t zero_divisions = 0;
+    for (instrument::site_report const &r : reports)
+    {
+        for (std::size_t o = 0; o < instrument::op_count; ++o)
+            total[o] += r.operations[o];
+        zero_divisions += r.zero_divisions;
+    }
+    std::printf("counted %llu add, %llu sub, %llu mul, %llu div, %llu zero divisions over %zu sites\n", (unsigned long long)total[0],
+                (unsigned long long)total[1], (unsigned long long)total[2], (unsigned long long)total[3],
+                (unsigned long long)zero_divisions, reports.size());
+
+    std::string json = instrument::to_json(reports);
+    if (argc > 2)
+    {
+        if (std::FILE *f = std::fopen(argv[2], "w"))
+        {
+            std::fputs(json.c_str(), f);
+            std::fclose(f);
+        }
+    }
+    else
+        std::fputs(json.c_str(), stdout);
+
+    bool ok = true;
+    if (total[0] != 6 * n || total[1] != n || total[2] != 6 * n || total[3] != n || zero_divisions != zeros || reports.size() != 2)
+    {
+        std::printf("the counts differ from the operations of the pipeline\n");
+        ok = false;
+    }
+    if (!same(hand, plain) || !same(plain, serial) || !same(plain, pooled))
+    {
+        std::printf("the instrumented results differ from the plain ones\n");
+        ok = false;
+    }
+    return ok ? 0 : 1;
+}
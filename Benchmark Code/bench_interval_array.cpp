@@ -0,0 +1,81 @@
+/// @file bench_interval_array.cpp
+/// @brief Throughput of the interval_array batch kernels against a loop over the interval operators
+/// @author George Downing
+/// @date 17-10-2026
+/// @details For every instruction set the processor supports, times interval_array multiplication and division and compares them with the same work done by a loop over #interval::operator* and #interval::operator/ on an array of interval objects. Sizes are chosen to sit in L2 and in main memory.
+/// @details Build: g++ -std=c++20 -O2 -I.. bench_interval_array.cpp ../interval_array.cpp ../interval.cpp -o bench_interval_array
+
+#include "bench.h"
+#include "interval_array.h"
+
+#include <string>
+#include <vector>
+
+/// @brief Times multiplication and division of n intervals through both layouts
+/// @param n the number of intervals per operand
+void run(std::size_t n)
+{
+    std::vector<double> ea = bench::random_endpoints(n, -10.0, 10.0, 1);
+    std::vector<double> eb = bench::random_endpoints(n, 0.5, 10.0, 2); // positive so division is defined
+    std::vector<interval> a(n), b(n), out(n);
+    interval_array sa(n), sb(n), sout(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        a[i] = interval(ea[2 * i], ea[2 * i + 1]);
+        b[i] = interval(eb[2 * i], eb[2 * i + 1]);
+        sa.set(i, a[i]);
+        sb.set(i, b[i]);
+    }
+    std::size_t reps = n < 100000 ? 200 : 4; // keep each timing well above the clock resolution
+    std::printf("-- n = %zu\n", n);
+
+    double base_mul = bench::time_ns_per_op(n * reps, [&]
+                                            {
+                                                for (std::size_t r = 0; r < reps; ++r)
+                                                {
+                                                    for (std::size_t i = 0; i < n; ++i)
+                                                        out[i] = a[i] * b[i];
+                                                    bench::clobber();
+                                                } });
+    double base_div = bench::time_ns_per_op(n * reps, [&]
+                                            {
+                                                for (std::size_t r = 0; r < reps; ++r)
+                                                {
+                                                    for (std::size_t i = 0; i < n; ++i)
+                                                        out[i] = a[i] / b[i];
+                                                    bench::clobber();
+                                                } });
+    bench::report("loop over interval::operator*", base_mul);
+    bench::report("loop over interval::operator/", base_div);
+
+    simd_level levels[] = {simd_level::scalar, simd_level::sse2, simd_level::avx2, simd_level::avx512};
+    for (simd_level level : levels)
+    {
+        if (level > detected_simd_level())
+            break; // the processor lacks this instruction set
+        set_simd_level(level);
+        double ns_mul = bench::time_ns_per_op(n * reps, [&]
+                                              { for (std::size_t r = 0; r < reps; ++r) mul(sa, sb, sout); });
+        double ns_div = bench::time_ns_per_op(n * reps, [&]
+                                              { for (std::size_t r = 0; r < reps; ++r) div(sa, sb, sout); });
+        double ns_bmul = bench::time_ns_per_op(n * reps, [&]
+                                               { for (std::size_t r = 0; r < reps; ++r) mul(sa, interval(-2.0, 3.0), sout); });
+        std::string name = std::string("interval_array mul ") + simd_level_name(level);
+        std::printf("%-40s %10.3f ns/op  %5.2fx\n", name.c_str(), ns_mul, base_mul / ns_mul);
+        name = std::string("interval_array div ") + simd_level_name(level);
+        std::printf("%-40s %10.3f ns/op  %5.2fx\n", name.c_str(), ns_div, base_div / ns_div);
+        name = std::string("interval_array mul broadcast ") + simd_level_name(level);
+        std::printf("%-40s %10.3f ns/op\n", name.c_str(), ns_bmul);
+    }
+    set_simd_level(detected_simd_level());
+    bench::do_not_optimize(out[n / 2]);
+    bench::do_not_optimize(sout.lo()[n / 2]);
+}
+
+/// @brief Runs the batch benchmarks at an L2 resident and a memory bound size
+int main()
+{
+    std::printf("detected instruction set: %s\n", simd_level_name(detected_simd_level()));
+    run(4096);
+    run(1 << 22);
+}
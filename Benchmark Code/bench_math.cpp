@@ -0,0 +1,103 @@
+/// @file bench_math.cpp
+/// @brief Throughput of the rigorous interval functions against a naive call of the C library per end point
+/// @author George Downing
+/// @date 17-10-2026
+/// @details For sqrt, exp, log, sin, cos, atan, pow and sqr, times the naive baseline, which calls std:: on both end points of every interval of an array of interval objects and is neither widened nor aware of extrema, against a loop over the rigorous scalar functions of interval_math.h and against the batch functions for every instruction set the processor supports. Every batch result must contain the two baseline values of its element.
+/// @details Build: g++ -std=c++20 -O2 -I.. bench_math.cpp ../interval_math.cpp ../interval_array.cpp ../interval.cpp -o bench_math
+
+#include "bench.h"
+#include "interval_math.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+/// @brief One timed function
+struct function
+{
+    char const *name;                                        ///< the printed name
+    double lo, hi;                                           ///< the range the arguments are drawn from
+    double (*naive)(double);                                 ///< the C library function applied to each end point
+    interval (*scalar)(interval const &);                    ///< the rigorous function of one interval
+    void (*batch)(interval_array const &, interval_array &); ///< the batch function
+};
+
+/// @brief Times one function through the three paths
+/// @param f the function
+/// @param n the number of intervals
+void run(function const &f, std::size_t n)
+{
+    std::vector<double> e = bench::random_endpoints(n, f.lo, f.hi, 1);
+    std::vector<interval> a(n), out(n);
+    interval_array sa(n), sout(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        a[i] = interval(e[2 * i], e[2 * i] + (e[2 * i + 1] - e[2 * i]) * 1e-3); // narrow, as in a converging computation
+        sa.set(i, a[i]);
+    }
+    std::size_t reps = 100;
+
+    double base = bench::time_ns_per_op(n * reps, [&]
+                                        {
+                                            for (std::size_t r = 0; r < reps; ++r)
+                                            {
+                                                for (std::size_t i = 0; i < n; ++i)
+                                                {
+                                                    double x = f.naive(a[i].min()), y = f.naive(a[i].max());
+                                                    out[i] = interval(std::min(x, y), std::max(x, y));
+                                                }
+                                                bench::clobber();
+                                            } });
+    std::vector<interval> expected = out; // the naive end points, which every enclosure must contain
+    double scalar = bench::time_ns_per_op(n * reps, [&]
+                                          {
+                                              for (std::size_t r = 0; r < reps; ++r)
+                                              {
+                                                  for (std::size_t i = 0; i < n; ++i)
+                                                      out[i] = f.scalar(a[i]);
+                                                  bench::clobber();
+                                              } });
+    std::printf("%-6s %-28s %10.3f ns/op\n", f.name, "naive std:: per end point", base);
+    std::printf("%-6s %-28s %10.3f ns/op  %5.2fx\n", f.name, "rigorous scalar", scalar, base / scalar);
+
+    simd_level levels[] = {simd_level::scalar, simd_level::sse2, simd_level::avx2, simd_level::avx512};
+    for (simd_level level : levels)
+    {
+        if (level > detected_simd_level())
+            break; // the processor lacks this instruction set
+        set_simd_level(level);
+        double ns = bench::time_ns_per_op(n * reps, [&]
+                                          { for (std::size_t r = 0; r < reps; ++r) f.batch(sa, sout); });
+        for (std::size_t i = 0; i < n; ++i)
+            if (!(sout.lo()[i] <= expected[i].min() && expected[i].max() <= sout.hi()[i]))
+            {
+                std::printf("%s %s: [%a, %a] misses the naive [%a, %a]\n", f.name, simd_level_name(level), sout.lo()[i], sout.hi()[i],
+                            expected[i].min(), expected[i].max());
+                std::exit(1);
+            }
+        std::string name = std::string("batch ") + simd_level_name(level);
+        std::printf("%-6s %-28s %10.3f ns/op  %5.2fx\n", f.name, name.c_str(), ns, base / ns);
+    }
+    set_simd_level(detected_simd_level());
+    bench::do_not_optimize(out[n / 2]);
+}
+
+/// @brief Runs every function on an L1 resident array
+int main()
+{
+    function functions[] = {
+        {"sqrt", 0.0, 1e6, [](double x) { return std::sqrt(x); }, [](interval const &x) { return sqrt(x); }, sqrt<double>},
+        {"exp", -20.0, 20.0, [](double x) { return std::exp(x); }, [](interval const &x) { return exp(x); }, exp<double>},
+        {"log", 1e-3, 1e6, [](double x) { return std::log(x); }, [](interval const &x) { return log(x); }, log<double>},
+        {"sin", -100.0, 100.0, [](double x) { return std::sin(x); }, [](interval const &x) { return sin(x); }, sin<double>},
+        {"cos", -100.0, 100.0, [](double x) { return std::cos(x); }, [](interval const &x) { return cos(x); }, cos<double>},
+        {"atan", -50.0, 50.0, [](double x) { return std::atan(x); }, [](interval const &x) { return atan(x); }, atan<double>},
+        {"pow", 0.1, 10.0, [](double x) { return std::pow(x, 2.5); }, [](interval const &x) { return pow(x, 2.5); },
+         [](interval_array const &a, interval_array &o) { pow(a, interval(2.5), o); }},
+        {"sqr", -10.0, 10.0, [](double x) { return x * x; }, [](interval const &x) { return sqr(x); }, sqr<double>},
+    };
+    std::printf("detected instruction set: %s\n", simd_level_name(detected_simd_level()));
+    for (function const &f : functions)
+        run(f, 4096);
+}
@@ -0,0 +1,120 @@
+/// @file bench_matrix.cpp
+/// @brief Interval matrix product: the naive operator loop against the blocked infimum supremum and midpoint radius kernels
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Multiplies random n by n interval matrices for n = 256, 512, ... up to the largest size, once with a triple loop over basic_interval::operator* and operator+, and once with matmul in each mode on the default pool. Prints the milliseconds, the interval multiply-adds per nanosecond and the speedup over the naive loop, which is only run up to its own largest size since it takes minutes beyond. Entries of both modes must contain the exact product, so each must contain the midpoint of the naive entry, which rounding to nearest moves far less than the width of these intervals, and must meet the other mode's entry. The mean radius of the midpoint radius entries over the infimum supremum ones is printed.
+/// @details Usage: bench_matrix [largest n] [largest naive n]
+/// @details Build: g++ -std=c++20 -O2 -frounding-math -pthread -I.. bench_matrix.cpp ../interval_matrix.cpp ../parallel.cpp ../interval_array.cpp ../interval.cpp -o bench_matrix
+#include "bench.h"
+#include "interval_matrix.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+/// @brief Makes an n by n matrix of reproducible narrow mixed sign intervals
+/// @param n the order
+/// @param seed the seed of the end points
+/// @return the matrix
+interval_matrix make_operand(std::size_t n, unsigned seed)
+{
+    std::vector<double> e = bench::random_endpoints(n * n, -1.0, 1.0, seed);
+    interval_matrix a = interval_matrix::for_overwrite(n, n);
+    for (std::size_t i = 0; i < n * n; ++i)
+        a.set(i / n, i % n, interval(e[2 * i], e[2 * i] + (e[2 * i + 1] - e[2 * i]) * 1e-3)); // narrow, as data with measurement error
+    return a;
+}
+
+/// @brief Multiplies two matrices with the interval operators, one entry at a time
+/// @param a the left operand
+/// @param b the right operand
+/// @return the product
+interval_matrix naive_product(interval_matrix const &a, interval_matrix const &b)
+{
+    std::size_t n = a.rows();
+    interval_matrix c(n, n);
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            interval sum;
+            for (std::size_t k = 0; k < n; ++k)
+                sum += a(i, k) * b(k, j);
+            c.set(i, j, sum);
+        }
+    return c;
+}
+
+/// @brief Times one call of a callable
+/// @return the seconds taken
+template <class Fn>
+double seconds(Fn &&fn)
+{
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// @brief Prints one result line
+/// @param name what was timed
+/// @param n the order
+/// @param s the seconds taken
+/// @param base the seconds of the naive loop, or 0 if it was not run
+void report(char const *name, std::size_t n, double s, double base)
+{
+    double madds = double(n) * double(n) * double(n);
+    std::printf("%5zu  %-8s %12.1f ms %10.3f madd/ns", n, name, s * 1e3, madds / s * 1e-9);
+    if (base > 0.0)
+        std::printf("  %8.1fx", base / s);
+    std::printf("\n");
+}
+
+/// @brief Times every method for one order and checks the enclosures
+/// @param n the order
+/// @param naive true to run the naive loop too
+/// @return false if a check fails
+bool run(std::size_t n, bool naive)
+{
+    interval_matrix a = make_operand(n, 13), b = make_operand(n, 14), reference, infsup, midrad;
+    double base = naive ? seconds([&] { reference = naive_product(a, b); }) : 0.0;
+    matmul(a, b, infsup, matmul_mode::infsup); // warm the pool and the packing buffers
+    double t_infsup = seconds([&] { matmul(a, b, infsup, matmul_mode::infsup); });
+    double t_midrad = seconds([&] { matmul(a, b, midrad, matmul_mode::midrad); });
+    if (naive)
+        report("naive", n, base, 0.0);
+    report("infsup", n, t_infsup, base);
+    report("midrad", n, t_midrad, base);
+
+    bool ok = true;
+    double ratio = 0.0;
+    for (std::size_t i = 0; i < n * n; ++i)
+    {
+        double ilo = infsup.lo()[i], ihi = infsup.hi()[i], mlo = midrad.lo()[i], mhi = midrad.hi()[i];
+        if (naive)
+        {
+            double mid = reference.lo()[i] / 2 + reference.hi()[i] / 2;
+            ok = ok && ilo <= mid && mid <= ihi && mlo <= mid && mid <= mhi;
+        }
+        ok = ok && mlo <= ihi && ilo <= mhi;
+        ratio += (mhi - mlo) / (ihi - ilo);
+    }
+    std::printf("%5zu  midrad radius / infsup radius %.3f on average\n", n, ratio / double(n * n));
+    return ok;
+}
+
+/// @brief Runs the matrix benchmark
+/// @param argc 1 to 3
+/// @param argv the optional largest order, by default 4096, and the largest order of the naive loop, by default 1024
+int main(int argc, char **argv)
+{
+    std::size_t largest = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4096;
+    std::size_t naive = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1024;
+    std::printf("%zu workers, %s kernels\n", default_pool().size(), simd_level_name(active_simd_level()));
+    bool ok = true;
+    for (std::size_t n = 256; n <= largest; n *= 2)
+        ok = run(n, n <= naive) && ok;
+    if (!ok)
+    {
+        std::printf("an enclosure check failed\n");
+        return 1;
+    }
+}
@@ -0,0 +1,62 @@
+/// @file bench_operators.cpp
+/// @brief Per-operation cost of the interval operators
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Streams two arrays of intervals through every operator family and reports the cost of a single operation. Only the public interface of interval.h is used so the same file can time older revisions of the class.
+/// @details Build: g++ -std=c++20 -O2 -I.. bench_operators.cpp ../interval.cpp -o bench_operators
+
+#include "bench.h"
+#include "interval.h"
+
+#include <vector>
+
+/// @brief Number of intervals in each operand array, small enough to stay in L2
+constexpr std::size_t N = 4096;
+
+/// @brief Times one binary operator over the operand arrays
+/// @param name the name to report
+/// @param a the left operands
+/// @param b the right operands
+/// @param out the results
+/// @param op the operation applied to each pair
+template <class Op>
+void run(char const *name, std::vector<interval> &a, std::vector<interval> &b, std::vector<interval> &out, Op op)
+{
+    double ns = bench::time_ns_per_op(N * 100, [&]
+                                      {
+                                          for (int rep = 0; rep < 100; ++rep)
+                                          {
+                                              for (std::size_t i = 0; i < N; ++i)
+                                                  out[i] = op(a[i], b[i]); // one operation per element
+                                              bench::clobber();
+                                          } });
+    bench::do_not_optimize(out[N / 2]);
+    bench::report(name, ns);
+}
+
+/// @brief Runs the operator benchmarks
+int main()
+{
+    std::vector<double> ea = bench::random_endpoints(N, -10.0, 10.0, 1);
+    std::vector<double> eb = bench::random_endpoints(N, 0.5, 10.0, 2); // positive so division is defined
+    std::vector<interval> a, b, out(N);
+    std::vector<double> s(N);
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        a.push_back(interval(ea[2 * i], ea[2 * i + 1]));
+        b.push_back(interval(eb[2 * i], eb[2 * i + 1]));
+        s[i] = eb[2 * i];
+    }
+
+    run("interval + interval", a, b, out, [](interval &x, interval &y) { return x + y; });
+    run("interval - interval", a, b, out, [](interval &x, interval &y) { return x - y; });
+    run("interval * interval", a, b, out, [](interval &x, interval &y) { return x * y; });
+    run("interval / interval", a, b, out, [](interval &x, interval &y) { return x / y; });
+    run("interval * double", a, b, out, [](interval &x, interval &y) { return x * y.min(); });
+    run("interval / double", a, b, out, [](interval &x, interval &y) { return x / y.min(); });
+    run("double * interval", a, b, out, [](interval &x, interval &y) { return y.min() * x; });
+    run("interval += interval (chained)", a, b, out, [](interval &x, interval &y)
+        { interval t(x); t += y; t += y; return t; });
+    run("interval *= interval (chained)", a, b, out, [](interval &x, interval &y)
+        { interval t(x); t *= y; t *= y; return t; });
+}
@@ -0,0 +1,102 @@
+/// @file bench_optimize.cpp
+/// @brief Throughput and thread scaling of the branch and bound minimiser
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Minimises the Six-hump camel, Rosenbrock and Griewank test functions with 1, 2, 4, ... up to the number of hardware threads and prints the enclosure of the minimum, boxes evaluated per second, and the speedup and parallel efficiency of the throughput. Every run must enclose the known minimum of its function.
+/// @details Usage: bench_optimize [max threads]
+/// @details Build: g++ -std=c++20 -O2 -pthread -I.. bench_optimize.cpp ../parallel.cpp ../interval_math.cpp ../interval_array.cpp ../interval.cpp -o bench_optimize
+
+#include "bench.h"
+#include "interval_math.h"
+#include "optimize.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <span>
+#include <thread>
+#include <vector>
+
+using box = std::span<interval const>; ///< the argument of every test function
+
+/// @brief A test function with its search box and known minimum
+struct problem
+{
+    char const *name;                   ///< the printed name
+    std::function<interval(box)> f;     ///< the function
+    std::vector<interval> domain;       ///< the search box
+    double minimum;                     ///< the known global minimum
+    minimize_options options;           ///< the stopping rules
+};
+
+/// @brief Builds the three test problems
+/// @return the problems
+std::vector<problem> problems()
+{
+    std::vector<problem> out;
+    out.push_back({"six-hump camel", [](box x)
+                   {
+                       interval x2 = sqr(x[0]), y2 = sqr(x[1]);
+                       return (4.0 - 2.1 * x2 + sqr(x2) / 3.0) * x2 + x[0] * x[1] + (-4.0 + 4.0 * y2) * y2; },
+                   {interval(-3.0, 3.0), interval(-2.0, 2.0)}, -1.0316284534898774, {1e-5, 1e-6, 20000000}});
+    out.push_back({"rosenbrock 16d", [](box x)
+                   {
+                       interval sum(0.0);
+                       for (std::size_t i = 0; i + 1 < x.size(); ++i)
+                           sum += 100.0 * sqr(x[i + 1] - sqr(x[i])) + sqr(1.0 - x[i]);
+                       return sum; },
+                   std::vector<interval>(16, interval(-5.0, 10.0)), 0.0, {1e-5, 0.0, 20000000}});
+    out.push_back({"griewank 10d", [](box x)
+                   {
+                       interval sum(0.0), product(1.0);
+                       for (std::size_t i = 0; i < x.size(); ++i)
+                       {
+                           sum += sqr(x[i]);
+                           product *= cos(x[i] / std::sqrt(double(i + 1)));
+                       }
+                       return 1.0 + sum / 4000.0 - product; },
+                   std::vector<interval>(10, interval(-600.0, 700.0)), 0.0, {1e-5, 0.0, 20000000}});
+    return out;
+}
+
+/// @brief Runs every problem for thread counts 1, 2, 4, ... up to max_threads
+/// @param max_threads the largest pool size
+void run(std::size_t max_threads)
+{
+    std::vector<std::size_t> threads;
+    for (std::size_t t = 1; t < max_threads; t *= 2)
+        threads.push_back(t);
+    threads.push_back(max_threads);
+
+    std::printf("%-16s %7s %25s %10s %10s %13s %8s %10s\n", "function", "threads", "minimum", "boxes", "seconds", "boxes/s", "speedup", "efficiency");
+    for (problem const &p : problems())
+    {
+        double base = 0.0; // boxes per second with one thread
+        for (std::size_t t : threads)
+        {
+            thread_pool pool(t, true);
+            minimize_result<interval> r = minimize(p.f, p.domain, p.options, pool);
+            if (r.minimum.min() > p.minimum || r.minimum.max() < p.minimum - 1e-9)
+            {
+                std::printf("%s: [%.12g, %.12g] misses the minimum %.12g\n", p.name, r.minimum.min(), r.minimum.max(), p.minimum);
+                std::exit(1);
+            }
+            if (t == 1)
+                base = r.boxes_per_second();
+            double speedup = r.boxes_per_second() / base;
+            std::printf("%-16s %7zu [%11.8f, %11.8f] %10zu %10.3f %13.0f %7.2fx %9.1f%%\n", p.name, t, r.minimum.min(), r.minimum.max(),
+                        r.boxes, r.seconds, r.boxes_per_second(), speedup, 100.0 * speedup / double(t));
+        }
+    }
+}
+
+/// @brief Runs the optimiser benchmark
+/// @param argc 1, or 2 with a thread limit
+/// @param argv the optional largest number of threads, by default every hardware thread
+int main(int argc, char **argv)
+{
+    std::size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    if (argc > 1)
+        max_threads = std::max(1, std::atoi(argv[1]));
+    run(max_threads);
+}
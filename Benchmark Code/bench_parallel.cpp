@@ -0,0 +1,120 @@
+/// @file bench_parallel.cpp
+/// @brief Thread scaling of parallel_transform over large interval arrays
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Times + - * / and a user lambda over interval arrays of 2^23 elements, about 128 MiB per operand, with 1, 2, 4, ... up to the number of hardware threads. Each pool pins its threads and writes its own arrays with parallel_array, so every page sits on the memory node of the thread that works on it. For each thread count the speedup over one thread and the parallel efficiency, speedup divided by threads, are printed, and every result is checked to equal the serial one bit for bit.
+/// @details Usage: bench_parallel [max threads]
+/// @details Build: g++ -std=c++20 -O2 -pthread -I.. bench_parallel.cpp ../parallel.cpp ../interval_array.cpp ../interval.cpp -o bench_parallel
+
+#include "bench.h"
+#include "parallel.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+
+/// @brief Checks that two arrays hold the same end points bit for bit
+/// @param a the first array
+/// @param b the second array
+/// @return true if both columns match
+bool same_bits(interval_array const &a, interval_array const &b)
+{
+    return a.size() == b.size() && std::memcmp(a.lo(), b.lo(), a.size() * sizeof(double)) == 0 &&
+           std::memcmp(a.hi(), b.hi(), a.size() * sizeof(double)) == 0;
+}
+
+/// @brief Writes reproducible mixed sign intervals into an array on the workers of a pool
+/// @param pool the workers, which first touch the pages they write
+/// @param n the number of intervals
+/// @param seed the value mixed into every element
+/// @return the array
+interval_array make_operand(thread_pool &pool, std::size_t n, std::uint64_t seed)
+{
+    interval_array out = parallel_array<double>(pool, n);
+    parallel_for(pool, n, chunk_size<double>(n, 1, pool.size()), [&](std::size_t begin, std::size_t end)
+                 {
+                     for (std::size_t i = begin; i < end; ++i)
+                     {
+                         std::uint64_t h = (i + 1) * 0x9e3779b97f4a7c15ull ^ seed; // a cheap hash so every thread can fill its own part
+                         h ^= h >> 29;
+                         double c = double(h % 20000) / 1000.0 - 10.0, r = double((h >> 20) % 1000) / 1000.0;
+                         out.set(i, interval(c - r, c + r + 0.001)); // never a single point, so division sees every sign class
+                     } });
+    return out;
+}
+
+/// @brief One timed operation
+struct operation
+{
+    char const *name;                                                                       ///< the printed name
+    std::function<void(thread_pool &, interval_array const &, interval_array const &, interval_array &)> run; ///< runs it over whole arrays
+};
+
+/// @brief Runs every operation for thread counts 1, 2, 4, ... up to max_threads
+/// @param n the number of intervals per operand
+/// @param max_threads the largest pool size
+void run(std::size_t n, std::size_t max_threads)
+{
+    operation ops[] = {
+        {"a + b", [](thread_pool &p, interval_array const &a, interval_array const &b, interval_array &o)
+         { parallel_transform(p, a, b, o, std::plus<>()); }},
+        {"a - b", [](thread_pool &p, interval_array const &a, interval_array const &b, interval_array &o)
+         { parallel_transform(p, a, b, o, std::minus<>()); }},
+        {"a * b", [](thread_pool &p, interval_array const &a, interval_array const &b, interval_array &o)
+         { parallel_transform(p, a, b, o, std::multiplies<>()); }},
+        {"a / b", [](thread_pool &p, interval_array const &a, interval_array const &b, interval_array &o)
+         { parallel_transform(p, a, b, o, std::divides<>()); }},
+        {"lambda a * b + a", [](thread_pool &p, interval_array const &a, interval_array const &b, interval_array &o)
+         { parallel_transform(p, a, b, o, [](interval const &x, interval const &y) { return x * y + x; }); }},
+    };
+    constexpr std::size_t count = sizeof(ops) / sizeof(ops[0]);
+
+    std::vector<std::size_t> threads;
+    for (std::size_t t = 1; t < max_threads; t *= 2)
+        threads.push_back(t);
+    threads.push_back(max_threads);
+
+    interval_array expected[count]; // serial results, each thread count must match them
+    double base[count] = {};        // ns/op with one thread
+    std::printf("-- n = %zu, %.0f MiB per operand\n", n, double(n) * 2 * sizeof(double) / (1 << 20));
+    std::printf("%-18s %8s %12s %9s %11s %8s\n", "operation", "threads", "ns/op", "speedup", "efficiency", "steals");
+    for (std::size_t t : threads)
+    {
+        thread_pool pool(t, true);
+        interval_array a = make_operand(pool, n, 1), b = make_operand(pool, n, 2), out = parallel_array<double>(pool, n);
+        for (std::size_t k = 0; k < count; ++k)
+        {
+            std::size_t steals = pool.steals();
+            double ns = bench::time_ns_per_op(n, [&]
+                                              { ops[k].run(pool, a, b, out); },
+                                              5);
+            steals = pool.steals() - steals;
+            if (t == 1)
+            {
+                base[k] = ns;
+                expected[k] = out;
+            }
+            else if (!same_bits(out, expected[k]))
+            {
+                std::printf("%s with %zu threads differs from the serial result\n", ops[k].name, t);
+                std::exit(1);
+            }
+            double speedup = base[k] / ns;
+            std::printf("%-18s %8zu %12.3f %8.2fx %10.1f%% %8zu\n", ops[k].name, t, ns, speedup, 100.0 * speedup / double(t), steals);
+        }
+    }
+}
+
+/// @brief Runs the scaling benchmark
+/// @param argc 1, or 2 with a thread limit
+/// @param argv the optional largest number of threads, by default every hardware thread
+int main(int argc, char **argv)
+{
+    std::size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    if (argc > 1)
+        max_threads = std::max(1, std::atoi(argv[1]));
+    std::printf("instruction set %s, L2 %zu KiB, up to %zu threads\n", simd_level_name(active_simd_level()), l2_cache_bytes() >> 10, max_threads);
+    run(std::size_t(1) << 23, max_threads);
+}
@@ -0,0 +1,131 @@
+/// @file bench_precision.cpp
+/// @brief Throughput and memory footprint of float, double and long double intervals
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Times + and * for #intervalf, #interval and #intervall over arrays of interval objects, then for #interval_arrayf and #interval_array with every instruction set the processor supports. Sizes are chosen to sit in L2 and in main memory, where the halved footprint of float end points matters most. A float result is checked to enclose the double one under rounding::widen, which also shows the extra width a float end point costs.
+/// @details Build: g++ -std=c++20 -O2 -I.. bench_precision.cpp ../interval_array.cpp ../interval.cpp -o bench_precision
+
+#include "bench.h"
+#include "interval_array.h"
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+/// @brief Times + and * over n interval objects with end points of type T
+/// @param name the printed name of the interval type
+/// @param e the end points of the first operand, as from bench::random_endpoints
+/// @param f the end points of the second operand
+/// @param reps the number of passes over the arrays per timing
+template <class T>
+void time_objects(char const *name, std::vector<double> const &e, std::vector<double> const &f, std::size_t reps)
+{
+    std::size_t n = e.size() / 2;
+    std::vector<basic_interval<T>> a(n), b(n), out(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        a[i] = basic_interval<T>(basic_interval<double>(e[2 * i], e[2 * i + 1])); // rounded outward
+        b[i] = basic_interval<T>(basic_interval<double>(f[2 * i], f[2 * i + 1]));
+    }
+
+    double ns_add = bench::time_ns_per_op(n * reps, [&]
+                                          {
+                                              for (std::size_t r = 0; r < reps; ++r)
+                                              {
+                                                  for (std::size_t i = 0; i < n; ++i)
+                                                      out[i] = a[i] + b[i];
+                                                  bench::clobber();
+                                              } });
+    double ns_mul = bench::time_ns_per_op(n * reps, [&]
+                                          {
+                                              for (std::size_t r = 0; r < reps; ++r)
+                                              {
+                                                  for (std::size_t i = 0; i < n; ++i)
+                                                      out[i] = a[i] * b[i];
+                                                  bench::clobber();
+                                              } });
+    std::printf("%-40s %10.3f ns/op  mul %7.3f ns/op  %3zu bytes  %8.1f MiB\n", name, ns_add, ns_mul,
+                sizeof(basic_interval<T>), 3.0 * double(n * sizeof(basic_interval<T>)) / (1 << 20));
+    bench::do_not_optimize(out[n / 2]);
+}
+
+/// @brief Times + and * over an array of n intervals with end points of type T for every instruction set
+/// @param name the printed name of the array type
+/// @param e the end points of the first operand
+/// @param f the end points of the second operand
+/// @param reps the number of passes over the arrays per timing
+template <class T>
+void time_arrays(char const *name, std::vector<double> const &e, std::vector<double> const &f, std::size_t reps)
+{
+    std::size_t n = e.size() / 2;
+    basic_interval_array<T> a(n), b(n), out(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        a.set(i, basic_interval<T>(basic_interval<double>(e[2 * i], e[2 * i + 1])));
+        b.set(i, basic_interval<T>(basic_interval<double>(f[2 * i], f[2 * i + 1])));
+    }
+
+    simd_level levels[] = {simd_level::scalar, simd_level::sse2, simd_level::avx2, simd_level::avx512};
+    for (simd_level level : levels)
+    {
+        if (level > detected_simd_level())
+            break; // the processor lacks this instruction set
+        set_simd_level(level);
+        double ns_add = bench::time_ns_per_op(n * reps, [&]
+                                              { for (std::size_t r = 0; r < reps; ++r) add(a, b, out); });
+        double ns_mul = bench::time_ns_per_op(n * reps, [&]
+                                              { for (std::size_t r = 0; r < reps; ++r) mul(a, b, out); });
+        std::string label = std::string(name) + " " + simd_level_name(level);
+        std::printf("%-40s %10.3f ns/op  mul %7.3f ns/op\n", label.c_str(), ns_add, ns_mul);
+    }
+    set_simd_level(detected_simd_level());
+    bench::do_not_optimize(out.lo()[n / 2]);
+}
+
+/// @brief Checks that float results under rounding::widen enclose the double ones and reports the average width ratio
+/// @param e the end points of the first operand
+/// @param f the end points of the second operand
+void check_float_enclosure(std::vector<double> const &e, std::vector<double> const &f)
+{
+    using F = basic_interval<float, rounding::widen>;
+    using D = basic_interval<double, rounding::widen>;
+    std::size_t n = e.size() / 2;
+    double ratio = 0.0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        D x(e[2 * i], e[2 * i + 1]), y(f[2 * i], f[2 * i + 1]);
+        F fx(x), fy(y); // explicit, the conversion rounds outward
+        D exact = x * y;
+        F approx = fx * fy;
+        if (approx.min() > exact.min() || approx.max() < exact.max())
+        {
+            std::printf("float product does not enclose the double one at %zu\n", i);
+            std::exit(1);
+        }
+        ratio += (double(approx.max()) - double(approx.min())) / (exact.max() - exact.min());
+    }
+    std::printf("float products enclose the double ones, %.7f times as wide on average\n", ratio / double(n));
+}
+
+/// @brief Times every end point type on n intervals per operand
+void run(std::size_t n)
+{
+    std::vector<double> e = bench::random_endpoints(n, -10.0, 10.0, 1), f = bench::random_endpoints(n, -10.0, 10.0, 2);
+    std::size_t reps = n < 100000 ? 200 : 4; // keep each timing well above the clock resolution
+    std::printf("-- n = %zu, add and mul\n", n);
+
+    time_objects<float>("intervalf", e, f, reps);
+    time_objects<double>("interval", e, f, reps);
+    time_objects<long double>("intervall", e, f, reps);
+    time_arrays<float>("interval_arrayf", e, f, reps);
+    time_arrays<double>("interval_array", e, f, reps);
+    check_float_enclosure(e, f);
+}
+
+/// @brief Runs the precision benchmarks at an L2 sized and a main memory sized problem
+int main()
+{
+    std::printf("detected instruction set: %s\n", simd_level_name(detected_simd_level()));
+    run(1 << 12);
+    run(1 << 22);
+}
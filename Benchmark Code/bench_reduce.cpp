@@ -0,0 +1,145 @@
+/// @file bench_reduce.cpp
+/// @brief Reproducible parallel reductions against serial operator loops: throughput, width and bit reproducibility
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Reduces n random intervals, x in [-1, 1] widened upward by 1e-15, with sum and dot in both sum modes and with hull, intersect, min and max. The serial baselines are loops of basic_interval under rounding::scoped inside one rounding_scope: s += a[i], s += a[i] * b[i] and the end point comparisons. Prints ns per interval and, for the sums, the width of each result; the compensated sums are usually the narrowest.
+/// @details Each reduction is then run again on pools of 1, 2, 3 and 4 workers and with every instruction set the processor supports, and must give the same bits every time. Every sum must also meet the serial sum, since both enclose the same exact sum.
+/// @details Usage: bench_reduce [intervals]
+/// @details Build: g++ -std=c++20 -O2 -frounding-math -pthread -I.. bench_reduce.cpp ../interval_reduce.cpp ../parallel.cpp ../interval_array.cpp ../interval.cpp -o bench_reduce
+#include "bench.h"
+#include "interval_reduce.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+/// @brief Interval arithmetic rounded outward while a rounding_scope is active, for the serial baselines
+using up = basic_interval<double, rounding::scoped>;
+
+/// @brief Checks that two intervals have the same end points bit for bit
+bool same(interval const &a, interval const &b) { return std::memcmp(&a, &b, sizeof(interval)) == 0; }
+
+/// @brief Prints one result line
+/// @param name what was timed
+/// @param ns the nanoseconds per interval
+/// @param base the nanoseconds of the serial loop, or 0 for the loop
+/// @param width the width of the result, or a negative number to leave it out
+void report(char const *name, double ns, double base, double width)
+{
+    std::printf("  %-22s %8.3f ns/interval", name, ns);
+    if (base > 0.0)
+        std::printf("  %7.2fx", base / ns);
+    else
+        std::printf("  %8s", "");
+    if (width >= 0.0)
+        std::printf("  width %.3e", width);
+    std::printf("\n");
+}
+
+/// @brief Runs a reduction on pools of several sizes and with every supported instruction set
+/// @param reduce the reduction, taking a pool
+/// @return false if any run differs from the first
+bool reproducible(char const *name, std::function<interval(thread_pool &)> const &reduce)
+{
+    interval first = reduce(default_pool());
+    bool ok = true;
+    for (std::size_t workers : {1, 2, 3, 4})
+    {
+        thread_pool pool(workers);
+        ok = same(reduce(pool), first) && ok;
+    }
+    simd_level saved = active_simd_level();
+    for (simd_level level : {simd_level::scalar, simd_level::sse2, simd_level::avx2, simd_level::avx512})
+        if (level <= detected_simd_level())
+        {
+            set_simd_level(level);
+            ok = same(reduce(default_pool()), first) && ok;
+        }
+    set_simd_level(saved);
+    if (!ok)
+        std::printf("  %s is not reproducible\n", name);
+    return ok;
+}
+
+/// @brief Runs the reduction benchmark
+/// @param argc 1, or 2 with a size
+/// @param argv the optional number of intervals, by default 10^7
+int main(int argc, char **argv)
+{
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    std::printf("%zu intervals, %zu workers, %s\n", n, default_pool().size(), simd_level_name(active_simd_level()));
+    interval_array a = interval_array::for_overwrite(n), b = interval_array::for_overwrite(n);
+    std::vector<double> ea = bench::random_endpoints(n, -1.0, 1.0, 81), eb = bench::random_endpoints(n, -1.0, 1.0, 82);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        a.set(i, interval(ea[2 * i], ea[2 * i] + 1e-15));
+        b.set(i, interval(eb[2 * i], eb[2 * i] + 1e-15));
+    }
+
+    // serial baselines
+    interval serial_sum, serial_dot, serial_hull;
+    double t_sum = bench::time_ns_per_op(n, [&]
+                                         {
+                                             rounding_scope upward;
+                                             up s(0.0);
+                                             for (std::size_t i = 0; i < n; ++i)
+                                                 s += up(a.lo()[i], a.hi()[i]);
+                                             serial_sum = interval(s.min(), s.max()); }, 3);
+    double t_dot = bench::time_ns_per_op(n, [&]
+                                         {
+                                             rounding_scope upward;
+                                             up s(0.0);
+                                             for (std::size_t i = 0; i < n; ++i)
+                                                 s += up(a.lo()[i], a.hi()[i]) * up(b.lo()[i], b.hi()[i]);
+                                             serial_dot = interval(s.min(), s.max()); }, 3);
+    double t_hull = bench::time_ns_per_op(n, [&]
+                                          {
+                                              double lo = a.lo()[0], hi = a.hi()[0];
+                                              for (std::size_t i = 1; i < n; ++i)
+                                              {
+                                                  lo = a.lo()[i] < lo ? a.lo()[i] : lo;
+                                                  hi = a.hi()[i] > hi ? a.hi()[i] : hi;
+                                              }
+                                              serial_hull = interval(lo, hi); }, 3);
+
+    // the reductions
+    interval r_sum, r_sum_c, r_dot, r_dot_c, r_hull, r_min, r_max;
+    std::optional<interval> r_meet;
+    double t_psum = bench::time_ns_per_op(n, [&] { r_sum = sum(a); }, 3);
+    double t_psum_c = bench::time_ns_per_op(n, [&] { r_sum_c = sum(a, sum_mode::compensated); }, 3);
+    double t_pdot = bench::time_ns_per_op(n, [&] { r_dot = dot(a, b); }, 3);
+    double t_pdot_c = bench::time_ns_per_op(n, [&] { r_dot_c = dot(a, b, sum_mode::compensated); }, 3);
+    double t_phull = bench::time_ns_per_op(n, [&] { r_hull = hull(a); }, 3);
+    double t_pmeet = bench::time_ns_per_op(n, [&] { r_meet = intersect(a); }, 3);
+    double t_pmin = bench::time_ns_per_op(n, [&] { r_min = min(a); }, 3);
+    double t_pmax = bench::time_ns_per_op(n, [&] { r_max = max(a); }, 3);
+
+    auto width = [](interval const &x) { return x.max() - x.min(); };
+    report("serial sum", t_sum, 0.0, width(serial_sum));
+    report("sum outward", t_psum, t_sum, width(r_sum));
+    report("sum compensated", t_psum_c, t_sum, width(r_sum_c));
+    report("serial dot", t_dot, 0.0, width(serial_dot));
+    report("dot outward", t_pdot, t_dot, width(r_dot));
+    report("dot compensated", t_pdot_c, t_dot, width(r_dot_c));
+    report("serial hull", t_hull, 0.0, -1.0);
+    report("hull", t_phull, t_hull, -1.0);
+    report("intersect", t_pmeet, t_hull, -1.0);
+    report("min", t_pmin, t_hull, -1.0);
+    report("max", t_pmax, t_hull, -1.0);
+    std::printf("sum [%.17g, %.17g]\ndot [%.17g, %.17g]\n", r_sum_c.min(), r_sum_c.max(), r_dot_c.min(), r_dot_c.max());
+
+    auto meets = [](interval const &x, interval const &y) { return x.min() <= y.max() && y.min() <= x.max(); };
+    bool ok = meets(r_sum, serial_sum) && meets(r_sum_c, serial_sum) && meets(r_dot, serial_dot) && meets(r_dot_c, serial_dot) &&
+              same(r_hull, serial_hull);
+    if (!ok)
+        std::printf("a reduction misses its serial baseline\n");
+    ok = reproducible("sum outward", [&](thread_pool &p) { return sum(a, sum_mode::outward, p); }) && ok;
+    ok = reproducible("sum compensated", [&](thread_pool &p) { return sum(a, sum_mode::compensated, p); }) && ok;
+    ok = reproducible("dot outward", [&](thread_pool &p) { return dot(a, b, sum_mode::outward, p); }) && ok;
+    ok = reproducible("dot compensated", [&](thread_pool &p) { return dot(a, b, sum_mode::compensated, p); }) && ok;
+    ok = reproducible("hull", [&](thread_pool &p) { return hull(a, p); }) && ok;
+    if (!ok)
+        return 1;
+    std::printf("every reduction is the same bit for bit on 1 to 4 workers and every instruction set\n");
+}
@@ -0,0 +1,100 @@
+/// @file bench_rounding.cpp
+/// @brief Cost of the rounding policies in rounding.h
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Times + - * / for each rounding policy on the same random intervals: rounding::fast as the baseline, rounding::widen, rounding::switched which changes the FPU mode around every operation, and rounding::scoped with one rounding_scope around the whole batch. Before timing, each rigorous result is checked to enclose the round to nearest one.
+/// @details Build: g++ -std=c++20 -O2 -frounding-math -I.. bench_rounding.cpp ../interval.cpp -o bench_rounding
+
+#include "bench.h"
+#include "interval.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/// @brief Number of intervals in each operand array
+constexpr std::size_t N = 1 << 14;
+
+/// @brief Builds N intervals of policy P from random end points in [lo, hi]
+template <class P>
+std::vector<basic_interval<double, P>> make(double lo, double hi, unsigned seed)
+{
+    std::vector<double> e = bench::random_endpoints(N, lo, hi, seed);
+    std::vector<basic_interval<double, P>> out(N);
+    for (std::size_t i = 0; i < N; ++i)
+        out[i] = basic_interval<double, P>(e[2 * i], e[2 * i + 1]);
+    return out;
+}
+
+/// @brief Applies one operation to every pair of operands
+template <class P, class Op>
+void apply(std::vector<basic_interval<double, P>> const &a, std::vector<basic_interval<double, P>> const &b, std::vector<basic_interval<double, P>> &out, Op op)
+{
+    if constexpr (std::is_same_v<P, rounding::scoped>)
+    {
+        rounding_scope scope; // one mode change for the whole batch
+        for (std::size_t i = 0; i < N; ++i)
+            out[i] = op(a[i], b[i]);
+    }
+    else
+    {
+        for (std::size_t i = 0; i < N; ++i)
+            out[i] = op(a[i], b[i]);
+    }
+}
+
+/// @brief Times one operation under policy P and checks that its results enclose the round to nearest ones
+template <class P, class Op>
+double time(std::vector<interval> const &a, std::vector<interval> const &b, Op op)
+{
+    std::vector<basic_interval<double, P>> pa(N), pb(N), out(N);
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        pa[i] = basic_interval<double, P>(a[i].min(), a[i].max());
+        pb[i] = basic_interval<double, P>(b[i].min(), b[i].max());
+    }
+
+    apply(pa, pb, out, op);
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        interval nearest = op(a[i], b[i]);
+        if (out[i].min() > nearest.min() || out[i].max() < nearest.max())
+        {
+            std::printf("enclosure check failed at %zu\n", i);
+            std::exit(1);
+        }
+    }
+
+    double ns = bench::time_ns_per_op(N * 50, [&]
+                                      {
+                                          for (int rep = 0; rep < 50; ++rep)
+                                          {
+                                              apply(pa, pb, out, op);
+                                              bench::clobber();
+                                          } });
+    bench::do_not_optimize(out[N / 2]);
+    return ns;
+}
+
+/// @brief Runs one operation under every policy
+template <class Op>
+void run(char const *name, std::vector<interval> const &a, std::vector<interval> const &b, Op op)
+{
+    std::printf("%-12s fast %7.3f  widen %7.3f  switched %7.3f  scoped %7.3f  ns/op\n", name,
+                time<rounding::fast>(a, b, op),
+                time<rounding::widen>(a, b, op),
+                time<rounding::switched>(a, b, op),
+                time<rounding::scoped>(a, b, op));
+}
+
+/// @brief Runs the rounding policy benchmarks
+int main()
+{
+    std::vector<interval> a = make<rounding::fast>(-10.0, 10.0, 1), b = make<rounding::fast>(-10.0, 10.0, 2);
+    std::vector<interval> d = make<rounding::fast>(0.5, 10.0, 3); // divisors never contain zero
+
+    run("add", a, b, [](auto const &x, auto const &y) { return x + y; });
+    run("sub", a, b, [](auto const &x, auto const &y) { return x - y; });
+    run("mul", a, b, [](auto const &x, auto const &y) { return x * y; });
+    run("div", a, d, [](auto const &x, auto const &y) { return x / y; });
+}
@@ -0,0 +1,128 @@
+/// @file bench_sign_classes.cpp
+/// @brief Branch free multiplication and sign classified division against the original kernels
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Times #interval::operator* and #interval::operator/ against the original kernels, which form all four products or quotients and reduce them with find_min and find_max. Inputs are drawn so that every operand is positive, so that signs are random, and so that every operand contains zero, to expose the cost of mispredicted branches.
+/// @details Build: g++ -std=c++20 -O2 -I.. bench_sign_classes.cpp ../interval.cpp -o bench_sign_classes
+
+#include "bench.h"
+#include "interval.h"
+
+#include <vector>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 reference kernels
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Finds the minimum of four values as the original class did
+double find_min(double a, double b, double c, double d)
+{
+    double min = a;
+    if (b < min)
+        min = b;
+    if (c < min)
+        min = c;
+    if (d < min)
+        min = d;
+    return min;
+}
+
+/// @brief Finds the maximum of four values as the original class did
+double find_max(double a, double b, double c, double d)
+{
+    double max = a;
+    if (b > max)
+        max = b;
+    if (c > max)
+        max = c;
+    if (d > max)
+        max = d;
+    return max;
+}
+
+/// @brief The original interval multiplication
+interval reference_mul(interval const &x, interval const &y)
+{
+    double a = x.min() * y.min(), b = x.min() * y.max(), c = x.max() * y.min(), d = x.max() * y.max();
+    return interval(find_min(a, b, c, d), find_max(a, b, c, d));
+}
+
+/// @brief The original interval division
+interval reference_div(interval const &x, interval const &y)
+{
+    double a = x.min() / y.min(), b = x.min() / y.max(), c = x.max() / y.min(), d = x.max() / y.max();
+    return interval(find_min(a, b, c, d), find_max(a, b, c, d));
+}
+
+/// @brief The original interval by double multiplication, which formed each product twice
+interval reference_mul_double(interval const &x, double y)
+{
+    double a = x.min() * y, b = x.max() * y, c = x.min() * y, d = x.max() * y;
+    return interval(find_min(a, b, c, d), find_max(a, b, c, d));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 benchmark
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Number of intervals in each operand array
+constexpr std::size_t N = 1 << 14;
+
+/// @brief Builds N intervals from random end points in [lo, hi], optionally forcing each to contain zero
+std::vector<interval> make(double lo, double hi, bool straddle, unsigned seed)
+{
+    std::vector<double> e = bench::random_endpoints(N, lo, hi, seed);
+    std::vector<interval> out(N);
+    for (std::size_t i = 0; i < N; ++i)
+        out[i] = straddle ? interval(-e[2 * i + 1], e[2 * i]) : interval(e[2 * i], e[2 * i + 1]);
+    return out;
+}
+
+/// @brief Times one binary operation over a pair of operand arrays
+template <class Op>
+double time(std::vector<interval> const &a, std::vector<interval> const &b, Op op)
+{
+    std::vector<interval> out(N);
+    double ns = bench::time_ns_per_op(N * 50, [&]
+                                      {
+                                          for (int rep = 0; rep < 50; ++rep)
+                                          {
+                                              for (std::size_t i = 0; i < N; ++i)
+                                                  out[i] = op(a[i], b[i]);
+                                              bench::clobber();
+                                          } });
+    bench::do_not_optimize(out[N / 2]);
+    return ns;
+}
+
+/// @brief Runs every kernel on one input distribution
+void run(char const *name, std::vector<interval> const &a, std::vector<interval> const &b, std::vector<interval> const &d)
+{
+    std::printf("-- %s\n", name);
+    std::printf("%-32s %8.3f ns/op  (reference %8.3f)\n", "interval * interval",
+                time(a, b, [](interval const &x, interval const &y) { return x * y; }),
+                time(a, b, reference_mul));
+    std::printf("%-32s %8.3f ns/op  (reference %8.3f)\n", "interval / interval",
+                time(a, d, [](interval const &x, interval const &y) { return x / y; }),
+                time(a, d, reference_div));
+    std::printf("%-32s %8.3f ns/op  (reference %8.3f)\n", "interval * double",
+                time(a, b, [](interval const &x, interval const &y) { return x * y.min(); }),
+                time(a, b, [](interval const &x, interval const &y) { return reference_mul_double(x, y.min()); }));
+}
+
+/// @brief Runs the sign class benchmarks
+int main()
+{
+    std::vector<interval> pos_a = make(0.5, 10.0, false, 1), pos_b = make(0.5, 10.0, false, 2);
+    std::vector<interval> mix_a = make(-10.0, 10.0, false, 3), mix_b = make(-10.0, 10.0, false, 4);
+    std::vector<interval> mm_a = make(0.5, 10.0, true, 5), mm_b = make(0.5, 10.0, true, 6);
+
+    // divisors never contain zero, so both kernels take the same path; the sign of each divisor is random
+    std::vector<interval> div_mix = make(0.5, 10.0, false, 7);
+    for (std::size_t i = 0; i < N; i += 2)
+        div_mix[i] = -1.0 * div_mix[i];
+
+    run("all positive", pos_a, pos_b, pos_b);
+    run("random signs", mix_a, mix_b, div_mix);
+    run("all contain zero", mm_a, mm_b, div_mix);
+}
@@ -0,0 +1,165 @@
+/// @file bench_solve.cpp
+/// @brief Verified interval linear solver: dense and sparse systems from 100 to 10000 unknowns
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Solves random interval systems A x = b with solve, once refining with Krawczyk steps and once with interval Gauss-Seidel sweeps, on the default pool. The dense systems have general random midpoints in [-1, 1], not diagonally dominant, with relative radius 1e-9, and run from 100 unknowns up to the largest dense order, 2000 by default, since the dense path holds a few n by n matrices and a dense system of 10000 unknowns needs gigabytes. The sparse systems have eight random entries per row off a diagonal that dominates them, with relative radius 1e-6, and run from 100 up to 10000 unknowns.
+/// @details Prints for each system whether it was verified, the inflated Krawczyk iterations and the refinements taken, the milliseconds spent preconditioning and in all, and the mean relative width of the components of x. b encloses mid(A) x* for a known x*, so x* must lie in every enclosure.
+/// @details Usage: bench_solve [largest dense n] [largest sparse n]
+/// @details Build: g++ -std=c++20 -O2 -frounding-math -pthread -I.. bench_solve.cpp ../interval_solve.cpp ../interval_matrix.cpp ../parallel.cpp ../interval_array.cpp ../interval.cpp -o bench_solve
+#include "bench.h"
+#include "interval_solve.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+/// @brief A system with a known point inside its solution set
+struct linear_system
+{
+    std::vector<double> exact; ///< x*, whose product with mid(A) lies in b
+    interval_array b;          ///< the right hand sides
+};
+
+/// @brief Makes b as mid(A) x* widened by a relative radius that covers the rounding of the product
+/// @param sums the products mid(A) x* rounded to nearest
+/// @param scale a bound on the magnitude of the terms of each product, times n
+/// @param rel the relative radius of b
+/// @param s set to the right hand sides
+void make_rhs(std::vector<double> const &sums, std::vector<double> const &scale, double rel, linear_system &s)
+{
+    s.b = interval_array::for_overwrite(sums.size());
+    for (std::size_t i = 0; i < sums.size(); ++i)
+    {
+        double w = std::fabs(sums[i]) * rel + scale[i] * 1e-15;
+        s.b.set(i, interval(sums[i] - w, sums[i] + w));
+    }
+}
+
+/// @brief Makes a dense system with general random midpoints
+/// @param n the number of unknowns
+/// @param a set to the matrix
+/// @return the right hand sides and x*
+linear_system make_dense(std::size_t n, interval_matrix &a)
+{
+    std::vector<double> e = bench::random_endpoints(n * n, -1.0, 1.0, 21), x = bench::random_endpoints(n, -1.0, 1.0, 22);
+    a = interval_matrix::for_overwrite(n, n);
+    linear_system s;
+    s.exact.resize(n);
+    for (std::size_t j = 0; j < n; ++j)
+        s.exact[j] = x[2 * j];
+    std::vector<double> sums(n), scale(n);
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            double m = e[2 * (i * n + j)];
+            a.set(i, j, interval(m - std::fabs(m) * 1e-9, m + std::fabs(m) * 1e-9));
+            sums[i] += m * s.exact[j];
+            scale[i] += double(n) * std::fabs(m * s.exact[j]);
+        }
+    make_rhs(sums, scale, 1e-9, s);
+    return s;
+}
+
+/// @brief Makes a sparse diagonally dominant system with eight random entries per row off the diagonal
+/// @param n the number of unknowns
+/// @return the matrix, with the right hand sides and x* in s
+basic_sparse_interval_matrix<double> make_sparse(std::size_t n, linear_system &s)
+{
+    constexpr std::size_t per_row = 8;
+    std::vector<double> e = bench::random_endpoints(n * per_row, -1.0, 1.0, 31), x = bench::random_endpoints(n, -1.0, 1.0, 32);
+    s.exact.resize(n);
+    for (std::size_t j = 0; j < n; ++j)
+        s.exact[j] = x[2 * j];
+    std::vector<std::size_t> offsets{0}, cols;
+    interval_array values = interval_array::for_overwrite(n * (per_row + 1));
+    std::vector<double> sums(n), scale(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        auto put = [&](std::size_t j, double m)
+        {
+            values.set(cols.size(), interval(m - std::fabs(m) * 1e-6, m + std::fabs(m) * 1e-6));
+            cols.push_back(j);
+            sums[i] += m * s.exact[j];
+            scale[i] += double(per_row + 1) * std::fabs(m * s.exact[j]);
+        };
+        put(i, double(per_row) + 2.0); // dominates the sum of at most eight magnitudes below 1
+        for (std::size_t k = 0; k < per_row; ++k)
+        {
+            double u = e[2 * (i * per_row + k)], v = e[2 * (i * per_row + k) + 1];
+            put(std::size_t((u * 0.5 + 0.5) * double(n)) % n, v); // a repeated column only adds to the entry
+        }
+        offsets.push_back(cols.size());
+    }
+    make_rhs(sums, scale, 1e-6, s);
+    return basic_sparse_interval_matrix<double>(n, n, std::move(offsets), std::move(cols), std::move(values));
+}
+
+/// @brief Prints one result line and checks the enclosure
+/// @param kind dense or sparse
+/// @param n the number of unknowns
+/// @param method the name of the refinement
+/// @param r the outcome of solve
+/// @param s the system solved
+/// @param x the enclosure
+/// @return false if the system was not verified or x* is outside x
+bool report(char const *kind, std::size_t n, char const *method, solve_result const &r, linear_system const &s, interval_array const &x)
+{
+    bool ok = r.verified;
+    double width = 0.0;
+    for (std::size_t i = 0; i < n && ok; ++i)
+    {
+        ok = x.lo()[i] <= s.exact[i] && s.exact[i] <= x.hi()[i];
+        width += (x.hi()[i] - x.lo()[i]) / std::fabs(s.exact[i]);
+    }
+    std::printf("%-6s %6zu  %-12s %-8s %3d it %3d ref %10.1f ms pre %10.1f ms  width %.2e\n", kind, n, method,
+                r.verified ? "verified" : "FAILED", r.iterations, r.refinements, r.precondition_seconds * 1e3, r.seconds * 1e3,
+                ok ? width / double(n) : 0.0);
+    return ok;
+}
+
+/// @brief Solves one system with both refinements
+/// @return false if a check fails
+template <class Matrix>
+bool run(char const *kind, Matrix const &a, linear_system const &s)
+{
+    bool ok = true;
+    for (solve_method method : {solve_method::krawczyk, solve_method::gauss_seidel})
+    {
+        solve_options options;
+        options.method = method;
+        interval_array x;
+        solve_result r = solve(a, s.b, x, options);
+        ok = report(kind, s.exact.size(), method == solve_method::krawczyk ? "krawczyk" : "gauss-seidel", r, s, x) && ok;
+    }
+    return ok;
+}
+
+/// @brief Runs the solver benchmark
+/// @param argc 1 to 3
+/// @param argv the optional largest dense order, by default 2000, and the largest sparse order, by default 10000
+int main(int argc, char **argv)
+{
+    std::size_t dense = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000;
+    std::size_t sparse = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10000;
+    std::printf("%zu workers\n", default_pool().size());
+    bool ok = true;
+    for (std::size_t n : {100, 300, 1000, 2000, 3000, 10000})
+        if (n <= dense)
+        {
+            interval_matrix a;
+            linear_system s = make_dense(n, a);
+            ok = run("dense", a, s) && ok;
+        }
+    for (std::size_t n : {100, 300, 1000, 3000, 10000})
+        if (n <= sparse)
+        {
+            linear_system s;
+            basic_sparse_interval_matrix<double> a = make_sparse(n, s);
+            ok = run("sparse", a, s) && ok;
+        }
+    if (!ok)
+    {
+        std::printf("a system was not verified or an enclosure misses the known solution\n");
+        return 1;
+    }
+}
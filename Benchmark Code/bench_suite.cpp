@@ -0,0 +1,269 @@
+/// @file bench_suite.cpp
+/// @brief Regression benchmark covering every operator family of interval.h
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Times interval-interval, interval-double, double-interval, compound and stream operators of #interval on two data distributions: mixed sign intervals in [-10, 10], and small intervals clustered around zero, a fraction of which touch or contain it so that division meets its unbounded case. Each case is run at an L1 sized and a main memory sized problem.
+/// @details Every result reports ns/op, ops/cycle and last level cache misses per operation, read from the hardware counters where the kernel allows. With --json the results are also written one per line to a JSON file that can be diffed between commits.
+/// @details Usage: bench_suite [--quick] [--filter text] [--json file]
+/// @details Build: cmake -S .. -B build && cmake --build build --target bench_suite, or g++ -std=c++20 -O2 -I.. bench_suite.cpp ../interval.cpp -o bench_suite
+
+#include "bench.h"
+#include "interval.h"
+
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef INTERVAL_REVISION
+#define INTERVAL_REVISION "unknown" ///< the source revision, set by the CMake build
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 data distributions
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief The operands of one distribution
+struct dataset
+{
+    char const *name;         ///< the name of the distribution
+    std::vector<interval> a;  ///< left interval operands
+    std::vector<interval> b;  ///< right interval operands
+    std::vector<double> s;    ///< double operands
+    std::string text;         ///< a, written as the stream operators read it
+};
+
+/// @brief Builds mixed sign intervals with end points in [-10, 10]
+/// @param n the number of operands
+/// @return the dataset
+dataset mixed_sign(std::size_t n)
+{
+    dataset d{"mixed_sign", std::vector<interval>(n), std::vector<interval>(n), std::vector<double>(n), {}};
+    std::vector<double> ea = bench::random_endpoints(n, -10.0, 10.0, 1), eb = bench::random_endpoints(n, -10.0, 10.0, 2);
+    std::vector<double> es = bench::random_endpoints(n, -10.0, 10.0, 3);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        d.a[i] = interval(ea[2 * i], ea[2 * i + 1]);
+        d.b[i] = interval(eb[2 * i], eb[2 * i + 1]);
+        d.s[i] = es[2 * i];
+    }
+    return d;
+}
+
+/// @brief Builds small intervals clustered around zero
+/// @details Centres lie within 1e-3 of zero and radii are log uniform between 1e-9 and 1e-3, so most intervals keep one sign but many contain zero. One operand in sixteen has an end point of exactly zero, and one double in sixteen is zero.
+/// @param n the number of operands
+/// @return the dataset
+dataset near_zero(std::size_t n)
+{
+    dataset d{"near_zero", std::vector<interval>(n), std::vector<interval>(n), std::vector<double>(n), {}};
+    std::mt19937_64 gen(4);
+    std::uniform_real_distribution<double> centre(-1e-3, 1e-3), exponent(-9.0, -3.0);
+    auto make = [&](std::size_t i)
+    {
+        double c = centre(gen), r = std::pow(10.0, exponent(gen));
+        if (i % 16 == 0)
+            return interval(0.0, r); // touches zero
+        return interval(c - r, c + r);
+    };
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        d.a[i] = make(i);
+        d.b[i] = make(i + 8);
+        d.s[i] = i % 16 == 1 ? 0.0 : centre(gen);
+    }
+    return d;
+}
+
+/// @brief Writes the left operands of a dataset as text for the stream benchmarks
+/// @param d the dataset
+void write_text(dataset &d)
+{
+    std::ostringstream os;
+    os.precision(17); // round trips every double
+    for (interval const &x : d.a)
+        os << x.min() << ' ' << x.max() << '\n';
+    d.text = os.str();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 benchmark cases
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief One timed case
+struct result
+{
+    std::string name;         ///< the operator, e.g. "interval * interval"
+    std::string family;       ///< the operator family
+    std::string distribution; ///< the data distribution
+    std::size_t n;            ///< the number of operands
+    bench::measurement cost;  ///< the cost per operation
+};
+
+/// @brief Options from the command line
+struct options
+{
+    bool quick = false;        ///< only the small problem and fewer repeats
+    char const *filter = "";   ///< only cases whose name contains this text
+    char const *json = nullptr; ///< the file to write JSON results to
+};
+
+/// @brief Runs every case over one dataset
+/// @param d the dataset
+/// @param opt the command line options
+/// @param out the results, appended to
+void run(dataset &d, options const &opt, std::vector<result> &out)
+{
+    std::size_t n = d.a.size();
+    std::size_t reps = n < 100000 ? 100 : 2; // keep each timing well above the clock resolution
+    int repeats = opt.quick ? 3 : 7;
+    std::vector<interval> r(n);
+    std::vector<interval> const &a = d.a, &b = d.b;
+    std::vector<double> const &s = d.s;
+
+    auto time = [&](char const *family, char const *name, std::size_t ops, std::function<void()> const &body)
+    {
+        if (!std::strstr(name, opt.filter) && !std::strstr(family, opt.filter))
+            return;
+        bench::measurement m = bench::measure(ops, [&]
+                                              {
+                                                  for (std::size_t k = 0; k < reps; ++k)
+                                                  {
+                                                      body();
+                                                      bench::clobber();
+                                                  } },
+                                              repeats);
+        out.push_back({name, family, d.name, n, m});
+        double opc = m.cycles_per_op > 0 ? 1.0 / m.cycles_per_op : -1.0;
+        std::printf("%-24s %-18s %-11s %8zu %9.3f ns/op %8s ops/cycle %10s misses/op\n", name, family, d.name, n, m.ns_per_op,
+                    bench::json_number(opc).c_str(), bench::json_number(m.cache_misses_per_op).c_str());
+    };
+    std::size_t ops = n * reps;
+
+    // a loop over one operator; the lambdas are inlined into the timed loop
+#define BENCH_SUITE_LOOP(expr) [&] { for (std::size_t i = 0; i < n; ++i) r[i] = (expr); }
+
+    time("interval-interval", "interval + interval", ops, BENCH_SUITE_LOOP(a[i] + b[i]));
+    time("interval-interval", "interval - interval", ops, BENCH_SUITE_LOOP(a[i] - b[i]));
+    time("interval-interval", "interval * interval", ops, BENCH_SUITE_LOOP(a[i] * b[i]));
+    time("interval-interval", "interval / interval", ops, BENCH_SUITE_LOOP(a[i] / b[i]));
+
+    time("interval-double", "interval + double", ops, BENCH_SUITE_LOOP(a[i] + s[i]));
+    time("interval-double", "interval - double", ops, BENCH_SUITE_LOOP(a[i] - s[i]));
+    time("interval-double", "interval * double", ops, BENCH_SUITE_LOOP(a[i] * s[i]));
+    time("interval-double", "interval / double", ops, BENCH_SUITE_LOOP(a[i] / s[i]));
+
+    time("double-interval", "double + interval", ops, BENCH_SUITE_LOOP(s[i] + a[i]));
+    time("double-interval", "double - interval", ops, BENCH_SUITE_LOOP(s[i] - a[i]));
+    time("double-interval", "double * interval", ops, BENCH_SUITE_LOOP(s[i] * a[i]));
+    time("double-interval", "double / interval", ops, BENCH_SUITE_LOOP(s[i] / a[i]));
+
+    // each compound operator starts from a fresh copy so repeated passes cannot overflow or underflow
+    time("compound", "interval += interval", ops, BENCH_SUITE_LOOP(interval(a[i]) += b[i]));
+    time("compound", "interval -= interval", ops, BENCH_SUITE_LOOP(interval(a[i]) -= b[i]));
+    time("compound", "interval *= interval", ops, BENCH_SUITE_LOOP(interval(a[i]) *= b[i]));
+    time("compound", "interval /= interval", ops, BENCH_SUITE_LOOP(interval(a[i]) /= b[i]));
+    time("compound", "interval += double", ops, BENCH_SUITE_LOOP(interval(a[i]) += s[i]));
+    time("compound", "interval -= double", ops, BENCH_SUITE_LOOP(interval(a[i]) -= s[i]));
+    time("compound", "interval *= double", ops, BENCH_SUITE_LOOP(interval(a[i]) *= s[i]));
+    time("compound", "interval /= double", ops, BENCH_SUITE_LOOP(interval(a[i]) /= s[i]));
+#undef BENCH_SUITE_LOOP
+
+    // stream operators are far slower, so they make one pass per repeat
+    std::size_t stream_reps = reps;
+    reps = 1;
+    std::ostringstream os;
+    time("stream", "ostream << interval", n, [&]
+         {
+             os.str(std::string());
+             for (std::size_t i = 0; i < n; ++i)
+                 os << a[i] << '\n';
+         });
+    time("stream", "istream >> interval", n, [&]
+         {
+             std::istringstream is(d.text);
+             for (std::size_t i = 0; i < n; ++i)
+                 is >> r[i];
+         });
+    reps = stream_reps;
+
+    bench::do_not_optimize(r[n / 2]);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 output
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Writes the results as JSON, one result object per line so that text diffs line up between commits
+/// @param path the file to write
+/// @param results the results
+/// @return true if the file was written
+bool write_json(char const *path, std::vector<result> const &results)
+{
+    std::FILE *f = std::fopen(path, "w");
+    if (!f)
+        return false;
+    std::fprintf(f, "{\n  \"suite\": \"interval\",\n  \"revision\": %s,\n  \"compiler\": %s,\n  \"cycle_source\": %s,\n  \"results\": [\n",
+                 bench::json_string(INTERVAL_REVISION).c_str(), bench::json_string(__VERSION__).c_str(),
+                 bench::json_string(bench::hardware_counters().cycle_source()).c_str());
+    for (std::size_t k = 0; k < results.size(); ++k)
+    {
+        result const &r = results[k];
+        bench::measurement const &m = r.cost;
+        std::fprintf(f, "    {\"name\": %s, \"family\": %s, \"distribution\": %s, \"n\": %zu, \"ns_per_op\": %s, \"cycles_per_op\": %s, "
+                        "\"ops_per_cycle\": %s, \"instructions_per_op\": %s, \"cache_misses_per_op\": %s}%s\n",
+                     bench::json_string(r.name).c_str(), bench::json_string(r.family).c_str(), bench::json_string(r.distribution).c_str(), r.n,
+                     bench::json_number(m.ns_per_op).c_str(), bench::json_number(m.cycles_per_op).c_str(),
+                     bench::json_number(m.cycles_per_op > 0 ? 1.0 / m.cycles_per_op : -1.0).c_str(),
+                     bench::json_number(m.instructions_per_op).c_str(), bench::json_number(m.cache_misses_per_op).c_str(),
+                     k + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(f, "  ]\n}\n");
+    return std::fclose(f) == 0;
+}
+
+/// @brief Runs the suite
+/// @param argc the number of arguments
+/// @param argv --quick, --filter text and --json file
+/// @return 0 on success, 1 on bad arguments or if the JSON file cannot be written
+int main(int argc, char **argv)
+{
+    options opt;
+    for (int k = 1; k < argc; ++k)
+    {
+        if (!std::strcmp(argv[k], "--quick"))
+            opt.quick = true;
+        else if (!std::strcmp(argv[k], "--filter") && k + 1 < argc)
+            opt.filter = argv[++k];
+        else if (!std::strcmp(argv[k], "--json") && k + 1 < argc)
+            opt.json = argv[++k];
+        else
+        {
+            std::fprintf(stderr, "usage: %s [--quick] [--filter text] [--json file]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::printf("revision %s, cycles from %s\n", INTERVAL_REVISION, bench::hardware_counters().cycle_source());
+    std::vector<result> results;
+    std::vector<std::size_t> sizes = {std::size_t(1) << 12};
+    if (!opt.quick)
+        sizes.push_back(std::size_t(1) << 20); // 16 MiB per operand array, well beyond the last level cache
+    for (std::size_t n : sizes)
+    {
+        dataset mixed = mixed_sign(n), zero = near_zero(n);
+        write_text(mixed);
+        write_text(zero);
+        run(mixed, opt, results);
+        run(zero, opt, results);
+    }
+
+    if (opt.json && !write_json(opt.json, results))
+    {
+        std::fprintf(stderr, "cannot write %s\n", opt.json);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,108 @@
+/// @file bench_text.cpp
+/// @brief Throughput of the from_chars parser and to_chars formatter against the stream operators
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Reads a buffer of random intervals, one "a b" per line, once with operator>> through a std::istringstream and once with parse_intervals, and writes them once with operator<< through a std::ostringstream and once with format_intervals, both with 17 significant digits. Prints ns per interval, MB/s of text and the speedup. Every parsed interval must contain the written end points, and the formatted text must parse back to intervals containing the originals.
+/// @details Usage: bench_text [intervals]
+/// @details Build: g++ -std=c++20 -O2 -I.. bench_text.cpp ../interval_text.cpp ../interval_array.cpp ../interval.cpp -o bench_text
+
+#include "bench.h"
+#include "interval_text.h"
+
+#include <cstdlib>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/// @brief Prints one result line
+/// @param name what was timed
+/// @param ns the nanoseconds per interval
+/// @param bytes the bytes of text per interval
+/// @param base the nanoseconds per interval of the stream operator, or 0 for the stream operator itself
+void report(char const *name, double ns, double bytes, double base)
+{
+    std::printf("%-28s %10.1f ns/interval %10.1f MB/s", name, ns, bytes / ns * 1e3);
+    if (base > 0.0)
+        std::printf("  %6.1fx", base / ns);
+    std::printf("\n");
+}
+
+/// @brief Checks that every interval of an array contains the matching interval of another
+/// @param outer the enclosures
+/// @param inner the enclosed intervals
+/// @return true if every enclosure holds
+bool contains(interval_array const &outer, interval_array const &inner)
+{
+    if (outer.size() != inner.size())
+        return false;
+    for (std::size_t i = 0; i < inner.size(); ++i)
+        if (!(outer.lo()[i] <= inner.lo()[i] && inner.hi()[i] <= outer.hi()[i]))
+            return false;
+    return true;
+}
+
+/// @brief Times both readers and both writers
+/// @param n the number of intervals
+void run(std::size_t n)
+{
+    std::vector<double> e = bench::random_endpoints(n, -1e6, 1e6, 12);
+    interval_array a(n);
+    std::ostringstream text;
+    text.precision(std::numeric_limits<double>::max_digits10);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        a.set(i, interval(e[2 * i], e[2 * i + 1]));
+        text << e[2 * i] << ' ' << e[2 * i + 1] << '\n';
+    }
+    std::string const input = text.str();
+    double bytes = double(input.size()) / double(n);
+    std::printf("%zu intervals, %.1f MB of text\n", n, double(input.size()) / 1048576.0);
+
+    interval_array streamed(n), parsed;
+    double stream_in = bench::time_ns_per_op(n, [&]
+                                             {
+                                                 std::istringstream is(input);
+                                                 interval x;
+                                                 for (std::size_t i = 0; i < n && is >> x; ++i)
+                                                     streamed.set(i, x);
+                                             }, 3);
+    double parse = bench::time_ns_per_op(n, [&]
+                                         { parse_intervals(input, parsed); }, 3);
+    report("operator>> istringstream", stream_in, bytes, 0.0);
+    report("parse_intervals", parse, bytes, stream_in);
+
+    std::string streamed_text, formatted;
+    double stream_out = bench::time_ns_per_op(n, [&]
+                                              {
+                                                  std::ostringstream os;
+                                                  os.precision(std::numeric_limits<double>::max_digits10);
+                                                  for (std::size_t i = 0; i < n; ++i)
+                                                      os << a[i] << '\n';
+                                                  streamed_text = os.str();
+                                              }, 3);
+    double format = bench::time_ns_per_op(n, [&]
+                                          {
+                                              formatted.clear();
+                                              format_intervals(a, formatted);
+                                          }, 3);
+    double out_bytes = double(formatted.size()) / double(n);
+    report("operator<< ostringstream", stream_out, out_bytes, 0.0);
+    report("format_intervals", format, out_bytes, stream_out);
+
+    interval_array round_trip;
+    parse_intervals(formatted, round_trip);
+    if (!contains(parsed, a) || !contains(round_trip, a))
+    {
+        std::printf("a parsed interval misses the written end points\n");
+        std::exit(1);
+    }
+}
+
+/// @brief Runs the text benchmark
+/// @param argc 1, or 2 with a size
+/// @param argv the optional number of intervals, by default 2^21
+int main(int argc, char **argv)
+{
+    run(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t(1) << 21);
+}
@@ -3,9 +3,10 @@
 /// @author George Downing
 /// @date 16-12-2022
 /// @details This is a simple example of how to use the interval class
+/// @details Build: g++ -std=c++20 -O2 Example.cpp ../interval.cpp -o Example
 /// @details DOxygen documentation: https://georgedowning20.github.io/The-Interval-Arithmetic-Project/files.html
 
-#include "../interval.cpp"
+#include "../interval.h"
 
 /// @brief main to test the interval class
 /** @test Output: \n
@@ -0,0 +1,672 @@
+/// @file check_enclosure.cpp
+/// @brief Checks that the interval operators and the batch paths enclose the exact results
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Evaluates the interval operators under the enclosing rounding policies, the matrix product, the text parser and formatter, the ball operators and the reductions on random data, and checks every result against exact arithmetic on sample points of the operands. A sum or product of doubles is held exactly as an expansion of nonoverlapping doubles, built with TwoSum and with TwoProduct by fused multiply-add, so whether an end point lies below or above the exact value is decided without rounding.
+/// @details Prints each failure and the number of checks, and returns 1 if any failed. Registered with CTest as enclosure.
+/// @details Build: g++ -std=c++20 -O2 -frounding-math -pthread -I.. check_enclosure.cpp ../interval_text.cpp ../interval_matrix.cpp ../interval_reduce.cpp ../ball_array.cpp ../interval_math.cpp ../parallel.cpp ../interval_array.cpp ../interval_instrument.cpp ../interval.cpp -o check_enclosure
+
+#include "../ball.h"
+#include "../dd_interval_array.h"
+#include "../interval_expr.h"
+#include "../interval_math.h"
+#include "../interval_matrix.h"
+#include "../interval_reduce.h"
+#include "../interval_text.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 exact arithmetic
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Gets the sign of the exact sum of finite doubles
+/// @details Adds the terms one at a time to an expansion of nonoverlapping doubles of increasing magnitude with TwoSum, as Shewchuk's grow-expansion does; the largest nonzero component then has the sign of the whole sum.
+/// @param terms the terms, each finite, with no partial sum overflowing
+/// @return -1, 0 or 1
+int sign(std::vector<double> const &terms)
+{
+    std::vector<double> partials;
+    for (double x : terms)
+    {
+        std::size_t i = 0;
+        for (double y : partials)
+        {
+            if (std::abs(x) < std::abs(y))
+                std::swap(x, y);
+            double hi = x + y;
+            double lo = y - (hi - x); // exact error of hi, since |x| >= |y|
+            if (lo != 0.0)
+                partials[i++] = lo;
+            x = hi;
+        }
+        partials.resize(i);
+        partials.push_back(x);
+    }
+    for (std::size_t k = partials.size(); k-- > 0;)
+        if (partials[k] != 0.0)
+            return partials[k] > 0.0 ? 1 : -1;
+    return 0;
+}
+
+/// @brief Appends the exact product of two doubles to a list of terms
+/// @param terms the terms of a sum
+/// @param x factor 1
+/// @param y factor 2
+/// @param s +1 or -1, the sign the product is added with
+void add_product(std::vector<double> &terms, double x, double y, double s = 1.0)
+{
+    double p = x * y;
+    terms.push_back(s * p);
+    terms.push_back(s * std::fma(x, y, -p)); // the rounding error of p
+}
+
+/// @brief Checks that an interval holds an exact sum of doubles
+/// @param r the interval
+/// @param terms the terms of the exact value
+/// @return true if r.min() <= the sum <= r.max()
+template <class I>
+bool holds(I const &r, std::vector<double> terms)
+{
+    double lo = double(r.min()), hi = double(r.max());
+    if (lo != lo || hi != hi || lo == INFINITY || hi == -INFINITY)
+        return false;
+    bool ok = true;
+    if (lo != -INFINITY)
+    {
+        terms.push_back(-lo);
+        ok = sign(terms) >= 0;
+        terms.pop_back();
+    }
+    if (hi != INFINITY)
+    {
+        terms.push_back(-hi);
+        ok = ok && sign(terms) <= 0;
+    }
+    return ok;
+}
+
+/// @brief Checks that an interval holds the exact quotient of two doubles
+/// @details x / y >= lo is lo y <= x for y > 0 and lo y >= x for y < 0, a sign of lo y - x computed exactly. Both are first scaled by the same power of two so that |y| is in [1, 2) and lo y cannot overflow.
+template <class I>
+bool holds_quotient(I const &r, double x, double y)
+{
+    int e = std::ilogb(y);
+    x = std::ldexp(x, -e);
+    y = std::ldexp(y, -e);
+    double lo = double(r.min()), hi = double(r.max()), s = y > 0.0 ? 1.0 : -1.0;
+    if (lo != lo || hi != hi || lo == INFINITY || hi == -INFINITY)
+        return false;
+    bool ok = true;
+    if (lo != -INFINITY)
+    {
+        std::vector<double> t{x};
+        add_product(t, lo, y, -1.0);
+        ok = s * sign(t) >= 0;
+    }
+    if (hi != INFINITY)
+    {
+        std::vector<double> t{x};
+        add_product(t, hi, y, -1.0);
+        ok = ok && s * sign(t) <= 0;
+    }
+    return ok;
+}
+
+/// @brief Checks that a double-double interval holds an exact sum of doubles
+template <class I>
+bool holds_dd(I const &r, std::vector<double> terms)
+{
+    double_double lo = r.min(), hi = r.max();
+    if (lo.hi() != lo.hi() || hi.hi() != hi.hi() || lo.hi() == INFINITY || hi.hi() == -INFINITY)
+        return false;
+    bool ok = true;
+    if (lo.hi() != -INFINITY)
+    {
+        std::vector<double> t = terms;
+        t.insert(t.end(), {-lo.hi(), -lo.lo()});
+        ok = sign(t) >= 0;
+    }
+    if (hi.hi() != INFINITY)
+    {
+        terms.insert(terms.end(), {-hi.hi(), -hi.lo()});
+        ok = ok && sign(terms) <= 0;
+    }
+    return ok;
+}
+
+/// @brief Checks that a double-double interval holds the exact quotient of two double-doubles
+/// @details As holds_quotient, with every part of x and y scaled so that |y| is in [1, 2). The products of the check are exact while |x / y| stays within about 2^-800 to 2^800.
+template <class I>
+bool holds_dd_quotient(I const &r, double_double x, double_double y)
+{
+    int e = std::ilogb(y.hi());
+    double xh = std::ldexp(x.hi(), -e), xl = std::ldexp(x.lo(), -e), yh = std::ldexp(y.hi(), -e), yl = std::ldexp(y.lo(), -e);
+    double s = yh > 0.0 ? 1.0 : -1.0;
+    auto side = [&](double_double b) // the sign of b y - x
+    {
+        std::vector<double> t{-xh, -xl};
+        add_product(t, b.hi(), yh);
+        add_product(t, b.hi(), yl);
+        add_product(t, b.lo(), yh);
+        add_product(t, b.lo(), yl);
+        return s * sign(t);
+    };
+    double_double lo = r.min(), hi = r.max();
+    if (lo.hi() != lo.hi() || hi.hi() != hi.hi())
+        return false;
+    return (lo.hi() == -INFINITY || side(lo) <= 0) && (hi.hi() == INFINITY || side(hi) >= 0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 checks
+//---------------------------------------------------------------------------------------------------------------------
+
+std::size_t checks = 0;   ///< the checks made
+std::size_t failures = 0; ///< the checks that failed
+
+/// @brief Counts one check and prints it if it failed
+/// @param ok the outcome
+/// @param what the path checked
+/// @param a operand 1, or the result
+/// @param b operand 2
+void check(bool ok, char const *what, interval const &a, interval const &b = interval())
+{
+    ++checks;
+    if (!ok && ++failures <= 20)
+        std::printf("FAIL %s: [%a, %a] [%a, %a]\n", what, a.min(), a.max(), b.min(), b.max());
+}
+
+/// @brief Gets points of an interval to evaluate exactly: its finite end points, its midpoint and zero if it holds it
+/// @details An unbounded end point is stood in for by +-1e150, far enough out to reach the unbounded side of a result and near enough that no exact product overflows.
+std::vector<double> samples(interval const &x)
+{
+    double lo = x.min() == -INFINITY ? -1e150 : x.min(), hi = x.max() == INFINITY ? 1e150 : x.max();
+    std::vector<double> s{lo, hi, lo * 0.5 + hi * 0.5};
+    if (lo <= 0.0 && 0.0 <= hi)
+        s.push_back(0.0);
+    return s;
+}
+
+/// @brief Makes a random end point from a pool of awkward values and random doubles of every magnitude
+double end_point(std::mt19937_64 &gen, std::vector<double> const &pool)
+{
+    if (gen() % 2)
+        return pool[gen() % pool.size()];
+    double m = std::uniform_real_distribution<double>(-1.0, 1.0)(gen);
+    return std::ldexp(m, int(gen() % 200) - 100);
+}
+
+/// @brief Makes a random interval whose end points come from end_point, never [inf, inf] or [-inf, -inf]
+interval random_interval(std::mt19937_64 &gen, std::vector<double> const &pool)
+{
+    double a = end_point(gen, pool), b = end_point(gen, pool);
+    if (a == b && std::isinf(a))
+        b = 0.0;
+    return a <= b ? interval(a, b) : interval(b, a);
+}
+
+/// @brief Checks the four operators of one enclosing rounding policy at the sample points of random operands
+template <class R>
+void check_operators(char const *name, std::vector<double> const &pool)
+{
+    using I = basic_interval<double, R>;
+    std::mt19937_64 gen(1);
+    std::string what[5];
+    for (int k = 0; k < 4; ++k)
+        what[k] = std::string(name) + " " + "+-*/"[k];
+    what[4] = std::string(name) + " fma";
+    for (int n = 0; n < 20000; ++n)
+    {
+        interval a = random_interval(gen, pool), b = random_interval(gen, pool), c = random_interval(gen, pool);
+        I x(a.min(), a.max()), y(b.min(), b.max()), z(c.min(), c.max());
+        I sum = x + y, diff = x - y, prod = x * y, quot = x / y, fused = expr::fma(x, y, z);
+        bool ok[5] = {true, true, true, true, true};
+        for (double p : samples(a))
+            for (double q : samples(b))
+            {
+                ok[0] = ok[0] && holds(sum, {p, q});
+                ok[1] = ok[1] && holds(diff, {p, -q});
+                std::vector<double> t;
+                add_product(t, p, q);
+                ok[2] = ok[2] && holds(prod, t);
+                ok[3] = ok[3] && (q == 0.0 || holds_quotient(quot, p, q));
+                for (double r : samples(c))
+                {
+                    t.push_back(r);
+                    ok[4] = ok[4] && holds(fused, t);
+                    t.pop_back();
+                }
+            }
+        for (int k = 0; k < 4; ++k)
+            check(ok[k], what[k].c_str(), a, b);
+        check(ok[4], what[4].c_str(), a, b);
+    }
+}
+
+/// @brief Checks that an unbounded end point times a zero one counts as zero, whatever the policy and the operand order
+template <class R>
+void check_unbounded_products(char const *name)
+{
+    using I = basic_interval<double, R>;
+    auto same = [](I const &x, double lo, double hi) // exactly for rounding to nearest, holding [lo, hi] for the others
+    {
+        if constexpr (std::is_same_v<R, rounding::fast>)
+            return x.min() == lo && x.max() == hi;
+        else
+            return x.min() <= lo && hi <= x.max();
+    };
+    I up(1.0, INFINITY), down(-INFINITY, -1.0), unit(0.0, 1.0), zero(0.0);
+    std::string what = std::string(name) + " unbounded *";
+    char const *w = what.c_str();
+    check(same(up * unit, 0.0, INFINITY), w, interval(1.0, INFINITY), interval(0.0, 1.0));
+    check(same(unit * up, 0.0, INFINITY), w, interval(0.0, 1.0), interval(1.0, INFINITY));
+    check(same(down * unit, -INFINITY, 0.0), w, interval(-INFINITY, -1.0), interval(0.0, 1.0));
+    check(same(unit * down, -INFINITY, 0.0), w, interval(0.0, 1.0), interval(-INFINITY, -1.0));
+    check(same(I::entire() * unit, -INFINITY, INFINITY), w, interval::entire(), interval(0.0, 1.0));
+    check(same(unit * I::entire(), -INFINITY, INFINITY), w, interval(0.0, 1.0), interval::entire());
+    check(same(up * zero, 0.0, 0.0) && same(zero * I::entire(), 0.0, 0.0), w, interval(1.0, INFINITY), interval(0.0));
+    check(same(up * 0.0, 0.0, 0.0) && same(unit * INFINITY, 0.0, INFINITY) && same(unit * -INFINITY, -INFINITY, 0.0), w, interval(0.0, 1.0), interval(INFINITY));
+    basic_interval<float, R> upf(1.0f, INFINITY), unitf(0.0f, 1.0f);
+    check((upf * unitf).min() <= 0.0f && (upf * unitf).max() == INFINITY && (unitf * upf).min() <= 0.0f, w, interval(1.0, INFINITY), interval(0.0, 1.0));
+
+    std::string fused = std::string(name) + " unbounded fma";
+    char const *f = fused.c_str();
+    I two(2.0, 3.0);
+    check(same(expr::fma(unit, up, zero), 0.0, INFINITY) && same(expr::fma(up, unit, zero), 0.0, INFINITY), f, interval(0.0, 1.0), interval(1.0, INFINITY));
+    check(same(expr::fma(unit, down, two), -INFINITY, 3.0) && same(expr::fma(down, unit, two), -INFINITY, 3.0), f, interval(0.0, 1.0), interval(-INFINITY, -1.0));
+    check(same(expr::fma(unit, I::entire(), two), -INFINITY, INFINITY) && same(expr::fma(up, zero, two), 2.0, 3.0), f, interval(0.0, 1.0), interval::entire());
+}
+
+/// @brief Checks that the batch kernels of every instruction set give the end points of the scalar operators
+template <class T>
+void check_arrays(std::vector<double> const &pool)
+{
+    using I = basic_interval<T>;
+    std::mt19937_64 gen(6);
+    std::size_t n = 1003; // not a multiple of any register width, so the remainder loop runs too
+    basic_interval_array<T> a(n), b(n), out;
+    auto narrow = [](double x) // finite doubles stay finite in T
+    {
+        double top = double(std::numeric_limits<T>::max());
+        return T(std::isinf(x) ? x : std::clamp(x, -top, top));
+    };
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        interval x = random_interval(gen, pool), y = random_interval(gen, pool);
+        a.set(i, I(narrow(x.min()), narrow(x.max())));
+        b.set(i, I(narrow(y.min()), narrow(y.max())));
+    }
+    I k = b[0];
+    simd_level chosen = active_simd_level();
+    for (simd_level level : {simd_level::scalar, simd_level::sse2, simd_level::avx2, simd_level::avx512})
+    {
+        if (set_simd_level(level) != level)
+            continue; // not supported by this processor
+        std::string what = std::string("array ") + simd_level_name(level) + (sizeof(T) == 4 ? " float " : " double ");
+        for (int o = 0; o < 4; ++o)
+        {
+            std::string w = what + "+-*/"[o];
+            auto same = [&](I const &x, I const &y, I const &r)
+            {
+                I e = o == 0 ? x + y : o == 1 ? x - y : o == 2 ? x * y : x / y;
+                check(e.min() == r.min() && e.max() == r.max(), w.c_str(), interval(x.min(), x.max()), interval(y.min(), y.max()));
+            };
+            void (*ops[4])(basic_interval_array<T> const &, basic_interval_array<T> const &, basic_interval_array<T> &) = {add, sub, mul, div};
+            void (*right[4])(basic_interval_array<T> const &, std::type_identity_t<I> const &, basic_interval_array<T> &) = {add, sub, mul, div};
+            void (*left[4])(std::type_identity_t<I> const &, basic_interval_array<T> const &, basic_interval_array<T> &) = {add, sub, mul, div};
+            ops[o](a, b, out);
+            for (std::size_t i = 0; i < n; ++i)
+                same(a[i], b[i], out[i]);
+            right[o](a, k, out);
+            for (std::size_t i = 0; i < n; ++i)
+                same(a[i], k, out[i]);
+            left[o](k, b, out);
+            for (std::size_t i = 0; i < n; ++i)
+                same(k, b[i], out[i]);
+        }
+        T nan = std::numeric_limits<T>::quiet_NaN();
+        I odd[] = {I(nan, T(-1)), I(nan, T(1)), I(T(-1), nan), I(T(1), nan), I(nan, nan)}; // divisors with a NaN end point
+        basic_interval_array<T> d(n);
+        for (std::size_t i = 0; i < n; ++i)
+            d.set(i, odd[i % 5]);
+        div(a, d, out);
+        auto equal = [](T x, T y) { return x == y || (x != x && y != y); };
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            I e = a[i] / d[i];
+            check(equal(e.min(), out[i].min()) && equal(e.max(), out[i].max()), (what + "/ nan").c_str(), interval(a[i].min(), a[i].max()), interval(d[i].min(), d[i].max()));
+        }
+    }
+    set_simd_level(chosen);
+}
+
+/// @brief Checks both modes of the matrix product against exact dot products of sample point matrices
+void check_matmul(std::vector<double> const &pool)
+{
+    std::mt19937_64 gen(2);
+    for (auto [m, k, n] : {std::array<std::size_t, 3>{7, 5, 6}, {37, 29, 33}, {64, 70, 9}})
+    {
+        interval_matrix a(m, k), b(k, n);
+        for (std::size_t i = 0; i < m; ++i)
+            for (std::size_t l = 0; l < k; ++l)
+                a.set(i, l, random_interval(gen, pool));
+        for (std::size_t l = 0; l < k; ++l)
+            for (std::size_t j = 0; j < n; ++j)
+                b.set(l, j, random_interval(gen, pool));
+        for (matmul_mode mode : {matmul_mode::infsup, matmul_mode::midrad})
+        {
+            interval_matrix c;
+            matmul(a, b, c, mode);
+            for (int rep = 0; rep < 3; ++rep)
+            {
+                std::vector<double> pa(m * k), pb(k * n); // one point of every entry
+                for (std::size_t i = 0; i < pa.size(); ++i)
+                {
+                    std::vector<double> s = samples(a.array()[i]);
+                    pa[i] = s[gen() % s.size()];
+                }
+                for (std::size_t i = 0; i < pb.size(); ++i)
+                {
+                    std::vector<double> s = samples(b.array()[i]);
+                    pb[i] = s[gen() % s.size()];
+                }
+                for (std::size_t i = 0; i < m; ++i)
+                    for (std::size_t j = 0; j < n; ++j)
+                    {
+                        std::vector<double> t;
+                        for (std::size_t l = 0; l < k; ++l)
+                            add_product(t, pa[i * k + l], pb[l * n + j]);
+                        check(holds(c(i, j), t), mode == matmul_mode::infsup ? "matmul infsup" : "matmul midrad", c(i, j));
+                    }
+            }
+        }
+    }
+}
+
+/// @brief Checks that parsed decimal literals m 10^-e enclose their values, and that formatting and parsing again encloses the interval
+void check_text()
+{
+    std::mt19937_64 gen(3);
+    for (int n = 0; n < 20000; ++n)
+    {
+        long long m = (long long)(gen() % 1000000000000000ULL) * (gen() % 2 ? 1 : -1);
+        int e = int(gen() % 23); // 10^e is an exact double
+        std::string d = std::to_string(m) + "e-" + std::to_string(e), s = "[" + d + ", " + d + "]";
+        interval x;
+        std::from_chars_result r = from_chars(s.data(), s.data() + s.size(), x);
+        bool ok = r.ec == std::errc{};
+        double scale = std::pow(10.0, e);
+        for (double end : {x.min(), x.max()}) // end 10^e compared with m exactly
+        {
+            std::vector<double> t{double(m)}; // below 2^53, so exact
+            add_product(t, end, scale, -1.0);
+            ok = ok && (end == x.min() ? sign(t) >= 0 : sign(t) <= 0);
+        }
+        check(ok, "from_chars", x);
+
+        char buf[128];
+        int digits = 1 + int(gen() % 17);
+        std::to_chars_result w = to_chars(buf, buf + sizeof buf, x, digits);
+        interval y;
+        ok = w.ec == std::errc{} && from_chars(buf, w.ptr, y).ec == std::errc{};
+        check(ok && y.min() <= x.min() && x.max() <= y.max(), "to_chars", x, y);
+    }
+}
+
+/// @brief Checks the ball operators and conversions at the sample points of random operands
+void check_balls(std::vector<double> const &pool)
+{
+    std::mt19937_64 gen(4);
+    for (int n = 0; n < 20000; ++n)
+    {
+        interval a = random_interval(gen, pool), b = random_interval(gen, pool);
+        ball x(a), y(b);
+        interval xa = x.to_interval(), ya = y.to_interval();
+        check(xa.min() <= a.min() && a.max() <= xa.max(), "ball from interval", a, xa);
+        interval sum = (x + y).to_interval(), diff = (x - y).to_interval(), prod = (x * y).to_interval(), quot = (x / y).to_interval();
+        bool ok[4] = {true, true, true, true};
+        for (double p : samples(a))
+            for (double q : samples(b))
+            {
+                ok[0] = ok[0] && holds(sum, {p, q});
+                ok[1] = ok[1] && holds(diff, {p, -q});
+                std::vector<double> t;
+                add_product(t, p, q);
+                ok[2] = ok[2] && holds(prod, t);
+                ok[3] = ok[3] && (q == 0.0 || holds_quotient(quot, p, q));
+            }
+        check(ok[0], "ball +", a, b);
+        check(ok[1], "ball -", a, b);
+        check(ok[2], "ball *", a, b);
+        check(ok[3], "ball /", a, b);
+    }
+    for (double v : pool) // a double that float cannot hold must give a ball that encloses it
+    {
+        ballf b = v;
+        basic_interval<float> r = b.to_interval(), r3 = (b * 3).to_interval();
+        check(r.min() <= v && v <= r.max(), "float ball from double", interval(v));
+        std::vector<double> t;
+        add_product(t, v, 3.0);
+        check(holds(r3, t), "float ball * 3", interval(v));
+    }
+}
+
+/// @brief Makes a random double-double of a sign with its high part of exponent in [lo, hi]
+double_double random_dd(std::mt19937_64 &gen, int lo, int hi, double sign)
+{
+    double h = sign * std::ldexp(std::uniform_real_distribution<double>(1.0, 2.0)(gen), lo + int(gen() % (hi - lo + 1)));
+    double l = std::ldexp(std::uniform_real_distribution<double>(-1.0, 1.0)(gen), std::ilogb(h) - 54); // under half an ulp of h
+    return double_double::sum(h, l);
+}
+
+/// @brief Checks the operators of #dd_interval and the batch kernels of every instruction set, away from and near underflow
+/// @details Near underflow both operands have exponents in [-1020, -960] and only the quotient is checked, since the other results underflow. Every quotient stays within 2^-120 to 2^120, where holds_dd_quotient is exact.
+void check_dd()
+{
+    std::mt19937_64 gen(8);
+    std::size_t n = 1003;
+    dd_interval_array a(n), b(n), out;
+    std::vector<char> tiny(n);
+    auto make = [&](int lo, int hi, double sign)
+    {
+        double_double p = random_dd(gen, lo, hi, sign), q = random_dd(gen, lo, hi, sign);
+        return p < q ? dd_interval(p, q) : dd_interval(q, p);
+    };
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        tiny[i] = gen() % 2;
+        int lo = tiny[i] ? -1020 : -60, hi = tiny[i] ? -960 : 60;
+        a.set(i, make(lo, hi, gen() % 2 ? 1.0 : -1.0));
+        b.set(i, make(lo, hi, gen() % 2 ? 1.0 : -1.0)); // never holds zero
+    }
+    a.set(0, dd_interval(double_double(0x1.a46de46ee5fcp-1001)));
+    b.set(0, dd_interval(double_double(-0x1.58b459d4b1fc8p-1001)));
+    tiny[0] = 1;
+
+    auto encloses = [&](std::size_t i, int o, dd_interval const &r)
+    {
+        bool ok = true;
+        for (double_double p : {a[i].min(), a[i].max()})
+            for (double_double q : {b[i].min(), b[i].max()})
+            {
+                std::vector<double> t{p.hi(), p.lo()};
+                if (o == 0)
+                    t.insert(t.end(), {q.hi(), q.lo()});
+                else if (o == 1)
+                    t.insert(t.end(), {-q.hi(), -q.lo()});
+                else if (o == 2)
+                {
+                    t.clear();
+                    add_product(t, p.hi(), q.hi());
+                    add_product(t, p.hi(), q.lo());
+                    add_product(t, p.lo(), q.hi());
+                    add_product(t, p.lo(), q.lo());
+                }
+                ok = ok && (o == 3 ? holds_dd_quotient(r, p, q) : holds_dd(r, t));
+            }
+        return ok;
+    };
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        dd_interval x = a[i], y = b[i], r[4] = {x + y, x - y, x * y, x / y};
+        for (int o = tiny[i] ? 3 : 0; o < 4; ++o)
+            check(encloses(i, o, r[o]), (std::string("dd ") + "+-*/"[o]).c_str(), interval(x.min().hi(), x.max().hi()), interval(y.min().hi(), y.max().hi()));
+    }
+    dd_interval small = dd_interval(double_double(0x1p-950)) / dd_interval(double_double(0x1.8p500)); // a quotient below every double
+    check(small.min() <= 0.0 && 0.0 < small.max(), "dd / underflow", interval(0x1p-950), interval(0x1.8p500));
+
+    simd_level chosen = active_simd_level();
+    for (simd_level level : {simd_level::scalar, simd_level::sse2, simd_level::avx2, simd_level::avx512})
+    {
+        if (set_simd_level(level) != level)
+            continue; // not supported by this processor
+        void (*ops[4])(dd_interval_array const &, dd_interval_array const &, dd_interval_array &) = {add, sub, mul, div};
+        for (int o = 0; o < 4; ++o)
+        {
+            std::string what = std::string("dd array ") + simd_level_name(level) + " " + "+-*/"[o];
+            ops[o](a, b, out);
+            for (std::size_t i = 0; i < n; ++i)
+                if (o == 3 || !tiny[i])
+                    check(encloses(i, o, out[i]), what.c_str(), interval(a[i].min().hi(), a[i].max().hi()), interval(b[i].min().hi(), b[i].max().hi()));
+        }
+    }
+    set_simd_level(chosen);
+}
+
+/// @brief Checks integer powers of #interval, which rounds to nearest, against exact powers of sample points, and the batch powers of every instruction set against them
+/// @details Powers of a sample point p are expanded exactly by products of p; for a negative exponent e, 1 / P >= lo is lo P <= 1 for P = p^-e > 0, a sign computed exactly. The pool keeps every expansion clear of underflow and overflow.
+void check_powers()
+{
+    std::mt19937_64 gen(9);
+    std::vector<double> pool{0.0, -0.0, 1.0, -1.0, 0.1, -0.1, 3.0, -3.0, 1e-30, -1e-30, 1e30, -1e30, INFINITY, -INFINITY};
+    std::size_t n = 1003;
+    interval_array a(n), out;
+    for (std::size_t i = 0; i < n; ++i)
+        a.set(i, random_interval(gen, pool));
+    simd_level chosen = active_simd_level();
+    for (int e : {2, 3, 5, -1, -2, -3})
+    {
+        std::string what = "pow " + std::to_string(e);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            interval r = e == 2 ? sqr(a[i]) : pow(a[i], e);
+            bool ok = true;
+            for (double p : samples(a[i]))
+            {
+                if (std::abs(p) > 1e100 && e != 2)
+                    continue; // the stand in for an unbounded end point, or its midpoint, would overflow
+                std::vector<double> t{p};
+                for (int k = 1; k < (e < 0 ? -e : e); ++k)
+                {
+                    std::vector<double> u;
+                    for (double v : t)
+                        add_product(u, v, p);
+                    t = u;
+                }
+                if (e > 0)
+                    ok = ok && holds(r, t);
+                else if (p != 0.0)
+                {
+                    double s = sign(t);
+                    auto side = [&](double b) // the sign of b P - 1, turned by the sign of P
+                    {
+                        std::vector<double> u{-1.0};
+                        for (double v : t)
+                            add_product(u, b, v);
+                        return s * sign(u);
+                    };
+                    ok = ok && r.min() == r.min() && r.max() == r.max();
+                    ok = ok && (r.min() == -INFINITY || side(r.min()) <= 0) && (r.max() == INFINITY || side(r.max()) >= 0);
+                }
+            }
+            check(ok, what.c_str(), a[i], interval(e));
+        }
+        for (simd_level level : {simd_level::scalar, simd_level::sse2, simd_level::avx2, simd_level::avx512})
+        {
+            if (set_simd_level(level) != level)
+                continue; // not supported by this processor
+            std::string w = what + " array " + simd_level_name(level);
+            if (e == 2)
+                sqr(a, out);
+            else
+                pow(a, e, out);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                interval r = pow(a[i], e);
+                check(r.min() == out[i].min() && r.max() == out[i].max(), w.c_str(), a[i], out[i]);
+            }
+        }
+        set_simd_level(chosen);
+    }
+}
+
+/// @brief Checks sum and dot in both modes against exact sums of sample points
+void check_reduce()
+{
+    std::mt19937_64 gen(5);
+    std::vector<double> pool{0.0, 0.1, -0.1, 1.0 / 3.0};
+    for (std::size_t n : {1, 3, 100, 10007, 100003})
+    {
+        interval_array a(n), b(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            a.set(i, random_interval(gen, pool));
+            b.set(i, random_interval(gen, pool));
+        }
+        for (sum_mode mode : {sum_mode::outward, sum_mode::compensated})
+        {
+            char const *name = mode == sum_mode::outward ? "sum outward" : "sum compensated";
+            interval s = sum(a, mode), d = dot(a, b, mode);
+            std::vector<double> lo, hi;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                lo.push_back(a[i].min());
+                hi.push_back(a[i].max());
+            }
+            check(holds(s, lo) && holds(s, hi), name, s);
+            for (int rep = 0; rep < 3; ++rep)
+            {
+                std::vector<double> t;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    std::vector<double> p = samples(a[i]), q = samples(b[i]);
+                    add_product(t, p[gen() % p.size()], q[gen() % q.size()]);
+                }
+                check(holds(d, t), mode == sum_mode::outward ? "dot outward" : "dot compensated", d);
+            }
+        }
+    }
+}
+
+/// @brief Runs every check
+/// @return 0 if every result enclosed the exact one, 1 otherwise
+int main()
+{
+    std::vector<double> pool{0.0, -0.0, 1.0, -1.0, 0.1, -0.1, 3.0, -3.0, 1e-100, -1e-100, 1e100, -1e100};
+    std::vector<double> unbounded = pool;
+    unbounded.insert(unbounded.end(), {INFINITY, -INFINITY, INFINITY, -INFINITY});
+    check_operators<rounding::widen>("widen", unbounded);
+    check_operators<rounding::switched>("switched", unbounded);
+    check_unbounded_products<rounding::fast>("fast");
+    check_unbounded_products<rounding::widen>("widen");
+    check_unbounded_products<rounding::switched>("switched");
+    check_arrays<double>(unbounded);
+    check_arrays<float>(unbounded);
+    check_matmul(unbounded);
+    check_text();
+    check_balls(pool);
+    check_dd();
+    check_powers();
+    check_reduce();
+    std::printf("%zu checks, %zu failed\n", checks, failures);
+    return failures != 0;
+}
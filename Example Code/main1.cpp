@@ -1,4 +1,4 @@
-#include "../interval.cpp"
+#include "../interval.h"
 
 using namespace std;
 int main()
@@ -0,0 +1,175 @@
+/// @file affine_form.cpp
+/// @brief Implementation of the term arenas and noise symbols of affine forms
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Each thread has an arena with one free list per power of two block size, from min_block to max_block. A block is cut from the slab the arena is carving when its list is empty, and a released block goes onto the list of the releasing thread, so a form made on one thread and destroyed on another moves its block across. Slabs are never returned: a thread that ends hands its lists and the rest of its slab to a shared spare arena, which the next new thread adopts, so the memory is bounded by the most terms alive at once plus one slab per thread.
+/// @details Noise symbols are numbered from one shared counter, which each thread advances a block at a time.
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                    include files
+//---------------------------------------------------------------------------------------------------------------------
+
+#include "affine_form.h"
+
+#include <atomic>
+#include <mutex>
+#include <new>
+
+namespace
+{
+    /// @brief The bytes of every slab
+    constexpr std::size_t slab_bytes = std::size_t(1) << 18;
+
+    /// @brief The number of block sizes, from min_block to max_block
+    constexpr std::size_t classes = std::countr_zero(affine_detail::max_block) - std::countr_zero(affine_detail::min_block) + 1;
+
+    /// @brief The symbols a thread reserves at a time
+    constexpr std::uint64_t symbol_block = 4096;
+
+    /// @brief Gets the list of a block size
+    std::size_t class_of(std::size_t bytes) noexcept { return std::countr_zero(bytes) - std::countr_zero(affine_detail::min_block); }
+
+    /// @brief Gets the next block of a free list, stored in the first bytes of the block
+    void *next_of(void *block) noexcept
+    {
+        void *next;
+        std::memcpy(&next, block, sizeof(void *));
+        return next;
+    }
+
+    /// @brief Free lists and the slab being carved
+    struct lists
+    {
+        void *free[classes] = {}; ///< the first free block of each size
+        char *cursor = nullptr;   ///< the next unused byte of the slab
+        char *end = nullptr;      ///< the end of the slab
+
+        /// @brief Moves every block and the rest of the slab of another set of lists here
+        void adopt(lists &other) noexcept
+        {
+            for (std::size_t k = 0; k < classes; ++k)
+            {
+                if (!other.free[k])
+                    continue;
+                void *tail = other.free[k];
+                while (void *next = next_of(tail))
+                    tail = next;
+                std::memcpy(tail, &free[k], sizeof(void *)); // the other list goes in front of this one
+                free[k] = std::exchange(other.free[k], nullptr);
+            }
+            if (other.end - other.cursor > end - cursor) // keep the larger remainder; the smaller is lost, at most one slab per thread
+            {
+                cursor = std::exchange(other.cursor, nullptr);
+                end = std::exchange(other.end, nullptr);
+            }
+        }
+    };
+
+    /// @brief The lists left by threads that ended, and the slab memory taken so far
+    struct shared
+    {
+        std::mutex lock;                   ///< guards spare
+        lists spare;                       ///< the lists of threads that ended
+        std::atomic<std::size_t> bytes{0}; ///< the bytes of every slab
+    };
+
+    /// @brief Gets the shared state, which outlives every thread arena
+    shared &global() noexcept
+    {
+        static shared *s = new shared; // never destroyed, so threads ending during exit can still hand back their lists
+        return *s;
+    }
+
+    /// @brief The arena of one thread
+    struct arena : lists
+    {
+        arena()
+        {
+            std::lock_guard<std::mutex> hold(global().lock);
+            adopt(global().spare);
+        }
+
+        ~arena()
+        {
+            std::lock_guard<std::mutex> hold(global().lock);
+            global().spare.adopt(*this);
+        }
+
+        /// @brief Cuts a block from the slab, starting a new slab when the block does not fit
+        void *carve(std::size_t bytes)
+        {
+            if (std::size_t(end - cursor) < bytes)
+            {
+                cursor = static_cast<char *>(::operator new(slab_bytes, std::align_val_t(64)));
+                end = cursor + slab_bytes;
+                global().bytes.fetch_add(slab_bytes, std::memory_order_relaxed);
+            }
+            char *block = cursor;
+            cursor += bytes; // every size is a power of two from 32, so blocks stay aligned
+            return block;
+        }
+    };
+
+    /// @brief Gets the arena of the calling thread
+    arena &this_thread()
+    {
+        thread_local arena a;
+        return a;
+    }
+
+    /// @brief The first symbol of the next block handed to a thread; 0 is the symbol of the whole line
+    std::atomic<std::uint64_t> next_symbol{1};
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 arena
+//---------------------------------------------------------------------------------------------------------------------
+
+void *affine_detail::allocate(std::size_t bytes)
+{
+    if (bytes > max_block)
+        return ::operator new(bytes, std::align_val_t(64));
+    arena &a = this_thread();
+    std::size_t k = class_of(bytes);
+    if (void *block = a.free[k])
+    {
+        a.free[k] = next_of(block);
+        return block;
+    }
+    return a.carve(bytes);
+}
+
+void affine_detail::release(void *block, std::size_t bytes) noexcept
+{
+    if (!block)
+        return;
+    if (bytes > max_block)
+    {
+        ::operator delete(block, std::align_val_t(64));
+        return;
+    }
+    arena &a = this_thread();
+    std::size_t k = class_of(bytes);
+    std::memcpy(block, &a.free[k], sizeof(void *));
+    a.free[k] = block;
+}
+
+std::size_t affine_detail::arena_bytes() noexcept
+{
+    return global().bytes.load(std::memory_order_relaxed);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 noise symbols
+//---------------------------------------------------------------------------------------------------------------------
+
+std::uint64_t affine_detail::fresh_symbol() noexcept
+{
+    thread_local std::uint64_t next = 0, end = 0;
+    if (next == end)
+    {
+        next = next_symbol.fetch_add(symbol_block, std::memory_order_relaxed);
+        end = next + symbol_block;
+    }
+    return next++;
+}
@@ -0,0 +1,582 @@
+/// @file affine_form.h
+/// @brief Affine arithmetic: forms that keep the linear correlations interval arithmetic loses
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares the basic_affine_form class, which holds a quantity as x0 + x1 e1 + ... + xn en, a centre plus a coefficient for each of the noise symbols ei it depends on, every ei ranging over [-1, 1]. Two forms that share a symbol vary together, so x + a - a gives back x where basic_interval gives x widened by twice the width of a, and a function evaluated over a box keeps the cancellation between its terms that interval arithmetic cannot see. Each nonlinear operation encloses what it cannot represent linearly with a coefficient on a new symbol of its own.
+/// @details The terms are stored sorted by symbol in a sparse array, so + and - are one merge of two sorted arrays. The arrays come from the arena of the calling thread, which keeps freed blocks in lists by size and hands them out again, so in a steady state an operation never calls malloc. Every result with more than MaxTerms terms is condensed: its smallest terms, in practice mostly rounding errors, are merged into one new symbol, which bounds both the memory and the cost of every operation.
+/// @details The coefficient bounds follow those of ball.h and hold for every faithful rounding: the rounding error of each coefficient and of the centre is added to the coefficient of the new symbol, which is then moved up by a relative (n + 16) eps for the n terms summed. The nonlinear functions take their enclosures from interval_math.h and basic_interval under rounding::widen, which are rigorous in round to nearest.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "interval.h"
+#include "interval_math.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 implementation details
+//---------------------------------------------------------------------------------------------------------------------
+
+namespace affine_detail
+{
+    /// @brief The smallest block the arena hands out, in bytes
+    inline constexpr std::size_t min_block = 32;
+
+    /// @brief The largest block the arena keeps in its lists, in bytes; larger ones go to operator new
+    inline constexpr std::size_t max_block = std::size_t(1) << 20;
+
+    /// @brief Gets a block from the arena of the calling thread
+    /// @param bytes the size, a power of two from min_block
+    /// @return the block, aligned to 16 bytes
+    void *allocate(std::size_t bytes);
+
+    /// @brief Returns a block to the arena of the calling thread, which need not be the thread that got it
+    /// @param block the block, or nullptr
+    /// @param bytes the size it was got with
+    void release(void *block, std::size_t bytes) noexcept;
+
+    /// @brief Gets a noise symbol no form has used, from a block of symbols reserved by the calling thread
+    /// @return the symbol, never 0
+    std::uint64_t fresh_symbol() noexcept;
+
+    /// @brief Gets the memory the arenas of every thread have taken from operator new
+    /// @return the bytes of every slab, which are kept for the life of the process
+    std::size_t arena_bytes() noexcept;
+
+    /// @brief The constants of the coefficient bounds of one end point type
+    template <class T>
+    struct constants
+    {
+        static constexpr T eps = std::numeric_limits<T>::epsilon();   ///< relative rounding error of one operation
+        static constexpr T tiny = std::numeric_limits<T>::min();        ///< bound of the absolute error of one underflowing product, normal so that no bound takes a subnormal operand
+        static constexpr T limit = std::numeric_limits<T>::max() / 4;   ///< bound of |centre| + radius below which nothing overflowed
+        static constexpr T inf = std::numeric_limits<T>::infinity();    ///< the coefficient of the whole real line
+    };
+} // namespace affine_detail
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 class declaration
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Affine arithmetic with sparse noise symbols
+/// @details A scalar converts implicitly to the form with no terms, exactly when T holds it, so forms combine with scalars through the same operators. An interval converts explicitly, each conversion to a new symbol: two forms made from the same interval are not correlated, so a variable is converted once and then reused.
+/// @details The whole real line is the form of centre 0 whose only term is an infinite coefficient on symbol 0, which no other form uses. Division by a form whose range contains zero returns it, as does every operation whose result overflows.
+/// @details Forms are not thread safe, but a form may be handed to another thread, and its terms released there.
+/// @tparam T the centre and coefficient type, float or double
+/// @tparam MaxTerms the number of terms above which a result is condensed
+/// @author George Downing
+/// @date 17-10-2026
+template <class T = double, std::size_t MaxTerms = 32>
+class basic_affine_form
+{
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "basic_affine_form holds float or double");
+    static_assert(MaxTerms >= 4, "condensing keeps at least three terms and the new one");
+
+public:
+    /// @brief The centre and coefficient type
+    using value_type = T;
+
+    /// @brief The type that names a noise symbol
+    using symbol_type = std::uint64_t;
+
+    /// @brief The interval type a form converts to and from
+    using interval_type = basic_interval<T>;
+
+    /// @brief One term: a coefficient times a noise symbol that ranges over [-1, 1]
+    struct term
+    {
+        symbol_type symbol; ///< the noise symbol, increasing along the terms of a form
+        T coeff;            ///< the coefficient
+    };
+
+    /// @brief The number of terms above which a result is condensed
+    static constexpr std::size_t max_terms = MaxTerms;
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 constructors
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Default constructor for the exact form 0
+    constexpr basic_affine_form() noexcept = default;
+
+    /// @brief Constructor for a scalar, exact with no terms where T holds it, and otherwise the interval enclosing it
+    /// @param val the value
+    template <interval_scalar S>
+    basic_affine_form(S val)
+    {
+        if constexpr (rounding::exact_conversion<S, T>)
+            Center = T(val);
+        else
+            *this = basic_affine_form(basic_interval<T>(val));
+    }
+
+    /// @brief Constructor for the form of a new noise symbol ranging over an interval
+    /// @details The centre is the rounded midpoint and the coefficient its distance to the farther end point, moved up by 4 eps, as ball.h encloses an interval. A point interval gives a form with no terms, and an interval with an infinite end point the whole line.
+    /// @param obj the interval
+    template <class R>
+    explicit basic_affine_form(basic_interval<T, R> const &obj)
+    {
+        using C = affine_detail::constants<T>;
+        T c = obj.min() * T(0.5) + obj.max() * T(0.5); // between the end points in every rounding mode, without overflow
+        T d = std::max(c - obj.min(), obj.max() - c);
+        if (!(std::abs(c) + d < C::limit)) // false also for NaN
+        {
+            *this = entire();
+            return;
+        }
+        Center = c;
+        if (d > 0)
+        {
+            reserve(1);
+            Terms[Size++] = term{affine_detail::fresh_symbol(), d * (1 + 4 * C::eps)};
+        }
+    }
+
+    /// @brief Gets the form covering the whole real line
+    /// @return the form of centre 0 and one infinite coefficient
+    static basic_affine_form entire()
+    {
+        basic_affine_form r;
+        r.reserve(1);
+        r.Terms[r.Size++] = term{0, affine_detail::constants<T>::inf};
+        return r;
+    }
+
+    /// @brief Copy constructor, which copies the terms into a block of the calling thread
+    basic_affine_form(basic_affine_form const &obj) : Center(obj.Center)
+    {
+        reserve(obj.Size);
+        if (obj.Size)
+            std::memcpy(Terms, obj.Terms, obj.Size * sizeof(term));
+        Size = obj.Size;
+    }
+
+    /// @brief Move constructor, which takes the terms
+    basic_affine_form(basic_affine_form &&obj) noexcept
+        : Center(obj.Center), Terms(std::exchange(obj.Terms, nullptr)), Size(std::exchange(obj.Size, 0)), Capacity(std::exchange(obj.Capacity, 0)) {}
+
+    /// @brief Copy assignment, which reuses the block of this form when the terms fit
+    basic_affine_form &operator=(basic_affine_form const &obj)
+    {
+        if (this != &obj)
+        {
+            if (Capacity < obj.Size)
+            {
+                clear();
+                reserve(obj.Size);
+            }
+            if (obj.Size)
+                std::memcpy(Terms, obj.Terms, obj.Size * sizeof(term));
+            Size = obj.Size;
+            Center = obj.Center;
+        }
+        return *this;
+    }
+
+    /// @brief Move assignment, which releases the terms of this form and takes those of another
+    basic_affine_form &operator=(basic_affine_form &&obj) noexcept
+    {
+        if (this != &obj)
+        {
+            clear();
+            Center = obj.Center;
+            Terms = std::exchange(obj.Terms, nullptr);
+            Size = std::exchange(obj.Size, 0);
+            Capacity = std::exchange(obj.Capacity, 0);
+        }
+        return *this;
+    }
+
+    /// @brief Destructor, which returns the terms to the arena of the calling thread
+    ~basic_affine_form() { clear(); }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 access and conversion
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Gets the centre
+    /// @return the value of the form when every noise symbol is 0
+    constexpr T center() const noexcept { return Center; }
+
+    /// @brief Gets the terms
+    /// @return the terms, sorted by symbol
+    std::span<term const> terms() const noexcept { return std::span<term const>(Terms, Size); }
+
+    /// @brief Gets the number of terms
+    /// @return the number of noise symbols the form depends on
+    constexpr std::size_t size() const noexcept { return Size; }
+
+    /// @brief Bounds the sum of the magnitudes of the coefficients from above
+    /// @return the total deviation, inf for the whole line
+    T radius() const noexcept
+    {
+        using C = affine_detail::constants<T>;
+        T s = 0;
+        for (std::size_t i = 0; i < Size; ++i)
+            s += std::abs(Terms[i].coeff);
+        return s * (1 + T(Size + 2) * C::eps); // a sum of n magnitudes is rounded n - 1 times
+    }
+
+    /// @brief Encloses the form in an interval, rounding both end points outward by one step
+    /// @details A form with no terms converts exactly, and one that is not bounded to basic_interval::entire.
+    /// @tparam R the rounding policy of the interval
+    /// @return the interval [center - radius, center + radius], rounded outward
+    template <class R = rounding::fast>
+    basic_interval<T, R> to_interval() const noexcept
+    {
+        using C = affine_detail::constants<T>;
+        if (Size == 0)
+            return basic_interval<T, R>(Center);
+        T r = radius();
+        if (!(r < C::inf))
+            return basic_interval<T, R>(-C::inf, C::inf);
+        return basic_interval<T, R>(rounding::next_down(Center - r), rounding::next_up(Center + r));
+    }
+
+    /// @brief Merges the smallest terms into one new symbol
+    /// @details The keep - 1 terms of largest magnitude stay as they are and the sum of the magnitudes of the others becomes the coefficient of the new symbol, which encloses the same set but forgets the correlations of the merged symbols. Operators do this to every result with more than MaxTerms terms.
+    /// @param keep the number of terms left, at least 1
+    /// @throws std::invalid_argument if keep is 0
+    void condense(std::size_t keep)
+    {
+        if (keep == 0)
+            throw std::invalid_argument("condense: at least one term is kept");
+        if (Size <= keep)
+            return;
+        using C = affine_detail::constants<T>;
+        auto larger = [](term const &a, term const &b) { return std::abs(a.coeff) > std::abs(b.coeff); };
+        std::nth_element(Terms, Terms + (keep - 1), Terms + Size, larger);
+        T merged = 0;
+        for (std::size_t i = keep - 1; i < Size; ++i)
+            merged += std::abs(Terms[i].coeff);
+        merged *= 1 + T(Size - keep + 2) * C::eps;
+        std::sort(Terms, Terms + (keep - 1), [](term const &a, term const &b) { return a.symbol < b.symbol; });
+        Size = keep - 1;
+        insert(term{affine_detail::fresh_symbol(), merged});
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 compound operators
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Adds a form, or a scalar, to this form
+    /// @param obj the form to add
+    /// @return this form
+    basic_affine_form &operator+=(basic_affine_form const &obj) { return *this = *this + obj; }
+
+    /// @brief Subtracts a form, or a scalar, from this form
+    /// @param obj the form to subtract
+    /// @return this form
+    basic_affine_form &operator-=(basic_affine_form const &obj) { return *this = *this - obj; }
+
+    /// @brief Multiplies this form by a form or a scalar
+    /// @param obj the form to multiply by
+    /// @return this form
+    basic_affine_form &operator*=(basic_affine_form const &obj) { return *this = *this * obj; }
+
+    /// @brief Divides this form by a form or a scalar
+    /// @param obj the divisor, giving the whole line when its range contains zero
+    /// @return this form
+    basic_affine_form &operator/=(basic_affine_form const &obj) { return *this = *this / obj; }
+
+    /// @brief Adds an interval, as a new symbol, to this form
+    template <class R>
+    basic_affine_form &operator+=(basic_interval<T, R> const &obj) { return *this += basic_affine_form(obj); }
+
+    /// @brief Subtracts an interval, as a new symbol, from this form
+    template <class R>
+    basic_affine_form &operator-=(basic_interval<T, R> const &obj) { return *this -= basic_affine_form(obj); }
+
+    /// @brief Multiplies this form by an interval, as a new symbol
+    template <class R>
+    basic_affine_form &operator*=(basic_interval<T, R> const &obj) { return *this *= basic_affine_form(obj); }
+
+    /// @brief Divides this form by an interval, as a new symbol
+    template <class R>
+    basic_affine_form &operator/=(basic_interval<T, R> const &obj) { return *this /= basic_affine_form(obj); }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 form operators
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Negates a form, which is exact
+    /// @return the form with the centre and every coefficient negated
+    basic_affine_form operator-() const
+    {
+        basic_affine_form r(*this);
+        r.Center = -r.Center;
+        for (std::size_t i = 0; i < r.Size; ++i)
+            r.Terms[i].coeff = -r.Terms[i].coeff;
+        return r;
+    }
+
+    /// @brief Adds two forms, either of which may be a scalar
+    friend basic_affine_form operator+(basic_affine_form const &a, basic_affine_form const &b)
+    {
+        T c = a.Center + b.Center;
+        return combine(c, T(1), a, T(1), b, std::abs(c) * affine_detail::constants<T>::eps);
+    }
+
+    /// @brief Subtracts two forms, either of which may be a scalar
+    friend basic_affine_form operator-(basic_affine_form const &a, basic_affine_form const &b)
+    {
+        T c = a.Center - b.Center;
+        return combine(c, T(1), a, T(-1), b, std::abs(c) * affine_detail::constants<T>::eps);
+    }
+
+    /// @brief Multiplies two forms, either of which may be a scalar
+    /// @details The product of the centres and of each centre with the other's terms is linear; the product of the two sums of terms is bounded by the product of the radii and given a new symbol.
+    friend basic_affine_form operator*(basic_affine_form const &a, basic_affine_form const &b)
+    {
+        using C = affine_detail::constants<T>;
+        T c = a.Center * b.Center;
+        T quadratic = a.Size && b.Size ? a.radius() * b.radius() * (1 + 2 * C::eps) : T(0);
+        return combine(c, b.Center, a, a.Center, b, quadratic + std::abs(c) * C::eps + C::tiny);
+    }
+
+    /// @brief Divides two forms, either of which may be a scalar, as a times the reciprocal of b
+    friend basic_affine_form operator/(basic_affine_form const &a, basic_affine_form const &b)
+    {
+        if (b.Size == 0 && b.Center != 0)
+            return a * (basic_interval<T, rounding::widen>(T(1)) / b.Center); // one rounding of the scalar, as a new symbol
+        return a * b.reciprocal();
+    }
+
+    /// @brief Adds a form and an interval
+    template <class R>
+    friend basic_affine_form operator+(basic_affine_form const &a, basic_interval<T, R> const &b) { return a + basic_affine_form(b); }
+
+    /// @brief Subtracts an interval from a form
+    template <class R>
+    friend basic_affine_form operator-(basic_affine_form const &a, basic_interval<T, R> const &b) { return a - basic_affine_form(b); }
+
+    /// @brief Multiplies a form by an interval
+    template <class R>
+    friend basic_affine_form operator*(basic_affine_form const &a, basic_interval<T, R> const &b) { return a * basic_affine_form(b); }
+
+    /// @brief Divides a form by an interval
+    template <class R>
+    friend basic_affine_form operator/(basic_affine_form const &a, basic_interval<T, R> const &b) { return a / basic_affine_form(b); }
+
+    /// @brief Adds an interval and a form
+    template <class R>
+    friend basic_affine_form operator+(basic_interval<T, R> const &a, basic_affine_form const &b) { return basic_affine_form(a) + b; }
+
+    /// @brief Subtracts a form from an interval
+    template <class R>
+    friend basic_affine_form operator-(basic_interval<T, R> const &a, basic_affine_form const &b) { return basic_affine_form(a) - b; }
+
+    /// @brief Multiplies an interval by a form
+    template <class R>
+    friend basic_affine_form operator*(basic_interval<T, R> const &a, basic_affine_form const &b) { return basic_affine_form(a) * b; }
+
+    /// @brief Divides an interval by a form
+    template <class R>
+    friend basic_affine_form operator/(basic_interval<T, R> const &a, basic_affine_form const &b) { return basic_affine_form(a) / b; }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 linearisation
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Applies a function of one variable through a linear approximation
+    /// @details The result is alpha times this form plus rest, whose midpoint joins the centre and whose radius becomes the coefficient of a new symbol. It encloses f over the range of this form whenever rest encloses f(x) - alpha x there; the functions below choose alpha so that this difference is monotone.
+    /// @param alpha the slope
+    /// @param rest the enclosure of f(x) - alpha x over the range of this form
+    /// @return the enclosure of f
+    template <class R>
+    basic_affine_form chain(T alpha, basic_interval<T, R> const &rest) const
+    {
+        using C = affine_detail::constants<T>;
+        T z = rest.min() * T(0.5) + rest.max() * T(0.5);
+        T d = std::max(z - rest.min(), rest.max() - z) * (1 + 4 * C::eps);
+        if (!(std::abs(z) + d < C::limit)) // false also for NaN
+            return entire();
+        T scaled = alpha * Center, c = scaled + z;
+        return combine(c, alpha, *this, T(0), basic_affine_form(), d + (std::abs(scaled) + std::abs(c)) * C::eps + C::tiny);
+    }
+
+    /// @brief Encloses the reciprocal with the min-range linear approximation
+    /// @details 1 / x is convex and monotone on each side of zero, so its slope at the end point farthest from zero makes 1 / x - alpha x monotone and its range the hull of its values at the end points.
+    /// @return the enclosure of 1 / x, the whole line when the range contains zero
+    basic_affine_form reciprocal() const
+    {
+        using W = basic_interval<T, rounding::widen>;
+        W x = to_interval<rounding::widen>();
+        if (!(x.min() > 0 || x.max() < 0)) // false also for NaN
+            return entire();
+        W a(x.min()), b(x.max()), far = x.min() > 0 ? b : a;
+        T alpha = (W(T(-1)) / (far * far)).max(); // at least the slope at far, so 1 / x - alpha x stays monotone
+        return chain(alpha, hull(W(T(1)) / a - a * alpha, W(T(1)) / b - b * alpha));
+    }
+
+private:
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                Private Functions
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Gets the smallest interval holding two
+    template <class R>
+    static basic_interval<T, R> hull(basic_interval<T, R> const &a, basic_interval<T, R> const &b) noexcept
+    {
+        return basic_interval<T, R>(std::min(a.min(), b.min()), std::max(a.max(), b.max()));
+    }
+
+    /// @brief Gets a block for at least n terms from the arena, releasing none; the form must have no block
+    void reserve(std::size_t n)
+    {
+        std::size_t bytes = std::bit_ceil(std::max(n * sizeof(term), affine_detail::min_block));
+        Terms = static_cast<term *>(affine_detail::allocate(bytes));
+        Capacity = static_cast<std::uint32_t>(bytes / sizeof(term));
+    }
+
+    /// @brief Returns the block to the arena
+    void clear() noexcept
+    {
+        affine_detail::release(Terms, Capacity * sizeof(term));
+        Terms = nullptr;
+        Size = Capacity = 0;
+    }
+
+    /// @brief Inserts a term whose symbol no term of the form has, keeping the terms sorted; there must be room for it
+    void insert(term t) noexcept
+    {
+        std::size_t k = Size;
+        while (k > 0 && Terms[k - 1].symbol > t.symbol) // fresh symbols are nearly always the largest
+            --k;
+        std::memmove(Terms + k + 1, Terms + k, (Size - k) * sizeof(term));
+        Terms[k] = t;
+        ++Size;
+    }
+
+    /// @brief Computes alpha a + beta b with a given centre, adding every rounding error to a new symbol
+    /// @details One merge of the two sorted term arrays. Each coefficient adds eps times the magnitudes of its two products and of itself to the error, which covers every faithful rounding; the error is moved up by (n + 16) eps for the n terms summed into it. A result that is not bounded is the whole line, and one with more than MaxTerms terms is condensed to three quarters of them.
+    /// @param center the centre of the result, computed by the caller
+    /// @param alpha the factor of a
+    /// @param a the first form
+    /// @param beta the factor of b
+    /// @param b the second form
+    /// @param delta the bound on everything the caller could not represent, including the rounding error of the centre
+    /// @return the form
+    static basic_affine_form combine(T center, T alpha, basic_affine_form const &a, T beta, basic_affine_form const &b, T delta)
+    {
+        using C = affine_detail::constants<T>;
+        basic_affine_form r(center);
+        r.reserve(a.Size + b.Size + 1);
+        term *out = r.Terms;
+        T err = 0, sum = 0;
+        std::size_t i = 0, j = 0;
+        auto emit = [&](symbol_type s, T p, T q)
+        {
+            T c = p + q;
+            err += std::abs(p) + std::abs(q) + std::abs(c);
+            sum += std::abs(c);
+            *out = term{s, c};
+            out += c != 0; // a symbol cancelled exactly is dropped
+        };
+        while (i < a.Size && j < b.Size) // without branches on the order of the symbols, which is unpredictable
+        {
+            symbol_type sa = a.Terms[i].symbol, sb = b.Terms[j].symbol;
+            bool take_a = sa <= sb, take_b = sb <= sa;
+            emit(take_a ? sa : sb, take_a ? alpha * a.Terms[i].coeff : T(0), take_b ? beta * b.Terms[j].coeff : T(0));
+            i += take_a;
+            j += take_b;
+        }
+        for (; i < a.Size; ++i)
+            emit(a.Terms[i].symbol, alpha * a.Terms[i].coeff, T(0));
+        for (; j < b.Size; ++j)
+            emit(b.Terms[j].symbol, T(0), beta * b.Terms[j].coeff);
+        r.Size = static_cast<std::uint32_t>(out - r.Terms);
+        T total = (delta + err * C::eps + T(r.Size + 1) * 2 * C::tiny) * (1 + T(a.Size + b.Size + 16) * C::eps);
+        if (!(std::abs(center) + sum + total < C::limit)) // false also for NaN
+            return entire();
+        if (total > 0)
+            r.insert(term{affine_detail::fresh_symbol(), total});
+        if (r.Size > MaxTerms)
+            r.condense(MaxTerms - MaxTerms / 4);
+        return r;
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    T Center{};                 ///< The centre
+    term *Terms = nullptr;      ///< The terms, sorted by symbol, in a block of the arena
+    std::uint32_t Size = 0;     ///< The number of terms
+    std::uint32_t Capacity = 0; ///< The number of terms the block holds
+};
+
+/// @brief Affine form with double centre and coefficients
+using affine_form = basic_affine_form<double>;
+
+/// @brief Affine form with float centre and coefficients
+using affine_formf = basic_affine_form<float>;
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 affine functions
+//---------------------------------------------------------------------------------------------------------------------
+
+// Each function is convex or concave and monotone over the range of its argument, so the min-range approximation
+// applies: the slope of the end point where the function is flattest makes f(x) - alpha x monotone, and its values at
+// the two end points bound it. Where the slope is unbounded the function falls back to its interval enclosure.
+
+/// @brief Encloses the square, x0^2 + 2 x0 (x - x0) + (x - x0)^2 with the last part in [0, radius^2]
+template <class T, std::size_t M>
+basic_affine_form<T, M> sqr(basic_affine_form<T, M> const &x)
+{
+    using W = basic_interval<T, rounding::widen>;
+    W c2 = sqr(W(x.center())), r2 = sqr(W(x.radius()));
+    return x.chain(2 * x.center(), W(-c2.max(), (r2 - c2).max())); // 2 x0 is exact
+}
+
+/// @brief Encloses the square root of a form whose range is above zero, and otherwise that of its range
+template <class T, std::size_t M>
+basic_affine_form<T, M> sqrt(basic_affine_form<T, M> const &x)
+{
+    using W = basic_interval<T, rounding::widen>;
+    W range = x.template to_interval<rounding::widen>();
+    if (!(range.min() > 0))
+        return basic_affine_form<T, M>(sqrt(range));
+    W a(range.min()), b(range.max());
+    T alpha = (W(T(0.5)) / sqrt(b)).min(); // at most the slope at b, so sqrt(x) - alpha x stays increasing
+    W ga = sqrt(a) - a * alpha, gb = sqrt(b) - b * alpha;
+    return x.chain(alpha, W(std::min(ga.min(), gb.min()), std::max(ga.max(), gb.max())));
+}
+
+/// @brief Encloses e raised to a form
+template <class T, std::size_t M>
+basic_affine_form<T, M> exp(basic_affine_form<T, M> const &x)
+{
+    using W = basic_interval<T, rounding::widen>;
+    W range = x.template to_interval<rounding::widen>();
+    W a(range.min()), b(range.max());
+    T alpha = exp(a).min(); // at most the slope at a, so e^x - alpha x stays increasing
+    W ga = exp(a) - a * alpha, gb = exp(b) - b * alpha;
+    return x.chain(alpha, W(std::min(ga.min(), gb.min()), std::max(ga.max(), gb.max())));
+}
+
+/// @brief Encloses the natural logarithm of a form whose range is above zero, and otherwise that of its range
+template <class T, std::size_t M>
+basic_affine_form<T, M> log(basic_affine_form<T, M> const &x)
+{
+    using W = basic_interval<T, rounding::widen>;
+    W range = x.template to_interval<rounding::widen>();
+    if (!(range.min() > 0))
+        return basic_affine_form<T, M>(log(range));
+    W a(range.min()), b(range.max());
+    T alpha = (W(T(1)) / b).min(); // at most the slope at b, so log(x) - alpha x stays increasing
+    W ga = log(a) - a * alpha, gb = log(b) - b * alpha;
+    return x.chain(alpha, W(std::min(ga.min(), gb.min()), std::max(ga.max(), gb.max())));
+}
@@ -0,0 +1,368 @@
+/// @file atomic_interval.cpp
+/// @brief Implementation of the atomic interval and the sharded accumulator
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Float end point pairs fit in a std::uint64_t and are replaced with std::atomic_ref. Double end point pairs are replaced with lock cmpxchg16b on x86-64 processors whose cpuid reports it, and otherwise under the sequence lock of the object. Outside a compare and swap every end point is read and written with relaxed atomic accesses, so a sequence lock reader that races a writer reads stale values, which it then discards, rather than causing a data race.
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                    include files
+//---------------------------------------------------------------------------------------------------------------------
+
+#include "atomic_interval.h"
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <cpuid.h>
+#define ATOMIC_INTERVAL_CX16 1 ///< cmpxchg16b may be used, subject to cpuid
+#else
+#define ATOMIC_INTERVAL_CX16 0 ///< only the sequence lock is available for double end points
+#endif
+
+namespace
+{
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 word access
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Checks once whether the processor has cmpxchg16b
+    bool has_cx16() noexcept
+    {
+#if ATOMIC_INTERVAL_CX16
+        static bool const yes = []
+        {
+            unsigned a, b, c, d;
+            return __get_cpuid(1, &a, &b, &c, &d) && (c & bit_CMPXCHG16B);
+        }();
+        return yes;
+#else
+        return false;
+#endif
+    }
+
+    /// @brief Checks once whether aligned 16 byte loads are atomic, which Intel and AMD guarantee on processors with AVX
+    bool has_load16() noexcept
+    {
+#if ATOMIC_INTERVAL_CX16
+        static bool const yes = []
+        {
+            unsigned a, b, c, d;
+            return __get_cpuid(1, &a, &b, &c, &d) && (c & bit_AVX);
+        }();
+        return yes;
+#else
+        return false;
+#endif
+    }
+
+    /// @brief Reads a pair of 16 bytes whole with one aligned load, which orders as an acquire load as every x86-64 load does
+    /// @param word the pair, aligned to its size
+    template <class Ends>
+    Ends load16(Ends const &word) noexcept
+    {
+        Ends out;
+#if ATOMIC_INTERVAL_CX16
+        long long v __attribute__((vector_size(16)));
+        asm volatile("movdqa %[word], %[v]" : [v] "=x"(v) : [word] "m"(word) : "memory");
+        std::memcpy(&out, &v, 16);
+#else
+        out = word; // never called: has_load16 is false
+#endif
+        return out;
+    }
+
+    /// @brief Reads an end point that other threads may be writing
+    template <class T>
+    T relaxed_load(T &x) noexcept { return std::atomic_ref<T>(x).load(std::memory_order_relaxed); }
+
+    /// @brief Writes an end point that other threads may be reading
+    template <class T>
+    void relaxed_store(T &x, T v) noexcept { std::atomic_ref<T>(x).store(v, std::memory_order_relaxed); }
+
+    /// @brief Replaces a pair of end points if it still holds the expected one
+    /// @param word the pair, aligned to its size
+    /// @param expected the pair expected, set to the pair found on failure
+    /// @param desired the new pair
+    /// @return true if the pair was replaced
+    template <class Ends>
+    bool compare_exchange(Ends &word, Ends &expected, Ends const &desired) noexcept
+    {
+        if constexpr (sizeof(Ends) == 8)
+        {
+            std::uint64_t want, next;
+            std::memcpy(&want, &expected, 8);
+            std::memcpy(&next, &desired, 8);
+            bool done = std::atomic_ref<std::uint64_t>(reinterpret_cast<std::uint64_t &>(word))
+                            .compare_exchange_weak(want, next, std::memory_order_acq_rel, std::memory_order_acquire);
+            std::memcpy(&expected, &want, 8);
+            return done;
+        }
+        else
+        {
+#if ATOMIC_INTERVAL_CX16
+            std::uint64_t want[2], next[2];
+            std::memcpy(want, &expected, 16);
+            std::memcpy(next, &desired, 16);
+            bool done;
+            asm volatile("lock cmpxchg16b %[word]"
+                         : "=@ccz"(done), [word] "+m"(word), "+a"(want[0]), "+d"(want[1])
+                         : "b"(next[0]), "c"(next[1])
+                         : "memory");
+            std::memcpy(&expected, want, 16);
+            return done;
+#else
+            return false; // never called: has_cx16 is false
+#endif
+        }
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 sequence locks
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Takes a sequence lock for writing
+    /// @return the even sequence number the lock held
+    std::uint32_t lock(std::atomic<std::uint32_t> &sequence) noexcept
+    {
+        for (;;)
+        {
+            std::uint32_t s = sequence.load(std::memory_order_relaxed);
+            if (!(s & 1) && sequence.compare_exchange_weak(s, s + 1, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                std::atomic_thread_fence(std::memory_order_release); // a reader that sees a store after this sees the odd number
+                return s;
+            }
+            std::this_thread::yield(); // a writer holds it for a few instructions; let it run if it shares our processor
+        }
+    }
+
+    /// @brief Releases a sequence lock taken by #lock
+    /// @details The release store needs no fence before it: it orders the writer's end point stores before the even number, and a reader's acquire load of that number orders its reads after them.
+    void unlock(std::atomic<std::uint32_t> &sequence, std::uint32_t s) noexcept { sequence.store(s + 2, std::memory_order_release); }
+
+    /// @brief Reads a pair of end points guarded by a sequence lock, retrying while a writer holds it
+    template <class T>
+    void read_locked(std::atomic<std::uint32_t> const &sequence, T &lo, T &hi, T &out_lo, T &out_hi) noexcept
+    {
+        for (;;)
+        {
+            std::uint32_t before = sequence.load(std::memory_order_acquire);
+            if (before & 1)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            out_lo = relaxed_load(lo);
+            out_hi = relaxed_load(hi);
+            std::atomic_thread_fence(std::memory_order_acquire); // the reads above happen before the second check
+            if (sequence.load(std::memory_order_relaxed) == before)
+                return;
+        }
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 folds
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief The smallest interval containing two
+    template <class T>
+    basic_interval<T> hull_of(basic_interval<T> const &a, basic_interval<T> const &b) noexcept
+    {
+        return basic_interval<T>(b.min() < a.min() ? b.min() : a.min(), b.max() > a.max() ? b.max() : a.max());
+    }
+
+    /// @brief The interval common to two, with its lower end point above the upper one if they are disjoint
+    template <class T>
+    basic_interval<T> intersect_of(basic_interval<T> const &a, basic_interval<T> const &b) noexcept
+    {
+        return basic_interval<T>(b.min() > a.min() ? b.min() : a.min(), b.max() < a.max() ? b.max() : a.max());
+    }
+
+    /// @brief Applies a fold to two intervals
+    template <interval_fold Fold, class T>
+    basic_interval<T> fold(basic_interval<T> const &a, basic_interval<T> const &b) noexcept
+    {
+        if constexpr (Fold == interval_fold::add)
+            return a + b;
+        else if constexpr (Fold == interval_fold::hull)
+            return hull_of(a, b);
+        else
+            return intersect_of(a, b);
+    }
+
+    /// @brief The start value of a fold
+    template <interval_fold Fold, class T>
+    basic_interval<T> start() noexcept
+    {
+        constexpr T inf = std::numeric_limits<T>::infinity();
+        if constexpr (Fold == interval_fold::add)
+            return basic_interval<T>(T(0));
+        else if constexpr (Fold == interval_fold::hull)
+            return basic_interval<T>(inf, -inf);
+        else
+            return basic_interval<T>(-inf, inf);
+    }
+
+    /// @brief The next shard handed to a thread
+    std::atomic<std::size_t> next_shard{0};
+
+    /// @brief Gets the shard number of the calling thread, taken round robin on first use
+    std::size_t shard_of_thread() noexcept
+    {
+        thread_local std::size_t const mine = next_shard.fetch_add(1, std::memory_order_relaxed);
+        return mine;
+    }
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 atomic interval
+//---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+bool basic_atomic_interval<T>::is_lock_free() noexcept
+{
+    return sizeof(ends) == 8 || has_cx16();
+}
+
+template <class T>
+template <class Fn>
+basic_interval<T> basic_atomic_interval<T>::update(Fn fn) noexcept
+{
+    if (is_lock_free())
+    {
+        ends seen{relaxed_load(Ends.lo), relaxed_load(Ends.hi)}; // a guess, checked by the compare and swap
+        for (;;)
+        {
+            interval_type next = fn(interval_type(seen.lo, seen.hi));
+            if (compare_exchange(Ends, seen, ends{next.min(), next.max()}))
+                return interval_type(seen.lo, seen.hi);
+        }
+    }
+    std::uint32_t s = lock(Sequence);
+    interval_type old(relaxed_load(Ends.lo), relaxed_load(Ends.hi));
+    interval_type next = fn(old);
+    relaxed_store(Ends.lo, next.min());
+    relaxed_store(Ends.hi, next.max());
+    unlock(Sequence, s);
+    return old;
+}
+
+template <class T>
+basic_interval<T> basic_atomic_interval<T>::load() const noexcept
+{
+    if (is_lock_free())
+    {
+        if constexpr (sizeof(ends) == 8)
+        {
+            ends seen = std::atomic_ref<ends>(Ends).load(std::memory_order_acquire);
+            return interval_type(seen.lo, seen.hi);
+        }
+        else if (has_load16())
+        {
+            ends seen = load16(Ends);
+            return interval_type(seen.lo, seen.hi);
+        }
+        ends seen{relaxed_load(Ends.lo), relaxed_load(Ends.hi)};
+        while (!compare_exchange(Ends, seen, seen)) // succeeds only on a pair read whole, which it leaves unchanged, but writes its line
+        {
+        }
+        return interval_type(seen.lo, seen.hi);
+    }
+    T lo, hi;
+    read_locked(Sequence, Ends.lo, Ends.hi, lo, hi);
+    return interval_type(lo, hi);
+}
+
+template <class T>
+void basic_atomic_interval<T>::store(interval_type const &x) noexcept
+{
+    update([&](interval_type const &) { return x; });
+}
+
+template <class T>
+basic_interval<T> basic_atomic_interval<T>::fetch_add(interval_type const &x) noexcept
+{
+    return update([&](interval_type const &v) { return v + x; });
+}
+
+template <class T>
+basic_interval<T> basic_atomic_interval<T>::fetch_hull(interval_type const &x) noexcept
+{
+    return update([&](interval_type const &v) { return hull_of(v, x); });
+}
+
+template <class T>
+basic_interval<T> basic_atomic_interval<T>::fetch_intersect(interval_type const &x) noexcept
+{
+    return update([&](interval_type const &v) { return intersect_of(v, x); });
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 sharded accumulator
+//---------------------------------------------------------------------------------------------------------------------
+
+template <class T, interval_fold Fold>
+std::size_t basic_interval_accumulator<T, Fold>::default_shards() noexcept
+{
+    return 2 * std::max(1u, std::thread::hardware_concurrency());
+}
+
+template <class T, interval_fold Fold>
+basic_interval_accumulator<T, Fold>::basic_interval_accumulator(std::size_t shards) : Count(shards)
+{
+    if (shards == 0)
+        throw std::invalid_argument("basic_interval_accumulator: an accumulator needs at least one shard");
+    Shards = std::make_unique<shard[]>(shards);
+    reset();
+}
+
+template <class T, interval_fold Fold>
+void basic_interval_accumulator<T, Fold>::accumulate(interval_type const &x) noexcept
+{
+    shard &own = Shards[shard_of_thread() % Count];
+    std::uint32_t s = lock(own.sequence);
+    interval_type next = fold<Fold>(interval_type(relaxed_load(own.lo), relaxed_load(own.hi)), x);
+    relaxed_store(own.lo, next.min());
+    relaxed_store(own.hi, next.max());
+    unlock(own.sequence, s);
+}
+
+template <class T, interval_fold Fold>
+basic_interval<T> basic_interval_accumulator<T, Fold>::load() const noexcept
+{
+    interval_type total = start<Fold, T>();
+    for (std::size_t k = 0; k < Count; ++k)
+    {
+        T lo, hi;
+        read_locked(Shards[k].sequence, Shards[k].lo, Shards[k].hi, lo, hi);
+        total = fold<Fold>(total, interval_type(lo, hi));
+    }
+    return total;
+}
+
+template <class T, interval_fold Fold>
+void basic_interval_accumulator<T, Fold>::reset() noexcept
+{
+    interval_type s = start<Fold, T>();
+    for (std::size_t k = 0; k < Count; ++k)
+    {
+        relaxed_store(Shards[k].lo, s.min());
+        relaxed_store(Shards[k].hi, s.max());
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 explicit instantiations
+//---------------------------------------------------------------------------------------------------------------------
+
+template class basic_atomic_interval<float>; // the end point types of interval_array.h
+template class basic_atomic_interval<double>;
+template class basic_interval_accumulator<float, interval_fold::add>;
+template class basic_interval_accumulator<float, interval_fold::hull>;
+template class basic_interval_accumulator<float, interval_fold::intersect>;
+template class basic_interval_accumulator<double, interval_fold::add>;
+template class basic_interval_accumulator<double, interval_fold::hull>;
+template class basic_interval_accumulator<double, interval_fold::intersect>;
@@ -0,0 +1,196 @@
+/// @file atomic_interval.h
+/// @brief Intervals shared between threads: an atomic interval and a sharded accumulator
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares basic_atomic_interval, an interval that many threads update with fetch_add, fetch_hull and fetch_intersect without a mutex. Both end points are held in one naturally aligned word of twice the size of an end point and replaced together by compare and swap: an 8 byte compare and swap for float end points, and cmpxchg16b for double end points on x86-64 processors that have it, which is checked at run time. Where there is no such instruction the pair is guarded by a sequence lock: writers hold it for a few instructions and readers retry instead of waiting. Either way a reader never sees the lower end point of one value with the upper end point of another.
+/// @details basic_interval_accumulator serves the case where threads only fold values into a result that is read later. Each thread folds into one of several shards on its own cache line, so threads never contend for a line, and load folds the shards together. Its shards are guarded by the same sequence locks, which a thread takes without contention unless more threads than shards share the accumulator.
+/// @details Sums are those of the interval operator +, so they round as #interval does.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "interval.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 atomic interval
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief An interval whose end points are read and replaced together by any number of threads
+/// @details Intersecting disjoint intervals leaves a lower end point above the upper one, and later intersections keep it so; #empty reports it.
+/// @tparam T the end point type, float or double
+/// @author George Downing
+/// @date 17-10-2026
+template <class T>
+class basic_atomic_interval
+{
+public:
+    /// @brief The interval type stored
+    using interval_type = basic_interval<T>;
+
+    /// @brief Constructor for an atomic interval
+    /// @param init the initial value
+    explicit basic_atomic_interval(interval_type const &init = interval_type()) noexcept : Ends{init.min(), init.max()} {}
+
+    basic_atomic_interval(basic_atomic_interval const &) = delete;            ///< the end points are shared by address, so they cannot be copied
+    basic_atomic_interval &operator=(basic_atomic_interval const &) = delete; ///< the end points are shared by address, so they cannot be assigned
+
+    /// @brief Checks whether updates use a compare and swap of both end points rather than the sequence lock
+    /// @return true for float end points, and for double end points on processors with a 16 byte compare and swap
+    static bool is_lock_free() noexcept;
+
+    /// @brief Reads both end points together
+    /// @details Float end points are read with one 8 byte load, and lock free double end points with one 16 byte load on processors with AVX, where Intel and AMD make it atomic. Other lock free double end points are read by a compare and swap of the pair with itself, which takes the cache line for writing, so readers contend with each other and with writers.
+    /// @return the current value
+    interval_type load() const noexcept;
+
+    /// @brief Replaces both end points together
+    /// @param x the new value
+    void store(interval_type const &x) noexcept;
+
+    /// @brief Adds an interval
+    /// @param x the interval added
+    /// @return the value before the addition
+    interval_type fetch_add(interval_type const &x) noexcept;
+
+    /// @brief Widens the value to the smallest interval containing it and another
+    /// @param x the interval to contain
+    /// @return the value before
+    interval_type fetch_hull(interval_type const &x) noexcept;
+
+    /// @brief Narrows the value to its intersection with another interval
+    /// @param x the interval to intersect with
+    /// @return the value before
+    interval_type fetch_intersect(interval_type const &x) noexcept;
+
+    /// @brief Checks whether intersections have emptied the value
+    /// @return true if the lower end point is above the upper one
+    bool empty() const noexcept
+    {
+        interval_type x = load(); // one read, so both end points are of the same value
+        return x.min() > x.max();
+    }
+
+private:
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Functions
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Replaces the value by fn(value) atomically
+    /// @return the value fn was applied to
+    template <class Fn>
+    interval_type update(Fn fn) noexcept;
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Both end points, aligned so that one compare and swap covers them
+    struct alignas(2 * sizeof(T)) ends
+    {
+        T lo; ///< the lower end point
+        T hi; ///< the upper end point
+    };
+
+    mutable ends Ends;                               ///< The value, read and written only through atomic operations
+    mutable std::atomic<std::uint32_t> Sequence{0}; ///< The sequence lock where there is no wide compare and swap: odd while a writer holds it
+};
+
+/// @brief Atomic interval with double end points
+using atomic_interval = basic_atomic_interval<double>;
+
+/// @brief Atomic interval with float end points, always lock free
+using atomic_intervalf = basic_atomic_interval<float>;
+
+extern template class basic_atomic_interval<float>;  ///< compiled in atomic_interval.cpp
+extern template class basic_atomic_interval<double>; ///< compiled in atomic_interval.cpp
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 sharded accumulator
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief The fold an accumulator applies
+enum class interval_fold
+{
+    add,      ///< the sum of the intervals, starting from [0, 0]
+    hull,     ///< the smallest interval containing them, starting empty as [+inf, -inf]
+    intersect ///< the interval common to them, starting as [-inf, +inf]; empty once two are disjoint
+};
+
+/// @brief Folds intervals from many threads into per thread shards, combined when read
+/// @details A thread is given a shard on its first use of any accumulator, round robin, and keeps it for every accumulator. Sums are folded shard by shard, so their last bits may depend on which thread added which interval.
+/// @tparam T the end point type, float or double
+/// @tparam Fold the fold applied
+/// @author George Downing
+/// @date 17-10-2026
+template <class T, interval_fold Fold>
+class basic_interval_accumulator
+{
+public:
+    /// @brief The interval type folded
+    using interval_type = basic_interval<T>;
+
+    /// @brief Constructor for an accumulator holding the start value of its fold
+    /// @param shards the number of shards, by default twice the number of hardware threads
+    /// @throws std::invalid_argument if shards is 0
+    explicit basic_interval_accumulator(std::size_t shards = default_shards());
+
+    basic_interval_accumulator(basic_interval_accumulator const &) = delete;            ///< threads hold the shards by address, so they cannot be copied
+    basic_interval_accumulator &operator=(basic_interval_accumulator const &) = delete; ///< threads hold the shards by address, so they cannot be assigned
+
+    /// @brief Folds an interval into the shard of the calling thread
+    /// @param x the interval
+    void accumulate(interval_type const &x) noexcept;
+
+    /// @brief Folds every shard together, each read whole
+    /// @return the fold of every interval accumulated before the call, and perhaps of some accumulated during it
+    interval_type load() const noexcept;
+
+    /// @brief Returns every shard to the start value; not to be called while other threads accumulate
+    void reset() noexcept;
+
+    /// @brief Gets the number of shards
+    /// @return the number of shards
+    std::size_t shards() const noexcept { return Count; }
+
+    /// @brief Gets the default number of shards
+    /// @return twice the number of hardware threads, at least 2
+    static std::size_t default_shards() noexcept;
+
+private:
+    /// @brief One shard on its own cache line
+    struct alignas(64) shard
+    {
+        std::atomic<std::uint32_t> sequence{0}; ///< odd while a writer holds the shard
+        T lo;                                   ///< the lower end point of the fold of this shard
+        T hi;                                   ///< the upper end point of the fold of this shard
+    };
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    std::unique_ptr<shard[]> Shards; ///< The shards
+    std::size_t Count;               ///< The number of shards
+};
+
+/// @brief Sums intervals with double end points from many threads
+using interval_sum_accumulator = basic_interval_accumulator<double, interval_fold::add>;
+
+/// @brief Hull of intervals with double end points from many threads
+using interval_hull_accumulator = basic_interval_accumulator<double, interval_fold::hull>;
+
+/// @brief Intersection of intervals with double end points from many threads
+using interval_intersect_accumulator = basic_interval_accumulator<double, interval_fold::intersect>;
+
+extern template class basic_interval_accumulator<float, interval_fold::add>;        ///< compiled in atomic_interval.cpp
+extern template class basic_interval_accumulator<float, interval_fold::hull>;       ///< compiled in atomic_interval.cpp
+extern template class basic_interval_accumulator<float, interval_fold::intersect>;  ///< compiled in atomic_interval.cpp
+extern template class basic_interval_accumulator<double, interval_fold::add>;       ///< compiled in atomic_interval.cpp
+extern template class basic_interval_accumulator<double, interval_fold::hull>;      ///< compiled in atomic_interval.cpp
+extern template class basic_interval_accumulator<double, interval_fold::intersect>; ///< compiled in atomic_interval.cpp
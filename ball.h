@@ -0,0 +1,294 @@
+/// @file ball.h
+/// @brief Midpoint radius intervals, or balls, and their conversions to and from basic_interval
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares the basic_ball class, which holds a set of reals as a midpoint and a radius instead of two end points. The operators +, -, *, / compute the midpoint of the result as a plain floating point operation and bound the radius with a fixed chain of multiplies and adds, so a product costs three multiply-adds and a single overflow test where basic_interval::operator*= takes four products and three minimums and maximums each. The price is width: the radius of a product overestimates that of the exact set by at most a factor 1.5, reached when both operands have zero as an end point, and for balls away from zero by a relative rad(a) rad(b) / (|mid(a)| rad(b) + rad(a) |mid(b)|), below the smaller of the relative radii rad / |mid|.
+/// @details The radius bounds hold for every faithful rounding, so a ball encloses its exact result whatever the rounding mode of the caller and no policy is needed. Each radius adds the rounding error of the midpoint, eps |mid|, and is then moved up by a relative 16 eps and an absolute 8 times the smallest subnormal, which covers every rounding of the radius computation itself, with or without fused multiply-adds.
+/// @details The bounds are written once over math_detail lanes, so the SIMD kernels of ball_array.cpp evaluate exactly the same operations as the scalar operators here.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "interval.h"
+#include "interval_math.h"
+
+#include <bit>
+#include <limits>
+#include <type_traits>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 implementation details
+//---------------------------------------------------------------------------------------------------------------------
+
+namespace ball_detail
+{
+    using math_detail::element_t, math_detail::bits_t;
+
+    // The bounds blend lanes with the ?: operator directly rather than math_detail::select, so that the scalar operators stay
+    // constexpr; a comparison of lanes gives a bool or an integer vector and ?: accepts both. Every input is read before
+    // the first result is written, so the results may be the inputs.
+
+    /// @brief The constants of the radius bounds of one end point type
+    template <class E>
+    struct constants
+    {
+        static constexpr E eps = std::numeric_limits<E>::epsilon();          ///< relative rounding error of the midpoint
+        static constexpr E grow = E(1) + 16 * eps;                             ///< relative widening of every radius, exact
+        static constexpr E shrink = E(1) - 2 * eps;                            ///< relative narrowing of a lower bound, exact
+        static constexpr E tiny = std::numeric_limits<E>::denorm_min();        ///< absolute error of one underflowing product
+        static constexpr E limit = std::numeric_limits<E>::max() / 2;          ///< bound of |mid| + rad below which nothing overflowed
+        static constexpr E inf = std::numeric_limits<E>::infinity();           ///< the radius of the whole real line
+    };
+
+    /// @brief Absolute value of every lane by clearing the sign bit, so no comparison is made
+    template <class V>
+    [[gnu::always_inline]] constexpr V magnitude(V const &x) noexcept
+    {
+        using I = bits_t<V>;
+        return std::bit_cast<V>(std::bit_cast<I>(x) & ~std::bit_cast<I>(-V{})); // -V{} holds only sign bits
+    }
+
+    /// @brief Moves a radius computed with rounding errors above the exact value it approximates
+    /// @details Rounding toward zero or downward turns an overflow into the largest finite value instead of inf, so a midpoint or radius near the top of the range gives the whole line, the one comparison of the bounds.
+    /// @param m the rounded midpoint
+    /// @param s the radius before widening, a sum of products of non negative values rounded at most 8 times and underflowing at most 4 times
+    /// @return the rigorous radius, inf when the ball is not bounded
+    template <class V>
+    [[gnu::always_inline]] constexpr V round_radius(V const &m, V const &s) noexcept
+    {
+        using C = constants<element_t<V>>;
+        auto bounded = magnitude(m) + s < C::limit; // false also for NaN
+        return bounded ? (s + 8 * C::tiny) * C::grow : V{} + C::inf;
+    }
+
+    /// @brief Encloses the sum of two balls lane by lane
+    template <class V>
+    [[gnu::always_inline]] constexpr void add_bounds(V const &am, V const &ar, V const &bm, V const &br, V &m, V &r) noexcept
+    {
+        V c = am + bm;
+        r = round_radius<V>(c, (ar + br) + magnitude(c) * constants<element_t<V>>::eps);
+        m = c;
+    }
+
+    /// @brief Encloses the difference of two balls lane by lane
+    template <class V>
+    [[gnu::always_inline]] constexpr void sub_bounds(V const &am, V const &ar, V const &bm, V const &br, V &m, V &r) noexcept
+    {
+        V c = am - bm;
+        r = round_radius<V>(c, (ar + br) + magnitude(c) * constants<element_t<V>>::eps);
+        m = c;
+    }
+
+    /// @brief Encloses the product of two balls lane by lane
+    /// @details |xy - mid(a) mid(b)| <= |mid(a)| rad(b) + rad(a) (|mid(b)| + rad(b)) for every x in a and y in b, a fixed chain of multiply-adds with no comparison but the overflow test.
+    template <class V>
+    [[gnu::always_inline]] constexpr void mul_bounds(V const &am, V const &ar, V const &bm, V const &br, V &m, V &r) noexcept
+    {
+        V c = am * bm;
+        V s = ar * (magnitude(bm) + br);
+        s = magnitude(am) * br + s;
+        r = round_radius<V>(c, magnitude(c) * constants<element_t<V>>::eps + s);
+        m = c;
+    }
+
+    /// @brief Encloses the quotient of two balls lane by lane, the whole line when b may contain zero
+    /// @details |x / y - mid(a) / mid(b)| <= (rad(a) + |mid(a) / mid(b)| rad(b)) / (|mid(b)| - rad(b)) for every x in a and y in b.
+    template <class V>
+    [[gnu::always_inline]] constexpr void div_bounds(V const &am, V const &ar, V const &bm, V const &br, V &m, V &r) noexcept
+    {
+        using C = constants<element_t<V>>;
+        V c = am / bm;
+        V d = (magnitude(bm) - br) * C::shrink; // below |mid(b)| - rad(b), the least |y|
+        V q = magnitude(c) + C::tiny;           // covers a subnormal quotient's absolute error
+        V s = ((q * br + ar) + 2 * C::tiny) / d;
+        auto nonzero = d > 0; // false also for NaN
+        r = nonzero ? round_radius<V>(c, q * C::eps + s) : V{} + C::inf;
+        m = nonzero ? c : V{};
+    }
+
+    /// @brief Encloses [lo, hi] in a ball lane by lane, the whole line when an end point is infinite or near the top of the range
+    template <class V>
+    [[gnu::always_inline]] constexpr void from_interval(V const &lo, V const &hi, V &m, V &r) noexcept
+    {
+        using C = constants<element_t<V>>;
+        V c = lo * element_t<V>(0.5) + hi * element_t<V>(0.5); // between lo and hi in every rounding mode, without overflow
+        V dl = c - lo, dh = hi - c;
+        V d = dl > dh ? dl : dh;
+        auto bounded = magnitude(c) + d < C::limit;       // false also for NaN
+        r = bounded ? d * (1 + 4 * C::eps) : V{} + C::inf; // a difference is exact when subnormal and relatively rounded otherwise
+        m = bounded ? c : V{};
+    }
+
+    /// @brief Encloses a ball in an interval lane by lane, the whole line when the radius is infinite or NaN
+    template <class V>
+    [[gnu::always_inline]] inline void to_interval(V const &m, V const &r, V &lo, V &hi) noexcept
+    {
+        using C = constants<element_t<V>>;
+        auto point = r == 0;      // exact, no rounding to undo
+        auto bounded = r < C::inf; // false also for NaN
+        V l = point ? m : math_detail::step_down(m - r);
+        V h = point ? m : math_detail::step_up(m + r);
+        lo = bounded ? l : V{} - C::inf;
+        hi = bounded ? h : V{} + C::inf;
+    }
+} // namespace ball_detail
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 class declaration
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Midpoint radius interval arithmetic
+/// @details A ball holds every real within rad() of mid(). A radius that is infinite or NaN stands for the whole real line, which division by a ball that may contain zero returns, as does every operation on it. The class is trivially copyable and holds exactly two values, like basic_interval.
+/// @details A scalar converts implicitly to the ball of radius zero around it, so balls combine with scalars through the same operators.
+/// @tparam T the midpoint and radius type, float or double
+/// @author George Downing
+/// @date 17-10-2026
+template <class T = double>
+class basic_ball
+{
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "basic_ball holds float or double");
+
+public:
+    /// @brief The midpoint and radius type of this ball type
+    using value_type = T;
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 constructors
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Default constructor for the ball [0, 0]
+    constexpr basic_ball() noexcept = default;
+
+    /// @brief Constructor for a ball with a midpoint and a radius
+    /// @param mid the midpoint
+    /// @param rad the radius, not negative
+    constexpr basic_ball(T mid, T rad) noexcept : Mid(mid), Rad(rad) {}
+
+    /// @brief Constructor for the ball of radius zero around one value
+    /// @param val the midpoint
+    constexpr basic_ball(T val) noexcept : Mid(val) {}
+
+    /// @brief Constructor for a scalar of another type, of radius zero where T holds it exactly and otherwise the ball around the interval enclosing it
+    /// @param val the value to enclose
+    template <interval_scalar S>
+        requires(!std::is_same_v<S, T>)
+    constexpr basic_ball(S val) noexcept
+    {
+        if constexpr (rounding::exact_conversion<S, T>)
+            Mid = T(val);
+        else
+            ball_detail::from_interval(basic_interval<T>(val).min(), basic_interval<T>(val).max(), Mid, Rad);
+    }
+
+    /// @brief Constructor for the smallest ball this class computes around an interval
+    /// @details The midpoint is the rounded centre and the radius its distance to the farther end point, moved up by 4 eps; an interval with an infinite end point gives the whole line.
+    /// @param obj the interval to enclose
+    template <class R>
+    constexpr explicit basic_ball(basic_interval<T, R> const &obj) noexcept { ball_detail::from_interval(obj.min(), obj.max(), Mid, Rad); }
+
+    /// @brief Gets the ball covering the whole real line
+    /// @return the ball of midpoint 0 and radius inf
+    static constexpr basic_ball entire() noexcept { return basic_ball(T(0), std::numeric_limits<T>::infinity()); }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 access and conversion
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Gets the midpoint of the ball
+    /// @return the midpoint
+    constexpr T mid() const noexcept { return Mid; }
+
+    /// @brief Gets the radius of the ball
+    /// @return the radius
+    constexpr T rad() const noexcept { return Rad; }
+
+    /// @brief Encloses the ball in an interval, rounding both end points outward by one step
+    /// @details A ball of radius zero converts exactly, and the whole line converts to basic_interval::entire.
+    /// @tparam R the rounding policy of the interval
+    /// @return the interval [mid - rad, mid + rad], rounded outward
+    template <class R = rounding::fast>
+    basic_interval<T, R> to_interval() const noexcept
+    {
+        T lo, hi;
+        ball_detail::to_interval(Mid, Rad, lo, hi);
+        return basic_interval<T, R>(lo, hi);
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 ball operators
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Negates a ball, which is exact
+    /// @return the ball with the opposite midpoint
+    constexpr basic_ball operator-() const noexcept { return basic_ball(-Mid, Rad); }
+
+    /// @brief Adds a ball to this ball
+    /// @param obj the ball to add
+    /// @return this ball
+    constexpr basic_ball &operator+=(basic_ball const &obj) noexcept
+    {
+        ball_detail::add_bounds(Mid, Rad, obj.Mid, obj.Rad, Mid, Rad);
+        return *this;
+    }
+
+    /// @brief Subtracts a ball from this ball
+    /// @param obj the ball to subtract
+    /// @return this ball
+    constexpr basic_ball &operator-=(basic_ball const &obj) noexcept
+    {
+        ball_detail::sub_bounds(Mid, Rad, obj.Mid, obj.Rad, Mid, Rad);
+        return *this;
+    }
+
+    /// @brief Multiplies this ball by a ball
+    /// @param obj the ball to multiply by
+    /// @return this ball
+    constexpr basic_ball &operator*=(basic_ball const &obj) noexcept
+    {
+        ball_detail::mul_bounds(Mid, Rad, obj.Mid, obj.Rad, Mid, Rad);
+        return *this;
+    }
+
+    /// @brief Divides this ball by a ball
+    /// @param obj the divisor, giving the whole line when it may contain zero
+    /// @return this ball
+    constexpr basic_ball &operator/=(basic_ball const &obj) noexcept
+    {
+        ball_detail::div_bounds(Mid, Rad, obj.Mid, obj.Rad, Mid, Rad);
+        return *this;
+    }
+
+    /// @brief Adds two balls, either of which may be a scalar
+    friend constexpr basic_ball operator+(basic_ball a, basic_ball const &b) noexcept { return a += b; }
+
+    /// @brief Subtracts two balls, either of which may be a scalar
+    friend constexpr basic_ball operator-(basic_ball a, basic_ball const &b) noexcept { return a -= b; }
+
+    /// @brief Multiplies two balls, either of which may be a scalar
+    friend constexpr basic_ball operator*(basic_ball a, basic_ball const &b) noexcept { return a *= b; }
+
+    /// @brief Divides two balls, either of which may be a scalar
+    friend constexpr basic_ball operator/(basic_ball a, basic_ball const &b) noexcept { return a /= b; }
+
+private:
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    T Mid = T(0); ///< The midpoint of the ball
+    T Rad = T(0); ///< The radius of the ball
+};
+
+/// @brief Ball with double midpoint and radius
+using ball = basic_ball<double>;
+
+/// @brief Ball with float midpoint and radius
+using ballf = basic_ball<float>;
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 layout guarantees
+//---------------------------------------------------------------------------------------------------------------------
+
+static_assert(std::is_trivially_copyable_v<ball> && sizeof(ball) == 2 * sizeof(double), "ball must be exactly two doubles");
+static_assert(std::is_trivially_copyable_v<ballf> && sizeof(ballf) == 2 * sizeof(float), "ballf must be exactly two floats");
@@ -0,0 +1,342 @@
+/// @file ball_array.cpp
+/// @brief SIMD kernels of the batch ball operators and conversions
+/// @author George Downing
+/// @date 17-10-2026
+/// @details This file contains the kernels behind the batch functions of ball_array.h. Each kernel loads W midpoints and W radii per operand into vectors, evaluates the ball_detail bounds of ball.h and stores the results; elements that do not fill a whole register go through the same bounds with scalar lanes, so every element gets the midpoint and radius of the scalar operators, apart from the last bits where the AVX kernels fuse a multiply and an add that the scalar code rounds twice; both are rigorous. The kernels are compiled for SSE2, AVX2 with FMA and AVX-512 and picked with #active_simd_level.
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                    include files
+//---------------------------------------------------------------------------------------------------------------------
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BALL_ARRAY_X86 1 ///< the x86 kernels are available
+#else
+#define BALL_ARRAY_X86 0 ///< only the scalar kernels are available
+#endif
+
+#if BALL_ARRAY_X86
+// The kernels pass vector types between always_inline helpers of ball.h that are compiled without AVX. They are always
+// inlined into a function built for the right instruction set, so the ABI note GCC emits for them does not apply.
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+#include "ball_array.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+    /// @brief The batch operations, indexing each kernel table
+    enum class op
+    {
+        add,         ///< a + b
+        sub,         ///< a - b
+        mul,         ///< a * b
+        div,         ///< a / b
+        to_ball,     ///< the ball around the interval a
+        to_interval, ///< the interval around the ball a
+        count        ///< the number of operations
+    };
+
+    /// @brief Which operand, if any, is one ball shared by every element
+    enum class form
+    {
+        arrays,          ///< both operands are arrays
+        broadcast_left,  ///< a is one ball
+        broadcast_right, ///< b is one ball
+        count            ///< the number of forms
+    };
+
+    /// @brief Signature shared by every compiled kernel of one midpoint type
+    template <class T>
+    using kernel_fn = void (*)(T const *am, T const *ar, T const *bm, T const *br, T *om, T *orad, std::size_t n);
+
+    /// @brief W lanes of type T
+    template <class T, std::size_t W>
+    struct lanes
+    {
+        typedef T type __attribute__((vector_size(W * sizeof(T)))); ///< the vector type
+    };
+
+    /// @brief Applies one operation to lanes of midpoints and radii, or of lower and upper end points for the conversions
+    template <op Op, class V>
+    [[gnu::always_inline]] inline void apply(V const &am, V const &ar, V const &bm, V const &br, V &m, V &r) noexcept
+    {
+        if constexpr (Op == op::add)
+            ball_detail::add_bounds(am, ar, bm, br, m, r);
+        else if constexpr (Op == op::sub)
+            ball_detail::sub_bounds(am, ar, bm, br, m, r);
+        else if constexpr (Op == op::mul)
+            ball_detail::mul_bounds(am, ar, bm, br, m, r);
+        else if constexpr (Op == op::div)
+            ball_detail::div_bounds(am, ar, bm, br, m, r);
+        else if constexpr (Op == op::to_ball)
+            ball_detail::from_interval(am, ar, m, r);
+        else
+            ball_detail::to_interval(am, ar, m, r);
+    }
+
+    /// @brief Runs one operation over n elements, W at a time, with the remainder done with scalar lanes
+    /// @details A broadcast operand is read once from element zero of its pointers.
+    template <class T, std::size_t W, op Op, form Form>
+    [[gnu::always_inline]] inline void kernel(T const *am, T const *ar, T const *bm, T const *br, T *om, T *orad, std::size_t n) noexcept
+    {
+        constexpr bool bcast_a = Form == form::broadcast_left;  // left operand is shared
+        constexpr bool bcast_b = Form == form::broadcast_right; // right operand is shared
+        std::size_t i = 0;
+
+        if constexpr (W > 1)
+        {
+            using V = typename lanes<T, W>::type;
+            V ka_m = V{} + am[0], ka_r = V{} + ar[0]; // broadcast copies of the left operand
+            V kb_m = V{} + bm[0], kb_r = V{} + br[0]; // broadcast copies of the right operand
+            for (; i + W <= n; i += W)
+            {
+                V a_m = ka_m, a_r = ka_r, b_m = kb_m, b_r = kb_r, m, r;
+                if constexpr (!bcast_a)
+                {
+                    std::memcpy(&a_m, am + i, sizeof(V)); // load W midpoints
+                    std::memcpy(&a_r, ar + i, sizeof(V)); // load W radii
+                }
+                if constexpr (!bcast_b)
+                {
+                    std::memcpy(&b_m, bm + i, sizeof(V));
+                    std::memcpy(&b_r, br + i, sizeof(V));
+                }
+                apply<Op>(a_m, a_r, b_m, b_r, m, r);
+                std::memcpy(om + i, &m, sizeof(V));   // store W midpoints
+                std::memcpy(orad + i, &r, sizeof(V)); // store W radii
+            }
+        }
+
+        for (; i < n; ++i)
+        {
+            std::size_t ia = bcast_a ? 0 : i, ib = bcast_b ? 0 : i;
+            T m, r;
+            apply<Op>(am[ia], ar[ia], bm[ib], br[ib], m, r);
+            om[i] = m;
+            orad[i] = r;
+        }
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 per instruction set entry points
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Kernel compiled for the default target, used as the scalar fallback
+    template <class T, op Op, form Form>
+    void kernel_scalar(T const *am, T const *ar, T const *bm, T const *br, T *om, T *orad, std::size_t n) noexcept
+    {
+        kernel<T, 1, Op, Form>(am, ar, bm, br, om, orad, n);
+    }
+
+#if BALL_ARRAY_X86
+    /// @brief Kernel using 128 bit registers, the x86-64 baseline
+    template <class T, op Op, form Form>
+    __attribute__((target("sse2"))) void kernel_sse2(T const *am, T const *ar, T const *bm, T const *br, T *om, T *orad, std::size_t n) noexcept
+    {
+        kernel<T, 16 / sizeof(T), Op, Form>(am, ar, bm, br, om, orad, n);
+    }
+
+    /// @brief Kernel using 256 bit registers and fused multiply-adds
+    template <class T, op Op, form Form>
+    __attribute__((target("avx2,fma"))) void kernel_avx2(T const *am, T const *ar, T const *bm, T const *br, T *om, T *orad, std::size_t n) noexcept
+    {
+        kernel<T, 32 / sizeof(T), Op, Form>(am, ar, bm, br, om, orad, n);
+    }
+
+    /// @brief Kernel using 512 bit registers
+    template <class T, op Op, form Form>
+    __attribute__((target("avx512f"))) void kernel_avx512(T const *am, T const *ar, T const *bm, T const *br, T *om, T *orad, std::size_t n) noexcept
+    {
+        kernel<T, 64 / sizeof(T), Op, Form>(am, ar, bm, br, om, orad, n);
+    }
+#endif
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 dispatch tables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Every kernel compiled for one instruction set and midpoint type, indexed by operation and form
+    template <class T>
+    struct kernel_table
+    {
+        kernel_fn<T> fn[static_cast<int>(op::count)][static_cast<int>(form::count)]; ///< the kernels
+    };
+
+    /// @brief Builds the three forms of one operation from an entry point template
+#define BALL_ARRAY_FORMS(entry, o) {entry<T, o, form::arrays>, entry<T, o, form::broadcast_left>, entry<T, o, form::broadcast_right>}
+
+    /// @brief Builds the table of one instruction set from its entry point template
+#define BALL_ARRAY_TABLE(entry)                                                                                          \
+    kernel_table<T>                                                                                                      \
+    {                                                                                                                    \
+        {                                                                                                                \
+            BALL_ARRAY_FORMS(entry, op::add), BALL_ARRAY_FORMS(entry, op::sub), BALL_ARRAY_FORMS(entry, op::mul),        \
+                BALL_ARRAY_FORMS(entry, op::div), BALL_ARRAY_FORMS(entry, op::to_ball), BALL_ARRAY_FORMS(entry, op::to_interval), \
+        }                                                                                                                \
+    }
+
+    template <class T>
+    kernel_table<T> const scalar_table = BALL_ARRAY_TABLE(kernel_scalar); ///< the scalar fallback
+#if BALL_ARRAY_X86
+    template <class T>
+    kernel_table<T> const sse2_table = BALL_ARRAY_TABLE(kernel_sse2); ///< the SSE2 kernels
+    template <class T>
+    kernel_table<T> const avx2_table = BALL_ARRAY_TABLE(kernel_avx2); ///< the AVX2 kernels
+    template <class T>
+    kernel_table<T> const avx512_table = BALL_ARRAY_TABLE(kernel_avx512); ///< the AVX-512 kernels
+#endif
+#undef BALL_ARRAY_TABLE
+#undef BALL_ARRAY_FORMS
+
+    /// @brief Gets the table of kernels for the active instruction set
+    /// @return the active table
+    template <class T>
+    kernel_table<T> const &active_table() noexcept
+    {
+        switch (active_simd_level())
+        {
+#if BALL_ARRAY_X86
+        case simd_level::avx512:
+            return avx512_table<T>;
+        case simd_level::avx2:
+            if (__builtin_cpu_supports("fma"))
+                return avx2_table<T>;
+            [[fallthrough]]; // AVX2 without FMA runs the SSE2 kernels
+        case simd_level::sse2:
+            return sse2_table<T>;
+#endif
+        default:
+            return scalar_table<T>;
+        }
+    }
+
+    /// @brief Sizes the result and runs the selected kernel
+    /// @param o the operation
+    /// @param f the form
+    /// @param n the number of elements
+    template <class T>
+    void run(op o, form f, T const *am, T const *ar, T const *bm, T const *br, T *om, T *orad, std::size_t n)
+    {
+        if (n != 0)
+            active_table<T>().fn[static_cast<int>(o)][static_cast<int>(f)](am, ar, bm, br, om, orad, n);
+    }
+
+    /// @brief Runs an operation on two arrays
+    template <class T>
+    void run(op o, basic_ball_array<T> const &a, basic_ball_array<T> const &b, basic_ball_array<T> &out)
+    {
+        if (a.size() != b.size())
+            throw std::invalid_argument("ball_array: operands have different sizes");
+        out.resize(a.size()); // no-op when out is one of the operands
+        run(o, form::arrays, a.mid(), a.rad(), b.mid(), b.rad(), out.mid(), out.rad(), a.size());
+    }
+
+    /// @brief Runs an operation on an array and a shared right operand
+    template <class T>
+    void run(op o, basic_ball_array<T> const &a, basic_ball<T> const &b, basic_ball_array<T> &out)
+    {
+        T bm = b.mid(), br = b.rad(); // read before out may be resized
+        out.resize(a.size());
+        run(o, form::broadcast_right, a.mid(), a.rad(), &bm, &br, out.mid(), out.rad(), a.size());
+    }
+
+    /// @brief Runs an operation on a shared left operand and an array
+    template <class T>
+    void run(op o, basic_ball<T> const &a, basic_ball_array<T> const &b, basic_ball_array<T> &out)
+    {
+        T am = a.mid(), ar = a.rad(); // read before out may be resized
+        out.resize(b.size());
+        run(o, form::broadcast_left, &am, &ar, b.mid(), b.rad(), out.mid(), out.rad(), b.size());
+    }
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 batch ball operators
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details Each element is computed as by basic_ball::operator+=.
+template <class T>
+void add(basic_ball_array<T> const &a, basic_ball_array<T> const &b, basic_ball_array<T> &out) { run(op::add, a, b, out); }
+
+template <class T>
+void add(basic_ball_array<T> const &a, std::type_identity_t<basic_ball<T>> const &b, basic_ball_array<T> &out) { run(op::add, a, b, out); }
+
+template <class T>
+void add(std::type_identity_t<basic_ball<T>> const &a, basic_ball_array<T> const &b, basic_ball_array<T> &out) { run(op::add, a, b, out); }
+
+/// @details Each element is computed as by basic_ball::operator-=.
+template <class T>
+void sub(basic_ball_array<T> const &a, basic_ball_array<T> const &b, basic_ball_array<T> &out) { run(op::sub, a, b, out); }
+
+template <class T>
+void sub(basic_ball_array<T> const &a, std::type_identity_t<basic_ball<T>> const &b, basic_ball_array<T> &out) { run(op::sub, a, b, out); }
+
+template <class T>
+void sub(std::type_identity_t<basic_ball<T>> const &a, basic_ball_array<T> const &b, basic_ball_array<T> &out) { run(op::sub, a, b, out); }
+
+/// @details Each element is computed as by basic_ball::operator*=, whose only comparison in the SIMD kernels is the overflow test.
+template <class T>
+void mul(basic_ball_array<T> const &a, basic_ball_array<T> const &b, basic_ball_array<T> &out) { run(op::mul, a, b, out); }
+
+template <class T>
+void mul(basic_ball_array<T> const &a, std::type_identity_t<basic_ball<T>> const &b, basic_ball_array<T> &out) { run(op::mul, a, b, out); }
+
+template <class T>
+void mul(std::type_identity_t<basic_ball<T>> const &a, basic_ball_array<T> const &b, basic_ball_array<T> &out) { run(op::mul, a, b, out); }
+
+/// @details Each element is computed as by basic_ball::operator/=.
+template <class T>
+void div(basic_ball_array<T> const &a, basic_ball_array<T> const &b, basic_ball_array<T> &out) { run(op::div, a, b, out); }
+
+template <class T>
+void div(basic_ball_array<T> const &a, std::type_identity_t<basic_ball<T>> const &b, basic_ball_array<T> &out) { run(op::div, a, b, out); }
+
+template <class T>
+void div(std::type_identity_t<basic_ball<T>> const &a, basic_ball_array<T> const &b, basic_ball_array<T> &out) { run(op::div, a, b, out); }
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 batch conversions
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details The end point columns are read as the two operands of the kernel, so no interval is formed.
+template <class T>
+void to_ball(basic_interval_array<T> const &a, basic_ball_array<T> &out)
+{
+    out.resize(a.size());
+    run(op::to_ball, form::arrays, a.lo(), a.hi(), a.lo(), a.hi(), out.mid(), out.rad(), a.size());
+}
+
+template <class T>
+void to_interval(basic_ball_array<T> const &a, basic_interval_array<T> &out)
+{
+    out.resize(a.size());
+    run(op::to_interval, form::arrays, a.mid(), a.rad(), a.mid(), a.rad(), out.lo(), out.hi(), a.size());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 explicit instantiations
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Instantiates the three forms of one batch operator for one midpoint type
+#define BALL_ARRAY_INSTANTIATE(name, T)                                                                                   \
+    template void name(basic_ball_array<T> const &, basic_ball_array<T> const &, basic_ball_array<T> &);                 \
+    template void name(basic_ball_array<T> const &, std::type_identity_t<basic_ball<T>> const &, basic_ball_array<T> &); \
+    template void name(std::type_identity_t<basic_ball<T>> const &, basic_ball_array<T> const &, basic_ball_array<T> &);
+
+BALL_ARRAY_INSTANTIATE(add, float)
+BALL_ARRAY_INSTANTIATE(sub, float)
+BALL_ARRAY_INSTANTIATE(mul, float)
+BALL_ARRAY_INSTANTIATE(div, float)
+BALL_ARRAY_INSTANTIATE(add, double)
+BALL_ARRAY_INSTANTIATE(sub, double)
+BALL_ARRAY_INSTANTIATE(mul, double)
+BALL_ARRAY_INSTANTIATE(div, double)
+#undef BALL_ARRAY_INSTANTIATE
+
+template void to_ball(basic_interval_array<float> const &, basic_ball_array<float> &);
+template void to_ball(basic_interval_array<double> const &, basic_ball_array<double> &);
+template void to_interval(basic_ball_array<float> const &, basic_interval_array<float> &);
+template void to_interval(basic_ball_array<double> const &, basic_interval_array<double> &);
@@ -0,0 +1,233 @@
+/// @file ball_array.h
+/// @brief Structure of arrays container for batches of balls and its batch operators
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares the basic_ball_array class, the batch operators +, -, *, / on whole arrays of balls and the batch conversions between ball arrays and interval arrays, so a program can keep its data as intervals and convert to balls for the kernels where multiplications dominate.
+/// @details The kernels in ball_array.cpp evaluate the bounds of ball.h on whole registers and give the midpoints and radii of the scalar operators, up to fused multiply-adds in the AVX kernels. Like the interval kernels they are compiled for SSE2, AVX2 and AVX-512 and picked with #active_simd_level; the AVX2 kernels also use FMA, since a ball product is a chain of multiply-adds.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "ball.h"
+#include "interval_array.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 class declaration
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief An array of balls stored as separate midpoint and radius columns
+/// @details The columns live in a basic_interval_array used as aligned storage, the midpoints in its lower end point column and the radii in its upper one, so they share its alignment, padding and first touch behaviour.
+/// @tparam T the midpoint and radius type, float or double
+/// @author George Downing
+/// @date 17-10-2026
+template <class T>
+class basic_ball_array
+{
+public:
+    /// @brief The midpoint and radius type of the columns
+    using value_type = T;
+
+    /// @brief The ball type read from and written to the array
+    using ball_type = basic_ball<T>;
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 constructors
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Default constructor for an empty array
+    basic_ball_array() noexcept = default;
+
+    /// @brief Constructor for an array of n balls [0, 0]
+    /// @param n the number of balls
+    explicit basic_ball_array(std::size_t n) : Data(n) {}
+
+    /// @brief Constructor for an array of n copies of one ball
+    /// @param n the number of balls
+    /// @param fill the ball to copy into every element
+    basic_ball_array(std::size_t n, ball_type const &fill) : Data(n, basic_interval<T>(fill.mid(), fill.rad())) {}
+
+    /// @brief Makes an array of n balls whose midpoints and radii are left unwritten
+    /// @details Every element must be written before it is read.
+    /// @param n the number of balls
+    /// @return the array
+    static basic_ball_array for_overwrite(std::size_t n) { return basic_ball_array(basic_interval_array<T>::for_overwrite(n)); }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 element access
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Gets the number of balls in the array
+    /// @return the number of balls
+    std::size_t size() const noexcept { return Data.size(); }
+
+    /// @brief Checks whether the array holds no balls
+    /// @return true if the array is empty
+    bool empty() const noexcept { return Data.empty(); }
+
+    /// @brief Gets the column of midpoints
+    /// @return a pointer to size() aligned midpoints
+    T *mid() noexcept { return Data.lo(); }
+
+    /// @brief Gets the column of midpoints
+    /// @return a pointer to size() aligned midpoints
+    T const *mid() const noexcept { return Data.lo(); }
+
+    /// @brief Gets the column of radii
+    /// @return a pointer to size() aligned radii
+    T *rad() noexcept { return Data.hi(); }
+
+    /// @brief Gets the column of radii
+    /// @return a pointer to size() aligned radii
+    T const *rad() const noexcept { return Data.hi(); }
+
+    /// @brief Gets one ball of the array
+    /// @param i the index of the ball
+    /// @return the ball at index i
+    ball_type operator[](std::size_t i) const noexcept { return ball_type(mid()[i], rad()[i]); }
+
+    /// @brief Sets one ball of the array
+    /// @param i the index of the ball
+    /// @param val the ball to store at index i
+    void set(std::size_t i, ball_type const &val) noexcept
+    {
+        mid()[i] = val.mid(); // store the midpoint
+        rad()[i] = val.rad(); // store the radius
+    }
+
+    /// @brief Changes the number of balls, keeping the leading elements and filling new ones with [0, 0]
+    /// @param n the new number of balls
+    void resize(std::size_t n) { Data.resize(n); }
+
+private:
+    /// @brief Constructor for for_overwrite, takes storage of the right size
+    /// @param data the columns
+    explicit basic_ball_array(basic_interval_array<T> &&data) noexcept : Data(std::move(data)) {}
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    basic_interval_array<T> Data; ///< The midpoints as lower end points and the radii as upper end points
+};
+
+/// @brief Array of balls with double midpoints and radii
+using ball_array = basic_ball_array<double>;
+
+/// @brief Array of balls with float midpoints and radii, twice as many per register as #ball_array
+using ball_arrayf = basic_ball_array<float>;
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 batch ball operators
+//---------------------------------------------------------------------------------------------------------------------
+
+// The midpoint type is deduced from the array operands only, so a scalar converts implicitly to a ball of radius zero.
+// Each operator is compiled in ball_array.cpp for float and double.
+
+/// @brief Adds two arrays of balls element by element
+/// @param a the left operands
+/// @param b the right operands, the same size as a
+/// @param out the sums, resized to the size of a; may be a or b
+/// @throws std::invalid_argument if a and b differ in size
+template <class T>
+void add(basic_ball_array<T> const &a, basic_ball_array<T> const &b, basic_ball_array<T> &out);
+
+/// @brief Adds one ball to every element of an array
+/// @param a the left operands
+/// @param b the right operand shared by every element
+/// @param out the sums, resized to the size of a; may be a
+template <class T>
+void add(basic_ball_array<T> const &a, std::type_identity_t<basic_ball<T>> const &b, basic_ball_array<T> &out);
+
+/// @brief Adds every element of an array to one ball
+/// @param a the left operand shared by every element
+/// @param b the right operands
+/// @param out the sums, resized to the size of b; may be b
+template <class T>
+void add(std::type_identity_t<basic_ball<T>> const &a, basic_ball_array<T> const &b, basic_ball_array<T> &out);
+
+/// @brief Subtracts two arrays of balls element by element
+/// @param a the left operands
+/// @param b the right operands, the same size as a
+/// @param out the differences, resized to the size of a; may be a or b
+/// @throws std::invalid_argument if a and b differ in size
+template <class T>
+void sub(basic_ball_array<T> const &a, basic_ball_array<T> const &b, basic_ball_array<T> &out);
+
+/// @brief Subtracts one ball from every element of an array
+/// @param a the left operands
+/// @param b the right operand shared by every element
+/// @param out the differences, resized to the size of a; may be a
+template <class T>
+void sub(basic_ball_array<T> const &a, std::type_identity_t<basic_ball<T>> const &b, basic_ball_array<T> &out);
+
+/// @brief Subtracts every element of an array from one ball
+/// @param a the left operand shared by every element
+/// @param b the right operands
+/// @param out the differences, resized to the size of b; may be b
+template <class T>
+void sub(std::type_identity_t<basic_ball<T>> const &a, basic_ball_array<T> const &b, basic_ball_array<T> &out);
+
+/// @brief Multiplies two arrays of balls element by element
+/// @param a the left operands
+/// @param b the right operands, the same size as a
+/// @param out the products, resized to the size of a; may be a or b
+/// @throws std::invalid_argument if a and b differ in size
+template <class T>
+void mul(basic_ball_array<T> const &a, basic_ball_array<T> const &b, basic_ball_array<T> &out);
+
+/// @brief Multiplies every element of an array by one ball
+/// @param a the left operands
+/// @param b the right operand shared by every element
+/// @param out the products, resized to the size of a; may be a
+template <class T>
+void mul(basic_ball_array<T> const &a, std::type_identity_t<basic_ball<T>> const &b, basic_ball_array<T> &out);
+
+/// @brief Multiplies one ball by every element of an array
+/// @param a the left operand shared by every element
+/// @param b the right operands
+/// @param out the products, resized to the size of b; may be b
+template <class T>
+void mul(std::type_identity_t<basic_ball<T>> const &a, basic_ball_array<T> const &b, basic_ball_array<T> &out);
+
+/// @brief Divides two arrays of balls element by element
+/// @param a the dividends
+/// @param b the divisors, the same size as a
+/// @param out the quotients, resized to the size of a; may be a or b
+/// @throws std::invalid_argument if a and b differ in size
+template <class T>
+void div(basic_ball_array<T> const &a, basic_ball_array<T> const &b, basic_ball_array<T> &out);
+
+/// @brief Divides every element of an array by one ball
+/// @param a the dividends
+/// @param b the divisor shared by every element
+/// @param out the quotients, resized to the size of a; may be a
+template <class T>
+void div(basic_ball_array<T> const &a, std::type_identity_t<basic_ball<T>> const &b, basic_ball_array<T> &out);
+
+/// @brief Divides one ball by every element of an array
+/// @param a the dividend shared by every element
+/// @param b the divisors
+/// @param out the quotients, resized to the size of b; may be b
+template <class T>
+void div(std::type_identity_t<basic_ball<T>> const &a, basic_ball_array<T> const &b, basic_ball_array<T> &out);
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 batch conversions
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Encloses every interval of an array in a ball, as the ball constructor from an interval does
+/// @param a the intervals
+/// @param out the balls, resized to the size of a
+template <class T>
+void to_ball(basic_interval_array<T> const &a, basic_ball_array<T> &out);
+
+/// @brief Encloses every ball of an array in an interval, as basic_ball::to_interval does
+/// @param a the balls
+/// @param out the intervals, resized to the size of a
+template <class T>
+void to_interval(basic_ball_array<T> const &a, basic_interval_array<T> &out);
@@ -0,0 +1,413 @@
+/// @file dd_interval_array.cpp
+/// @brief SIMD kernels of the batch double-double interval operators
+/// @author George Downing
+/// @date 17-10-2026
+/// @details This file contains the kernels behind the batch functions of dd_interval_array.h. Each kernel loads W high and W low parts of every end point of each operand into vectors, applies the dd_detail algorithms of double_double.h and the end point selection of the scalar operators of interval.h lane by lane, steps the results outward with dd_detail::step_up and stores them; elements that do not fill a whole register go through the same code with scalar lanes. Every element therefore gets the end points of the scalar #dd_interval operators exactly.
+/// @details A double-double product is a TwoProd and two fused multiply-adds, so there is no SSE2 kernel: the AVX2 kernels need FMA and the scalar kernels run without it.
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                    include files
+//---------------------------------------------------------------------------------------------------------------------
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DD_ARRAY_X86 1 ///< the x86 kernels are available
+#else
+#define DD_ARRAY_X86 0 ///< only the scalar kernels are available
+#endif
+
+#if DD_ARRAY_X86
+// The kernels pass vector types between always_inline helpers of double_double.h that are compiled without AVX. They
+// are always inlined into a function built for the right instruction set, so the ABI note GCC emits does not apply.
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+#include "dd_interval_array.h"
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+    /// @brief The batch operations, indexing each kernel table
+    enum class op
+    {
+        add,  ///< a + b
+        sub,  ///< a - b
+        mul,  ///< a * b
+        div,  ///< a / b
+        count ///< the number of operations
+    };
+
+    /// @brief Which operand, if any, is one interval shared by every element
+    enum class form
+    {
+        arrays,          ///< both operands are arrays
+        broadcast_left,  ///< a is one interval
+        broadcast_right, ///< b is one interval
+        count            ///< the number of forms
+    };
+
+    /// @brief The four columns of one operand or result
+    template <class P>
+    struct columns
+    {
+        P min_hi; ///< the high parts of the lower end points
+        P min_lo; ///< the low parts of the lower end points
+        P max_hi; ///< the high parts of the upper end points
+        P max_lo; ///< the low parts of the upper end points
+    };
+
+    using in_cols = columns<double const *>; ///< the columns of an operand
+    using out_cols = columns<double *>;      ///< the columns of a result
+
+    /// @brief Signature shared by every compiled kernel
+    using kernel_fn = void (*)(in_cols a, in_cols b, out_cols out, std::size_t n);
+
+    /// @brief W lanes of doubles
+    template <std::size_t W>
+    struct lanes
+    {
+        typedef double type __attribute__((vector_size(W * sizeof(double)))); ///< the vector type
+    };
+
+    /// @brief A double-double in each lane
+    template <class V>
+    struct dd
+    {
+        V hi; ///< the high parts
+        V lo; ///< the low parts
+    };
+
+    /// @brief Picks a where the mask is set and b elsewhere
+    template <class M, class V>
+    [[gnu::always_inline]] inline dd<V> pick(M const &m, dd<V> const &a, dd<V> const &b) noexcept
+    {
+        return {m ? a.hi : b.hi, m ? a.lo : b.lo};
+    }
+
+    // The double-double comparisons pick by the low parts where the high parts are equal and by the high parts elsewhere,
+    // which gives the operator<=> of double_double. Each mask feeds ?: straight from one comparison: for masks combined
+    // with | and & GCC builds 512 bit integer masks lane by lane in scalar code.
+
+    /// @brief The smaller of two double-doubles as basic_interval::min2 picks it, a where they are equal or unordered
+    template <class V>
+    [[gnu::always_inline]] inline dd<V> min2(dd<V> const &a, dd<V> const &b) noexcept
+    {
+        return pick(a.hi == b.hi, pick(b.lo < a.lo, b, a), pick(b.hi < a.hi, b, a));
+    }
+
+    /// @brief The larger of two double-doubles as basic_interval::max2 picks it, a where they are equal or unordered
+    template <class V>
+    [[gnu::always_inline]] inline dd<V> max2(dd<V> const &a, dd<V> const &b) noexcept
+    {
+        return pick(a.hi == b.hi, pick(b.lo > a.lo, b, a), pick(b.hi > a.hi, b, a));
+    }
+
+    template <class V>
+    [[gnu::always_inline]] inline dd<V> operator+(dd<V> const &a, dd<V> const &b) noexcept
+    {
+        dd<V> r;
+        dd_detail::add(a.hi, a.lo, b.hi, b.lo, r.hi, r.lo);
+        return r;
+    }
+
+    template <class V>
+    [[gnu::always_inline]] inline dd<V> operator-(dd<V> const &a, dd<V> const &b) noexcept
+    {
+        dd<V> r;
+        dd_detail::add(a.hi, a.lo, -b.hi, -b.lo, r.hi, r.lo);
+        return r;
+    }
+
+    template <class V>
+    [[gnu::always_inline]] inline dd<V> operator*(dd<V> const &a, dd<V> const &b) noexcept
+    {
+        dd<V> r;
+        dd_detail::mul(a.hi, a.lo, b.hi, b.lo, r.hi, r.lo);
+        return r;
+    }
+
+    template <class V>
+    [[gnu::always_inline]] inline dd<V> operator/(dd<V> const &a, dd<V> const &b) noexcept
+    {
+        dd<V> r;
+        dd_detail::div(a.hi, a.lo, b.hi, b.lo, r.hi, r.lo);
+        return r;
+    }
+
+    /// @brief Hides lanes from the optimiser, so that the selects computing them are not merged into later ones
+    /// @details GCC folds a ?: whose operand is another ?: into one select on the combined masks, and for 512 bit vectors
+    /// it then compares lane by lane in scalar code. The barrier costs nothing: the value stays in its register.
+    template <class V>
+    [[gnu::always_inline]] inline void keep(dd<V> &x) noexcept
+    {
+#if DD_ARRAY_X86
+        asm("" : "+v"(x.hi), "+v"(x.lo));
+#else
+        (void)x;
+#endif
+    }
+
+    /// @brief Rounds a lower end point outward, as rounding::widen::down does
+    template <class V>
+    [[gnu::always_inline]] inline dd<V> down(dd<V> const &x) noexcept
+    {
+        dd<V> r;
+        dd_detail::step_up(-x.hi, -x.lo, r.hi, r.lo); // next_down(x) is -next_up(-x)
+        return {-r.hi, -r.lo};
+    }
+
+    /// @brief Rounds an upper end point outward, as rounding::widen::up does
+    template <class V>
+    [[gnu::always_inline]] inline dd<V> up(dd<V> const &x) noexcept
+    {
+        dd<V> r;
+        dd_detail::step_up(x.hi, x.lo, r.hi, r.lo);
+        return r;
+    }
+
+    /// @brief Applies one operation to lanes of intervals, following the scalar operator of interval.h step by step
+    template <op Op, class V>
+    [[gnu::always_inline]] inline void apply(dd<V> const &a0, dd<V> const &a1, dd<V> const &b0, dd<V> const &b1, dd<V> &r0, dd<V> &r1) noexcept
+    {
+        if constexpr (Op == op::add)
+        {
+            r0 = down(a0 + b0);
+            r1 = up(a1 + b1);
+        }
+        else if constexpr (Op == op::sub)
+        {
+            r0 = down(a0 - b1);
+            r1 = up(a1 - b0);
+        }
+        else if constexpr (Op == op::mul)
+        {
+            dd<V> p = a0 * b0, q = a0 * b1, s = a1 * b0, t = a1 * b1;
+            r0 = down(min2(min2(p, q), min2(s, t)));
+            r1 = up(max2(max2(p, q), max2(s, t)));
+        }
+        else
+        {
+            V zero = V{} + 0.0;
+            // Each mask comes from one comparison, for the reason given at min2. The operator picks each divisor by the
+            // sign of b and then of its numerator; here the numerator is picked first and its sign alone picks the divisor,
+            // which differs only for a zero numerator, where both divisors have the sign of b and give the same zero.
+            auto b_pos = b0.hi > zero;        // the divisor is strictly positive
+            dd<V> lo_n = pick(b_pos, a0, a1); // numerator of the min value
+            dd<V> hi_n = pick(b_pos, a1, a0); // numerator of the max value
+            dd<V> lo_d = pick(lo_n.hi >= zero, b1, b0);
+            dd<V> hi_d = pick(hi_n.hi <= zero, b1, b0);
+            dd<V> lo = down(lo_n / lo_d), hi = up(hi_n / hi_d);
+            keep(lo); // their zero low part selects stay apart from the selects below
+            keep(hi);
+
+            // the divisor excludes zero where it is positive, or else where its negated upper end point is
+            V side = b_pos ? b0.hi : -b1.hi;
+            dd<V> inf = {V{} + std::numeric_limits<double>::infinity(), zero};
+            r0 = pick(side > zero, lo, dd<V>{-inf.hi, -zero}); // -infinity() of double_double where the divisor contains zero
+            r1 = pick(side > zero, hi, inf);
+        }
+    }
+
+    /// @brief Loads one operand, from element i of its columns or from element zero when it is shared
+    template <class V, bool Shared>
+    [[gnu::always_inline]] inline void load(in_cols c, std::size_t i, dd<V> &x0, dd<V> &x1) noexcept
+    {
+        if constexpr (Shared)
+        {
+            x0 = {V{} + c.min_hi[0], V{} + c.min_lo[0]};
+            x1 = {V{} + c.max_hi[0], V{} + c.max_lo[0]};
+        }
+        else
+        {
+            std::memcpy(&x0.hi, c.min_hi + i, sizeof(V)); // load W of each part
+            std::memcpy(&x0.lo, c.min_lo + i, sizeof(V));
+            std::memcpy(&x1.hi, c.max_hi + i, sizeof(V));
+            std::memcpy(&x1.lo, c.max_lo + i, sizeof(V));
+        }
+    }
+
+    /// @brief Runs one operation over n elements, W at a time, with the remainder done with scalar lanes
+    template <std::size_t W, op Op, form Form>
+    [[gnu::always_inline]] inline void kernel(in_cols a, in_cols b, out_cols out, std::size_t n) noexcept
+    {
+        constexpr bool bcast_a = Form == form::broadcast_left;  // left operand is shared
+        constexpr bool bcast_b = Form == form::broadcast_right; // right operand is shared
+        std::size_t i = 0;
+
+        if constexpr (W > 1)
+        {
+            using V = typename lanes<W>::type;
+            for (; i + W <= n; i += W)
+            {
+                dd<V> a0, a1, b0, b1, r0, r1;
+                load<V, bcast_a>(a, i, a0, a1);
+                load<V, bcast_b>(b, i, b0, b1);
+                apply<Op>(a0, a1, b0, b1, r0, r1);
+                std::memcpy(out.min_hi + i, &r0.hi, sizeof(V)); // store W of each part
+                std::memcpy(out.min_lo + i, &r0.lo, sizeof(V));
+                std::memcpy(out.max_hi + i, &r1.hi, sizeof(V));
+                std::memcpy(out.max_lo + i, &r1.lo, sizeof(V));
+            }
+        }
+
+        for (; i < n; ++i)
+        {
+            dd<double> a0, a1, b0, b1, r0, r1;
+            load<double, bcast_a>(a, i, a0, a1);
+            load<double, bcast_b>(b, i, b0, b1);
+            apply<Op>(a0, a1, b0, b1, r0, r1);
+            out.min_hi[i] = r0.hi;
+            out.min_lo[i] = r0.lo;
+            out.max_hi[i] = r1.hi;
+            out.max_lo[i] = r1.lo;
+        }
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 per instruction set entry points
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Kernel compiled for the default target, used as the scalar fallback
+    template <op Op, form Form>
+    void kernel_scalar(in_cols a, in_cols b, out_cols out, std::size_t n) noexcept
+    {
+        kernel<1, Op, Form>(a, b, out, n);
+    }
+
+#if DD_ARRAY_X86
+    /// @brief Kernel using 256 bit registers and fused multiply-adds
+    template <op Op, form Form>
+    __attribute__((target("avx2,fma"))) void kernel_avx2(in_cols a, in_cols b, out_cols out, std::size_t n) noexcept
+    {
+        kernel<4, Op, Form>(a, b, out, n);
+    }
+
+    /// @brief Kernel using 512 bit registers
+    template <op Op, form Form>
+    __attribute__((target("avx512f"))) void kernel_avx512(in_cols a, in_cols b, out_cols out, std::size_t n) noexcept
+    {
+        kernel<8, Op, Form>(a, b, out, n);
+    }
+#endif
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 dispatch tables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Every kernel compiled for one instruction set, indexed by operation and form
+    struct kernel_table
+    {
+        kernel_fn fn[static_cast<int>(op::count)][static_cast<int>(form::count)]; ///< the kernels
+    };
+
+    /// @brief Builds the three forms of one operation from an entry point template
+#define DD_ARRAY_FORMS(entry, o) {entry<o, form::arrays>, entry<o, form::broadcast_left>, entry<o, form::broadcast_right>}
+
+    /// @brief Builds the table of one instruction set from its entry point template
+#define DD_ARRAY_TABLE(entry)                                                                                                      \
+    kernel_table                                                                                                                   \
+    {                                                                                                                              \
+        {                                                                                                                          \
+            DD_ARRAY_FORMS(entry, op::add), DD_ARRAY_FORMS(entry, op::sub), DD_ARRAY_FORMS(entry, op::mul), DD_ARRAY_FORMS(entry, op::div), \
+        }                                                                                                                          \
+    }
+
+    kernel_table const scalar_table = DD_ARRAY_TABLE(kernel_scalar); ///< the scalar fallback
+#if DD_ARRAY_X86
+    kernel_table const avx2_table = DD_ARRAY_TABLE(kernel_avx2);     ///< the AVX2 kernels
+    kernel_table const avx512_table = DD_ARRAY_TABLE(kernel_avx512); ///< the AVX-512 kernels
+#endif
+#undef DD_ARRAY_TABLE
+#undef DD_ARRAY_FORMS
+
+    /// @brief Gets the table of kernels for the active instruction set
+    /// @return the active table
+    kernel_table const &active_table() noexcept
+    {
+        switch (active_simd_level())
+        {
+#if DD_ARRAY_X86
+        case simd_level::avx512:
+            return avx512_table;
+        case simd_level::avx2:
+            if (__builtin_cpu_supports("fma"))
+                return avx2_table;
+            return scalar_table; // AVX2 without FMA would fuse each product lane by lane in software
+#endif
+        default:
+            return scalar_table;
+        }
+    }
+
+    /// @brief Gets the columns of an operand array
+    in_cols cols(dd_interval_array const &a) noexcept { return {a.min_hi(), a.min_lo(), a.max_hi(), a.max_lo()}; }
+
+    /// @brief Gets the columns of a result array
+    out_cols cols(dd_interval_array &a) noexcept { return {a.min_hi(), a.min_lo(), a.max_hi(), a.max_lo()}; }
+
+    /// @brief Runs the selected kernel
+    void run(op o, form f, in_cols a, in_cols b, out_cols out, std::size_t n)
+    {
+        if (n != 0)
+            active_table().fn[static_cast<int>(o)][static_cast<int>(f)](a, b, out, n);
+    }
+
+    /// @brief Runs an operation on two arrays
+    void run(op o, dd_interval_array const &a, dd_interval_array const &b, dd_interval_array &out)
+    {
+        if (a.size() != b.size())
+            throw std::invalid_argument("dd_interval_array: operands have different sizes");
+        out.resize(a.size()); // no-op when out is one of the operands
+        run(o, form::arrays, cols(a), cols(b), cols(out), a.size());
+    }
+
+    /// @brief Runs an operation on an array and a shared right operand
+    void run(op o, dd_interval_array const &a, dd_interval const &b, dd_interval_array &out)
+    {
+        double p[4] = {b.min().hi(), b.min().lo(), b.max().hi(), b.max().lo()}; // read before out may be resized
+        out.resize(a.size());
+        run(o, form::broadcast_right, cols(a), in_cols{p, p + 1, p + 2, p + 3}, cols(out), a.size());
+    }
+
+    /// @brief Runs an operation on a shared left operand and an array
+    void run(op o, dd_interval const &a, dd_interval_array const &b, dd_interval_array &out)
+    {
+        double p[4] = {a.min().hi(), a.min().lo(), a.max().hi(), a.max().lo()}; // read before out may be resized
+        out.resize(b.size());
+        run(o, form::broadcast_left, in_cols{p, p + 1, p + 2, p + 3}, cols(b), cols(out), b.size());
+    }
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 batch interval operators
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details Each element is computed as by basic_interval::operator+= of #dd_interval.
+void add(dd_interval_array const &a, dd_interval_array const &b, dd_interval_array &out) { run(op::add, a, b, out); }
+
+void add(dd_interval_array const &a, dd_interval const &b, dd_interval_array &out) { run(op::add, a, b, out); }
+
+void add(dd_interval const &a, dd_interval_array const &b, dd_interval_array &out) { run(op::add, a, b, out); }
+
+/// @details Each element is computed as by basic_interval::operator-= of #dd_interval.
+void sub(dd_interval_array const &a, dd_interval_array const &b, dd_interval_array &out) { run(op::sub, a, b, out); }
+
+void sub(dd_interval_array const &a, dd_interval const &b, dd_interval_array &out) { run(op::sub, a, b, out); }
+
+void sub(dd_interval const &a, dd_interval_array const &b, dd_interval_array &out) { run(op::sub, a, b, out); }
+
+/// @details Each element is computed as by basic_interval::operator*= of #dd_interval, the four products reduced by comparisons of whole double-doubles.
+void mul(dd_interval_array const &a, dd_interval_array const &b, dd_interval_array &out) { run(op::mul, a, b, out); }
+
+void mul(dd_interval_array const &a, dd_interval const &b, dd_interval_array &out) { run(op::mul, a, b, out); }
+
+void mul(dd_interval const &a, dd_interval_array const &b, dd_interval_array &out) { run(op::mul, a, b, out); }
+
+/// @details Each element is computed as by basic_interval::operator/= of #dd_interval.
+void div(dd_interval_array const &a, dd_interval_array const &b, dd_interval_array &out) { run(op::div, a, b, out); }
+
+void div(dd_interval_array const &a, dd_interval const &b, dd_interval_array &out) { run(op::div, a, b, out); }
+
+void div(dd_interval const &a, dd_interval_array const &b, dd_interval_array &out) { run(op::div, a, b, out); }
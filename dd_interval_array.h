@@ -0,0 +1,220 @@
+/// @file dd_interval_array.h
+/// @brief Structure of arrays container for batches of double-double intervals and its batch operators
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares the dd_interval_array class and the batch operators +, -, *, / on whole arrays of #dd_interval. Every end point is split into its high and low double, so an array is four columns of doubles and a kernel loads a whole register of high parts and one of low parts at a time.
+/// @details The kernels in dd_interval_array.cpp evaluate the error-free transformations of double_double.h on whole registers and give exactly the end points of the scalar operators of #dd_interval. Every product needs a fused multiply-add, so they are compiled for AVX2 with FMA and for AVX-512 and picked with #active_simd_level; without FMA the scalar kernels run.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "double_double.h"
+#include "interval_array.h"
+
+#include <cstddef>
+#include <utility>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 class declaration
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief An array of double-double intervals stored as four columns of doubles
+/// @details The columns live in two basic_interval_array<double> used as aligned storage, one holding the high parts of the lower and upper end points and the other their low parts, so they share its alignment, padding and first touch behaviour.
+/// @author George Downing
+/// @date 17-10-2026
+class dd_interval_array
+{
+public:
+    /// @brief The interval type read from and written to the array
+    using interval_type = dd_interval;
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 constructors
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Default constructor for an empty array
+    dd_interval_array() noexcept = default;
+
+    /// @brief Constructor for an array of n intervals [0, 0]
+    /// @param n the number of intervals
+    explicit dd_interval_array(std::size_t n) : High(n), Low(n) {}
+
+    /// @brief Constructor for an array of n copies of one interval
+    /// @param n the number of intervals
+    /// @param fill the interval to copy into every element
+    dd_interval_array(std::size_t n, interval_type const &fill)
+        : High(n, interval(fill.min().hi(), fill.max().hi())), Low(n, interval(fill.min().lo(), fill.max().lo())) {}
+
+    /// @brief Makes an array of n intervals whose end points are left unwritten
+    /// @details Every element must be written before it is read.
+    /// @param n the number of intervals
+    /// @return the array
+    static dd_interval_array for_overwrite(std::size_t n) { return dd_interval_array(interval_array::for_overwrite(n), interval_array::for_overwrite(n)); }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 element access
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Gets the number of intervals in the array
+    /// @return the number of intervals
+    std::size_t size() const noexcept { return High.size(); }
+
+    /// @brief Checks whether the array holds no intervals
+    /// @return true if the array is empty
+    bool empty() const noexcept { return High.empty(); }
+
+    /// @brief Gets the column of the high parts of the lower end points
+    /// @return a pointer to size() aligned doubles
+    double *min_hi() noexcept { return High.lo(); }
+
+    /// @brief Gets the column of the high parts of the lower end points
+    /// @return a pointer to size() aligned doubles
+    double const *min_hi() const noexcept { return High.lo(); }
+
+    /// @brief Gets the column of the low parts of the lower end points
+    /// @return a pointer to size() aligned doubles
+    double *min_lo() noexcept { return Low.lo(); }
+
+    /// @brief Gets the column of the low parts of the lower end points
+    /// @return a pointer to size() aligned doubles
+    double const *min_lo() const noexcept { return Low.lo(); }
+
+    /// @brief Gets the column of the high parts of the upper end points
+    /// @return a pointer to size() aligned doubles
+    double *max_hi() noexcept { return High.hi(); }
+
+    /// @brief Gets the column of the high parts of the upper end points
+    /// @return a pointer to size() aligned doubles
+    double const *max_hi() const noexcept { return High.hi(); }
+
+    /// @brief Gets the column of the low parts of the upper end points
+    /// @return a pointer to size() aligned doubles
+    double *max_lo() noexcept { return Low.hi(); }
+
+    /// @brief Gets the column of the low parts of the upper end points
+    /// @return a pointer to size() aligned doubles
+    double const *max_lo() const noexcept { return Low.hi(); }
+
+    /// @brief Gets one interval of the array
+    /// @param i the index of the interval
+    /// @return the interval at index i
+    interval_type operator[](std::size_t i) const noexcept
+    {
+        return interval_type(double_double(min_hi()[i], min_lo()[i]), double_double(max_hi()[i], max_lo()[i]));
+    }
+
+    /// @brief Sets one interval of the array
+    /// @param i the index of the interval
+    /// @param val the interval to store at index i
+    void set(std::size_t i, interval_type const &val) noexcept
+    {
+        min_hi()[i] = val.min().hi(); // store the lower end point
+        min_lo()[i] = val.min().lo();
+        max_hi()[i] = val.max().hi(); // store the upper end point
+        max_lo()[i] = val.max().lo();
+    }
+
+    /// @brief Changes the number of intervals, keeping the leading elements and filling new ones with [0, 0]
+    /// @param n the new number of intervals
+    void resize(std::size_t n)
+    {
+        High.resize(n);
+        Low.resize(n);
+    }
+
+private:
+    /// @brief Constructor for for_overwrite, takes storage of the right size
+    /// @param high the high part columns
+    /// @param low the low part columns
+    dd_interval_array(interval_array &&high, interval_array &&low) noexcept : High(std::move(high)), Low(std::move(low)) {}
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    interval_array High; ///< The high parts, of the lower end points as lower end points and of the upper as upper
+    interval_array Low;  ///< The low parts, in the same columns as their high parts
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 batch interval operators
+//---------------------------------------------------------------------------------------------------------------------
+
+// A scalar converts implicitly to an interval of width zero for the shared operand forms.
+
+/// @brief Adds two arrays of intervals element by element
+/// @param a the left operands
+/// @param b the right operands, the same size as a
+/// @param out the sums, resized to the size of a; may be a or b
+/// @throws std::invalid_argument if a and b differ in size
+void add(dd_interval_array const &a, dd_interval_array const &b, dd_interval_array &out);
+
+/// @brief Adds one interval to every element of an array
+/// @param a the left operands
+/// @param b the right operand shared by every element
+/// @param out the sums, resized to the size of a; may be a
+void add(dd_interval_array const &a, dd_interval const &b, dd_interval_array &out);
+
+/// @brief Adds every element of an array to one interval
+/// @param a the left operand shared by every element
+/// @param b the right operands
+/// @param out the sums, resized to the size of b; may be b
+void add(dd_interval const &a, dd_interval_array const &b, dd_interval_array &out);
+
+/// @brief Subtracts two arrays of intervals element by element
+/// @param a the left operands
+/// @param b the right operands, the same size as a
+/// @param out the differences, resized to the size of a; may be a or b
+/// @throws std::invalid_argument if a and b differ in size
+void sub(dd_interval_array const &a, dd_interval_array const &b, dd_interval_array &out);
+
+/// @brief Subtracts one interval from every element of an array
+/// @param a the left operands
+/// @param b the right operand shared by every element
+/// @param out the differences, resized to the size of a; may be a
+void sub(dd_interval_array const &a, dd_interval const &b, dd_interval_array &out);
+
+/// @brief Subtracts every element of an array from one interval
+/// @param a the left operand shared by every element
+/// @param b the right operands
+/// @param out the differences, resized to the size of b; may be b
+void sub(dd_interval const &a, dd_interval_array const &b, dd_interval_array &out);
+
+/// @brief Multiplies two arrays of intervals element by element
+/// @param a the left operands
+/// @param b the right operands, the same size as a
+/// @param out the products, resized to the size of a; may be a or b
+/// @throws std::invalid_argument if a and b differ in size
+void mul(dd_interval_array const &a, dd_interval_array const &b, dd_interval_array &out);
+
+/// @brief Multiplies every element of an array by one interval
+/// @param a the left operands
+/// @param b the right operand shared by every element
+/// @param out the products, resized to the size of a; may be a
+void mul(dd_interval_array const &a, dd_interval const &b, dd_interval_array &out);
+
+/// @brief Multiplies one interval by every element of an array
+/// @param a the left operand shared by every element
+/// @param b the right operands
+/// @param out the products, resized to the size of b; may be b
+void mul(dd_interval const &a, dd_interval_array const &b, dd_interval_array &out);
+
+/// @brief Divides two arrays of intervals element by element
+/// @param a the dividends
+/// @param b the divisors, the same size as a
+/// @param out the quotients, resized to the size of a; may be a or b
+/// @throws std::invalid_argument if a and b differ in size
+void div(dd_interval_array const &a, dd_interval_array const &b, dd_interval_array &out);
+
+/// @brief Divides every element of an array by one interval
+/// @param a the dividends
+/// @param b the divisor shared by every element
+/// @param out the quotients, resized to the size of a; may be a
+void div(dd_interval_array const &a, dd_interval const &b, dd_interval_array &out);
+
+/// @brief Divides one interval by every element of an array
+/// @param a the dividend shared by every element
+/// @param b the divisors
+/// @param out the quotients, resized to the size of b; may be b
+void div(dd_interval const &a, dd_interval_array const &b, dd_interval_array &out);
@@ -0,0 +1,303 @@
+/// @file double_double.cpp
+/// @brief Implementation of the stream operators of double_double and of the intervals with double-double end points
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Output scales the value into [1, 10) by a double-double power of ten and takes one decimal digit at a time, so the digits are right to about 30 places, then lays them out as printf does for %g, %e or %f, following the floatfield, showpoint, showpos and uppercase flags of the stream. Precision above 32 digits is treated as 32, which is all a double-double holds.
+/// @details Input reads a decimal number with an optional sign, point and exponent, sums its first 34 digits exactly and scales by a power of ten, so the result is within a few units of the last bit of the nearest double-double.
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                    include files
+//---------------------------------------------------------------------------------------------------------------------
+
+#include "double_double.h"
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <string>
+
+namespace
+{
+    /// @brief The most significant digits written
+    constexpr int max_digits = 32;
+
+    /// @brief The most significant digits read; later ones only move the exponent
+    constexpr int max_read_digits = 34;
+
+    /// @brief Gets 10^k as a double-double, exact for k up to 44 and within a few units of the last bit beyond
+    /// @param k the power, at least zero
+    /// @return 10^k, or +inf past the range of double
+    double_double pow10(int k)
+    {
+        double_double r(1.0), base(10.0);
+        for (; k > 0; k >>= 1, base *= base) // binary powering, about log2 k products
+            if (k & 1)
+                r *= base;
+        return r;
+    }
+
+    /// @brief Scales a value by 10^k without overflowing an intermediate power near the ends of the range
+    /// @param x the value
+    /// @param k the power, of either sign
+    /// @return x * 10^k
+    double_double scale10(double_double x, int k)
+    {
+        for (; k > 300; k -= 300)
+            x *= pow10(300);
+        for (; k < -300; k += 300)
+            x /= pow10(300);
+        return k >= 0 ? x * pow10(k) : x / pow10(-k);
+    }
+
+    /// @brief Takes the decimal digits of a positive finite value, rounded to nearest at a given place
+    /// @param x the value
+    /// @param count called with the decimal exponent of the leading digit, returns how many digits to keep, possibly none
+    /// @param exp10 set to the decimal exponent of the first digit returned
+    /// @return the digits, empty if the value rounds to zero
+    template <class Count>
+    std::string digits(double_double x, Count count, int &exp10)
+    {
+        int e = static_cast<int>(std::floor(std::log10(x.hi())));
+        double_double y = scale10(x, -e);
+        if (y < 1.0) // log10 of the high part was a little off
+        {
+            y *= 10.0;
+            --e;
+        }
+        else if (y >= 10.0)
+        {
+            y /= 10.0;
+            ++e;
+        }
+
+        int n = std::min(count(e), max_digits);
+        exp10 = e;
+        if (n < 0)
+            return std::string();
+
+        std::string out;
+        for (int i = 0; i <= n; ++i) // one digit past the last kept, to round on
+        {
+            double d = std::floor(y.hi());
+            double_double r = y - d;
+            if (r < 0.0) // the high part was rounded up to an integer
+            {
+                d -= 1.0;
+                r += 1.0;
+            }
+            out.push_back(static_cast<char>('0' + std::clamp(static_cast<int>(d), 0, 9)));
+            y = r * 10.0;
+        }
+
+        bool up = out.back() >= '5';
+        out.pop_back();
+        for (std::size_t i = out.size(); up && i-- > 0;) // carry the rounding up
+        {
+            up = out[i] == '9';
+            out[i] = up ? '0' : static_cast<char>(out[i] + 1);
+        }
+        if (up) // every digit carried, or none were kept and the value rounded up to the next power of ten
+        {
+            out.insert(out.begin(), '1'); // 999 becomes 1000, then n digits are kept
+            if (n > 0)
+                out.pop_back();
+            exp10 = e + 1;
+        }
+        return out;
+    }
+
+    /// @brief Lays out digits in fixed notation
+    /// @param d the digits, the first at 10^exp10
+    /// @param exp10 the decimal exponent of the first digit
+    /// @param frac the digits after the point
+    /// @param point whether to write the point when there are no digits after it
+    /// @return the text
+    std::string fixed_text(std::string const &d, int exp10, int frac, bool point)
+    {
+        std::string out;
+        for (int j = std::max(exp10, 0); j >= -frac; --j)
+        {
+            int idx = exp10 - j;
+            out.push_back(idx >= 0 && idx < static_cast<int>(d.size()) ? d[idx] : '0');
+            if (j == 0 && (frac > 0 || point))
+                out.push_back('.');
+        }
+        return out;
+    }
+
+    /// @brief Lays out digits in scientific notation
+    /// @param d the digits, the first at 10^exp10
+    /// @param exp10 the decimal exponent of the first digit
+    /// @param frac the digits after the point
+    /// @param point whether to write the point when there are no digits after it
+    /// @param upper whether to write E rather than e
+    /// @return the text
+    std::string scientific_text(std::string const &d, int exp10, int frac, bool point, bool upper)
+    {
+        std::string out = fixed_text(d, 0, frac, point);
+        std::string e = std::to_string(exp10 < 0 ? -exp10 : exp10);
+        out += upper ? 'E' : 'e';
+        out += exp10 < 0 ? '-' : '+';
+        out += e.size() < 2 ? "0" + e : e; // at least two exponent digits, as printf writes
+        return out;
+    }
+
+    /// @brief Removes trailing zeros after a point, and the point if nothing follows it, as %g does
+    std::string strip_zeros(std::string s)
+    {
+        std::size_t point = s.find('.');
+        if (point == std::string::npos)
+            return s;
+        std::size_t end = s.find_first_of("eE");
+        std::string tail = end == std::string::npos ? std::string() : s.substr(end);
+        s.erase(end == std::string::npos ? s.size() : end);
+        s.erase(s.find_last_not_of('0') + 1);
+        if (s.back() == '.')
+            s.pop_back();
+        return s + tail;
+    }
+
+    /// @brief Writes an interval in the format of the interval stream operators of interval.cpp
+    template <class I>
+    std::ostream &write_interval(std::ostream &os, I const &obj)
+    {
+        return os << "[" << obj.min() << ", " << obj.max() << "]";
+    }
+
+    /// @brief Reads an interval in the format of the interval stream operators of interval.cpp
+    template <class I>
+    std::istream &read_interval(std::istream &is, I &obj)
+    {
+        double_double min, max;
+        is >> min >> max;
+        obj = I(min, max);
+        return is;
+    }
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 ios operators
+//---------------------------------------------------------------------------------------------------------------------
+
+std::ostream &operator<<(std::ostream &os, double_double const &x)
+{
+    if (!std::isfinite(x.hi()) || x.hi() == 0.0) // infinities, NaN and zeros are written as the double
+        return os << x.hi();
+
+    std::ios_base::fmtflags flags = os.flags();
+    std::ios_base::fmtflags field = flags & std::ios_base::floatfield;
+    bool point = flags & std::ios_base::showpoint, upper = flags & std::ios_base::uppercase;
+    int p = static_cast<int>(std::min<std::streamsize>(os.precision(), max_digits));
+    double_double mag = abs(x);
+    int e = 0;
+    std::string text;
+
+    if (field == std::ios_base::fixed)
+    {
+        std::string d = digits(mag, [p](int lead) { return lead + 1 + p; }, e); // every digit down to 10^-p
+        text = d.empty() ? fixed_text("0", 0, p, point) : fixed_text(d, e, p, point);
+    }
+    else if (field == std::ios_base::scientific)
+    {
+        std::string d = digits(mag, [p](int) { return p + 1; }, e);
+        text = scientific_text(d, e, p, point, upper);
+    }
+    else
+    {
+        int sig = std::max(p, 1);
+        std::string d = digits(mag, [sig](int) { return sig; }, e);
+        text = e < -4 || e >= sig ? scientific_text(d, e, sig - 1, point, upper) : fixed_text(d, e, sig - 1 - e, point);
+        if (!point)
+            text = strip_zeros(text);
+    }
+
+    if (x.hi() < 0.0)
+        text.insert(text.begin(), '-');
+    else if (flags & std::ios_base::showpos)
+        text.insert(text.begin(), '+');
+    return os << text; // honours the width and fill of the stream
+}
+
+std::istream &operator>>(std::istream &is, double_double &x)
+{
+    std::istream::sentry s(is); // skips leading whitespace
+    if (!s)
+        return is;
+
+    auto take = [&is](auto accept) -> int
+    {
+        int c = is.peek();
+        if (c != std::char_traits<char>::eof() && accept(static_cast<char>(c)))
+            return is.get();
+        return 0;
+    };
+    auto digit = [](char c) { return c >= '0' && c <= '9'; };
+
+    bool negative = take([](char c) { return c == '-' || c == '+'; }) == '-';
+    double_double m;
+    int kept = 0, exp10 = 0;
+    bool any = false, frac = false;
+    for (;;)
+    {
+        if (int c = take(digit))
+        {
+            any = true;
+            if (kept < max_read_digits)
+            {
+                if (kept > 0 || c != '0')
+                    ++kept;
+                m = m * 10.0 + static_cast<double>(c - '0'); // exact while m holds at most 31 digits
+                exp10 -= frac;
+            }
+            else
+                exp10 += !frac; // a dropped digit before the point still scales the value
+        }
+        else if (!frac && take([](char c) { return c == '.'; }))
+            frac = true;
+        else
+            break;
+    }
+    if (!any)
+    {
+        is.setstate(std::ios_base::failbit);
+        return is;
+    }
+
+    if (take([](char c) { return c == 'e' || c == 'E'; }))
+    {
+        bool eneg = take([](char c) { return c == '-' || c == '+'; }) == '-';
+        int e = 0;
+        bool edigits = false;
+        while (int c = take(digit))
+        {
+            edigits = true;
+            e = std::min(e * 10 + (c - '0'), 100000); // far past the range of double either way
+        }
+        if (!edigits)
+        {
+            is.setstate(std::ios_base::failbit);
+            return is;
+        }
+        exp10 += eneg ? -e : e;
+    }
+
+    double_double v = scale10(m, exp10);
+    x = negative ? -v : v;
+    return is;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 ios interval operators
+//---------------------------------------------------------------------------------------------------------------------
+
+template <>
+std::ostream &operator<<(std::ostream &os, dd_interval const &obj) { return write_interval(os, obj); }
+
+template <>
+std::ostream &operator<<(std::ostream &os, dd_interval_fast const &obj) { return write_interval(os, obj); }
+
+template <>
+std::istream &operator>>(std::istream &is, dd_interval &obj) { return read_interval(is, obj); }
+
+template <>
+std::istream &operator>>(std::istream &is, dd_interval_fast &obj) { return read_interval(is, obj); }
@@ -0,0 +1,393 @@
+/// @file double_double.h
+/// @brief Double-double numbers of 106 bits and the interval type with double-double end points
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares the double_double class, an unevaluated sum hi + lo of two doubles with |lo| at most half an ulp of hi, which carries 106 significant bits in the exponent range of double. Its +, -, * and / are the error-free transformation algorithms of Joldes, Muller and Popescu (2017): TwoSum and FastTwoSum for sums, TwoProd through a fused multiply-add for products. Their relative errors are at most 3 u^2 for a sum, 4 u^2 for a product and 15 u^2 for a quotient, with u = 2^-53, in round to nearest and away from underflow and overflow.
+/// @details double_double is a drop-in end point type for basic_interval. #dd_interval pairs it with rounding::widen, for which this file specialises rounding::next_up: one step outward moves a value by 2^-100 of itself plus 2^-1022, more than the error of any of the four operations, so every operator of interval.h rounds outward and gives a rigorous enclosure in round to nearest. The policies that change the rounding mode of the processor would break the error-free transformations and do not compile with it.
+/// @details The algorithms are written once over lanes, a double or a GCC vector of doubles, so the scalar operators here and the SIMD kernels of dd_interval_array.cpp share one definition.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "interval.h"
+
+#include <cmath>
+#include <compare>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <type_traits>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 implementation details
+//---------------------------------------------------------------------------------------------------------------------
+
+namespace dd_detail
+{
+    // Every function takes lanes V, a double or a GCC vector of doubles, and writes the high and low parts of its result
+    // after reading every input, so the results may be the inputs. Comparisons of lanes give a bool or an integer
+    // vector, which ?: accepts both.
+
+    /// @brief Computes a * b + c with one rounding in every lane
+    /// @details Vector lanes are fused one by one, which GCC turns into one vector instruction in a function compiled for FMA.
+    template <class V>
+    [[gnu::always_inline]] inline V fused(V const &a, V const &b, V const &c) noexcept
+    {
+        if constexpr (std::is_arithmetic_v<V>)
+            return std::fma(a, b, c);
+        else
+        {
+            V r;
+            for (std::size_t i = 0; i < sizeof(V) / sizeof(double); ++i)
+                r[i] = __builtin_fma(a[i], b[i], c[i]);
+            return r;
+        }
+    }
+
+    /// @brief Splits a + b into the rounded sum s and its exact error e, for any a and b (TwoSum)
+    template <class V>
+    [[gnu::always_inline]] inline void two_sum(V const &a, V const &b, V &s, V &e) noexcept
+    {
+        V t = a + b;
+        V bb = t - a;
+        e = (a - (t - bb)) + (b - bb);
+        s = t;
+    }
+
+    /// @brief Splits a + b into the rounded sum s and its exact error e, for |a| at least |b| or a zero (FastTwoSum)
+    template <class V>
+    [[gnu::always_inline]] inline void fast_two_sum(V const &a, V const &b, V &s, V &e) noexcept
+    {
+        V t = a + b;
+        e = b - (t - a);
+        s = t;
+    }
+
+    /// @brief Splits a * b into the rounded product p and its exact error e (TwoProd)
+    template <class V>
+    [[gnu::always_inline]] inline void two_prod(V const &a, V const &b, V &p, V &e) noexcept
+    {
+        V t = a * b;
+        e = fused(a, b, -t);
+        p = t;
+    }
+
+    /// @brief Clears a low part or error term where its high part is an infinity or NaN, where the transformations leave NaN
+    /// @details The operations clear each error term before it reaches a high part, so an infinity or an overflow gives the result of double arithmetic.
+    template <class V>
+    [[gnu::always_inline]] inline V finite_low(V const &hi, V const &lo) noexcept
+    {
+        return (hi - hi == 0) ? lo : V{} + 0.0; // hi - hi is NaN for an infinity or a NaN
+    }
+
+    /// @brief Adds two double-doubles with relative error at most 3 u^2 (AccurateDWPlusDW)
+    template <class V>
+    [[gnu::always_inline]] inline void add(V const &xh, V const &xl, V const &yh, V const &yl, V &zh, V &zl) noexcept
+    {
+        V sh, sl, th, tl, vh, vl;
+        two_sum(xh, yh, sh, sl);
+        two_sum(xl, yl, th, tl);
+        fast_two_sum(sh, finite_low(sh, sl) + th, vh, vl);
+        fast_two_sum(vh, finite_low(vh, tl + vl), sh, sl);
+        zl = finite_low(sh, sl);
+        zh = sh;
+    }
+
+    /// @brief Multiplies two double-doubles with relative error at most 4 u^2 (DWTimesDW3)
+    template <class V>
+    [[gnu::always_inline]] inline void mul(V const &xh, V const &xl, V const &yh, V const &yl, V &zh, V &zl) noexcept
+    {
+        V ch, cl;
+        two_prod(xh, yh, ch, cl);
+        V t = fused(xh, yl, xl * yl);
+        t = fused(xl, yh, t);
+        fast_two_sum(ch, finite_low(ch, cl + t), ch, cl);
+        zl = finite_low(ch, cl);
+        zh = ch;
+    }
+
+    /// @brief Divides two double-doubles with relative error at most 15 u^2 (DWDivDW2, with DWTimesFP3 for the remainder)
+    /// @details The remainder y * (x / y) is about x, and its error terms, about 2^-106 of it, would underflow for |x| below 2^-900 and lose the 2^-100 relative margin of #step_up. Such a dividend and its divisor are both scaled by 2^600, which is exact and leaves the quotient as it is. A divisor that overflows on scaling was above 2^424, so the quotient is below 2^-1324; it comes out as zero, within the 2^-1022 of #step_up.
+    template <class V>
+    [[gnu::always_inline]] inline void div(V const &xh0, V const &xl0, V const &yh0, V const &yl0, V &zh, V &zl) noexcept
+    {
+        V xmag = xh0 < 0 ? -xh0 : xh0;
+        V scale = xmag < 0x1p-900 ? V{} + 0x1p600 : V{} + 1.0;
+        V xh = xh0 * scale, xl = xl0 * scale, yh = yh0 * scale, yl = yl0 * scale;
+
+        V th = xh / yh;
+        V rh, rl;
+        two_prod(yh, th, rh, rl);
+        rl = fused(yl, th, rl);
+        fast_two_sum(rh, rl, rh, rl);
+        V tl = ((xh - rh) + (xl - rl)) / yh; // xh - rh is exact
+        fast_two_sum(th, finite_low(rh, tl), th, tl); // rh is not finite for an infinite quotient or divisor
+        zl = finite_low(th, tl);
+        zh = th;
+    }
+
+    /// @brief Moves a double-double above every value within the error of one operation of it
+    /// @details Adds 2^-100 of the value, 64 u^2 of it, plus the smallest normal double, which covers the absolute errors of underflowing low parts and, unlike a subnormal, costs no microcode assist; the addition itself loses at most 3 u^2, leaving more than the 15 u^2 of a quotient. Infinities and NaN stay as they are.
+    template <class V>
+    [[gnu::always_inline]] inline void step_up(V const &xh, V const &xl, V &zh, V &zl) noexcept
+    {
+        V mag = xh < 0 ? -xh : xh;
+        add(xh, xl, finite_low(xh, mag * 0x1p-100 + 0x1p-1022), V{} + 0.0, zh, zl); // -inf + inf is NaN, so an infinity stays
+    }
+} // namespace dd_detail
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 class declaration
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief A number held as the unevaluated sum of two doubles, with 106 significant bits
+/// @details Every float, double and integer of up to 64 bits converts exactly, and a long double converts exactly when it is within the range of double. The comparison operators compare the exact sums.
+/// @author George Downing
+/// @date 17-10-2026
+class double_double
+{
+public:
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 constructors
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Default constructor for 0
+    constexpr double_double() noexcept = default;
+
+    /// @brief Constructor for the exact value of a number of a built in type
+    /// @param x the value
+    template <class S>
+        requires std::is_arithmetic_v<S>
+    constexpr double_double(S x) noexcept
+    {
+        if constexpr (std::is_integral_v<S> && sizeof(S) > 4)
+        {
+            Hi = static_cast<double>(x);
+            Lo = static_cast<double>(static_cast<__int128>(x) - static_cast<__int128>(Hi)); // at most 11 bits, exact
+        }
+        else if constexpr (std::is_same_v<S, long double>)
+        {
+            Hi = static_cast<double>(x);
+            Lo = Hi - Hi == 0 ? static_cast<double>(x - Hi) : 0.0; // the remainder has at most 11 bits
+        }
+        else
+            Hi = static_cast<double>(x);
+    }
+
+    /// @brief Constructor from a high and a low part that are already normalised
+    /// @param hi the high part
+    /// @param lo the low part, at most half an ulp of hi
+    constexpr double_double(double hi, double lo) noexcept : Hi(hi), Lo(lo) {}
+
+    /// @brief Makes the double-double holding the exact sum of two doubles
+    /// @param a the first double
+    /// @param b the second double
+    /// @return a + b without rounding
+    static double_double sum(double a, double b) noexcept
+    {
+        double_double r;
+        dd_detail::two_sum(a, b, r.Hi, r.Lo);
+        r.Lo = dd_detail::finite_low(r.Hi, r.Lo);
+        return r;
+    }
+
+    /// @brief Makes the double-double holding the exact product of two doubles
+    /// @param a the first double
+    /// @param b the second double
+    /// @return a * b without rounding, away from underflow
+    static double_double product(double a, double b) noexcept
+    {
+        double_double r;
+        dd_detail::two_prod(a, b, r.Hi, r.Lo);
+        r.Lo = dd_detail::finite_low(r.Hi, r.Lo);
+        return r;
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 access and conversion
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Gets the high part
+    /// @return the double nearest the value
+    constexpr double hi() const noexcept { return Hi; }
+
+    /// @brief Gets the low part
+    /// @return the value minus hi()
+    constexpr double lo() const noexcept { return Lo; }
+
+    /// @brief Converts to the nearest double
+    constexpr explicit operator double() const noexcept { return Hi; }
+
+    /// @brief Converts to a long double, rounding once
+    constexpr explicit operator long double() const noexcept { return static_cast<long double>(Hi) + Lo; }
+
+    /// @brief Converts to a float, rounding through the nearest double
+    constexpr explicit operator float() const noexcept { return static_cast<float>(Hi); }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 arithmetic operators
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Negates a double-double, which is exact
+    constexpr double_double operator-() const noexcept { return double_double(-Hi, -Lo); }
+
+    /// @brief Adds a double-double to this one
+    double_double &operator+=(double_double const &obj) noexcept
+    {
+        dd_detail::add(Hi, Lo, obj.Hi, obj.Lo, Hi, Lo);
+        return *this;
+    }
+
+    /// @brief Subtracts a double-double from this one
+    double_double &operator-=(double_double const &obj) noexcept
+    {
+        dd_detail::add(Hi, Lo, -obj.Hi, -obj.Lo, Hi, Lo);
+        return *this;
+    }
+
+    /// @brief Multiplies this double-double by another
+    double_double &operator*=(double_double const &obj) noexcept
+    {
+        dd_detail::mul(Hi, Lo, obj.Hi, obj.Lo, Hi, Lo);
+        return *this;
+    }
+
+    /// @brief Divides this double-double by another
+    double_double &operator/=(double_double const &obj) noexcept
+    {
+        dd_detail::div(Hi, Lo, obj.Hi, obj.Lo, Hi, Lo);
+        return *this;
+    }
+
+    /// @brief Adds two double-doubles, either of which may be a built in number
+    friend double_double operator+(double_double a, double_double const &b) noexcept { return a += b; }
+
+    /// @brief Subtracts two double-doubles, either of which may be a built in number
+    friend double_double operator-(double_double a, double_double const &b) noexcept { return a -= b; }
+
+    /// @brief Multiplies two double-doubles, either of which may be a built in number
+    friend double_double operator*(double_double a, double_double const &b) noexcept { return a *= b; }
+
+    /// @brief Divides two double-doubles, either of which may be a built in number
+    friend double_double operator/(double_double a, double_double const &b) noexcept { return a /= b; }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 comparisons
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Checks whether two double-doubles hold the same value
+    friend constexpr bool operator==(double_double const &a, double_double const &b) noexcept { return a.Hi == b.Hi && a.Lo == b.Lo; }
+
+    /// @brief Orders two double-doubles by value, unordered if either is NaN
+    friend constexpr std::partial_ordering operator<=>(double_double const &a, double_double const &b) noexcept
+    {
+        if (auto c = a.Hi <=> b.Hi; c != 0) // normalised parts order by the high part first
+            return c;
+        return a.Lo <=> b.Lo;
+    }
+
+private:
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    double Hi = 0.0; ///< The high part, the value rounded to double
+    double Lo = 0.0; ///< The low part, at most half an ulp of Hi
+};
+
+/// @brief Gets the absolute value of a double-double, which is exact
+inline double_double abs(double_double const &x) noexcept { return x.hi() < 0 ? -x : x; }
+
+/// @brief Writes a double-double in the format of the stream's flags, with up to 32 significant digits of its precision
+/// @param os the stream
+/// @param x the value
+/// @return the stream
+std::ostream &operator<<(std::ostream &os, double_double const &x);
+
+/// @brief Reads a decimal number into the double-double nearest it, within a few units of its last bit
+/// @param is the stream
+/// @param x set to the value read
+/// @return the stream, with failbit set if no number was read
+std::istream &operator>>(std::istream &is, double_double &x);
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 numeric limits
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief The limits of double_double, which has the exponent range of double and 106 significant bits
+template <>
+struct std::numeric_limits<double_double>
+{
+    static constexpr bool is_specialized = true;              ///< the limits are known
+    static constexpr bool is_signed = true;                   ///< negative values exist
+    static constexpr bool is_integer = false;                 ///< not an integer type
+    static constexpr bool is_exact = false;                   ///< operations round
+    static constexpr bool has_infinity = true;                ///< infinities exist, with a zero low part
+    static constexpr bool has_quiet_NaN = true;               ///< NaN exists
+    static constexpr int radix = 2;                           ///< binary
+    static constexpr int digits = 106;                        ///< bits of the two significands together
+    static constexpr int digits10 = 31;                       ///< decimal digits that survive a round trip
+    static constexpr int max_digits10 = 33;                   ///< decimal digits that tell every value apart
+    static constexpr int max_exponent = 1024;                 ///< that of double
+    static constexpr int min_exponent = -1021;                ///< that of double, so every double converts exactly
+    static constexpr double_double min() noexcept { return double_double(std::numeric_limits<double>::min()); }                 ///< the smallest normal
+    static constexpr double_double max() noexcept { return double_double(std::numeric_limits<double>::max(), 0x1p970 - 0x1p917); } ///< the largest finite value
+    static constexpr double_double lowest() noexcept { return -max(); }                                                         ///< the most negative finite value
+    static constexpr double_double epsilon() noexcept { return double_double(0x1p-104); }                                       ///< the gap above 1, with one spare bit
+    static constexpr double_double infinity() noexcept { return double_double(std::numeric_limits<double>::infinity(), 0.0); }  ///< +inf
+    static constexpr double_double quiet_NaN() noexcept { return double_double(std::numeric_limits<double>::quiet_NaN(), 0.0); } ///< NaN
+    static constexpr double_double denorm_min() noexcept { return double_double(std::numeric_limits<double>::denorm_min()); }   ///< the smallest positive value
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 rounding
+//---------------------------------------------------------------------------------------------------------------------
+
+namespace rounding
+{
+    /// @brief Moves a double-double above every value within the error of one double-double operation of it
+    /// @details There is no next representable double-double to step to, so rounding::widen moves each end point by the bound of dd_detail::step_up instead.
+    template <>
+    inline double_double next_up<double_double>(double_double x) noexcept
+    {
+        double hi, lo;
+        dd_detail::step_up(x.hi(), x.lo(), hi, lo);
+        return double_double(hi, lo);
+    }
+
+    /// @brief Double-double operations are only error free in round to nearest, so the policies that round upward are excluded
+    template <>
+    double_double opaque<double_double>(double_double x) noexcept = delete;
+} // namespace rounding
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 interval types
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Interval with double-double end points rounded outward, rigorous in round to nearest
+using dd_interval = basic_interval<double_double, rounding::widen>;
+
+/// @brief Interval with double-double end points rounded to nearest, like #interval
+using dd_interval_fast = basic_interval<double_double, rounding::fast>;
+
+// The stream operators of the double-double intervals are compiled in double_double.cpp, so that interval.cpp does not
+// depend on this file.
+
+/// @brief Writes a #dd_interval as [min, max], as the stream operators of interval.cpp write every interval
+template <>
+std::ostream &operator<<(std::ostream &os, dd_interval const &obj);
+
+/// @brief Writes a #dd_interval_fast as [min, max]
+template <>
+std::ostream &operator<<(std::ostream &os, dd_interval_fast const &obj);
+
+/// @brief Reads a #dd_interval as its two end points separated by whitespace
+template <>
+std::istream &operator>>(std::istream &is, dd_interval &obj);
+
+/// @brief Reads a #dd_interval_fast as its two end points separated by whitespace
+template <>
+std::istream &operator>>(std::istream &is, dd_interval_fast &obj);
+
+static_assert(std::is_trivially_copyable_v<dd_interval> && sizeof(dd_interval) == 4 * sizeof(double), "dd_interval must be exactly four doubles");
@@ -0,0 +1,482 @@
+/// @file dual_interval.h
+/// @brief Forward mode automatic differentiation over intervals
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares the basic_dual_interval class, an interval value together with an interval enclosure of its gradient, and overloads +, -, *, / and the functions of interval_math.h for it so that a function written once in terms of intervals also gives the enclosure of its gradient over a box. That is what interval Newton steps, mean value forms and monotonicity tests need, without differentiating by hand.
+/// @details The gradient lives inside the object as two arrays, the lower end points of every component followed by the upper ones, so the component loops of the operators are plain loops over columns that the compiler vectorises and no dual ever touches the heap. Its size is a template argument: either fixed, or bounded with the number of components in use kept at run time, which keeps the loops short for functions of fewer variables than the bound.
+/// @details Every component is computed with the operators of basic_interval under the rounding policy of the dual, so the gradient is a rigorous enclosure whenever the policy rounds outward. gradient() evaluates a function over a whole batch of boxes on a thread_pool.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "interval.h"
+#include "interval_array.h"
+#include "interval_math.h"
+#include "parallel.h"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 class declaration
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief How the number of gradient components of a basic_dual_interval is set
+enum class gradient_size
+{
+    fixed,  ///< every dual has exactly N components
+    bounded ///< a dual uses the first dim() <= N components, and the rest are zero
+};
+
+namespace dual_detail
+{
+    /// @brief Stands in for the run time dimension of a fixed size gradient and takes no space
+    struct no_dim
+    {
+    };
+} // namespace dual_detail
+
+/// @brief An interval value and an interval enclosure of its gradient with respect to up to N variables
+/// @details Variables are made with #variable, constants with the explicit constructors, and everything else by the operators and functions, which apply the rules of differentiation to the value and every component. Scalars and intervals combine with a dual directly, without the cost of a zero gradient.
+/// @details The binary operators build their result in place rather than copying an operand and updating it, so a formula of n operations moves each gradient about n times instead of 3 n times.
+/// @details With gradient_size::bounded, dim() is one more than the highest variable index that reached the dual, and only the first dim() components are stored; the others read as zero and a binary operator works on the larger dim() of its operands. A constant has dim() zero.
+/// @tparam T the end point type: float, double or long double
+/// @tparam N the number of gradient components, or their bound
+/// @tparam Size whether the number of components is fixed or bounded
+/// @tparam Rounding the rounding policy of the value and of every component, see rounding.h
+/// @author George Downing
+/// @date 17-10-2026
+template <class T, std::size_t N, gradient_size Size = gradient_size::fixed, class Rounding = rounding::fast>
+class basic_dual_interval
+{
+    static_assert(N > 0, "a gradient has at least one component");
+
+public:
+    /// @brief The end point type of the value and of every component
+    using value_type = T;
+
+    /// @brief The interval type of the value and of every component
+    using interval_type = basic_interval<T, Rounding>;
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 constructors
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Default constructor for the constant [0, 0]
+    constexpr basic_dual_interval() noexcept : basic_dual_interval(interval_type(T(0))) {}
+
+    /// @brief Constructor for a constant, whose gradient is zero
+    /// @param val the value
+    constexpr explicit basic_dual_interval(interval_type const &val) noexcept : Val(val)
+    {
+        for (std::size_t i = 0; i < dim(); ++i)
+            set(i, interval_type(T(0)));
+    }
+
+    /// @brief Constructor for a constant scalar, enclosed as basic_interval encloses it
+    /// @param val the value
+    template <interval_scalar S>
+    constexpr explicit basic_dual_interval(S val) noexcept : basic_dual_interval(interval_type(val)) {}
+
+    /// @brief Makes the independent variable of one index
+    /// @param val the interval the variable ranges over
+    /// @param index the index of the variable, below N
+    /// @return the dual with value val and gradient the unit vector of index
+    static constexpr basic_dual_interval variable(interval_type const &val, std::size_t index) noexcept
+    {
+        basic_dual_interval x(val, index + 1);
+        for (std::size_t i = 0; i < x.dim(); ++i)
+            x.set(i, interval_type(T(i == index)));
+        return x;
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 access
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Gets the value
+    /// @return the enclosure of the function
+    constexpr interval_type const &value() const noexcept { return Val; }
+
+    /// @brief Gets the number of gradient components in use
+    /// @return N for a fixed size gradient
+    constexpr std::size_t dim() const noexcept
+    {
+        if constexpr (Size == gradient_size::bounded)
+            return Dim;
+        else
+            return N;
+    }
+
+    /// @brief Gets one component of the gradient
+    /// @param i the index of the variable, below N
+    /// @return the enclosure of the partial derivative with respect to variable i, zero from dim() on
+    constexpr interval_type gradient(std::size_t i) const noexcept { return i < dim() ? interval_type(Lo[i], Hi[i]) : interval_type(T(0)); }
+
+    /// @brief Gets the lower end points of the gradient
+    /// @return a pointer to dim() lower end points
+    constexpr T const *gradient_lo() const noexcept { return Lo; }
+
+    /// @brief Gets the upper end points of the gradient
+    /// @return a pointer to dim() upper end points
+    constexpr T const *gradient_hi() const noexcept { return Hi; }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 compound operators
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Adds a dual to this dual
+    /// @param obj the dual to add
+    /// @return this dual
+    constexpr basic_dual_interval &operator+=(basic_dual_interval const &obj) noexcept { return *this = *this + obj; }
+
+    /// @brief Subtracts a dual from this dual
+    /// @param obj the dual to subtract
+    /// @return this dual
+    constexpr basic_dual_interval &operator-=(basic_dual_interval const &obj) noexcept { return *this = *this - obj; }
+
+    /// @brief Multiplies this dual by a dual
+    /// @param obj the dual to multiply by
+    /// @return this dual
+    constexpr basic_dual_interval &operator*=(basic_dual_interval const &obj) noexcept { return *this = *this * obj; }
+
+    /// @brief Divides this dual by a dual
+    /// @param obj the divisor, giving the whole line when its value contains zero
+    /// @return this dual
+    constexpr basic_dual_interval &operator/=(basic_dual_interval const &obj) noexcept { return *this = *this / obj; }
+
+    /// @brief Adds a constant to this dual, leaving the gradient alone
+    /// @param obj the constant; a scalar converts to the interval enclosing it
+    /// @return this dual
+    constexpr basic_dual_interval &operator+=(interval_type const &obj) noexcept
+    {
+        Val += obj;
+        return *this;
+    }
+
+    /// @brief Subtracts a constant from this dual, leaving the gradient alone
+    /// @param obj the constant
+    /// @return this dual
+    constexpr basic_dual_interval &operator-=(interval_type const &obj) noexcept
+    {
+        Val -= obj;
+        return *this;
+    }
+
+    /// @brief Multiplies this dual by a constant
+    /// @param obj the constant
+    /// @return this dual
+    constexpr basic_dual_interval &operator*=(interval_type const &obj) noexcept { return *this = *this * obj; }
+
+    /// @brief Divides this dual by a constant
+    /// @param obj the constant, giving the whole line when it contains zero
+    /// @return this dual
+    constexpr basic_dual_interval &operator/=(interval_type const &obj) noexcept { return *this = *this / obj; }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 dual operators
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Negates a dual, which is exact
+    /// @return the dual with the value and every component negated
+    constexpr basic_dual_interval operator-() const noexcept
+    {
+        basic_dual_interval r(negate(Val), dim());
+        for (std::size_t i = 0; i < r.dim(); ++i)
+            r.set(i, negate(gradient(i)));
+        return r;
+    }
+
+    /// @brief Adds two duals
+    friend constexpr basic_dual_interval operator+(basic_dual_interval const &a, basic_dual_interval const &b) noexcept
+    {
+        basic_dual_interval r(a.Val + b.Val, std::max(a.dim(), b.dim()));
+        for (std::size_t i = 0; i < r.dim(); ++i)
+            r.set(i, a.gradient(i) + b.gradient(i));
+        return r;
+    }
+
+    /// @brief Subtracts two duals
+    friend constexpr basic_dual_interval operator-(basic_dual_interval const &a, basic_dual_interval const &b) noexcept
+    {
+        basic_dual_interval r(a.Val - b.Val, std::max(a.dim(), b.dim()));
+        for (std::size_t i = 0; i < r.dim(); ++i)
+            r.set(i, a.gradient(i) - b.gradient(i));
+        return r;
+    }
+
+    /// @brief Multiplies two duals, (u v)' = u' v + u v'
+    friend constexpr basic_dual_interval operator*(basic_dual_interval const &a, basic_dual_interval const &b) noexcept
+    {
+        basic_dual_interval r(a.Val * b.Val, std::max(a.dim(), b.dim()));
+        for (std::size_t i = 0; i < r.dim(); ++i)
+            r.set(i, a.gradient(i) * b.Val + a.Val * b.gradient(i));
+        return r;
+    }
+
+    /// @brief Divides two duals, (u / v)' = (u' - (u / v) v') / v
+    /// @details The components are multiplied by one enclosure of 1 / v rather than divided by v, which is branch free and encloses the same set.
+    friend constexpr basic_dual_interval operator/(basic_dual_interval const &a, basic_dual_interval const &b) noexcept
+    {
+        interval_type inv = interval_type(T(1)) / b.Val;
+        basic_dual_interval r(a.Val / b.Val, std::max(a.dim(), b.dim()));
+        for (std::size_t i = 0; i < r.dim(); ++i)
+            r.set(i, (a.gradient(i) - r.Val * b.gradient(i)) * inv);
+        return r;
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 dual constant operators
+    //---------------------------------------------------------------------------------------------------------------------
+
+    // A constant is an interval or a scalar, which converts to the interval enclosing it. It leaves the gradient alone
+    // under + and - and scales it under * and /.
+
+    /// @brief Adds a dual and a constant
+    friend constexpr basic_dual_interval operator+(basic_dual_interval const &a, interval_type const &b) noexcept { return a.chain(a.Val + b); }
+
+    /// @brief Subtracts a constant from a dual
+    friend constexpr basic_dual_interval operator-(basic_dual_interval const &a, interval_type const &b) noexcept { return a.chain(a.Val - b); }
+
+    /// @brief Multiplies a dual by a constant
+    friend constexpr basic_dual_interval operator*(basic_dual_interval const &a, interval_type const &b) noexcept { return a.chain(a.Val * b, b); }
+
+    /// @brief Divides a dual by a constant
+    friend constexpr basic_dual_interval operator/(basic_dual_interval const &a, interval_type const &b) noexcept
+    {
+        return a.chain(a.Val / b, interval_type(T(1)) / b);
+    }
+
+    /// @brief Adds a constant and a dual
+    friend constexpr basic_dual_interval operator+(interval_type const &a, basic_dual_interval const &b) noexcept { return b.chain(a + b.Val); }
+
+    /// @brief Subtracts a dual from a constant
+    friend constexpr basic_dual_interval operator-(interval_type const &a, basic_dual_interval const &b) noexcept
+    {
+        basic_dual_interval r = -b;
+        r.Val = a - b.Val;
+        return r;
+    }
+
+    /// @brief Multiplies a constant by a dual
+    friend constexpr basic_dual_interval operator*(interval_type const &a, basic_dual_interval const &b) noexcept { return b.chain(a * b.Val, a); }
+
+    /// @brief Divides a constant by a dual, (c / v)' = -(c / v) v' / v
+    friend constexpr basic_dual_interval operator/(interval_type const &a, basic_dual_interval const &b) noexcept
+    {
+        interval_type q = a / b.Val;
+        return b.chain(q, negate(q / b.Val));
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 chain rule
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Applies a function of one variable
+    /// @param val the enclosure of f over value()
+    /// @param slope the enclosure of f' over value()
+    /// @return the dual with value val and gradient slope times this gradient
+    constexpr basic_dual_interval chain(interval_type const &val, interval_type const &slope) const noexcept
+    {
+        basic_dual_interval r(val, dim());
+        for (std::size_t i = 0; i < r.dim(); ++i)
+            r.set(i, gradient(i) * slope);
+        return r;
+    }
+
+    /// @brief Replaces the value and keeps the gradient, for a function of slope exactly 1
+    /// @param val the new value
+    /// @return the dual with value val and this gradient
+    constexpr basic_dual_interval chain(interval_type const &val) const noexcept
+    {
+        basic_dual_interval r(*this);
+        r.Val = val;
+        return r;
+    }
+
+private:
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                Private Functions
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Constructor for a result whose first dim components are written next; for a fixed size gradient dim is N
+    /// @param val the value
+    /// @param dim the components in use
+    constexpr basic_dual_interval(interval_type const &val, [[maybe_unused]] std::size_t dim) noexcept : Val(val)
+    {
+        if constexpr (Size == gradient_size::bounded)
+            Dim = dim;
+    }
+
+    /// @brief Negates an interval exactly
+    static constexpr interval_type negate(interval_type const &x) noexcept { return interval_type(-x.max(), -x.min()); }
+
+    /// @brief Stores one component of the gradient
+    constexpr void set(std::size_t i, interval_type const &g) noexcept
+    {
+        Lo[i] = g.min(); // store the lower end point
+        Hi[i] = g.max(); // store the upper end point
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    interval_type Val; ///< The value
+    T Lo[N];           ///< The lower end points of the gradient, the first dim() written
+    T Hi[N];           ///< The upper end points of the gradient, the first dim() written
+    [[no_unique_address]] std::conditional_t<Size == gradient_size::bounded, std::size_t, dual_detail::no_dim> Dim{}; ///< The components in use, bounded gradients only
+};
+
+/// @brief Dual with double end points and a gradient of N components
+template <std::size_t N>
+using dual_interval = basic_dual_interval<double, N>;
+
+/// @brief Dual with float end points and a gradient of N components, twice as many per register as #dual_interval
+template <std::size_t N>
+using dual_intervalf = basic_dual_interval<float, N>;
+
+/// @brief Dual with double end points and a gradient of at most N components, as many as the variables that reach it
+template <std::size_t N>
+using bounded_dual_interval = basic_dual_interval<double, N, gradient_size::bounded>;
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 layout guarantees
+//---------------------------------------------------------------------------------------------------------------------
+
+static_assert(std::is_trivially_copyable_v<dual_interval<4>> && sizeof(dual_interval<4>) == 10 * sizeof(double), "a fixed size dual must hold only its value and gradient");
+static_assert(std::is_trivially_copyable_v<bounded_dual_interval<4>>, "a bounded dual must be trivially copyable");
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 dual functions
+//---------------------------------------------------------------------------------------------------------------------
+
+// Each function encloses f over the value with the function of interval_math.h and f' over the value to scale the
+// gradient, so a derivative that is unbounded over the value, as that of sqrt at zero, makes the gradient unbounded.
+
+/// @brief Encloses the square root and its gradient, (sqrt u)' = u' / (2 sqrt u)
+template <class T, std::size_t N, gradient_size Size, class R>
+basic_dual_interval<T, N, Size, R> sqrt(basic_dual_interval<T, N, Size, R> const &x) noexcept
+{
+    using I = basic_interval<T, R>;
+    I v = sqrt(x.value());
+    return x.chain(v, I(T(1)) / (v * T(2)));
+}
+
+/// @brief Encloses e raised to a dual and its gradient, (e^u)' = e^u u'
+template <class T, std::size_t N, gradient_size Size, class R>
+basic_dual_interval<T, N, Size, R> exp(basic_dual_interval<T, N, Size, R> const &x) noexcept
+{
+    basic_interval<T, R> v = exp(x.value());
+    return x.chain(v, v);
+}
+
+/// @brief Encloses the natural logarithm and its gradient, (log u)' = u' / u
+template <class T, std::size_t N, gradient_size Size, class R>
+basic_dual_interval<T, N, Size, R> log(basic_dual_interval<T, N, Size, R> const &x) noexcept
+{
+    using I = basic_interval<T, R>;
+    return x.chain(log(x.value()), I(T(1)) / x.value());
+}
+
+/// @brief Encloses the sine and its gradient, (sin u)' = cos(u) u'
+template <class T, std::size_t N, gradient_size Size, class R>
+basic_dual_interval<T, N, Size, R> sin(basic_dual_interval<T, N, Size, R> const &x) noexcept
+{
+    return x.chain(sin(x.value()), cos(x.value()));
+}
+
+/// @brief Encloses the cosine and its gradient, (cos u)' = -sin(u) u'
+template <class T, std::size_t N, gradient_size Size, class R>
+basic_dual_interval<T, N, Size, R> cos(basic_dual_interval<T, N, Size, R> const &x) noexcept
+{
+    basic_interval<T, R> s = sin(x.value());
+    return x.chain(cos(x.value()), basic_interval<T, R>(-s.max(), -s.min()));
+}
+
+/// @brief Encloses the arc tangent and its gradient, (atan u)' = u' / (1 + u^2)
+template <class T, std::size_t N, gradient_size Size, class R>
+basic_dual_interval<T, N, Size, R> atan(basic_dual_interval<T, N, Size, R> const &x) noexcept
+{
+    using I = basic_interval<T, R>;
+    return x.chain(atan(x.value()), I(T(1)) / (sqr(x.value()) + T(1)));
+}
+
+/// @brief Encloses a dual raised to an integer power and its gradient, (u^n)' = n u^(n-1) u'
+template <class T, std::size_t N, gradient_size Size, class R, std::integral M>
+basic_dual_interval<T, N, Size, R> pow(basic_dual_interval<T, N, Size, R> const &x, M n) noexcept
+{
+    using I = basic_interval<T, R>;
+    return x.chain(pow(x.value(), n), n == 0 ? I(T(0)) : pow(x.value(), n - 1) * n);
+}
+
+/// @brief Encloses the square and its gradient, (u^2)' = 2 u u'; the value is never negative
+template <class T, std::size_t N, gradient_size Size, class R>
+basic_dual_interval<T, N, Size, R> sqr(basic_dual_interval<T, N, Size, R> const &x) noexcept
+{
+    return x.chain(sqr(x.value()), x.value() * T(2));
+}
+
+/// @brief Gets the absolute value and encloses its gradient; where the value contains zero the slope is [-1, 1]
+template <class T, std::size_t N, gradient_size Size, class R>
+basic_dual_interval<T, N, Size, R> abs(basic_dual_interval<T, N, Size, R> const &x) noexcept
+{
+    using I = basic_interval<T, R>;
+    I slope = x.value().min() >= 0 ? I(T(1)) : x.value().max() <= 0 ? I(T(-1)) : I(T(-1), T(1));
+    return x.chain(abs(x.value()), slope);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 batch gradient evaluation
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Encloses a function and its gradient over every box of a batch
+/// @details Box k is (boxes[0][k], ..., boxes[N - 1][k]). Each worker seeds the N variables of a box, calls f and stores the value and the gradient, so the boxes, values and gradients stay in structure of arrays form throughout. Under a policy that rounds upward each worker runs inside a rounding_scope.
+/// @tparam Rounding the rounding policy of the duals passed to f
+/// @param f the function, called as f(x) with x a std::array of N basic_dual_interval<T, N, gradient_size::fixed, Rounding> and returning one of them; it is called from several threads at once
+/// @param boxes one array per variable, all the same size
+/// @param value set to the enclosure of f over every box
+/// @param grad set to one array per variable, the enclosure of that partial derivative over every box
+/// @param pool the workers
+/// @throws std::invalid_argument if the arrays of boxes differ in size
+template <class Rounding = rounding::fast, class F, class T, std::size_t N>
+void gradient(F &&f, std::array<basic_interval_array<T>, N> const &boxes, basic_interval_array<T> &value,
+              std::array<basic_interval_array<T>, N> &grad, thread_pool &pool = default_pool())
+{
+    using D = basic_dual_interval<T, N, gradient_size::fixed, Rounding>;
+    std::size_t n = boxes[0].size();
+    for (basic_interval_array<T> const &side : boxes)
+        if (side.size() != n)
+            throw std::invalid_argument("gradient: the arrays of boxes differ in size");
+    value.resize(n);
+    for (basic_interval_array<T> &g : grad)
+        g.resize(n);
+    auto body = [&](std::size_t begin, std::size_t end)
+    {
+        std::array<D, N> x;
+        for (std::size_t k = begin; k < end; ++k)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+                x[i] = D::variable(typename D::interval_type(boxes[i][k]), i);
+            D y = f(std::as_const(x));
+            value.set(k, basic_interval<T>(y.value().min(), y.value().max()));
+            for (std::size_t i = 0; i < N; ++i)
+                grad[i].set(k, basic_interval<T>(y.gradient_lo()[i], y.gradient_hi()[i]));
+        }
+    };
+    parallel_for(pool, n, 256, [&](std::size_t begin, std::size_t end)
+                 {
+                     if constexpr (Rounding::upward)
+                     {
+                         rounding_scope scope;
+                         body(begin, end);
+                     }
+                     else
+                         body(begin, end); });
+}
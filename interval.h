@@ -2,37 +2,66 @@
 /// @brief Interval arithmetic class
 /// @author George Downing
 /// @date 16-12-2022
-/// @version 1.0
+/// @version 1.3
 /// @details This file declares thh interval arithmetic class. its purpose it to perform interval arithmetic on two intervals by overloading the operators +, -, *, /, +=, -=, *=, /=, <<, >>.
+/// @details The arithmetic core is header-only, constexpr and noexcept so that every operator can be inlined into the caller. Only the stream operators are compiled in interval.cpp.
+/// @details The class is a template on the end point type and on a rounding policy from rounding.h. #intervalf, #interval and #intervall hold float, double and long double end points with rounding::fast, and #interval behaves as the original class. The other policies round the end points outward so that results are guaranteed enclosures.
 /// @details DOxygen documentation: https://georgedowning20.github.io/The-Interval-Arithmetic-Project/files.html
 //---------------------------------------------------------------------------------------------------------------------
 //                                                 #includes
 //---------------------------------------------------------------------------------------------------------------------
 #pragma once
+#include "interval_instrument.h"
+#include "rounding.h"
+
 #include <iostream>
+#include <limits>
+#include <type_traits>
 
 //---------------------------------------------------------------------------------------------------------------------
 //                                                 class declaration
 //---------------------------------------------------------------------------------------------------------------------
 
+/// @brief A scalar that may be combined with an interval: any integer or floating point type
+template <class S>
+concept interval_scalar = std::is_arithmetic_v<S>;
+
 /// @brief Interval arithmetic
 /// @details This class performs interval arithmetic on two intervals by overloading the operators +, -, *, /, +=, -=, *=, /=, <<, >>.
+/// @details The class is trivially copyable and holds exactly two end points, so arrays of intervals may be copied with memcpy and single intervals are passed in registers.
+/// @details A scalar of any arithmetic type may be combined with an interval. A scalar that T represents exactly takes the fast path of two operations; any other scalar is first enclosed in an interval by rounding it outward, so a double combined with an #intervalf is never silently truncated.
+/// @tparam T the end point type: float, double or long double
+/// @tparam Rounding the rounding policy applied to every end point, see rounding.h
 /// @author George Downing
 /// @date 16-12-2022
-class interval
+template <class T = double, class Rounding = rounding::fast>
+class basic_interval
 {
 public:
+    /// @brief The end point type of this interval type
+    using value_type = T;
+
+    /// @brief The rounding policy of this interval type
+    using rounding_policy = Rounding;
+
     //---------------------------------------------------------------------------------------------------------------------
     //                                              Global Read only access to interval
     //---------------------------------------------------------------------------------------------------------------------
 
     /// @brief Gets the minimum value of the interval
     /// @return the minimum value of the interval
-    double min() const { return Min; }
+    constexpr T min() const noexcept { return Min; }
 
     /// @brief Gets the maximum value of the interval
     /// @return the maximum value of the interval
-    double max() const { return Max; }
+    constexpr T max() const noexcept { return Max; }
+
+    /// @brief Gets the interval covering the whole real line
+    /// @return the interval [-inf, inf], the result of dividing by an interval that contains zero
+    static constexpr basic_interval entire() noexcept
+    {
+        return basic_interval(-std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity());
+    }
 
     //---------------------------------------------------------------------------------------------------------------------
     //                                                 interval constructors
@@ -41,21 +70,39 @@ public:
     /// @brief Constructor for interval with two values
     /// @param min the minimum value of the interval
     /// @param max the maximum value of the interval
-    interval(double min, double max);
+    constexpr basic_interval(T min, T max) noexcept;
 
     /// @brief Constructor for interval with one value
     /// @param val the value of the interval both min and max
-    interval(double val);
+    constexpr basic_interval(T val) noexcept;
+
+    /// @brief Constructor for the smallest interval enclosing a scalar of another type
+    /// @param val the value to enclose, held exactly when T can represent it
+    template <interval_scalar S>
+        requires(!std::is_same_v<S, T>)
+    constexpr basic_interval(S val) noexcept;
+
+    /// @brief Converting constructor from another end point type or rounding policy, rounding the end points outward
+    /// @details The conversion is implicit only when it keeps the rounding policy and cannot lose precision, as from #intervalf to #interval.
+    /// @param obj the interval to convert
+    template <class U, class R>
+        requires(!std::is_same_v<U, T> || !std::is_same_v<R, Rounding>)
+    constexpr explicit(!(std::is_same_v<R, Rounding> && rounding::exact_conversion<U, T>)) basic_interval(basic_interval<U, R> const &obj) noexcept;
 
     /// @brief Copy constructor for interval
     /// @param obj the interval to copy
-    interval(interval const &obj);
+    constexpr basic_interval(basic_interval const &obj) noexcept = default;
+
+    /// @brief Copy assignment for interval
+    /// @param obj the interval to copy
+    /// @return this interval
+    constexpr basic_interval &operator=(basic_interval const &obj) noexcept = default;
 
     /// @brief Default constructor for interval
-    interval();
+    constexpr basic_interval() noexcept = default;
 
     /// @brief Destructor for interval
-    ~interval();
+    ~basic_interval() = default;
 
     //---------------------------------------------------------------------------------------------------------------------
     //                                                 basic interval operators
@@ -64,22 +111,42 @@ public:
     /// @brief Operator overload for addition of two intervals
     /// @param obj the interval to add to this interval
     /// @return the sum of the two intervals as a new interval
-    interval operator+(interval const &obj);
+    constexpr basic_interval operator+(basic_interval const &obj) const & noexcept;
+
+    /// @brief Operator overload for addition of two intervals where this interval is a temporary
+    /// @param obj the interval to add to this interval
+    /// @return the sum of the two intervals, computed in the storage of the temporary
+    constexpr basic_interval operator+(basic_interval const &obj) && noexcept;
 
     /// @brief Operator overload for subtraction of two intervals
     /// @param obj the interval to subtract from this interval
     /// @return the difference of the two intervals as a new interval
-    interval operator-(interval const &obj);
+    constexpr basic_interval operator-(basic_interval const &obj) const & noexcept;
+
+    /// @brief Operator overload for subtraction of two intervals where this interval is a temporary
+    /// @param obj the interval to subtract from this interval
+    /// @return the difference of the two intervals, computed in the storage of the temporary
+    constexpr basic_interval operator-(basic_interval const &obj) && noexcept;
 
     /// @brief Operator overload for multiplication of two intervals
     /// @param obj the interval to multiply this interval by
     /// @return the product of the two intervals as a new interval
-    interval operator*(interval const &obj);
+    constexpr basic_interval operator*(basic_interval const &obj) const & noexcept;
+
+    /// @brief Operator overload for multiplication of two intervals where this interval is a temporary
+    /// @param obj the interval to multiply this interval by
+    /// @return the product of the two intervals, computed in the storage of the temporary
+    constexpr basic_interval operator*(basic_interval const &obj) && noexcept;
 
     /// @brief Operator overload for division of two intervals
     /// @param obj the interval to divide this interval by
     /// @return the quotient of the two intervals as a new interval
-    interval operator/(interval const &obj);
+    constexpr basic_interval operator/(basic_interval const &obj) const & noexcept;
+
+    /// @brief Operator overload for division of two intervals where this interval is a temporary
+    /// @param obj the interval to divide this interval by
+    /// @return the quotient of the two intervals, computed in the storage of the temporary
+    constexpr basic_interval operator/(basic_interval const &obj) && noexcept;
 
     //---------------------------------------------------------------------------------------------------------------------
     //                                                 compound interval operators
@@ -87,135 +154,663 @@ public:
 
     /// @brief Operator overload for addition AND assignment of an interval
     /// @param obj the interval to add to this interval
-    /// @return the sum of the two intervals as a new interval
-    interval operator+=(interval const &obj);
+    /// @return a reference to this interval
+    constexpr basic_interval &operator+=(basic_interval const &obj) noexcept;
 
     /// @brief Operator overload for subtraction AND assignment of an interval
     /// @param obj the interval to subtract from this interval
-    /// @return the difference of the two intervals as a new interval
-    interval operator-=(interval const &obj);
+    /// @return a reference to this interval
+    constexpr basic_interval &operator-=(basic_interval const &obj) noexcept;
 
     /// @brief Operator overload for multiplication AND assignment of an interval
     /// @param obj the interval to multiply this interval by
-    /// @return the product of the two intervals as a new interval
-    interval operator*=(interval const &obj);
+    /// @return a reference to this interval
+    constexpr basic_interval &operator*=(basic_interval const &obj) noexcept;
 
     /// @brief Operator overload for division AND assignment of an interval
     /// @param obj the interval to divide this interval by
-    /// @return the quotient of the two intervals as a new interval
-    interval operator/=(interval const &obj);
+    /// @return a reference to this interval
+    constexpr basic_interval &operator/=(basic_interval const &obj) noexcept;
 
     //---------------------------------------------------------------------------------------------------------------------
-    //                                                interval double operators
+    //                                                interval scalar operators
     //---------------------------------------------------------------------------------------------------------------------
 
-    /// @brief Operator overload for addition of an interval and a double
-    /// @param obj the double to add to this interval
-    /// @return the sum of the interval and the double as a new interval
-    interval operator+(double const &obj);
-
-    /// @brief Operator overload for subtraction of an interval and a double
-    /// @param obj the double to subtract from this interval
-    /// @return the difference of the interval and the double as a new interval
-    interval operator-(double const &obj);
-
-    /// @brief Operator overload for multiplication of an interval and a double
-    /// @param obj the double to multiply this interval by
-    /// @return the product of the interval and the double as a new interval
-    interval operator*(double const &obj);
-
-    /// @brief Operator overload for division of an interval and a double
-    /// @param obj the double to divide this interval by
-    /// @return the quotient of the interval and the double as a new interval
-    interval operator/(double const &obj);
+    /// @brief Operator overload for addition of an interval and a scalar
+    /// @param obj the scalar to add to this interval
+    /// @return the sum of the interval and the scalar as a new interval
+    template <interval_scalar S>
+    constexpr basic_interval operator+(S const &obj) const & noexcept;
+
+    /// @brief Operator overload for addition of an interval and a scalar where this interval is a temporary
+    /// @param obj the scalar
+    /// @return the sum of the interval and the scalar, computed in the storage of the temporary
+    template <interval_scalar S>
+    constexpr basic_interval operator+(S const &obj) && noexcept;
+
+    /// @brief Operator overload for subtraction of an interval and a scalar
+    /// @param obj the scalar to subtract from this interval
+    /// @return the difference of the interval and the scalar as a new interval
+    template <interval_scalar S>
+    constexpr basic_interval operator-(S const &obj) const & noexcept;
+
+    /// @brief Operator overload for subtraction of an interval and a scalar where this interval is a temporary
+    /// @param obj the scalar
+    /// @return the difference of the interval and the scalar, computed in the storage of the temporary
+    template <interval_scalar S>
+    constexpr basic_interval operator-(S const &obj) && noexcept;
+
+    /// @brief Operator overload for multiplication of an interval and a scalar
+    /// @param obj the scalar to multiply this interval by
+    /// @return the product of the interval and the scalar as a new interval
+    template <interval_scalar S>
+    constexpr basic_interval operator*(S const &obj) const & noexcept;
+
+    /// @brief Operator overload for multiplication of an interval and a scalar where this interval is a temporary
+    /// @param obj the scalar
+    /// @return the product of the interval and the scalar, computed in the storage of the temporary
+    template <interval_scalar S>
+    constexpr basic_interval operator*(S const &obj) && noexcept;
+
+    /// @brief Operator overload for division of an interval and a scalar
+    /// @param obj the scalar to divide this interval by
+    /// @return the quotient of the interval and the scalar as a new interval
+    template <interval_scalar S>
+    constexpr basic_interval operator/(S const &obj) const & noexcept;
+
+    /// @brief Operator overload for division of an interval and a scalar where this interval is a temporary
+    /// @param obj the scalar
+    /// @return the quotient of the interval and the scalar, computed in the storage of the temporary
+    template <interval_scalar S>
+    constexpr basic_interval operator/(S const &obj) && noexcept;
 
     //---------------------------------------------------------------------------------------------------------------------
-    //                                                interval double compound operators
+    //                                                interval scalar compound operators
     //---------------------------------------------------------------------------------------------------------------------
 
-    /// @brief Operator overload for addition AND assignment of an interval and a double
-    /// @param obj the double to add to this interval
-    /// @return the sum of the interval and the double as a new interval
-    interval operator+=(double const &obj);
-
-    /// @brief Operator overload for subtraction AND assignment of an interval and a double
-    /// @param obj the double to subtract from this interval
-    /// @return the difference of the interval and the double as a new interval
-    interval operator-=(double const &obj);
-
-    /// @brief Operator overload for multiplication AND assignment of an interval and a double
-    /// @param obj the double to multiply this interval by
-    /// @return the product of the interval and the double as a new interval
-    interval operator*=(double const &obj);
-
-    /// @brief Operator overload for division AND assignment of an interval and a double
-    /// @param obj the double to divide this interval by
-    /// @return the quotient of the interval and the double as a new interval
-    interval operator/=(double const &obj);
+    /// @brief Operator overload for addition AND assignment of an interval and a scalar
+    /// @param obj the scalar to add to this interval
+    /// @return a reference to this interval
+    template <interval_scalar S>
+    constexpr basic_interval &operator+=(S const &obj) noexcept;
+
+    /// @brief Operator overload for subtraction AND assignment of an interval and a scalar
+    /// @param obj the scalar to subtract from this interval
+    /// @return a reference to this interval
+    template <interval_scalar S>
+    constexpr basic_interval &operator-=(S const &obj) noexcept;
+
+    /// @brief Operator overload for multiplication AND assignment of an interval and a scalar
+    /// @param obj the scalar to multiply this interval by
+    /// @return a reference to this interval
+    template <interval_scalar S>
+    constexpr basic_interval &operator*=(S const &obj) noexcept;
+
+    /// @brief Operator overload for division AND assignment of an interval and a scalar
+    /// @param obj the scalar to divide this interval by
+    /// @return a reference to this interval
+    template <interval_scalar S>
+    constexpr basic_interval &operator/=(S const &obj) noexcept;
 
     //---------------------------------------------------------------------------------------------------------------------
-    //                                                 double interval operators
+    //                                                 scalar interval operators
     //---------------------------------------------------------------------------------------------------------------------
 
-    /// @brief Operator overload for addition of a double and an interval
-    /// @param obj the double to add to this interval
-    /// @return the sum of the interval and the double as a new interval
-    friend interval operator+(double const &obj, interval const &obj2);
-
-    /// @brief Operator overload for subtraction of a double and an interval
-    /// @param obj the double to subtract from this interval
-    /// @return the difference of the interval and the double as a new interval
-    friend interval operator-(double const &obj, interval const &obj2);
-
-    /// @brief Operator overload for multiplication of a double and an interval
-    /// @param obj the double to multiply this interval by
-    /// @return the product of the interval and the double as a new interval
-    friend interval operator*(double const &obj, interval const &obj2);
-
-    /// @brief Operator overload for division of a double and an interval
-    /// @param obj the double to divide this interval by
-    /// @return the quotient of the interval and the double as a new interval
-    friend interval operator/(double const &obj, interval const &obj2);
-
-    //---------------------------------------------------------------------------------------------------------------------
-    //                                                 ios interval operators
-    //---------------------------------------------------------------------------------------------------------------------
-
-    /// @brief Operator overload to load the output stream object
-    /// @param obj the interval to print to the output stream object
-    /// @return the output stream object
-    friend std::ostream &operator<<(std::ostream &os, interval const &obj);
-
-    /// @brief Operator overload to load the input stream object
-    /// @param obj the interval to read from the input stream object
-    /// @return the input stream object
-    friend std::istream &operator>>(std::istream &is, interval &obj);
+    /// @brief Operator overload for addition of a scalar and an interval
+    /// @param obj the scalar to add to this interval
+    /// @return the sum of the interval and the scalar as a new interval
+    template <interval_scalar S, class U, class R>
+    friend constexpr basic_interval<U, R> operator+(S const &obj, basic_interval<U, R> const &obj2) noexcept;
+
+    /// @brief Operator overload for subtraction of a scalar and an interval
+    /// @param obj the scalar to subtract from this interval
+    /// @return the difference of the interval and the scalar as a new interval
+    template <interval_scalar S, class U, class R>
+    friend constexpr basic_interval<U, R> operator-(S const &obj, basic_interval<U, R> const &obj2) noexcept;
+
+    /// @brief Operator overload for multiplication of a scalar and an interval
+    /// @param obj the scalar to multiply this interval by
+    /// @return the product of the interval and the scalar as a new interval
+    template <interval_scalar S, class U, class R>
+    friend constexpr basic_interval<U, R> operator*(S const &obj, basic_interval<U, R> const &obj2) noexcept;
+
+    /// @brief Operator overload for division of a scalar and an interval
+    /// @param obj the scalar to divide this interval by
+    /// @return the quotient of the interval and the scalar as a new interval
+    template <interval_scalar S, class U, class R>
+    friend constexpr basic_interval<U, R> operator/(S const &obj, basic_interval<U, R> const &obj2) noexcept;
 
 private:
     //---------------------------------------------------------------------------------------------------------------------
     //                                                 Private Variables
     //---------------------------------------------------------------------------------------------------------------------
 
-    double Min; ///< The minimum value of the interval
-    double Max; ///< The maximum value of the interval
+    T Min = T(0); ///< The minimum value of the interval
+    T Max = T(0); ///< The maximum value of the interval
 
     //---------------------------------------------------------------------------------------------------------------------
     //                                                Private Functions
     //---------------------------------------------------------------------------------------------------------------------
 
-    /// @brief Finds the minimum of four values
+    /// @brief Finds the smaller of two values without a branch
     /// @param a value 1
     /// @param b value 2
-    /// @param c value 3
-    /// @param d value 4
-    /// @return the minimum of the four values
-    static double find_min(double a, double b, double c, double d);
+    /// @return the smaller of the two values
+    static constexpr T min2(T a, T b) noexcept { return b < a ? b : a; }
 
-    /// @brief Finds the maximum of four values
+    /// @brief Finds the larger of two values without a branch
     /// @param a value 1
     /// @param b value 2
-    /// @param c value 3
-    /// @param d value 4
-    /// @return the maximum of the four values
-    static double find_max(double a, double b, double c, double d);
-};
\ No newline at end of file
+    /// @return the larger of the two values
+    static constexpr T max2(T a, T b) noexcept { return b > a ? b : a; }
+
+    /// @brief Takes a NaN product of two end points as zero
+    /// @details Of two end points that are numbers, only an unbounded one times a zero one gives NaN, and the product of the real numbers they bound is zero. #basic_interval::min2 and #basic_interval::max2 drop a NaN second operand and keep a NaN first one, so the products are reduced in a chain that starts from one product passed through this function, and every other NaN product lands where it is dropped. A dropped NaN product never moves an end point: the product of the other end point with the same zero is also zero, or the result is unbounded both ways.
+    /// @param product the product of two end points, rounded as needed
+    /// @return zero if the product is NaN, otherwise the product
+    static constexpr T times0(T product) noexcept { return product == product ? product : T(0); }
+};
+
+/// @brief Interval with float end points, half the size of #interval
+using intervalf = basic_interval<float>;
+
+/// @brief Interval with double end points rounded to nearest, the original interval class
+using interval = basic_interval<double>;
+
+/// @brief Interval with long double end points
+using intervall = basic_interval<long double>;
+
+/// @brief #interval that reports every operator to interval_instrument.h
+using instrumented_interval = basic_interval<double, rounding::instrumented<rounding::fast>>;
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 ios interval operators
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Operator overload to load the output stream object
+/// @param obj the interval to print to the output stream object
+/// @return the output stream object
+template <class T, class Rounding>
+std::ostream &operator<<(std::ostream &os, basic_interval<T, Rounding> const &obj);
+
+/// @brief Operator overload to load the input stream object
+/// @param obj the interval to read from the input stream object
+/// @return the input stream object
+template <class T, class Rounding>
+std::istream &operator>>(std::istream &is, basic_interval<T, Rounding> &obj);
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 layout guarantees
+//---------------------------------------------------------------------------------------------------------------------
+
+static_assert(std::is_trivially_copyable_v<interval>, "interval must stay trivially copyable so arrays of it can be memcpy'd");
+static_assert(std::is_standard_layout_v<interval>, "interval must keep Min and Max as its only members");
+static_assert(sizeof(interval) == 2 * sizeof(double), "interval must be exactly two doubles");
+static_assert(std::is_trivially_copyable_v<intervalf> && sizeof(intervalf) == 2 * sizeof(float), "intervalf must be exactly two floats");
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 inline implementation
+//---------------------------------------------------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 interval constructors
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details This constructor initialises a interval object and places the values into the min and max variables.
+template <class T, class Rounding>
+constexpr basic_interval<T, Rounding>::basic_interval(T min, T max) noexcept : Min(min), Max(max) {}
+
+/// @details This constructor initialises a interval object and places the value into the min and max variables.
+template <class T, class Rounding>
+constexpr basic_interval<T, Rounding>::basic_interval(T val) noexcept : Min(val), Max(val) {}
+
+/// @details This constructor rounds the scalar down for the min value and up for the max value, so the interval is degenerate when T represents the scalar and one ulp wide otherwise.
+template <class T, class Rounding>
+template <interval_scalar S>
+    requires(!std::is_same_v<S, T>)
+constexpr basic_interval<T, Rounding>::basic_interval(S val) noexcept
+    : Min(rounding::convert_down<T>(val)), Max(rounding::convert_up<T>(val)) {}
+
+/// @details This constructor rounds the min value down and the max value up, which is exact when T is at least as wide as U.
+template <class T, class Rounding>
+template <class U, class R>
+    requires(!std::is_same_v<U, T> || !std::is_same_v<R, Rounding>)
+constexpr basic_interval<T, Rounding>::basic_interval(basic_interval<U, R> const &obj) noexcept
+    : Min(rounding::convert_down<T>(obj.min())), Max(rounding::convert_up<T>(obj.max())) {}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 compound interval operators
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details This function overloads the += operator to add and assign an interval to another interval. The min and max values are added to the interval, rounded down and up by the rounding policy, and a reference to the interval is returned.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+constexpr basic_interval<T, Rounding> &basic_interval<T, Rounding>::operator+=(basic_interval const &obj) noexcept
+{
+    [[maybe_unused]] typename Rounding::guard guard; // set the rounding mode if the policy needs it
+    instrument::operands<Rounding, T> seen(Min, Max, obj.Min, obj.Max);
+
+    T min = rounding::add_down<Rounding>(Min, obj.Min); // add the min values together
+    Max = rounding::add_up<Rounding>(Max, obj.Max);     // add the max values together
+    Min = min;
+
+    seen.report(instrument::op::add, Min, Max);
+    return *this; // return the interval
+}
+
+/// @details This function overloads the -= operator to subtract and assign an interval to another interval. The min and max values are subtracted from the interval, rounded down and up by the rounding policy, and a reference to the interval is returned.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+constexpr basic_interval<T, Rounding> &basic_interval<T, Rounding>::operator-=(basic_interval const &obj) noexcept
+{
+    [[maybe_unused]] typename Rounding::guard guard; // set the rounding mode if the policy needs it
+    instrument::operands<Rounding, T> seen(Min, Max, obj.Min, obj.Max);
+
+    T min = rounding::sub_down<Rounding>(Min, obj.Max); // subtract the max values
+    Max = rounding::sub_up<Rounding>(Max, obj.Min);     // subtract the min values
+    Min = min;                                          // written last so that p -= p reads the original values
+
+    seen.report(instrument::op::sub, Min, Max);
+    return *this; // return the interval
+}
+
+/// @details This function overloads the *= operator to multiply and assign an interval to another interval. All permutations of the min and max values are multiplied together and reduced with #basic_interval::min2 and #basic_interval::max2, which compile to single min and max instructions, so the operator has no branches to mispredict when the signs of the operands vary.
+/// @details Picking two products by sign class (Moore's nine case table) saves two multiplications but needs selects between doubles, which compilers emit as branches; on mixed sign data that is several times slower than the four products (Benchmark Code/bench_sign_classes.cpp).
+/// @details Policies that round upward form the four products twice, once rounded down by negation and once rounded up. The other policies form them once and round the two reduced end points.
+/// @details A zero end point times an unbounded one, which gives NaN, counts as zero (#basic_interval::times0), so [1, inf] * [0, 1] is [0, inf] and entire() * [0, 1] is entire() in either order. Replacing one NaN and dropping the others keeps the extra cost to a single select.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+constexpr basic_interval<T, Rounding> &basic_interval<T, Rounding>::operator*=(basic_interval const &obj) noexcept
+{
+    [[maybe_unused]] typename Rounding::guard guard; // set the rounding mode if the policy needs it
+    instrument::operands<Rounding, T> seen(Min, Max, obj.Min, obj.Max);
+    using rounding::mul_down, rounding::mul_up;
+
+    if constexpr (Rounding::upward) // the lower end point needs its own products rounded down
+    {
+        T a = times0(mul_down<Rounding>(Min, obj.Min)); // multiply the min values
+        T b = mul_down<Rounding>(Min, obj.Max);         // multiply the min value by the max value
+        T c = mul_down<Rounding>(Max, obj.Min);         // multiply the max value by the min value
+        T d = mul_down<Rounding>(Max, obj.Max);         // multiply the max values
+        T min = min2(min2(min2(a, b), c), d);           // find the minimum value
+
+        a = times0(mul_up<Rounding>(Min, obj.Min)); // the same products rounded up
+        b = mul_up<Rounding>(Min, obj.Max);
+        c = mul_up<Rounding>(Max, obj.Min);
+        d = mul_up<Rounding>(Max, obj.Max);
+        Max = max2(max2(max2(a, b), c), d); // find the maximum value
+        Min = min;
+    }
+    else // down and up are monotone, so they are applied once to the reduced end points
+    {
+        T a = times0(Min * obj.Min); // multiply the min values
+        T b = Min * obj.Max;         // multiply the min value by the max value
+        T c = Max * obj.Min;         // multiply the max value by the min value
+        T d = Max * obj.Max;         // multiply the max values
+
+        Min = Rounding::down(min2(min2(min2(a, b), c), d)); // find the minimum value
+        Max = Rounding::up(max2(max2(max2(a, b), c), d));   // find the maximum value
+    }
+
+    seen.report(instrument::op::mul, Min, Max);
+    return *this; // return the interval
+}
+
+/// @details This function overloads the /= operator to divide and assign an interval to another interval. If the divisor contains zero the quotient is unbounded and the interval becomes #basic_interval::entire. Otherwise Moore's table is used: the sign of the divisor and one sign test on this interval pick the two quotients that form the end points, so only two of the four divisions are performed.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+constexpr basic_interval<T, Rounding> &basic_interval<T, Rounding>::operator/=(basic_interval const &obj) noexcept
+{
+    [[maybe_unused]] typename Rounding::guard guard; // set the rounding mode if the policy needs it
+    instrument::operands<Rounding, T> seen(Min, Max, obj.Min, obj.Max);
+    constexpr T zero = T(0);                         // compared in the end point type
+
+    bool b_pos = obj.Min > zero;              // the divisor is strictly positive
+    bool b_zero = !b_pos & !(obj.Max < zero); // the divisor contains zero
+
+    T lo_n = b_pos ? Min : Max;                                                             // numerator of the min value
+    T lo_d = b_pos ? (Min >= zero ? obj.Max : obj.Min) : (Max <= zero ? obj.Min : obj.Max); // denominator of the min value
+    T hi_n = b_pos ? Max : Min;                                                             // numerator of the max value
+    T hi_d = b_pos ? (Max <= zero ? obj.Max : obj.Min) : (Min >= zero ? obj.Min : obj.Max); // denominator of the max value
+
+    T min = rounding::div_down<Rounding>(lo_n, lo_d); // divide the factors of the min value
+    T max = rounding::div_up<Rounding>(hi_n, hi_d);   // divide the factors of the max value
+
+    Min = b_zero ? -std::numeric_limits<T>::infinity() : min; // unbounded below if the divisor contains zero
+    Max = b_zero ? std::numeric_limits<T>::infinity() : max;  // unbounded above if the divisor contains zero
+
+    seen.report(instrument::op::div, Min, Max);
+    return *this; // return the interval
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 basic interval operators
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details This function overloads the + operator to add two intervals together. A copy of this interval is made and the other interval is added to it with #basic_interval::operator+=. The copy is then returned.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+constexpr basic_interval<T, Rounding> basic_interval<T, Rounding>::operator+(basic_interval const &obj) const & noexcept
+{
+    basic_interval temp(*this); // create a temporary interval
+    temp += obj;                // add the other interval to it
+    return temp;                // return the temporary interval
+}
+
+/// @details This function overloads the + operator for a temporary left hand side. The temporary already owns storage for the result, so the sum is accumulated into it directly.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+constexpr basic_interval<T, Rounding> basic_interval<T, Rounding>::operator+(basic_interval const &obj) && noexcept
+{
+    return *this += obj; // accumulate into the temporary
+}
+
+/// @details This function overloads the - operator to subtract two intervals together. A copy of this interval is made and the other interval is subtracted from it with #basic_interval::operator-=. The copy is then returned.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+constexpr basic_interval<T, Rounding> basic_interval<T, Rounding>::operator-(basic_interval const &obj) const & noexcept
+{
+    basic_interval temp(*this); // create a temporary interval
+    temp -= obj;                // subtract the other interval from it
+    return temp;                // return the temporary interval
+}
+
+/// @details This function overloads the - operator for a temporary left hand side, subtracting directly in the storage of the temporary.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+constexpr basic_interval<T, Rounding> basic_interval<T, Rounding>::operator-(basic_interval const &obj) && noexcept
+{
+    return *this -= obj; // accumulate into the temporary
+}
+
+/// @details This function overloads the * operator to multiply two intervals together. A copy of this interval is made and multiplied by the other interval with #basic_interval::operator*=. The copy is then returned.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+constexpr basic_interval<T, Rounding> basic_interval<T, Rounding>::operator*(basic_interval const &obj) const & noexcept
+{
+    basic_interval temp(*this); // create a temporary interval
+    temp *= obj;                // multiply it by the other interval
+    return temp;                // return the temporary interval
+}
+
+/// @details This function overloads the * operator for a temporary left hand side, multiplying directly in the storage of the temporary.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+constexpr basic_interval<T, Rounding> basic_interval<T, Rounding>::operator*(basic_interval const &obj) && noexcept
+{
+    return *this *= obj; // accumulate into the temporary
+}
+
+/// @details This function overloads the / operator to divide two intervals together. A copy of this interval is made and divided by the other interval with #basic_interval::operator/=. The copy is then returned.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+constexpr basic_interval<T, Rounding> basic_interval<T, Rounding>::operator/(basic_interval const &obj) const & noexcept
+{
+    basic_interval temp(*this); // create a temporary interval
+    temp /= obj;                // divide it by the other interval
+    return temp;                // return the temporary interval
+}
+
+/// @details This function overloads the / operator for a temporary left hand side, dividing directly in the storage of the temporary.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+constexpr basic_interval<T, Rounding> basic_interval<T, Rounding>::operator/(basic_interval const &obj) && noexcept
+{
+    return *this /= obj; // accumulate into the temporary
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                interval scalar compound operators
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details This function overloads the += operator to add and assign a scalar to an interval. The scalar is added to the min and max values of the interval, rounded down and up by the rounding policy, and a reference to the interval is returned. A scalar that T cannot hold exactly is added as the interval that encloses it.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+template <interval_scalar S>
+constexpr basic_interval<T, Rounding> &basic_interval<T, Rounding>::operator+=(S const &obj) noexcept
+{
+    if constexpr (!rounding::exact_conversion<S, T>)
+        return *this += basic_interval(obj); // enclose the scalar first
+    else
+    {
+        [[maybe_unused]] typename Rounding::guard guard; // set the rounding mode if the policy needs it
+        T val = static_cast<T>(obj);                     // exact
+        instrument::operands<Rounding, T> seen(Min, Max, val, val);
+
+        Min = rounding::add_down<Rounding>(Min, val); // add the scalar to the min value
+        Max = rounding::add_up<Rounding>(Max, val);   // add the scalar to the max value
+
+        seen.report(instrument::op::add, Min, Max);
+        return *this; // return the interval
+    }
+}
+
+/// @details This function overloads the -= operator to subtract and assign a scalar from an interval. The scalar is subtracted from the min and max values of the interval, rounded down and up by the rounding policy, and a reference to the interval is returned. A scalar that T cannot hold exactly is subtracted as the interval that encloses it.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+template <interval_scalar S>
+constexpr basic_interval<T, Rounding> &basic_interval<T, Rounding>::operator-=(S const &obj) noexcept
+{
+    if constexpr (!rounding::exact_conversion<S, T>)
+        return *this -= basic_interval(obj); // enclose the scalar first
+    else
+    {
+        [[maybe_unused]] typename Rounding::guard guard; // set the rounding mode if the policy needs it
+        T val = static_cast<T>(obj);                     // exact
+        instrument::operands<Rounding, T> seen(Min, Max, val, val);
+
+        Min = rounding::sub_down<Rounding>(Min, val); // subtract the scalar from the min value
+        Max = rounding::sub_up<Rounding>(Max, val);   // subtract the scalar from the max value
+
+        seen.report(instrument::op::sub, Min, Max);
+        return *this; // return the interval
+    }
+}
+
+/// @details This function overloads the *= operator to multiply and assign a scalar to an interval. Both end points are multiplied by the scalar and the two products are ordered with #basic_interval::min2 and #basic_interval::max2, so two multiplications and no branches are needed under rounding::fast. A reference to the interval is returned.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+template <interval_scalar S>
+constexpr basic_interval<T, Rounding> &basic_interval<T, Rounding>::operator*=(S const &obj) noexcept
+{
+    if constexpr (!rounding::exact_conversion<S, T>)
+        return *this *= basic_interval(obj); // enclose the scalar first
+    else
+    {
+        [[maybe_unused]] typename Rounding::guard guard; // set the rounding mode if the policy needs it
+        using rounding::mul_down, rounding::mul_up;
+        T val = static_cast<T>(obj); // exact
+        instrument::operands<Rounding, T> seen(Min, Max, val, val);
+
+        T min = min2(times0(mul_down<Rounding>(Min, val)), mul_down<Rounding>(Max, val)); // a negative scalar swaps the end points
+        Max = max2(times0(mul_up<Rounding>(Min, val)), mul_up<Rounding>(Max, val));
+        Min = min;
+
+        seen.report(instrument::op::mul, Min, Max);
+        return *this; // return the interval
+    }
+}
+
+/// @details This function overloads the /= operator to divide and assign an interval by a scalar. Both end points are divided by the scalar and the two quotients are ordered with #basic_interval::min2 and #basic_interval::max2. Dividing by zero gives #basic_interval::entire, as for an interval divisor that contains zero. A reference to the interval is returned.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+template <interval_scalar S>
+constexpr basic_interval<T, Rounding> &basic_interval<T, Rounding>::operator/=(S const &obj) noexcept
+{
+    if constexpr (!rounding::exact_conversion<S, T>)
+        return *this /= basic_interval(obj); // enclose the scalar first
+    else
+    {
+        [[maybe_unused]] typename Rounding::guard guard; // set the rounding mode if the policy needs it
+        using rounding::div_down, rounding::div_up;
+        T val = static_cast<T>(obj); // exact
+        instrument::operands<Rounding, T> seen(Min, Max, val, val);
+
+        T min = min2(div_down<Rounding>(Min, val), div_down<Rounding>(Max, val)); // a negative scalar swaps the end points
+        T max = max2(div_up<Rounding>(Min, val), div_up<Rounding>(Max, val));
+
+        bool zero = val == T(0); // dividing by zero makes both end points unbounded
+        Min = zero ? -std::numeric_limits<T>::infinity() : min;
+        Max = zero ? std::numeric_limits<T>::infinity() : max;
+
+        seen.report(instrument::op::div, Min, Max);
+        return *this; // return the interval
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                interval scalar operators
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details This function overloads the + operator to add a scalar to a interval. A temporary interval is created and the value of the scalar is added to the temporary interval. The temporary interval is then returned.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+template <interval_scalar S>
+constexpr basic_interval<T, Rounding> basic_interval<T, Rounding>::operator+(S const &obj) const & noexcept
+{
+    basic_interval temp(*this); // create a temporary interval
+    temp += obj;                // add the scalar to it
+    return temp;                // return the temporary interval
+}
+
+/// @details This function overloads the + operator for a temporary interval and a scalar, adding directly in the storage of the temporary. Without this overload, a temporary plus a scalar would be ambiguous between the const scalar form and the temporary interval form, which converts the scalar.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+template <interval_scalar S>
+constexpr basic_interval<T, Rounding> basic_interval<T, Rounding>::operator+(S const &obj) && noexcept
+{
+    return *this += obj; // accumulate into the temporary
+}
+
+/// @details This function overloads the - operator to subtract a scalar from a interval. A temporary interval is created and the value of the scalar is subtracted from the temporary interval. The temporary interval is then returned.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+template <interval_scalar S>
+constexpr basic_interval<T, Rounding> basic_interval<T, Rounding>::operator-(S const &obj) const & noexcept
+{
+    basic_interval temp(*this); // create a temporary interval
+    temp -= obj;                // subtract the scalar from it
+    return temp;                // return the temporary interval
+}
+
+/// @details This function overloads the - operator for a temporary interval and a scalar, subtracting directly in the storage of the temporary.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+template <interval_scalar S>
+constexpr basic_interval<T, Rounding> basic_interval<T, Rounding>::operator-(S const &obj) && noexcept
+{
+    return *this -= obj; // accumulate into the temporary
+}
+
+/// @details This function overloads the * operator to multiply a scalar by a interval. A temporary interval is created and multiplied by the scalar with #basic_interval::operator*=. The temporary interval is then returned.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+template <interval_scalar S>
+constexpr basic_interval<T, Rounding> basic_interval<T, Rounding>::operator*(S const &obj) const & noexcept
+{
+    basic_interval temp(*this); // create a temporary interval
+    temp *= obj;                // multiply it by the scalar
+    return temp;                // return the temporary interval
+}
+
+/// @details This function overloads the * operator for a temporary interval and a scalar, multiplying directly in the storage of the temporary.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+template <interval_scalar S>
+constexpr basic_interval<T, Rounding> basic_interval<T, Rounding>::operator*(S const &obj) && noexcept
+{
+    return *this *= obj; // accumulate into the temporary
+}
+
+/// @details This function overloads the / operator to divide a scalar by a interval. A temporary interval is created and divided by the scalar with #basic_interval::operator/=. The temporary interval is then returned.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+template <interval_scalar S>
+constexpr basic_interval<T, Rounding> basic_interval<T, Rounding>::operator/(S const &obj) const & noexcept
+{
+    basic_interval temp(*this); // create a temporary interval
+    temp /= obj;                // divide it by the scalar
+    return temp;                // return the temporary interval
+}
+
+/// @details This function overloads the / operator for a temporary interval and a scalar, dividing directly in the storage of the temporary.
+/// @par Test Data: Example/Example.cpp
+template <class T, class Rounding>
+template <interval_scalar S>
+constexpr basic_interval<T, Rounding> basic_interval<T, Rounding>::operator/(S const &obj) && noexcept
+{
+    return *this /= obj; // accumulate into the temporary
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 scalar interval operators
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details This function overloads the + operator to add a interval to a scalar. Addition is commutative so the scalar is added to a copy of the interval with #basic_interval::operator+=.
+/// @par Test Data: Example/Example.cpp
+template <interval_scalar S, class U, class R>
+constexpr basic_interval<U, R> operator+(S const &obj, basic_interval<U, R> const &obj2) noexcept
+{
+    basic_interval<U, R> temp(obj2); // create a temporary interval
+    temp += obj;                     // add the scalar to it
+    return temp;                     // return the temporary interval
+}
+
+/// @details This function overloads the - operator to subtract a interval from a scalar. A temporary interval is created and the end points of the interval are subtracted from the scalar. The temporary interval is then returned. A scalar that U cannot hold exactly is first enclosed in an interval.
+/// @par Test Data: Example/Example.cpp
+template <interval_scalar S, class U, class R>
+constexpr basic_interval<U, R> operator-(S const &obj, basic_interval<U, R> const &obj2) noexcept
+{
+    if constexpr (!rounding::exact_conversion<S, U>)
+        return basic_interval<U, R>(obj) - obj2; // enclose the scalar first
+    else
+    {
+        [[maybe_unused]] typename R::guard guard; // set the rounding mode if the policy needs it
+        basic_interval<U, R> temp;                // create a temporary interval
+        U val = static_cast<U>(obj);              // exact
+        instrument::operands<R, U> seen(val, val, obj2.Min, obj2.Max);
+
+        temp.Min = rounding::sub_down<R>(val, obj2.Max); // subtract the max value from the scalar
+        temp.Max = rounding::sub_up<R>(val, obj2.Min);   // subtract the min value from the scalar
+
+        seen.report(instrument::op::sub, temp.Min, temp.Max);
+        return temp; // return the temporary interval
+    }
+}
+
+/// @details This function overloads the * operator to multiply a interval by a scalar. Multiplication is commutative so the interval is multiplied by the scalar with #basic_interval::operator*=, which needs two multiplications.
+/// @par Test Data: Example/Example.cpp
+template <interval_scalar S, class U, class R>
+constexpr basic_interval<U, R> operator*(S const &obj, basic_interval<U, R> const &obj2) noexcept
+{
+    basic_interval<U, R> temp(obj2); // create a temporary interval
+    temp *= obj;                     // multiply it by the scalar
+    return temp;                     // return the temporary interval
+}
+
+/// @details This function overloads the / operator to divide a scalar by an interval. If the interval contains zero the quotient is #basic_interval::entire. Otherwise the scalar is divided by both end points and the two quotients are ordered with #basic_interval::min2 and #basic_interval::max2.
+/// @par Test Data: Example/Example.cpp
+template <interval_scalar S, class U, class R>
+constexpr basic_interval<U, R> operator/(S const &obj, basic_interval<U, R> const &obj2) noexcept
+{
+    if constexpr (!rounding::exact_conversion<S, U>)
+        return basic_interval<U, R>(obj) / obj2; // enclose the scalar first
+    else
+    {
+        [[maybe_unused]] typename R::guard guard; // set the rounding mode if the policy needs it
+        using I = basic_interval<U, R>;
+        I temp;                      // create a temporary interval
+        U val = static_cast<U>(obj); // exact
+        instrument::operands<R, U> seen(val, val, obj2.Min, obj2.Max);
+
+        U min = I::min2(rounding::div_down<R>(val, obj2.Min), rounding::div_down<R>(val, obj2.Max)); // a negative scalar swaps the end points
+        U max = I::max2(rounding::div_up<R>(val, obj2.Min), rounding::div_up<R>(val, obj2.Max));
+
+        bool zero = !(obj2.Min > U(0)) & !(obj2.Max < U(0)); // the interval contains zero
+        temp.Min = zero ? -std::numeric_limits<U>::infinity() : min;
+        temp.Max = zero ? std::numeric_limits<U>::infinity() : max;
+
+        seen.report(instrument::op::div, temp.Min, temp.Max);
+        return temp; // return the temporary interval
+    }
+}
@@ -0,0 +1,629 @@
+/// @file interval_array.cpp
+/// @brief Implementation of the basic_interval_array class and its batch kernels
+/// @author George Downing
+/// @date 17-10-2026
+/// @details This file contains the storage management of basic_interval_array and the SIMD kernels behind the batch operators. Each kernel is written once with GCC vector extensions and compiled for several instruction sets and for float and double end points; the widest instruction set the processor supports is chosen the first time a kernel runs.
+/// @details Elements that do not fill a whole register are computed with the interval operators themselves, so both paths share one definition of the arithmetic.
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                    include files
+//---------------------------------------------------------------------------------------------------------------------
+
+#include "interval_array.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define INTERVAL_ARRAY_X86 1 ///< the x86 kernels and run time detection are available
+#else
+#define INTERVAL_ARRAY_X86 0 ///< only the scalar kernels are available
+#endif
+
+#if INTERVAL_ARRAY_X86
+// The kernels pass vector types between always_inline helpers that are compiled without AVX. They are always inlined into
+// a function built for the right instruction set, so the ABI note GCC emits for them does not apply.
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 basic_interval_array storage
+//---------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    /// @brief Rounds a number of end points up to a whole number of alignment blocks
+    /// @param n the number of end points
+    /// @return the padded number of end points
+    template <class T>
+    std::size_t padded(std::size_t n) noexcept
+    {
+        constexpr std::size_t per_block = basic_interval_array<T>::alignment / sizeof(T); // end points per cache line
+        return (n + per_block - 1) / per_block * per_block;
+    }
+
+    /// @brief Allocates room for both columns of an array in one aligned block
+    /// @param capacity the number of intervals each column must hold
+    /// @return the start of the block, nullptr when capacity is zero
+    template <class T>
+    T *allocate(std::size_t capacity)
+    {
+        if (capacity == 0)
+            return nullptr;
+        return static_cast<T *>(::operator new(2 * capacity * sizeof(T), std::align_val_t(basic_interval_array<T>::alignment)));
+    }
+
+    /// @brief Releases a block made by allocate
+    /// @param block the block to release, may be nullptr
+    template <class T>
+    void deallocate(T *block) noexcept
+    {
+        if (block)
+            ::operator delete(block, std::align_val_t(basic_interval_array<T>::alignment));
+    }
+} // namespace
+
+/// @details This constructor allocates both columns and sets every interval to [0, 0], the value of a default constructed interval.
+template <class T>
+basic_interval_array<T>::basic_interval_array(std::size_t n) : basic_interval_array(n, interval_type()) {}
+
+/// @details This constructor allocates both columns and copies the end points of fill into every element.
+template <class T>
+basic_interval_array<T>::basic_interval_array(std::size_t n, interval_type const &fill)
+    : Size(n), Capacity(padded<T>(n))
+{
+    Lo = allocate<T>(Capacity);        // one block for both columns
+    Hi = Lo ? Lo + Capacity : nullptr; // the upper column follows the lower one
+    std::fill_n(Lo, Size, fill.min()); // fill the lower end points
+    std::fill_n(Hi, Size, fill.max()); // fill the upper end points
+}
+
+/// @details This constructor allocates new columns of the same size and copies both columns of obj into them.
+template <class T>
+basic_interval_array<T>::basic_interval_array(basic_interval_array const &obj)
+    : Size(obj.Size), Capacity(padded<T>(obj.Size))
+{
+    Lo = allocate<T>(Capacity);                                // one block for both columns
+    Hi = Lo ? Lo + Capacity : nullptr;                         // the upper column follows the lower one
+    std::copy_n(obj.Lo, Size, Lo);                             // copy the lower end points
+    std::copy_n(obj.Hi, Size, Hi);                             // copy the upper end points
+}
+
+/// @details This constructor only allocates, leaving the end points as the allocator returned them.
+template <class T>
+basic_interval_array<T>::basic_interval_array(std::size_t n, std::nullptr_t)
+    : Size(n), Capacity(padded<T>(n))
+{
+    Lo = allocate<T>(Capacity);        // one block for both columns
+    Hi = Lo ? Lo + Capacity : nullptr; // the upper column follows the lower one
+}
+
+/// @details This function calls the private constructor that skips the fill; large blocks come straight from the operating system, so their pages are only placed when first written.
+template <class T>
+basic_interval_array<T> basic_interval_array<T>::for_overwrite(std::size_t n)
+{
+    return basic_interval_array(n, nullptr);
+}
+
+/// @details This constructor takes ownership of the columns of obj and leaves obj empty.
+template <class T>
+basic_interval_array<T>::basic_interval_array(basic_interval_array &&obj) noexcept
+    : Lo(obj.Lo), Hi(obj.Hi), Size(obj.Size), Capacity(obj.Capacity)
+{
+    obj.Lo = obj.Hi = nullptr; // obj no longer owns the block
+    obj.Size = obj.Capacity = 0;
+}
+
+/// @details This operator copies obj through a temporary so that this array is unchanged if the allocation fails.
+template <class T>
+basic_interval_array<T> &basic_interval_array<T>::operator=(basic_interval_array const &obj)
+{
+    if (this != &obj)
+        *this = basic_interval_array(obj); // copy then move into place
+    return *this;
+}
+
+/// @details This operator releases the columns of this array and takes ownership of the columns of obj.
+template <class T>
+basic_interval_array<T> &basic_interval_array<T>::operator=(basic_interval_array &&obj) noexcept
+{
+    if (this != &obj)
+    {
+        deallocate(Lo); // release the current block
+        Lo = obj.Lo;
+        Hi = obj.Hi;
+        Size = obj.Size;
+        Capacity = obj.Capacity;
+        obj.Lo = obj.Hi = nullptr; // obj no longer owns the block
+        obj.Size = obj.Capacity = 0;
+    }
+    return *this;
+}
+
+/// @details This destructor releases the block holding both columns.
+template <class T>
+basic_interval_array<T>::~basic_interval_array()
+{
+    deallocate(Lo);
+}
+
+/// @details This function keeps the leading min(size(), n) intervals. A new block is only allocated when n exceeds the capacity of the current one.
+template <class T>
+void basic_interval_array<T>::resize(std::size_t n)
+{
+    if (n > Capacity)
+    {
+        std::size_t capacity = padded<T>(n);
+        T *lo = allocate<T>(capacity);                       // one block for both columns
+        T *hi = lo + capacity;                               // the upper column follows the lower one
+        std::copy_n(Lo, Size, lo);                           // keep the lower end points
+        std::copy_n(Hi, Size, hi);                           // keep the upper end points
+        deallocate(Lo);                                      // release the old block
+        Lo = lo;
+        Hi = hi;
+        Capacity = capacity;
+    }
+    if (n > Size)
+    {
+        std::fill(Lo + Size, Lo + n, T(0)); // new intervals are [0, 0]
+        std::fill(Hi + Size, Hi + n, T(0));
+    }
+    Size = n;
+}
+
+template class basic_interval_array<float>;  // the end point types the kernels are compiled for
+template class basic_interval_array<double>;
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 batch kernels
+//---------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    /// @brief The four batch operations, indexing the rows of each kernel table
+    using op = batch_op;
+
+    /// @brief Which operand, if any, is a single interval shared by every element
+    enum class form
+    {
+        both_arrays,     ///< both operands are arrays
+        broadcast_right, ///< the right operand is a single interval
+        broadcast_left   ///< the left operand is a single interval
+    };
+
+    /// @brief Signature shared by every compiled kernel of one end point type
+    template <class T>
+    using kernel_fn = void (*)(T const *alo, T const *ahi, T const *blo, T const *bhi,
+                               T *olo, T *ohi, std::size_t n);
+
+    /// @brief Applies one operation to a single pair of intervals using the interval operators
+    /// @param a the left operand
+    /// @param b the right operand
+    /// @return the result of the operation
+    template <op Op, class T>
+    [[gnu::always_inline]] inline basic_interval<T> apply(basic_interval<T> const &a, basic_interval<T> const &b) noexcept
+    {
+        if constexpr (Op == op::add)
+            return a + b;
+        else if constexpr (Op == op::sub)
+            return a - b;
+        else if constexpr (Op == op::mul)
+            return a * b;
+        else
+            return a / b;
+    }
+
+#if INTERVAL_ARRAY_X86
+    /// @brief A SIMD register of W end points of type T
+    template <class T, std::size_t W>
+    struct simd
+    {
+        typedef T type __attribute__((vector_size(W * sizeof(T)))); ///< the vector type
+    };
+
+    /// @brief Element wise minimum of two registers, compiles to a single min instruction
+    /// @details The operands are compared in the order of #basic_interval::min2, so a NaN lane gives the same end point as the interval operators.
+    template <class V>
+    [[gnu::always_inline]] inline V vmin(V const &a, V const &b) noexcept { return b < a ? b : a; }
+
+    /// @brief Element wise maximum of two registers, compiles to a single max instruction
+    template <class V>
+    [[gnu::always_inline]] inline V vmax(V const &a, V const &b) noexcept { return b > a ? b : a; }
+
+    /// @brief Takes the NaN lanes of a product as zero, as #basic_interval::times0 does, so an unbounded end point times a zero one counts as zero
+    template <class V>
+    [[gnu::always_inline]] inline V times0(V const &product) noexcept { return product == product ? product : V{}; }
+
+    /// @brief Applies one operation to W pairs of intervals held in registers
+    /// @details The end points equal those of the interval operators. Multiplication forms all four products and reduces them with a branch free minimum and maximum in the same chain as #basic_interval::operator*=. Division picks its two quotients by sign class with blends, as #basic_interval::operator/= does, because the divider is the bottleneck; a divisor containing zero gives #basic_interval::entire.
+    template <op Op, class T, class V>
+    [[gnu::always_inline]] inline void apply(V const &a0, V const &a1, V const &b0, V const &b1, V &lo, V &hi) noexcept
+    {
+        if constexpr (Op == op::add)
+        {
+            lo = a0 + b0; // add the min values together
+            hi = a1 + b1; // add the max values together
+        }
+        else if constexpr (Op == op::sub)
+        {
+            lo = a0 - b1; // subtract the max values
+            hi = a1 - b0; // subtract the min values
+        }
+        else if constexpr (Op == op::mul)
+        {
+            V p = times0(a0 * b0), q = a0 * b1, r = a1 * b0, s = a1 * b1; // all permutations of the end points
+            lo = vmin(vmin(vmin(p, q), r), s);                            // find the minimum value, dropping NaN q, r and s
+            hi = vmax(vmax(vmax(p, q), r), s);                            // find the maximum value
+        }
+        else
+        {
+            constexpr T zero = T(0);                         // compared in the end point type
+            auto b_pos = b0 > zero;                          // lanes whose divisor is strictly positive
+            auto b_bounded = (b_pos ? V{} - 1 : b1) < zero; // lanes whose divisor excludes zero, NaN counted as containing it
+            V lo_n = b_pos ? a0 : a1;                        // numerator of the min value
+            V lo_d = b_pos ? (a0 >= zero ? b1 : b0) : (a1 <= zero ? b0 : b1); // denominator of the min value
+            V hi_n = b_pos ? a1 : a0;                        // numerator of the max value
+            V hi_d = b_pos ? (a1 <= zero ? b1 : b0) : (a0 >= zero ? b0 : b1); // denominator of the max value
+            V inf = V{} + std::numeric_limits<T>::infinity();
+            lo = b_bounded ? lo_n / lo_d : -inf; // unbounded below if the divisor contains zero
+            hi = b_bounded ? hi_n / hi_d : inf;  // unbounded above if the divisor contains zero
+        }
+    }
+#endif
+
+    /// @brief Runs one operation over n elements, W at a time, with the remainder done one interval at a time
+    /// @details A broadcast operand is read once from element zero of its pointers.
+    template <class T, std::size_t W, op Op, form Form>
+    [[gnu::always_inline]] inline void kernel(T const *alo, T const *ahi, T const *blo, T const *bhi,
+                                              T *olo, T *ohi, std::size_t n) noexcept
+    {
+        constexpr bool bcast_a = Form == form::broadcast_left; // left operand is shared
+        constexpr bool bcast_b = Form == form::broadcast_right; // right operand is shared
+        std::size_t i = 0;
+
+#if INTERVAL_ARRAY_X86
+        if constexpr (W > 1)
+        {
+            using V = typename simd<T, W>::type;
+            V ka0 = V{} + alo[0], ka1 = V{} + ahi[0]; // broadcast copies of the left operand
+            V kb0 = V{} + blo[0], kb1 = V{} + bhi[0]; // broadcast copies of the right operand
+            for (; i + W <= n; i += W)
+            {
+                V a0 = ka0, a1 = ka1, b0 = kb0, b1 = kb1, lo, hi;
+                if constexpr (!bcast_a)
+                {
+                    std::memcpy(&a0, alo + i, sizeof(V)); // load W lower end points
+                    std::memcpy(&a1, ahi + i, sizeof(V)); // load W upper end points
+                }
+                if constexpr (!bcast_b)
+                {
+                    std::memcpy(&b0, blo + i, sizeof(V));
+                    std::memcpy(&b1, bhi + i, sizeof(V));
+                }
+                apply<Op, T>(a0, a1, b0, b1, lo, hi);
+                std::memcpy(olo + i, &lo, sizeof(V)); // store W lower end points
+                std::memcpy(ohi + i, &hi, sizeof(V)); // store W upper end points
+            }
+        }
+#endif
+
+        using I = basic_interval<T>;
+        I ka(alo[0], ahi[0]), kb(blo[0], bhi[0]); // broadcast operands, unused otherwise
+        for (; i < n; ++i)
+        {
+            I r = apply<Op>(bcast_a ? ka : I(alo[i], ahi[i]), bcast_b ? kb : I(blo[i], bhi[i]));
+            olo[i] = r.min(); // store the lower end point
+            ohi[i] = r.max(); // store the upper end point
+        }
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 per instruction set entry points
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Kernel compiled for the default target, used as the scalar fallback
+    template <class T, op Op, form Form>
+    void kernel_scalar(T const *alo, T const *ahi, T const *blo, T const *bhi, T *olo, T *ohi, std::size_t n) noexcept
+    {
+        kernel<T, 1, Op, Form>(alo, ahi, blo, bhi, olo, ohi, n);
+    }
+
+#if INTERVAL_ARRAY_X86
+    /// @brief Kernel using 128 bit registers, the x86-64 baseline
+    template <class T, op Op, form Form>
+    __attribute__((target("sse2"))) void kernel_sse2(T const *alo, T const *ahi, T const *blo, T const *bhi, T *olo, T *ohi, std::size_t n) noexcept
+    {
+        kernel<T, 16 / sizeof(T), Op, Form>(alo, ahi, blo, bhi, olo, ohi, n);
+    }
+
+    /// @brief Kernel using 256 bit registers
+    template <class T, op Op, form Form>
+    __attribute__((target("avx2"))) void kernel_avx2(T const *alo, T const *ahi, T const *blo, T const *bhi, T *olo, T *ohi, std::size_t n) noexcept
+    {
+        kernel<T, 32 / sizeof(T), Op, Form>(alo, ahi, blo, bhi, olo, ohi, n);
+    }
+
+    /// @brief Kernel using 512 bit registers
+    template <class T, op Op, form Form>
+    __attribute__((target("avx512f"))) void kernel_avx512(T const *alo, T const *ahi, T const *blo, T const *bhi, T *olo, T *ohi, std::size_t n) noexcept
+    {
+        kernel<T, 64 / sizeof(T), Op, Form>(alo, ahi, blo, bhi, olo, ohi, n);
+    }
+#endif
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 dispatch tables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Every kernel compiled for one instruction set and end point type, indexed by operation then form
+    template <class T>
+    struct kernel_table
+    {
+        kernel_fn<T> fn[4][3]; ///< the kernels
+    };
+
+    /// @brief Builds the table of one instruction set from its entry point template
+#define INTERVAL_ARRAY_TABLE(entry)                                                                                                    \
+    kernel_table<T>                                                                                                                    \
+    {                                                                                                                                  \
+        {                                                                                                                              \
+            {entry<T, op::add, form::both_arrays>, entry<T, op::add, form::broadcast_right>, entry<T, op::add, form::broadcast_left>}, \
+            {entry<T, op::sub, form::both_arrays>, entry<T, op::sub, form::broadcast_right>, entry<T, op::sub, form::broadcast_left>}, \
+            {entry<T, op::mul, form::both_arrays>, entry<T, op::mul, form::broadcast_right>, entry<T, op::mul, form::broadcast_left>}, \
+            {entry<T, op::div, form::both_arrays>, entry<T, op::div, form::broadcast_right>, entry<T, op::div, form::broadcast_left>}, \
+        }                                                                                                                              \
+    }
+
+    template <class T>
+    kernel_table<T> const scalar_table = INTERVAL_ARRAY_TABLE(kernel_scalar); ///< the scalar fallback
+#if INTERVAL_ARRAY_X86
+    template <class T>
+    kernel_table<T> const sse2_table = INTERVAL_ARRAY_TABLE(kernel_sse2); ///< the SSE2 kernels
+    template <class T>
+    kernel_table<T> const avx2_table = INTERVAL_ARRAY_TABLE(kernel_avx2); ///< the AVX2 kernels
+    template <class T>
+    kernel_table<T> const avx512_table = INTERVAL_ARRAY_TABLE(kernel_avx512); ///< the AVX-512 kernels
+#endif
+#undef INTERVAL_ARRAY_TABLE
+
+    /// @brief Gets the table of kernels compiled for an instruction set
+    /// @param level the instruction set, which must be supported by the processor
+    /// @return the matching table
+    template <class T>
+    kernel_table<T> const &table_for(simd_level level) noexcept
+    {
+        switch (level)
+        {
+#if INTERVAL_ARRAY_X86
+        case simd_level::avx512:
+            return avx512_table<T>;
+        case simd_level::avx2:
+            return avx2_table<T>;
+        case simd_level::sse2:
+            return sse2_table<T>;
+#endif
+        default:
+            return scalar_table<T>;
+        }
+    }
+
+    /// @brief The instruction set in use, set on first use to the detected one
+    std::atomic<int> active{-1};
+
+    /// @brief Gets the table of kernels for the active instruction set
+    /// @return the active table
+    template <class T>
+    kernel_table<T> const &active_table() noexcept
+    {
+        return table_for<T>(active_simd_level());
+    }
+
+    /// @brief Checks operand sizes, sizes the result and runs the selected kernel
+    /// @param o the operation
+    /// @param f which operand is broadcast
+    /// @param alo the left lower end points
+    /// @param ahi the left upper end points
+    /// @param blo the right lower end points
+    /// @param bhi the right upper end points
+    /// @param n the number of elements
+    /// @param out the result array
+    template <class T>
+    void run(op o, form f, T const *alo, T const *ahi, T const *blo, T const *bhi,
+             std::size_t n, basic_interval_array<T> &out)
+    {
+        out.resize(n); // no-op when out is one of the operands
+        if (n != 0)
+            active_table<T>().fn[static_cast<int>(o)][static_cast<int>(f)](alo, ahi, blo, bhi, out.lo(), out.hi(), n);
+    }
+
+    /// @brief Runs an operation on two arrays of the same size
+    template <class T>
+    void run(op o, basic_interval_array<T> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out)
+    {
+        if (a.size() != b.size())
+            throw std::invalid_argument("interval_array: operands have different sizes");
+        run(o, form::both_arrays, a.lo(), a.hi(), b.lo(), b.hi(), a.size(), out);
+    }
+
+    /// @brief Runs an operation on an array and a broadcast right operand
+    template <class T>
+    void run(op o, basic_interval_array<T> const &a, basic_interval<T> const &b, basic_interval_array<T> &out)
+    {
+        T blo = b.min(), bhi = b.max(); // read before out may be resized
+        run(o, form::broadcast_right, a.lo(), a.hi(), &blo, &bhi, a.size(), out);
+    }
+
+    /// @brief Runs an operation on a broadcast left operand and an array
+    template <class T>
+    void run(op o, basic_interval<T> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out)
+    {
+        T alo = a.min(), ahi = a.max(); // read before out may be resized
+        run(o, form::broadcast_left, &alo, &ahi, b.lo(), b.hi(), b.size(), out);
+    }
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 instruction set selection
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details This function asks the processor which vector extensions it supports. Only the x86 extensions are recognised; every other target reports scalar.
+simd_level detected_simd_level() noexcept
+{
+#if INTERVAL_ARRAY_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return simd_level::avx512;
+    if (__builtin_cpu_supports("avx2"))
+        return simd_level::avx2;
+    if (__builtin_cpu_supports("sse2"))
+        return simd_level::sse2;
+#endif
+    return simd_level::scalar;
+}
+
+/// @details This function returns the instruction set chosen by #set_simd_level, or the detected one if none has been chosen.
+simd_level active_simd_level() noexcept
+{
+    int level = active.load(std::memory_order_relaxed);
+    if (level < 0)
+    {
+        level = static_cast<int>(detected_simd_level());  // first use picks the widest supported set
+        active.store(level, std::memory_order_relaxed);
+    }
+    return static_cast<simd_level>(level);
+}
+
+/// @details This function never selects an instruction set wider than the processor supports.
+simd_level set_simd_level(simd_level level) noexcept
+{
+    simd_level chosen = std::min(level, detected_simd_level());     // never exceed the processor
+    active.store(static_cast<int>(chosen), std::memory_order_relaxed);
+    return chosen;
+}
+
+/// @details This function returns a static string.
+char const *simd_level_name(simd_level level) noexcept
+{
+    switch (level)
+    {
+    case simd_level::sse2:
+        return "sse2";
+    case simd_level::avx2:
+        return "avx2";
+    case simd_level::avx512:
+        return "avx512";
+    default:
+        return "scalar";
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 batch interval operators
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details Each element is computed as by #basic_interval::operator+.
+template <class T>
+void add(basic_interval_array<T> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out) { run(op::add, a, b, out); }
+
+/// @details Each element is computed as by #basic_interval::operator+.
+template <class T>
+void add(basic_interval_array<T> const &a, std::type_identity_t<basic_interval<T>> const &b, basic_interval_array<T> &out) { run(op::add, a, b, out); }
+
+/// @details Each element is computed as by #basic_interval::operator+.
+template <class T>
+void add(std::type_identity_t<basic_interval<T>> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out) { run(op::add, a, b, out); }
+
+/// @details Each element is computed as by #basic_interval::operator-.
+template <class T>
+void sub(basic_interval_array<T> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out) { run(op::sub, a, b, out); }
+
+/// @details Each element is computed as by #basic_interval::operator-.
+template <class T>
+void sub(basic_interval_array<T> const &a, std::type_identity_t<basic_interval<T>> const &b, basic_interval_array<T> &out) { run(op::sub, a, b, out); }
+
+/// @details Each element is computed as by #basic_interval::operator-.
+template <class T>
+void sub(std::type_identity_t<basic_interval<T>> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out) { run(op::sub, a, b, out); }
+
+/// @details Each element is computed as by #basic_interval::operator*.
+template <class T>
+void mul(basic_interval_array<T> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out) { run(op::mul, a, b, out); }
+
+/// @details Each element is computed as by #basic_interval::operator*.
+template <class T>
+void mul(basic_interval_array<T> const &a, std::type_identity_t<basic_interval<T>> const &b, basic_interval_array<T> &out) { run(op::mul, a, b, out); }
+
+/// @details Each element is computed as by #basic_interval::operator*.
+template <class T>
+void mul(std::type_identity_t<basic_interval<T>> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out) { run(op::mul, a, b, out); }
+
+/// @details Each element is computed as by #basic_interval::operator/.
+template <class T>
+void div(basic_interval_array<T> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out) { run(op::div, a, b, out); }
+
+/// @details Each element is computed as by #basic_interval::operator/.
+template <class T>
+void div(basic_interval_array<T> const &a, std::type_identity_t<basic_interval<T>> const &b, basic_interval_array<T> &out) { run(op::div, a, b, out); }
+
+/// @details Each element is computed as by #basic_interval::operator/.
+template <class T>
+void div(std::type_identity_t<basic_interval<T>> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out) { run(op::div, a, b, out); }
+
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 batch operators on ranges
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details This function offsets every column by first and runs the active kernel on count elements, without resizing out.
+template <class T>
+void apply_range(batch_op o, basic_interval_array<T> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out,
+                 std::size_t first, std::size_t count)
+{
+    if (count != 0)
+        active_table<T>().fn[static_cast<int>(o)][static_cast<int>(form::both_arrays)](
+            a.lo() + first, a.hi() + first, b.lo() + first, b.hi() + first, out.lo() + first, out.hi() + first, count);
+}
+
+/// @details This function offsets the columns of a and out by first and runs the active kernel on count elements, without resizing out.
+template <class T>
+void apply_range(batch_op o, basic_interval_array<T> const &a, std::type_identity_t<basic_interval<T>> const &b, basic_interval_array<T> &out,
+                 std::size_t first, std::size_t count)
+{
+    T blo = b.min(), bhi = b.max(); // the kernel reads a broadcast operand through pointers
+    if (count != 0)
+        active_table<T>().fn[static_cast<int>(o)][static_cast<int>(form::broadcast_right)](
+            a.lo() + first, a.hi() + first, &blo, &bhi, out.lo() + first, out.hi() + first, count);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 explicit instantiations
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Instantiates the three forms of one batch operator for one end point type
+#define INTERVAL_ARRAY_INSTANTIATE(name, T)                                                                                          \
+    template void name(basic_interval_array<T> const &, basic_interval_array<T> const &, basic_interval_array<T> &);                 \
+    template void name(basic_interval_array<T> const &, std::type_identity_t<basic_interval<T>> const &, basic_interval_array<T> &); \
+    template void name(std::type_identity_t<basic_interval<T>> const &, basic_interval_array<T> const &, basic_interval_array<T> &);
+
+INTERVAL_ARRAY_INSTANTIATE(add, float)
+INTERVAL_ARRAY_INSTANTIATE(sub, float)
+INTERVAL_ARRAY_INSTANTIATE(mul, float)
+INTERVAL_ARRAY_INSTANTIATE(div, float)
+INTERVAL_ARRAY_INSTANTIATE(add, double)
+INTERVAL_ARRAY_INSTANTIATE(sub, double)
+INTERVAL_ARRAY_INSTANTIATE(mul, double)
+INTERVAL_ARRAY_INSTANTIATE(div, double)
+#undef INTERVAL_ARRAY_INSTANTIATE
+
+template void apply_range(batch_op, basic_interval_array<float> const &, basic_interval_array<float> const &, basic_interval_array<float> &,
+                          std::size_t, std::size_t);
+template void apply_range(batch_op, basic_interval_array<float> const &, std::type_identity_t<basic_interval<float>> const &,
+                          basic_interval_array<float> &, std::size_t, std::size_t);
+template void apply_range(batch_op, basic_interval_array<double> const &, basic_interval_array<double> const &, basic_interval_array<double> &,
+                          std::size_t, std::size_t);
+template void apply_range(batch_op, basic_interval_array<double> const &, std::type_identity_t<basic_interval<double>> const &,
+                          basic_interval_array<double> &, std::size_t, std::size_t);
@@ -0,0 +1,382 @@
+/// @file interval_array.h
+/// @brief Structure of arrays container for batches of intervals
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.3
+/// @details This file declares the basic_interval_array class and the batch operators +, -, *, / that act on whole arrays at once. The lower and upper end points are held in two separate aligned columns so that the batch kernels can load several intervals per SIMD register.
+/// @details #interval_array holds double end points and #interval_arrayf float ones; a float column fits twice as many intervals into each register and each cache line. The kernels give exactly the same end points as the scalar operators of the interval class. The widest instruction set supported by the processor (SSE2, AVX2 or AVX-512) is picked at run time, with a scalar fallback for every other target.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "interval.h"
+
+#include <cstddef>
+#include <type_traits>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 class declaration
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief An array of intervals stored as separate lower and upper end point columns
+/// @details Both columns are aligned to #basic_interval_array::alignment bytes and padded to a whole number of cache lines. Element access returns intervals by value because no interval object is stored in memory.
+/// @tparam T the end point type, float or double
+/// @author George Downing
+/// @date 17-10-2026
+template <class T>
+class basic_interval_array
+{
+public:
+    /// @brief The end point type of the columns
+    using value_type = T;
+
+    /// @brief The interval type read from and written to the array
+    using interval_type = basic_interval<T>;
+
+    /// @brief Alignment in bytes of both end point columns
+    static constexpr std::size_t alignment = 64;
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 constructors
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Default constructor for an empty array
+    basic_interval_array() noexcept = default;
+
+    /// @brief Constructor for an array of n default intervals [0, 0]
+    /// @param n the number of intervals
+    explicit basic_interval_array(std::size_t n);
+
+    /// @brief Constructor for an array of n copies of one interval
+    /// @param n the number of intervals
+    /// @param fill the interval to copy into every element
+    basic_interval_array(std::size_t n, interval_type const &fill);
+
+    /// @brief Copy constructor for basic_interval_array
+    /// @param obj the array to copy
+    basic_interval_array(basic_interval_array const &obj);
+
+    /// @brief Move constructor for basic_interval_array
+    /// @param obj the array to take the columns from, left empty
+    basic_interval_array(basic_interval_array &&obj) noexcept;
+
+    /// @brief Copy assignment for basic_interval_array
+    /// @param obj the array to copy
+    /// @return this array
+    basic_interval_array &operator=(basic_interval_array const &obj);
+
+    /// @brief Move assignment for basic_interval_array
+    /// @param obj the array to take the columns from, left empty
+    /// @return this array
+    basic_interval_array &operator=(basic_interval_array &&obj) noexcept;
+
+    /// @brief Destructor for basic_interval_array
+    ~basic_interval_array();
+
+    /// @brief Makes an array of n intervals whose end points are left unwritten
+    /// @details No page of the columns is touched, so the thread that first writes each part of the array decides which memory node holds it. Every element must be written before it is read.
+    /// @param n the number of intervals
+    /// @return the array
+    static basic_interval_array for_overwrite(std::size_t n);
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 element access
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Gets the number of intervals in the array
+    /// @return the number of intervals
+    std::size_t size() const noexcept { return Size; }
+
+    /// @brief Checks whether the array holds no intervals
+    /// @return true if the array is empty
+    bool empty() const noexcept { return Size == 0; }
+
+    /// @brief Gets the column of lower end points
+    /// @return a pointer to size() aligned lower end points
+    T *lo() noexcept { return Lo; }
+
+    /// @brief Gets the column of lower end points
+    /// @return a pointer to size() aligned lower end points
+    T const *lo() const noexcept { return Lo; }
+
+    /// @brief Gets the column of upper end points
+    /// @return a pointer to size() aligned upper end points
+    T *hi() noexcept { return Hi; }
+
+    /// @brief Gets the column of upper end points
+    /// @return a pointer to size() aligned upper end points
+    T const *hi() const noexcept { return Hi; }
+
+    /// @brief Gets one interval of the array
+    /// @param i the index of the interval
+    /// @return the interval at index i
+    interval_type operator[](std::size_t i) const noexcept { return interval_type(Lo[i], Hi[i]); }
+
+    /// @brief Sets one interval of the array
+    /// @param i the index of the interval
+    /// @param val the interval to store at index i
+    void set(std::size_t i, interval_type const &val) noexcept
+    {
+        Lo[i] = val.min(); // store the lower end point
+        Hi[i] = val.max(); // store the upper end point
+    }
+
+    /// @brief Changes the number of intervals, keeping the leading elements and filling new ones with [0, 0]
+    /// @param n the new number of intervals
+    void resize(std::size_t n);
+
+private:
+    /// @brief Constructor for for_overwrite, allocates the columns without writing them
+    /// @param n the number of intervals
+    /// @param unused distinguishes this constructor from the public ones
+    basic_interval_array(std::size_t n, std::nullptr_t unused);
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    T *Lo = nullptr;          ///< The lower end point column, also the start of the allocation
+    T *Hi = nullptr;          ///< The upper end point column, inside the same allocation as Lo
+    std::size_t Size = 0;     ///< The number of intervals held
+    std::size_t Capacity = 0; ///< The number of intervals each column has room for
+};
+
+/// @brief Array of intervals with double end points
+using interval_array = basic_interval_array<double>;
+
+/// @brief Array of intervals with float end points, twice as many per register as #interval_array
+using interval_arrayf = basic_interval_array<float>;
+
+extern template class basic_interval_array<float>;  ///< compiled in interval_array.cpp
+extern template class basic_interval_array<double>; ///< compiled in interval_array.cpp
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 read only view
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief A read only view of two end point columns held elsewhere, such as an array or a memory mapped file
+/// @details The view never owns its columns; they must outlive it. An array converts implicitly, so a function taking a view accepts both.
+/// @tparam T the end point type, float or double
+/// @author George Downing
+/// @date 17-10-2026
+template <class T>
+class basic_interval_view
+{
+public:
+    /// @brief The end point type of the columns
+    using value_type = T;
+
+    /// @brief The interval type read from the view
+    using interval_type = basic_interval<T>;
+
+    /// @brief Default constructor for an empty view
+    constexpr basic_interval_view() noexcept = default;
+
+    /// @brief Constructor for a view of two columns
+    /// @param lo the lower end points
+    /// @param hi the upper end points
+    /// @param n the number of intervals in each column
+    constexpr basic_interval_view(T const *lo, T const *hi, std::size_t n) noexcept : Lo(lo), Hi(hi), Size(n) {}
+
+    /// @brief Constructor for a view of a whole array
+    /// @param a the array, which must outlive the view and not be resized while it is used
+    basic_interval_view(basic_interval_array<T> const &a) noexcept : Lo(a.lo()), Hi(a.hi()), Size(a.size()) {}
+
+    /// @brief Gets the number of intervals in the view
+    /// @return the number of intervals
+    constexpr std::size_t size() const noexcept { return Size; }
+
+    /// @brief Checks whether the view holds no intervals
+    /// @return true if the view is empty
+    constexpr bool empty() const noexcept { return Size == 0; }
+
+    /// @brief Gets the column of lower end points
+    /// @return a pointer to size() lower end points
+    constexpr T const *lo() const noexcept { return Lo; }
+
+    /// @brief Gets the column of upper end points
+    /// @return a pointer to size() upper end points
+    constexpr T const *hi() const noexcept { return Hi; }
+
+    /// @brief Gets one interval of the view
+    /// @param i the index of the interval
+    /// @return the interval at index i
+    interval_type operator[](std::size_t i) const noexcept { return interval_type(Lo[i], Hi[i]); }
+
+    /// @brief Gets a view of part of this view
+    /// @param first the index of the first interval
+    /// @param count the number of intervals, not checked against size()
+    /// @return the view of [first, first + count)
+    constexpr basic_interval_view subview(std::size_t first, std::size_t count) const noexcept { return {Lo + first, Hi + first, count}; }
+
+private:
+    T const *Lo = nullptr; ///< The lower end point column
+    T const *Hi = nullptr; ///< The upper end point column
+    std::size_t Size = 0;  ///< The number of intervals
+};
+
+/// @brief View of intervals with double end points
+using interval_view = basic_interval_view<double>;
+
+/// @brief View of intervals with float end points
+using interval_viewf = basic_interval_view<float>;
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 instruction set selection
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief The instruction sets the batch kernels can be compiled for
+enum class simd_level
+{
+    scalar, ///< one interval at a time using the interval operators
+    sse2,   ///< two doubles or four floats per register
+    avx2,   ///< four doubles or eight floats per register
+    avx512  ///< eight doubles or sixteen floats per register
+};
+
+/// @brief Gets the widest instruction set supported by this processor
+/// @return the detected instruction set
+simd_level detected_simd_level() noexcept;
+
+/// @brief Gets the instruction set currently used by the batch kernels
+/// @return the active instruction set
+simd_level active_simd_level() noexcept;
+
+/// @brief Selects the instruction set used by the batch kernels, mostly useful for benchmarking
+/// @param level the requested instruction set, lowered to the detected one if the processor lacks it
+/// @return the instruction set that is now active
+simd_level set_simd_level(simd_level level) noexcept;
+
+/// @brief Gets a printable name for an instruction set
+/// @param level the instruction set
+/// @return the name of the instruction set
+char const *simd_level_name(simd_level level) noexcept;
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 batch interval operators
+//---------------------------------------------------------------------------------------------------------------------
+
+// The end point type is deduced from the array operands only, so a scalar or a narrower interval converts implicitly to
+// basic_interval<T>. Each operator is compiled in interval_array.cpp for float and double.
+
+/// @brief Adds two arrays of intervals element by element
+/// @param a the left operands
+/// @param b the right operands, the same size as a
+/// @param out the sums, resized to the size of a; may be a or b
+template <class T>
+void add(basic_interval_array<T> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out);
+
+/// @brief Adds one interval to every element of an array, a scalar converts to the interval enclosing it
+/// @param a the left operands
+/// @param b the right operand shared by every element
+/// @param out the sums, resized to the size of a; may be a
+template <class T>
+void add(basic_interval_array<T> const &a, std::type_identity_t<basic_interval<T>> const &b, basic_interval_array<T> &out);
+
+/// @brief Adds every element of an array to one interval
+/// @param a the left operand shared by every element
+/// @param b the right operands
+/// @param out the sums, resized to the size of b; may be b
+template <class T>
+void add(std::type_identity_t<basic_interval<T>> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out);
+
+/// @brief Subtracts two arrays of intervals element by element
+/// @param a the left operands
+/// @param b the right operands, the same size as a
+/// @param out the differences, resized to the size of a; may be a or b
+template <class T>
+void sub(basic_interval_array<T> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out);
+
+/// @brief Subtracts one interval from every element of an array, a scalar converts to the interval enclosing it
+/// @param a the left operands
+/// @param b the right operand shared by every element
+/// @param out the differences, resized to the size of a; may be a
+template <class T>
+void sub(basic_interval_array<T> const &a, std::type_identity_t<basic_interval<T>> const &b, basic_interval_array<T> &out);
+
+/// @brief Subtracts every element of an array from one interval
+/// @param a the left operand shared by every element
+/// @param b the right operands
+/// @param out the differences, resized to the size of b; may be b
+template <class T>
+void sub(std::type_identity_t<basic_interval<T>> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out);
+
+/// @brief Multiplies two arrays of intervals element by element
+/// @param a the left operands
+/// @param b the right operands, the same size as a
+/// @param out the products, resized to the size of a; may be a or b
+template <class T>
+void mul(basic_interval_array<T> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out);
+
+/// @brief Multiplies every element of an array by one interval, a scalar converts to the interval enclosing it
+/// @param a the left operands
+/// @param b the right operand shared by every element
+/// @param out the products, resized to the size of a; may be a
+template <class T>
+void mul(basic_interval_array<T> const &a, std::type_identity_t<basic_interval<T>> const &b, basic_interval_array<T> &out);
+
+/// @brief Multiplies one interval by every element of an array
+/// @param a the left operand shared by every element
+/// @param b the right operands
+/// @param out the products, resized to the size of b; may be b
+template <class T>
+void mul(std::type_identity_t<basic_interval<T>> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out);
+
+/// @brief Divides two arrays of intervals element by element
+/// @param a the dividends
+/// @param b the divisors, the same size as a
+/// @param out the quotients, resized to the size of a; may be a or b
+template <class T>
+void div(basic_interval_array<T> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out);
+
+/// @brief Divides every element of an array by one interval, a scalar converts to the interval enclosing it
+/// @param a the dividends
+/// @param b the divisor shared by every element
+/// @param out the quotients, resized to the size of a; may be a
+template <class T>
+void div(basic_interval_array<T> const &a, std::type_identity_t<basic_interval<T>> const &b, basic_interval_array<T> &out);
+
+/// @brief Divides one interval by every element of an array
+/// @param a the dividend shared by every element
+/// @param b the divisors
+/// @param out the quotients, resized to the size of b; may be b
+template <class T>
+void div(std::type_identity_t<basic_interval<T>> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out);
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 batch operators on ranges
+//---------------------------------------------------------------------------------------------------------------------
+
+// These run the same kernels on the elements [first, first + count) only and never resize out, so that several threads
+// can each fill their own part of one result. Ranges are not checked against the array sizes.
+
+/// @brief The four batch operations, for callers that choose one at run time
+enum class batch_op
+{
+    add, ///< a + b
+    sub, ///< a - b
+    mul, ///< a * b
+    div  ///< a / b
+};
+
+/// @brief Applies one operation to a range of elements of two arrays
+/// @param o the operation
+/// @param a the left operands
+/// @param b the right operands
+/// @param out the results, already holding at least first + count elements; may be a or b
+/// @param first the index of the first element
+/// @param count the number of elements
+template <class T>
+void apply_range(batch_op o, basic_interval_array<T> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out,
+                 std::size_t first, std::size_t count);
+
+/// @brief Applies one operation to a range of elements of an array and one interval
+/// @param o the operation
+/// @param a the left operands
+/// @param b the right operand shared by every element
+/// @param out the results, already holding at least first + count elements; may be a
+/// @param first the index of the first element
+/// @param count the number of elements
+template <class T>
+void apply_range(batch_op o, basic_interval_array<T> const &a, std::type_identity_t<basic_interval<T>> const &b, basic_interval_array<T> &out,
+                 std::size_t first, std::size_t count);
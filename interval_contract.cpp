@@ -0,0 +1,285 @@
+/// @file interval_contract.cpp
+/// @brief Constraint collection, the agenda and HC4Revise of basic_contractor
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Adding a constraint walks the tape back from its node once and keeps the nodes it reaches in recording order, so a revision is two straight passes over a short list of node indices, with the enclosures of the nodes in one work array the size of the tape. Shared subexpressions are evaluated again by every constraint that reads them, so the revisions of different constraints are independent.
+/// @details The agenda is a first in, first out ring with a flag per constraint, so a constraint is never waiting twice and a narrowing that touches many constraints costs one flag test each.
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                    include files
+//---------------------------------------------------------------------------------------------------------------------
+
+#include "interval_contract.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+    /// @brief Evaluates one node from the enclosures of its operands
+    template <class I>
+    I forward(tape_op op, I const &a, I const &b, int n) noexcept
+    {
+        switch (op)
+        {
+        case tape_op::add:
+            return a + b;
+        case tape_op::sub:
+            return a - b;
+        case tape_op::mul:
+            return a * b;
+        case tape_op::div:
+            return a / b;
+        case tape_op::neg:
+            return I(-a.max(), -a.min());
+        case tape_op::sqr:
+            return sqr(a);
+        case tape_op::pow:
+            return pow(a, n);
+        case tape_op::sqrt:
+            return sqrt(a);
+        case tape_op::exp:
+            return exp(a);
+        case tape_op::log:
+            return log(a);
+        case tape_op::sin:
+            return sin(a);
+        case tape_op::cos:
+            return cos(a);
+        case tape_op::atan:
+            return atan(a);
+        case tape_op::abs:
+            return abs(a);
+        default:
+            return a; // inputs and constants are loaded, not evaluated
+        }
+    }
+
+    /// @brief Projects the enclosure of one node back onto its operands
+    /// @return false if no values of the operands give a result in z
+    template <class I>
+    bool backward(tape_op op, I const &z, I &a, I &b, int n) noexcept
+    {
+        switch (op)
+        {
+        case tape_op::add:
+            return add_backward(z, a, b);
+        case tape_op::sub:
+            return sub_backward(z, a, b);
+        case tape_op::mul:
+            return mul_backward(z, a, b);
+        case tape_op::div:
+            return div_backward(z, a, b);
+        case tape_op::neg:
+            return neg_backward(z, a);
+        case tape_op::sqr:
+            return sqr_backward(z, a);
+        case tape_op::pow:
+            return pow_backward(z, n, a);
+        case tape_op::sqrt:
+            return sqrt_backward(z, a);
+        case tape_op::exp:
+            return exp_backward(z, a);
+        case tape_op::log:
+            return log_backward(z, a);
+        case tape_op::atan:
+            return atan_backward(z, a);
+        case tape_op::abs:
+            return abs_backward(z, a);
+        default:
+            return true; // sin and cos leave their operand as it is
+        }
+    }
+
+    /// @brief Checks whether a narrowing is large enough to requeue the constraints on an input
+    template <class I>
+    bool requeues(I const &before, I const &after, contract_options const &options) noexcept
+    {
+        double w0 = double(before.max()) - double(before.min()), w1 = double(after.max()) - double(after.min());
+        if (!(w0 > options.min_width))
+            return false;
+        if (w0 == std::numeric_limits<double>::infinity()) // an unbounded domain has no fraction; any move counts
+            return w1 < w0 || before.min() != after.min() || before.max() != after.max();
+        return w0 - w1 > options.ratio * w0;
+    }
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 constraints
+//---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+std::size_t basic_contractor<T>::add(value_type const &expr, interval_type const &range)
+{
+    if (expr.tape() != Tape)
+        throw std::invalid_argument("basic_contractor::add: the expression belongs to another tape");
+    std::vector<tape_detail::node> const &nodes = Tape->nodes();
+    std::uint32_t c = std::uint32_t(Roots.size()), stamp = c + 1;
+    if (Seen.size() < nodes.size())
+        Seen.resize(nodes.size(), 0);
+
+    // collect the nodes the constraint reads, then put them in recording order
+    std::size_t first = Nodes.size();
+    Nodes.push_back(expr.node());
+    Seen[expr.node()] = stamp;
+    for (std::size_t k = first; k < Nodes.size(); ++k)
+    {
+        tape_detail::node const &x = nodes[Nodes[k]];
+        if (x.op == tape_op::input || x.op == tape_op::constant)
+            continue;
+        bool binary = x.op == tape_op::add || x.op == tape_op::sub || x.op == tape_op::mul || x.op == tape_op::div;
+        for (std::uint32_t operand : {x.a, binary ? x.b : x.a})
+            if (Seen[operand] != stamp)
+            {
+                Seen[operand] = stamp;
+                Nodes.push_back(operand);
+            }
+    }
+    std::sort(Nodes.begin() + std::ptrdiff_t(first), Nodes.end()); // operands are recorded before the nodes that read them
+    NodeOffsets.push_back(std::uint32_t(Nodes.size()));
+
+    for (std::size_t k = first; k < Nodes.size(); ++k)
+        if (tape_detail::node const &x = nodes[Nodes[k]]; x.op == tape_op::input)
+        {
+            if (Watchers.size() <= x.a)
+                Watchers.resize(x.a + 1);
+            Watchers[x.a].push_back(c);
+        }
+    Roots.push_back(expr.node());
+    Ranges.push_back(range);
+    return c;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 propagation
+//---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+contract_result basic_contractor<T>::contract(std::span<interval_type> domains, contract_options const &options)
+{
+    prepare(domains);
+    for (std::uint32_t c = 0; c < size(); ++c)
+        push(c);
+    return run(domains, options);
+}
+
+template <class T>
+contract_result basic_contractor<T>::contract(std::span<interval_type> domains, std::span<std::size_t const> changed, contract_options const &options)
+{
+    prepare(domains);
+    for (std::size_t i : changed)
+        if (i >= domains.size())
+            throw std::invalid_argument("basic_contractor::contract: a changed input has no domain");
+    for (std::size_t i : changed)
+        push_watchers(i, std::uint32_t(size())); // no constraint is skipped
+    return run(domains, options);
+}
+
+template <class T>
+void basic_contractor<T>::prepare(std::span<interval_type> domains)
+{
+    if (domains.size() < inputs())
+        throw std::invalid_argument("basic_contractor::contract: fewer domains than the constraints read");
+    if (Agenda.size() != size()) // constraints were added since the last contract
+    {
+        Agenda.resize(size());
+        Queued.resize(size(), 0);
+    }
+    if (Values.size() < Tape->nodes().size())
+        Values.resize(Tape->nodes().size());
+}
+
+template <class T>
+bool basic_contractor<T>::push(std::uint32_t c) noexcept
+{
+    if (Queued[c])
+        return false;
+    Queued[c] = 1;
+    Agenda[(Head + Waiting++) % size()] = c;
+    return true;
+}
+
+template <class T>
+std::size_t basic_contractor<T>::push_watchers(std::size_t input, std::uint32_t skip) noexcept
+{
+    std::size_t pushed = 0;
+    if (input < Watchers.size())
+        for (std::uint32_t c : Watchers[input])
+            pushed += c != skip && push(c); // the revision that narrowed the input has already used it
+    return pushed;
+}
+
+/// @details The agenda is left empty on return, including when the domains turn out empty or the revision limit is reached, so the next call starts afresh.
+template <class T>
+contract_result basic_contractor<T>::run(std::span<interval_type> domains, contract_options const &options)
+{
+    contract_result result;
+    result.fixpoint = true;
+    while (Waiting > 0)
+    {
+        std::uint32_t c = Agenda[Head];
+        Head = (Head + 1) % size();
+        --Waiting;
+        Queued[c] = 0;
+        if (result.revisions == options.max_revisions)
+        {
+            result.fixpoint = false;
+            break;
+        }
+        ++result.revisions;
+        if (!revise(c, domains, options, result))
+        {
+            result.empty = true;
+            result.fixpoint = false;
+            break;
+        }
+    }
+    for (; Waiting > 0; --Waiting, Head = (Head + 1) % size())
+        Queued[Agenda[Head]] = 0;
+    return result;
+}
+
+/// @details The forward pass loads inputs and constants into the work array and evaluates every other node; the backward pass starts from the root intersected with the range and projects each node onto its operands, from the last node to the first, so a node is projected only after every node of the constraint that reads it. The enclosures left on the input nodes are the narrowed domains.
+template <class T>
+bool basic_contractor<T>::revise(std::uint32_t c, std::span<interval_type> domains, contract_options const &options, contract_result &result)
+{
+    std::vector<tape_detail::node> const &nodes = Tape->nodes();
+    std::vector<interval_type> const &constants = Tape->constants();
+    std::uint32_t const *first = Nodes.data() + NodeOffsets[c], *last = Nodes.data() + NodeOffsets[c + 1];
+
+    for (std::uint32_t const *k = first; k != last; ++k)
+    {
+        tape_detail::node const &x = nodes[*k];
+        if (x.op == tape_op::input)
+            Values[*k] = work_type(domains[x.a]);
+        else if (x.op == tape_op::constant)
+            Values[*k] = work_type(constants[x.a]);
+        else
+            Values[*k] = forward(x.op, Values[x.a], Values[x.b], x.n);
+    }
+
+    if (!contract_detail::narrow(Values[Roots[c]], work_type(Ranges[c])))
+        return false;
+    for (std::uint32_t const *k = last; k-- != first;)
+    {
+        tape_detail::node const &x = nodes[*k];
+        if (x.op != tape_op::input && x.op != tape_op::constant && !backward(x.op, Values[*k], Values[x.a], Values[x.b], x.n))
+            return false;
+    }
+
+    for (std::uint32_t const *k = first; k != last; ++k)
+        if (tape_detail::node const &x = nodes[*k]; x.op == tape_op::input)
+        {
+            interval_type before = domains[x.a], after(Values[*k]);
+            if (after.min() == before.min() && after.max() == before.max())
+                continue;
+            domains[x.a] = after;
+            ++result.narrowings;
+            if (requeues(before, after, options))
+                result.requeued += push_watchers(x.a, c);
+        }
+    return true;
+}
+
+template class basic_contractor<float>; // the end point types of the tapes
+template class basic_contractor<double>;
@@ -0,0 +1,328 @@
+/// @file interval_contract.h
+/// @brief Backward projections of the interval operations and an HC4 contractor over constraints recorded on a tape
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares the backward projections of every operation a tape records. Given an enclosure z of the result of an operation, a projection narrows the enclosures of its operands to the parts that can give a result in z: for z = x + y it narrows x to x ∩ (z - y) and then y to y ∩ (z - x). Each returns false when an intersection is empty, which proves that no values of the operands give a result in z.
+/// @details basic_contractor narrows the domains of the inputs of a tape against constraints f(x) ∈ [a, b], where every f is a node recorded on the tape, so constraints share their common subexpressions. One revision of a constraint is the HC4Revise algorithm: a forward pass evaluates the nodes of f in recording order, the result is intersected with [a, b], and a backward pass projects it back through the nodes in reverse order, down to the inputs. A node read by several others is narrowed by each of them before it is projected itself, since they come later in recording order.
+/// @details contract keeps an agenda of the constraints to revise. A constraint goes back on it only when a revision of another one narrows an input it reads by more than a set fraction of its width, so after a change to a few domains only the constraints near them are revisited. It stops at a fixpoint, when the agenda is empty, or after a set number of revisions, and reports a constraint that cannot be met.
+/// @details Revisions compute with rounding::widen, so every narrowing keeps all the solutions whatever the rounding policy of the tape; the constants folded on the tape when it was recorded are rounded as the tape rounds them.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "interval.h"
+#include "interval_math.h"
+#include "interval_tape.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <vector>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 implementation details
+//---------------------------------------------------------------------------------------------------------------------
+
+namespace contract_detail
+{
+    /// @brief Narrows an interval to its intersection with another
+    /// @details A NaN end point of y carries no information and leaves the end point of x as it is.
+    /// @param x the interval to narrow
+    /// @param y the interval to intersect with
+    /// @return false if the intersection is empty, leaving x as it was
+    template <class T, class R>
+    constexpr bool narrow(basic_interval<T, R> &x, basic_interval<T, R> const &y) noexcept
+    {
+        T lo = x.min() < y.min() ? y.min() : x.min();
+        T hi = y.max() < x.max() ? y.max() : x.max();
+        if (!(lo <= hi))
+            return false;
+        x = basic_interval<T, R>(lo, hi);
+        return true;
+    }
+
+    /// @brief Narrows an interval to the values whose absolute value lies in another
+    /// @param x the interval to narrow
+    /// @param r the absolute values, never below zero
+    /// @return false if no value of x has its absolute value in r
+    template <class T, class R>
+    constexpr bool narrow_symmetric(basic_interval<T, R> &x, basic_interval<T, R> const &r) noexcept
+    {
+        basic_interval<T, R> neg(-r.max(), -r.min()), pos = r;
+        bool n = narrow(neg, x), p = narrow(pos, x); // the negative and positive branches within x
+        if (!n && !p)
+            return false;
+        x = !n ? pos : !p ? neg : basic_interval<T, R>(neg.min(), pos.max());
+        return true;
+    }
+
+    /// @brief Gets the part of an interval at or above zero
+    /// @param z the interval
+    /// @param out set to z ∩ [0, inf]
+    /// @return false if z lies wholly below zero
+    template <class T, class R>
+    constexpr bool nonnegative(basic_interval<T, R> const &z, basic_interval<T, R> &out) noexcept
+    {
+        out = basic_interval<T, R>(T(0), std::numeric_limits<T>::infinity());
+        return narrow(out, z);
+    }
+} // namespace contract_detail
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 backward projections
+//---------------------------------------------------------------------------------------------------------------------
+
+// Each projection narrows the operands of one operation to the values that can give a result in z, and returns false
+// if there are none, after which the operands are left partly narrowed and should be discarded. Operands may be the
+// same interval, as for x * x.
+
+/// @brief Narrows x and y against x + y ∈ z
+template <class T, class R>
+constexpr bool add_backward(basic_interval<T, R> const &z, basic_interval<T, R> &x, basic_interval<T, R> &y) noexcept
+{
+    using contract_detail::narrow;
+    return narrow(x, z - y) && narrow(y, z - x);
+}
+
+/// @brief Narrows x and y against x - y ∈ z
+template <class T, class R>
+constexpr bool sub_backward(basic_interval<T, R> const &z, basic_interval<T, R> &x, basic_interval<T, R> &y) noexcept
+{
+    using contract_detail::narrow;
+    return narrow(x, z + y) && narrow(y, x - z);
+}
+
+/// @brief Narrows x and y against x * y ∈ z
+/// @details x is narrowed to z / y, which is #basic_interval::entire and leaves x as it is when y contains zero, and then y to z / x.
+template <class T, class R>
+constexpr bool mul_backward(basic_interval<T, R> const &z, basic_interval<T, R> &x, basic_interval<T, R> &y) noexcept
+{
+    using contract_detail::narrow;
+    return narrow(x, z / y) && narrow(y, z / x);
+}
+
+/// @brief Narrows x and y against x / y ∈ z
+/// @details x is narrowed to z * y and y to x / z, which leaves y as it is when z contains zero.
+template <class T, class R>
+constexpr bool div_backward(basic_interval<T, R> const &z, basic_interval<T, R> &x, basic_interval<T, R> &y) noexcept
+{
+    using contract_detail::narrow;
+    return narrow(x, z * y) && narrow(y, x / z);
+}
+
+/// @brief Narrows x against -x ∈ z
+template <class T, class R>
+constexpr bool neg_backward(basic_interval<T, R> const &z, basic_interval<T, R> &x) noexcept
+{
+    return contract_detail::narrow(x, basic_interval<T, R>(-z.max(), -z.min()));
+}
+
+/// @brief Narrows x against x^2 ∈ z, keeping both signs of the square root
+template <class T, class R>
+bool sqr_backward(basic_interval<T, R> const &z, basic_interval<T, R> &x) noexcept
+{
+    basic_interval<T, R> r;
+    return contract_detail::nonnegative(z, r) && contract_detail::narrow_symmetric(x, sqrt(r));
+}
+
+/// @brief Narrows x against x^n ∈ z
+/// @details The n-th root is enclosed as z^(1/n) with pow over intervals; odd powers keep the sign of z and even ones take both signs as sqr_backward does. Powers below one leave x as it is.
+template <class T, class R>
+bool pow_backward(basic_interval<T, R> const &z, int n, basic_interval<T, R> &x) noexcept
+{
+    using I = basic_interval<T, R>;
+    using contract_detail::narrow, contract_detail::nonnegative;
+    if (n < 1)
+        return true;
+    I e = I(T(1)) / I(T(n)), pos, neg;
+    if (n % 2 == 0)
+        return nonnegative(z, pos) && contract_detail::narrow_symmetric(x, pow(pos, e));
+    bool p = nonnegative(z, pos), m = nonnegative(I(-z.max(), -z.min()), neg);
+    I lo = m ? pow(neg, e) : I(), hi = p ? pow(pos, e) : I();
+    return narrow(x, I(m ? -lo.max() : hi.min(), p ? hi.max() : -lo.min())); // the hull of the roots of both signs
+}
+
+/// @brief Narrows x against sqrt(x) ∈ z, which also keeps x at or above zero
+template <class T, class R>
+bool sqrt_backward(basic_interval<T, R> const &z, basic_interval<T, R> &x) noexcept
+{
+    basic_interval<T, R> r;
+    return contract_detail::nonnegative(z, r) && contract_detail::narrow(x, sqr(r));
+}
+
+/// @brief Narrows x against e^x ∈ z
+template <class T, class R>
+bool exp_backward(basic_interval<T, R> const &z, basic_interval<T, R> &x) noexcept
+{
+    basic_interval<T, R> r;
+    return contract_detail::nonnegative(z, r) && contract_detail::narrow(x, log(r));
+}
+
+/// @brief Narrows x against log(x) ∈ z
+template <class T, class R>
+bool log_backward(basic_interval<T, R> const &z, basic_interval<T, R> &x) noexcept
+{
+    return contract_detail::narrow(x, exp(z));
+}
+
+/// @brief Narrows x against |x| ∈ z
+template <class T, class R>
+constexpr bool abs_backward(basic_interval<T, R> const &z, basic_interval<T, R> &x) noexcept
+{
+    basic_interval<T, R> r;
+    return contract_detail::nonnegative(z, r) && contract_detail::narrow_symmetric(x, r);
+}
+
+/// @brief Narrows x against atan(x) ∈ z
+/// @details The tangent is increasing on (-pi/2, pi/2), so each end point of z is mapped to an enclosure of its tangent, sin / cos at the point; an end point at or past pi/2 in magnitude leaves that side unbounded.
+template <class T, class R>
+bool atan_backward(basic_interval<T, R> const &z, basic_interval<T, R> &x) noexcept
+{
+    using I = basic_interval<T, R>;
+    constexpr T inf = std::numeric_limits<T>::infinity();
+    constexpr T half_pi = T(std::numbers::pi / 2);
+    I range(-half_pi, half_pi), w = z;
+    if (!contract_detail::narrow(w, range))
+        return false;
+    auto tan = [](T t) // an enclosure of tan(t), or NaN end points where cos(t) may reach zero
+    {
+        I c = cos(I(t));
+        return c.min() > 0 ? sin(I(t)) / c : I(std::numeric_limits<T>::quiet_NaN());
+    };
+    I lo = w.min() > -half_pi ? tan(w.min()) : I(-inf), hi = w.max() < half_pi ? tan(w.max()) : I(inf);
+    return contract_detail::narrow(x, I(lo.min(), hi.max()));
+}
+
+// sin and cos have no backward projection here: their operands are left as they are, which keeps every solution.
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 options and results
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief When contract puts constraints back on its agenda and when it stops
+struct contract_options
+{
+    double ratio = 0.01;                                           ///< an input must lose more than this fraction of its width to requeue the constraints that read it
+    double min_width = 0.0;                                        ///< an input this narrow or narrower no longer requeues its constraints
+    std::size_t max_revisions = std::numeric_limits<std::size_t>::max(); ///< the most revisions before contract stops short of a fixpoint
+};
+
+/// @brief The outcome of contract
+struct contract_result
+{
+    bool empty = false;         ///< true if a constraint has no solution in the domains, which are then partly narrowed
+    bool fixpoint = false;      ///< true if the agenda emptied, false if the domains are empty or max_revisions stopped it
+    std::size_t revisions = 0;  ///< the constraints revised, one forward and backward pass each
+    std::size_t narrowings = 0; ///< the times the domain of an input was narrowed
+    std::size_t requeued = 0;   ///< the constraints put back on the agenda by those narrowings
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 class declaration
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Narrows the domains of the inputs of a tape against constraints on its nodes
+/// @details A contractor refers to its tape, which must outlive it; nodes recorded after a constraint was added do not change it. contract keeps its work space in the contractor, so one contractor serves one thread at a time.
+/// @tparam T the end point type, float or double
+/// @author George Downing
+/// @date 17-10-2026
+template <class T>
+class basic_contractor
+{
+public:
+    /// @brief The interval type of the domains and ranges
+    using interval_type = basic_interval<T>;
+
+    /// @brief The handle type of the constrained nodes
+    using value_type = basic_tape_value<T>;
+
+    /// @brief Constructor for a contractor with no constraints
+    /// @param tape the tape whose nodes are constrained
+    explicit basic_contractor(basic_tape<T> const &tape) noexcept : Tape(&tape) {}
+
+    /// @brief Adds the constraint that a node lies within a range
+    /// @param expr the constrained node, from the tape of the contractor
+    /// @param range the values allowed; a scalar converts to an equation
+    /// @return the index of the constraint
+    /// @throws std::invalid_argument if expr belongs to another tape
+    std::size_t add(value_type const &expr, interval_type const &range);
+
+    /// @brief Gets the number of constraints
+    /// @return the number of constraints
+    std::size_t size() const noexcept { return Roots.size(); }
+
+    /// @brief Gets the number of inputs the constraints read
+    /// @return one more than the highest input index read, the fewest domains contract accepts
+    std::size_t inputs() const noexcept { return Watchers.size(); }
+
+    /// @brief Narrows the domains against every constraint until a fixpoint
+    /// @param domains the domain of every input, by input index, narrowed in place
+    /// @param options the requeue threshold and revision limit
+    /// @return whether the domains are empty or reached a fixpoint and the work done
+    /// @throws std::invalid_argument if there are fewer domains than inputs()
+    contract_result contract(std::span<interval_type> domains, contract_options const &options = {});
+
+    /// @brief Narrows the domains after some of them changed, starting from the constraints that read those
+    /// @details The domains must be a fixpoint of the constraints apart from the changed inputs, as after an earlier contract followed by a bisection, so only the constraints near the change need to be revisited.
+    /// @param domains the domain of every input, by input index, narrowed in place
+    /// @param changed the inputs whose domains changed
+    /// @param options the requeue threshold and revision limit
+    /// @return whether the domains are empty or reached a fixpoint and the work done
+    /// @throws std::invalid_argument if there are fewer domains than inputs() or a changed input has no domain
+    contract_result contract(std::span<interval_type> domains, std::span<std::size_t const> changed, contract_options const &options = {});
+
+private:
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Functions
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief The interval type revisions compute with
+    using work_type = basic_interval<T, rounding::widen>;
+
+    /// @brief Checks the domains and sizes the agenda and the work array for the constraints and the tape
+    void prepare(std::span<interval_type> domains);
+
+    /// @brief Puts a constraint on the agenda unless it is waiting already
+    /// @return whether it was added
+    bool push(std::uint32_t c) noexcept;
+
+    /// @brief Puts the constraints that read an input on the agenda, except one
+    /// @return the constraints added
+    std::size_t push_watchers(std::size_t input, std::uint32_t skip) noexcept;
+
+    /// @brief Empties the agenda, revising each constraint taken off it
+    contract_result run(std::span<interval_type> domains, contract_options const &options);
+
+    /// @brief Revises one constraint with HC4Revise and requeues the constraints on the inputs it narrows
+    /// @return false if the constraint has no solution in the domains
+    bool revise(std::uint32_t c, std::span<interval_type> domains, contract_options const &options, contract_result &result);
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    basic_tape<T> const *Tape;                        ///< The tape holding the constrained nodes
+    std::vector<std::uint32_t> Roots;                 ///< The constrained node of every constraint
+    std::vector<interval_type> Ranges;                ///< The range of every constraint
+    std::vector<std::uint32_t> Nodes;                 ///< The nodes of every constraint in recording order, one after another
+    std::vector<std::uint32_t> NodeOffsets{0};        ///< Where the nodes of each constraint start in Nodes, and one past the last
+    std::vector<std::vector<std::uint32_t>> Watchers; ///< The constraints that read each input
+    std::vector<std::uint32_t> Agenda;                ///< The constraints waiting for revision, a ring of size() slots
+    std::vector<char> Queued;                         ///< Whether each constraint is on the agenda
+    std::size_t Head = 0;                             ///< The slot of the next constraint to revise
+    std::size_t Waiting = 0;                          ///< The constraints on the agenda
+    std::vector<work_type> Values;                    ///< The enclosure of every node of the tape during a revision
+    std::vector<std::uint32_t> Seen;                  ///< The constraint that last collected each node, plus one
+};
+
+/// @brief Contractor over a #tape
+using contractor = basic_contractor<double>;
+
+/// @brief Contractor over a #tapef
+using contractorf = basic_contractor<float>;
+
+extern template class basic_contractor<float>;  ///< compiled in interval_contract.cpp
+extern template class basic_contractor<double>; ///< compiled in interval_contract.cpp
@@ -0,0 +1,376 @@
+/// @file interval_expr.h
+/// @brief Expression templates that evaluate whole interval formulas without temporaries
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.1
+/// @details The operators +, -, *, / of this file build a tree of expression nodes instead of computing a result. An expression is evaluated once per element by expr::evaluate, so a formula such as a * b + c * d - e / f over arrays is a single loop with no intermediate arrays, and a formula over single intervals holds no named temporaries.
+/// @details Each node applies the eager operator of basic_interval, so results have exactly the same end points as the eager code. The mode change of rounding::switched is made once per evaluation rather than once per node. expr::fma is the only fused form, and it has to be asked for: it rounds a * b + c once per end point, so its bounds may be tighter than those of the eager a * b + c.
+/// @details Operands may be expressions, basic_interval values, arithmetic scalars, or any array type whose operator[] returns a basic_interval, such as interval_array or std::vector<intervalf>. All intervals of one expression must share their end point type and rounding policy; scalars take those of the other operand. At least one operand of each operator must already be an expression; expr::lift turns a value or an array into one. Arrays are held by reference, so they must outlive the expression.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "interval.h"
+
+#include <concepts>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace expr
+{
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 operand concepts
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief The extent of an operand that is the same for every element
+    inline constexpr std::size_t broadcast = std::size_t(-1);
+
+    /// @brief Base class of every expression node
+    struct node
+    {
+    };
+
+    /// @brief Checks whether a type is a basic_interval of any rounding policy
+    template <class T>
+    struct is_interval : std::false_type
+    {
+    };
+
+    /// @brief Checks whether a type is a basic_interval of any rounding policy
+    template <class T, class R>
+    struct is_interval<basic_interval<T, R>> : std::true_type
+    {
+    };
+
+    /// @brief An expression node
+    template <class T>
+    concept expression = std::derived_from<std::remove_cvref_t<T>, node>;
+
+    /// @brief A single interval of any rounding policy
+    template <class T>
+    concept single_interval = is_interval<std::remove_cvref_t<T>>::value;
+
+    /// @brief An array type whose elements are read as basic_interval values
+    template <class T>
+    concept interval_range = !expression<T> && requires(T const &a, std::size_t i) {
+        { a.size() } -> std::convertible_to<std::size_t>;
+        { a[i] } -> single_interval;
+    };
+
+    /// @brief Anything that may appear as an operand of an expression
+    template <class T>
+    concept operand = expression<T> || single_interval<T> || interval_range<T> || std::is_arithmetic_v<std::remove_cvref_t<T>>;
+
+    /// @brief The rounding policy or end point type of two operands, void for scalars which take those of the other operand
+    template <class P, class Q>
+    using common_policy = std::conditional_t<std::is_void_v<P>, Q, P>;
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 leaf nodes
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief A single interval used by every element
+    template <class T, class P>
+    struct scalar : node
+    {
+        using value_type = T; ///< The end point type of the interval
+        using policy = P;     ///< The rounding policy of the interval
+
+        basic_interval<T, P> Value; ///< The interval
+
+        /// @brief Gets the number of elements of the leaf
+        constexpr std::size_t extent() const noexcept { return broadcast; }
+
+        /// @brief Gets the interval under the evaluation policy Q
+        template <class Q>
+        constexpr basic_interval<T, Q> eval(std::size_t) const noexcept { return basic_interval<T, Q>(Value.min(), Value.max()); }
+    };
+
+    /// @brief An arithmetic scalar used by every element, combined with the scalar forms of the operators
+    template <class S>
+    struct constant : node
+    {
+        using value_type = void; ///< Takes the end point type of the other operand
+        using policy = void;     ///< Takes the policy of the other operand
+
+        S Value; ///< The value
+
+        /// @brief Gets the number of elements of the leaf
+        constexpr std::size_t extent() const noexcept { return broadcast; }
+
+        /// @brief Gets the value
+        template <class Q>
+        constexpr S eval(std::size_t) const noexcept { return Value; }
+    };
+
+    /// @brief An array of intervals read one element at a time
+    template <class A>
+    struct range : node
+    {
+        using element = std::remove_cvref_t<decltype(std::declval<A const &>()[0])>; ///< The interval type of the elements
+        using value_type = typename element::value_type;                               ///< The end point type of the elements
+        using policy = typename element::rounding_policy;                              ///< The rounding policy of the elements
+
+        A const &Ref; ///< The array, which must outlive the expression
+
+        /// @brief Gets the number of elements of the leaf
+        std::size_t extent() const noexcept { return Ref.size(); }
+
+        /// @brief Gets one element under the evaluation policy Q
+        template <class Q>
+        basic_interval<value_type, Q> eval(std::size_t i) const noexcept
+        {
+            auto v = Ref[i]; // by value for interval_array, which stores no interval objects
+            return basic_interval<value_type, Q>(v.min(), v.max());
+        }
+    };
+
+    /// @brief Turns an operand into an expression node
+    /// @param x the operand
+    /// @return x if it is already a node, otherwise a leaf that refers to or copies it
+    template <operand T>
+    constexpr auto lift(T const &x) noexcept
+    {
+        if constexpr (expression<T>)
+            return x;
+        else if constexpr (single_interval<T>)
+            return scalar<typename T::value_type, typename T::rounding_policy>{{}, x};
+        else if constexpr (interval_range<T>)
+            return range<T>{{}, x};
+        else
+            return constant<T>{{}, x};
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 operation nodes
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Combines the extents of two operands
+    /// @param a the extent of the left operand
+    /// @param b the extent of the right operand
+    /// @return the common extent, broadcast only if both operands are
+    inline std::size_t merge_extent(std::size_t a, std::size_t b)
+    {
+        if (a == broadcast)
+            return b;
+        if (b != broadcast && a != b)
+            throw std::invalid_argument("expr: operands have different sizes");
+        return a;
+    }
+
+    /// @brief The operations a binary node may apply, each forwarding to the eager operator
+    namespace ops
+    {
+        struct add ///< a + b
+        {
+            template <class A, class B>
+            static constexpr auto apply(A const &a, B const &b) noexcept { return a + b; }
+        };
+
+        struct sub ///< a - b
+        {
+            template <class A, class B>
+            static constexpr auto apply(A const &a, B const &b) noexcept { return a - b; }
+        };
+
+        struct mul ///< a * b
+        {
+            template <class A, class B>
+            static constexpr auto apply(A const &a, B const &b) noexcept { return a * b; }
+        };
+
+        struct div ///< a / b
+        {
+            template <class A, class B>
+            static constexpr auto apply(A const &a, B const &b) noexcept { return a / b; }
+        };
+    } // namespace ops
+
+    /// @brief Applies Op to the values of two nodes
+    template <class Op, class L, class R>
+    struct binary : node
+    {
+        using value_type = common_policy<typename L::value_type, typename R::value_type>; ///< The end point type of the result
+        using policy = common_policy<typename L::policy, typename R::policy>;             ///< The rounding policy of the result
+        static_assert(std::is_void_v<typename L::policy> || std::is_void_v<typename R::policy> || std::is_same_v<typename L::policy, typename R::policy>,
+                      "expr: operands use different rounding policies");
+        static_assert(std::is_void_v<typename L::value_type> || std::is_void_v<typename R::value_type> || std::is_same_v<typename L::value_type, typename R::value_type>,
+                      "expr: operands use different end point types");
+
+        L Left;  ///< The left operand
+        R Right; ///< The right operand
+
+        /// @brief Gets the number of elements of the expression
+        std::size_t extent() const { return merge_extent(Left.extent(), Right.extent()); }
+
+        /// @brief Evaluates one element under the evaluation policy Q
+        template <class Q>
+        constexpr basic_interval<value_type, Q> eval(std::size_t i) const noexcept
+        {
+            return Op::apply(Left.template eval<Q>(i), Right.template eval<Q>(i));
+        }
+    };
+
+    /// @brief Converts a node value to an interval with end points of type T under the evaluation policy Q
+    template <class T, class Q, class X>
+    constexpr basic_interval<T, Q> as_interval(X const &x) noexcept
+    {
+        return basic_interval<T, Q>(x); // a scalar becomes the interval enclosing it
+    }
+
+    /// @brief Replaces a NaN fused end point by the end point of the addend
+    /// @details Of end points that are numbers, a fused a * b + c is NaN only for an unbounded end point times a zero one, whose product of real numbers is zero so the sum is c, or for infinities of opposite signs, where c is the infinity that the end point must take anyway. This is #basic_interval::times0 with the addend in place of zero.
+    template <class T>
+    constexpr T plus0(T fused, T addend) noexcept
+    {
+        return fused == fused ? fused : addend;
+    }
+
+    /// @brief Computes the enclosure of a * b + c, rounding each end point once
+    /// @details Every product is fused with the matching end point of c, so each end point is rounded once instead of twice. Under the outward rounding policies the result is never wider than the eager a * b + c; under rounding::fast it differs from it by at most one rounding either way.
+    /// @details The fused end points are reduced in the chain of basic_interval::operator*=, starting from one passed through #plus0, so an unbounded end point times a zero one counts as zero as it does there.
+    /// @param a the first factor
+    /// @param b the second factor
+    /// @param c the addend
+    /// @return an interval that encloses x * y + z for all x in a, y in b and z in c
+    template <class T, class R>
+    inline basic_interval<T, R> fma(basic_interval<T, R> const &a, basic_interval<T, R> const &b, basic_interval<T, R> const &c) noexcept
+    {
+        [[maybe_unused]] typename R::guard guard; // set the rounding mode if the policy needs it
+        using rounding::fma_down, rounding::fma_up;
+        auto min2 = [](T p, T q) { return q < p ? q : p; }; // drops a NaN second operand, as basic_interval::min2
+        auto max2 = [](T p, T q) { return q > p ? q : p; };
+
+        T w = plus0(fma_down<R>(a.min(), b.min(), c.min()), c.min()); // every product fused with the min of c
+        T x = fma_down<R>(a.min(), b.max(), c.min());
+        T y = fma_down<R>(a.max(), b.min(), c.min());
+        T z = fma_down<R>(a.max(), b.max(), c.min());
+        T min = min2(min2(min2(w, x), y), z); // reduced as in basic_interval::operator*=
+
+        w = plus0(fma_up<R>(a.min(), b.min(), c.max()), c.max()); // every product fused with the max of c
+        x = fma_up<R>(a.min(), b.max(), c.max());
+        y = fma_up<R>(a.max(), b.min(), c.max());
+        z = fma_up<R>(a.max(), b.max(), c.max());
+        T max = max2(max2(max2(w, x), y), z);
+
+        return basic_interval<T, R>(min, max);
+    }
+
+    /// @brief Applies the fused multiply add to the values of three nodes
+    template <class A, class B, class C>
+    struct fused : node
+    {
+        using value_type = common_policy<typename A::value_type, common_policy<typename B::value_type, typename C::value_type>>; ///< The end point type of the result
+        using policy = common_policy<typename A::policy, common_policy<typename B::policy, typename C::policy>>;                ///< The rounding policy of the result
+
+        A First;  ///< The first factor
+        B Second; ///< The second factor
+        C Addend; ///< The addend
+
+        /// @brief Gets the number of elements of the expression
+        std::size_t extent() const { return merge_extent(merge_extent(First.extent(), Second.extent()), Addend.extent()); }
+
+        /// @brief Evaluates one element under the evaluation policy Q
+        template <class Q>
+        basic_interval<value_type, Q> eval(std::size_t i) const noexcept
+        {
+            return expr::fma(as_interval<value_type, Q>(First.template eval<Q>(i)), as_interval<value_type, Q>(Second.template eval<Q>(i)),
+                             as_interval<value_type, Q>(Addend.template eval<Q>(i)));
+        }
+    };
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 expression operators
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Builds the node for a + b
+    template <operand L, operand R>
+        requires(expression<L> || expression<R>)
+    constexpr auto operator+(L const &a, R const &b) noexcept
+    {
+        return binary<ops::add, decltype(lift(a)), decltype(lift(b))>{{}, lift(a), lift(b)};
+    }
+
+    /// @brief Builds the node for a - b
+    template <operand L, operand R>
+        requires(expression<L> || expression<R>)
+    constexpr auto operator-(L const &a, R const &b) noexcept
+    {
+        return binary<ops::sub, decltype(lift(a)), decltype(lift(b))>{{}, lift(a), lift(b)};
+    }
+
+    /// @brief Builds the node for a * b
+    template <operand L, operand R>
+        requires(expression<L> || expression<R>)
+    constexpr auto operator*(L const &a, R const &b) noexcept
+    {
+        return binary<ops::mul, decltype(lift(a)), decltype(lift(b))>{{}, lift(a), lift(b)};
+    }
+
+    /// @brief Builds the node for a / b
+    template <operand L, operand R>
+        requires(expression<L> || expression<R>)
+    constexpr auto operator/(L const &a, R const &b) noexcept
+    {
+        return binary<ops::div, decltype(lift(a)), decltype(lift(b))>{{}, lift(a), lift(b)};
+    }
+
+    /// @brief Builds the node for the fused multiply add a * b + c
+    template <operand A, operand B, operand C>
+        requires(expression<A> || expression<B> || expression<C> || interval_range<A> || interval_range<B> || interval_range<C>)
+    constexpr auto fma(A const &a, B const &b, C const &c) noexcept
+    {
+        return fused<decltype(lift(a)), decltype(lift(b)), decltype(lift(c))>{{}, lift(a), lift(b), lift(c)};
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 evaluation
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Evaluates an expression of single intervals
+    /// @param e the expression, which must not refer to any array
+    /// @return the value of the expression
+    template <expression E>
+    basic_interval<typename E::value_type, typename E::policy> evaluate(E const &e)
+    {
+        using T = typename E::value_type;
+        using P = typename E::policy;
+        if (e.extent() != broadcast)
+            throw std::invalid_argument("expr: expression over arrays needs an output array");
+
+        [[maybe_unused]] typename P::guard guard; // one mode change for the whole expression
+        basic_interval<T, typename P::batch> v = e.template eval<typename P::batch>(0);
+        return basic_interval<T, P>(v.min(), v.max());
+    }
+
+    /// @brief Evaluates an expression over arrays into an output array in one pass
+    /// @param e the expression, which must refer to at least one array
+    /// @param out the results, resized to the extent of e if it can be, otherwise already that size; may be one of the operands
+    template <expression E, class Out>
+    void evaluate(E const &e, Out &out)
+    {
+        using T = typename E::value_type;
+        using P = typename E::policy;
+        using B = typename P::batch;
+        std::size_t n = e.extent();
+        if (n == broadcast)
+            throw std::invalid_argument("expr: expression refers to no array");
+
+        if constexpr (requires { out.resize(n); })
+            out.resize(n);
+        else if (std::size_t(out.size()) != n)
+            throw std::invalid_argument("expr: output has a different size");
+
+        [[maybe_unused]] typename P::guard guard; // one mode change for the whole array
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            basic_interval<T, B> v = e.template eval<B>(i);
+            if constexpr (requires { out.set(i, {v.min(), v.max()}); })
+                out.set(i, {v.min(), v.max()}); // interval_array stores the end points in columns
+            else
+                out[i] = {v.min(), v.max()};
+        }
+    }
+} // namespace expr
@@ -0,0 +1,419 @@
+/// @file interval_file.cpp
+/// @brief Implementation of the binary interval file reader and writer
+/// @author George Downing
+/// @date 17-10-2026
+/// @details This file contains basic_interval_writer, basic_interval_reader and the CRC-32C checksum, compiled for float and double end points. Files are written with POSIX write calls and read through mmap.
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                    include files
+//---------------------------------------------------------------------------------------------------------------------
+
+#include "interval_file.h"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#define INTERVAL_FILE_X86 1
+#else
+#define INTERVAL_FILE_X86 0
+#endif
+
+namespace
+{
+    /// @brief Throws the error of the last failed system call
+    /// @param what the operation that failed
+    [[noreturn]] void fail(char const *what) { throw std::system_error(errno, std::generic_category(), what); }
+
+    /// @brief Rounds a size up to a whole number of #interval_file::alignment blocks
+    /// @param n the size in bytes
+    /// @return the padded size
+    constexpr std::uint64_t padded(std::uint64_t n) noexcept { return (n + interval_file::alignment - 1) / interval_file::alignment * interval_file::alignment; }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 checksums
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief The reflected CRC-32C polynomial
+    constexpr std::uint32_t castagnoli = 0x82f63b78u;
+
+    /// @brief The remainder of every byte value, for the table driven fallback
+    constexpr std::array<std::uint32_t, 256> crc_table = []
+    {
+        std::array<std::uint32_t, 256> t{};
+        for (std::uint32_t i = 0; i < 256; ++i)
+        {
+            std::uint32_t c = i;
+            for (int k = 0; k < 8; ++k)
+                c = c & 1 ? c >> 1 ^ castagnoli : c >> 1; // one bit of polynomial division
+            t[i] = c;
+        }
+        return t;
+    }();
+
+    /// @brief Updates an inverted checksum one byte at a time through #crc_table
+    std::uint32_t crc_bytes(unsigned char const *p, std::size_t n, std::uint32_t c) noexcept
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            c = crc_table[(c ^ p[i]) & 0xff] ^ c >> 8;
+        return c;
+    }
+
+#if INTERVAL_FILE_X86
+    /// @brief Updates an inverted checksum eight bytes at a time with the crc32 instruction
+    __attribute__((target("sse4.2"))) std::uint32_t crc_sse42(unsigned char const *p, std::size_t n, std::uint32_t c) noexcept
+    {
+        std::uint64_t c64 = c;
+        for (; n >= 8; n -= 8, p += 8)
+        {
+            std::uint64_t word;
+            std::memcpy(&word, p, 8); // columns are aligned, but the caller may pass any block
+            c64 = _mm_crc32_u64(c64, word);
+        }
+        c = static_cast<std::uint32_t>(c64);
+        for (; n > 0; --n, ++p)
+            c = _mm_crc32_u8(c, *p);
+        return c;
+    }
+#endif
+
+    /// @brief The checksum routine for this processor
+    using crc_fn = std::uint32_t (*)(unsigned char const *, std::size_t, std::uint32_t) noexcept;
+
+    /// @brief Picks the crc32 instruction when the processor has it
+    /// @return the checksum routine
+    crc_fn pick_crc() noexcept
+    {
+#if INTERVAL_FILE_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("sse4.2"))
+            return crc_sse42;
+#endif
+        return crc_bytes;
+    }
+
+    /// @brief Checksums the two columns of a chunk
+    template <class T>
+    std::uint32_t chunk_checksum(T const *lo, T const *hi, std::size_t n) noexcept
+    {
+        std::uint32_t c = interval_file::crc32c(lo, n * sizeof(T));
+        return interval_file::crc32c(hi, n * sizeof(T), c);
+    }
+} // namespace
+
+/// @details The checksum is inverted before and after, as in the iSCSI standard, so crc32c("123456789", 9) is 0xe3069283.
+std::uint32_t interval_file::crc32c(void const *data, std::size_t size, std::uint32_t crc) noexcept
+{
+    static crc_fn const fn = pick_crc();
+    return ~fn(static_cast<unsigned char const *>(data), size, ~crc);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 writer
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details The header space is zeroed, so the file fails the magic check until #close writes the real header.
+template <class T>
+basic_interval_writer<T>::basic_interval_writer(std::string const &path, std::size_t chunk_size, bool checksums)
+    : ChunkSize(chunk_size), Checksums(checksums)
+{
+    if (chunk_size == 0)
+        throw std::invalid_argument("interval_writer: chunk size is 0");
+    Fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (Fd < 0)
+        fail("interval_writer: open");
+    try
+    {
+        interval_file::header blank{};
+        write_padded(&blank, sizeof(blank));
+    }
+    catch (...)
+    {
+        ::close(Fd); // the destructor does not run for a constructor that throws
+        throw;
+    }
+    Lo.reserve(chunk_size);
+    Hi.reserve(chunk_size);
+}
+
+/// @details Errors cannot be reported from a destructor, so a writer whose file matters should be closed explicitly.
+template <class T>
+basic_interval_writer<T>::~basic_interval_writer()
+{
+    try
+    {
+        close();
+    }
+    catch (...)
+    {
+        if (Fd >= 0)
+            ::close(Fd); // give up on the file but not the descriptor
+    }
+}
+
+/// @details A full buffer is written before this function returns.
+template <class T>
+void basic_interval_writer<T>::append(interval_type const &x)
+{
+    Lo.push_back(x.min());
+    Hi.push_back(x.max());
+    ++Count;
+    if (Lo.size() == ChunkSize)
+        flush();
+}
+
+/// @details The intervals are copied into the chunk buffer a column at a time.
+template <class T>
+void basic_interval_writer<T>::append(basic_interval_view<T> v)
+{
+    std::size_t done = 0;
+    while (done < v.size())
+    {
+        std::size_t take = std::min(ChunkSize - Lo.size(), v.size() - done); // fill the rest of this chunk
+        Lo.insert(Lo.end(), v.lo() + done, v.lo() + done + take);
+        Hi.insert(Hi.end(), v.hi() + done, v.hi() + done + take);
+        done += take;
+        Count += take;
+        if (Lo.size() == ChunkSize)
+            flush();
+    }
+}
+
+/// @details The header goes last, at offset 0, so that a reader never sees a header for a file that is still being written.
+template <class T>
+void basic_interval_writer<T>::close()
+{
+    if (Fd < 0)
+        return;
+    if (!Lo.empty())
+        flush();
+
+    interval_file::header h{};
+    std::memcpy(h.magic, interval_file::magic, sizeof(h.magic));
+    h.byte_order = interval_file::byte_order_mark;
+    h.version = interval_file::version;
+    h.precision = sizeof(T);
+    h.flags = Checksums ? interval_file::has_checksums : 0;
+    h.count = Count;
+    h.chunk_size = ChunkSize;
+    h.chunk_count = Table.size();
+    h.table_offset = Offset;
+    write_padded(Table.data(), Table.size() * sizeof(interval_file::chunk_entry));
+    if (::pwrite(Fd, &h, sizeof(h), 0) != static_cast<ssize_t>(sizeof(h)))
+        fail("interval_writer: write");
+    int fd = std::exchange(Fd, -1);
+    if (::close(fd) != 0)
+        fail("interval_writer: close");
+}
+
+/// @details The checksum is taken from the buffer before it is written, so it covers what the writer meant to store.
+template <class T>
+void basic_interval_writer<T>::flush()
+{
+    std::size_t n = Lo.size();
+    interval_file::chunk_entry e{};
+    e.offset = Offset;
+    e.count = n;
+    if (Checksums)
+        e.checksum = chunk_checksum(Lo.data(), Hi.data(), n);
+    write_padded(Lo.data(), n * sizeof(T));
+    write_padded(Hi.data(), n * sizeof(T));
+    Table.push_back(e);
+    Lo.clear();
+    Hi.clear();
+}
+
+/// @details Short writes are retried until every byte is written.
+template <class T>
+void basic_interval_writer<T>::write_padded(void const *data, std::size_t size)
+{
+    static constexpr unsigned char zeros[interval_file::alignment] = {};
+    auto put = [this](void const *p, std::size_t n)
+    {
+        auto bytes = static_cast<unsigned char const *>(p);
+        while (n > 0)
+        {
+            ssize_t w = ::write(Fd, bytes, n);
+            if (w < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                fail("interval_writer: write");
+            }
+            bytes += w;
+            n -= static_cast<std::size_t>(w);
+        }
+    };
+    put(data, size);
+    put(zeros, padded(size) - size);
+    Offset += padded(size);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 reader
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details The whole file is mapped read only and private; no page is read until it is used. Every chunk entry is checked to lie inside the file, so a view can never point past the mapping.
+template <class T>
+basic_interval_reader<T>::basic_interval_reader(std::string const &path)
+{
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        fail("interval_reader: open");
+    struct stat st;
+    if (::fstat(fd, &st) != 0)
+    {
+        int e = errno;
+        ::close(fd);
+        throw std::system_error(e, std::generic_category(), "interval_reader: stat");
+    }
+    Length = static_cast<std::size_t>(st.st_size);
+    if (Length < sizeof(interval_file::header))
+    {
+        ::close(fd);
+        throw std::runtime_error("interval_reader: file is too short");
+    }
+    void *map = ::mmap(nullptr, Length, PROT_READ, MAP_PRIVATE, fd, 0);
+    int e = errno;
+    ::close(fd); // the mapping keeps the file open
+    if (map == MAP_FAILED)
+        throw std::system_error(e, std::generic_category(), "interval_reader: mmap");
+    Base = static_cast<unsigned char const *>(map);
+
+    auto reject = [this](char const *why)
+    {
+        ::munmap(const_cast<unsigned char *>(Base), Length);
+        Base = nullptr;
+        throw std::runtime_error(std::string("interval_reader: ") + why);
+    };
+    interval_file::header h;
+    std::memcpy(&h, Base, sizeof(h));
+    if (std::memcmp(h.magic, interval_file::magic, sizeof(h.magic)) != 0)
+        reject("not an interval file, or its writer did not finish");
+    if (h.byte_order != interval_file::byte_order_mark)
+        reject("file was written with the other byte order");
+    if (h.version > interval_file::version)
+        reject("file format is newer than this reader");
+    if (h.precision != sizeof(T))
+        reject("file holds a different end point type");
+    if (h.chunk_size == 0 || h.chunk_count != h.count / h.chunk_size + (h.count % h.chunk_size != 0)) // no sum that could wrap
+        reject("chunk counts are inconsistent");
+    if (h.table_offset % interval_file::alignment != 0 || h.table_offset > Length ||
+        (Length - h.table_offset) / sizeof(interval_file::chunk_entry) < h.chunk_count)
+        reject("chunk table lies outside the file");
+
+    Count = h.count;
+    ChunkSize = h.chunk_size;
+    ChunkCount = h.chunk_count;
+    Checksums = h.flags & interval_file::has_checksums;
+    Table = reinterpret_cast<interval_file::chunk_entry const *>(Base + h.table_offset);
+    for (std::size_t i = 0; i < ChunkCount; ++i)
+    {
+        interval_file::chunk_entry const &c = Table[i];
+        std::uint64_t expected = i + 1 < ChunkCount ? ChunkSize : Count - i * ChunkSize;
+        if (c.count != expected || c.offset % interval_file::alignment != 0 || c.offset > h.table_offset ||
+            c.count > (h.table_offset - c.offset) / 2 / sizeof(T) || // checked before any product, which could wrap
+            (h.table_offset - c.offset) / 2 < padded(c.count * sizeof(T)))
+            reject("chunk lies outside the file");
+    }
+}
+
+/// @details The other reader is left holding no mapping.
+template <class T>
+basic_interval_reader<T>::basic_interval_reader(basic_interval_reader &&obj) noexcept
+    : Base(std::exchange(obj.Base, nullptr)), Length(std::exchange(obj.Length, 0)), Table(std::exchange(obj.Table, nullptr)),
+      Count(std::exchange(obj.Count, 0)), ChunkSize(std::exchange(obj.ChunkSize, 1)), ChunkCount(std::exchange(obj.ChunkCount, 0)),
+      Checksums(std::exchange(obj.Checksums, false))
+{
+}
+
+/// @details The mapping held before is released.
+template <class T>
+basic_interval_reader<T> &basic_interval_reader<T>::operator=(basic_interval_reader &&obj) noexcept
+{
+    if (this != &obj)
+    {
+        if (Base)
+            ::munmap(const_cast<unsigned char *>(Base), Length); // release the current mapping
+        Base = std::exchange(obj.Base, nullptr);                  // obj no longer owns the mapping
+        Length = std::exchange(obj.Length, 0);
+        Table = std::exchange(obj.Table, nullptr);
+        Count = std::exchange(obj.Count, 0);
+        ChunkSize = std::exchange(obj.ChunkSize, 1);
+        ChunkCount = std::exchange(obj.ChunkCount, 0);
+        Checksums = std::exchange(obj.Checksums, false);
+    }
+    return *this;
+}
+
+/// @details Views handed out by #chunk point into the mapping and dangle afterwards.
+template <class T>
+basic_interval_reader<T>::~basic_interval_reader()
+{
+    if (Base)
+        ::munmap(const_cast<unsigned char *>(Base), Length);
+}
+
+/// @details The lower column starts at the entry's offset and the upper one after its padding, both 64 byte aligned because the mapping starts on a page.
+template <class T>
+basic_interval_view<T> basic_interval_reader<T>::chunk(std::size_t i) const noexcept
+{
+    interval_file::chunk_entry const &c = Table[i];
+    auto lo = reinterpret_cast<T const *>(Base + c.offset);
+    auto hi = reinterpret_cast<T const *>(Base + c.offset + padded(c.count * sizeof(T)));
+    return {lo, hi, static_cast<std::size_t>(c.count)};
+}
+
+/// @details Reads both columns of the chunk.
+template <class T>
+bool basic_interval_reader<T>::verify(std::size_t i) const noexcept
+{
+    if (!Checksums)
+        return true;
+    basic_interval_view<T> v = chunk(i);
+    return chunk_checksum(v.lo(), v.hi(), v.size()) == Table[i].checksum;
+}
+
+/// @details Reads the whole file.
+template <class T>
+bool basic_interval_reader<T>::verify() const noexcept
+{
+    for (std::size_t i = 0; i < ChunkCount; ++i)
+        if (!verify(i))
+            return false;
+    return true;
+}
+
+/// @details The columns are copied chunk by chunk into an array whose pages are written only once.
+template <class T>
+basic_interval_array<T> basic_interval_reader<T>::to_array() const
+{
+    basic_interval_array<T> a = basic_interval_array<T>::for_overwrite(Count);
+    for (std::size_t i = 0; i < ChunkCount; ++i)
+    {
+        basic_interval_view<T> v = chunk(i);
+        std::memcpy(a.lo() + i * ChunkSize, v.lo(), v.size() * sizeof(T));
+        std::memcpy(a.hi() + i * ChunkSize, v.hi(), v.size() * sizeof(T));
+    }
+    return a;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 explicit instantiations
+//---------------------------------------------------------------------------------------------------------------------
+
+template class basic_interval_writer<float>;
+template class basic_interval_writer<double>;
+template class basic_interval_reader<float>;
+template class basic_interval_reader<double>;
@@ -0,0 +1,260 @@
+/// @file interval_file.h
+/// @brief Versioned binary file format for interval arrays, read through a memory map without copying
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares basic_interval_writer, which appends intervals to a file in fixed size chunks, and basic_interval_reader, which maps such a file into memory and hands out each chunk as a #basic_interval_view straight onto the mapped pages. Nothing is parsed or copied on open, so opening a file costs the same whatever its size and only the pages that are read become resident.
+/// @details Layout, every offset a multiple of 64 bytes:
+/// @details - a 64 byte #interval_file::header: magic, format version, byte order mark, end point size, flags, and the number of intervals and chunks;
+/// @details - the chunks, each one column of lower end points followed by one column of upper end points, each column padded to 64 bytes;
+/// @details - a table with one #interval_file::chunk_entry per chunk giving its offset, length and, if the file has checksums, the CRC-32C of both columns.
+/// @details The header is written last, so a file whose writer did not finish is rejected. Files are read only on a host with the byte order and end point type they were written with, because mapped columns cannot be converted in place.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "interval_array.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 on disk structures
+//---------------------------------------------------------------------------------------------------------------------
+
+namespace interval_file
+{
+    /// @brief The first eight bytes of every file
+    inline constexpr char magic[8] = {'I', 'V', 'L', 'A', 'R', 'R', 'A', 'Y'};
+
+    /// @brief The format version written; a reader rejects any newer version
+    inline constexpr std::uint16_t version = 1;
+
+    /// @brief Written in the byte order of the writer, so a reader on a host of the other byte order sees 0x04030201
+    inline constexpr std::uint32_t byte_order_mark = 0x01020304;
+
+    /// @brief Set in #header::flags when every chunk entry holds a checksum
+    inline constexpr std::uint8_t has_checksums = 1;
+
+    /// @brief Alignment in bytes of every column and of the chunk table
+    inline constexpr std::size_t alignment = 64;
+
+    /// @brief The file header, at offset 0
+    struct header
+    {
+        char magic[8];              ///< #interval_file::magic
+        std::uint32_t byte_order;   ///< #byte_order_mark in the byte order of the writer
+        std::uint16_t version;      ///< the format version
+        std::uint8_t precision;     ///< the size in bytes of one end point, 4 or 8
+        std::uint8_t flags;         ///< #has_checksums or 0
+        std::uint64_t count;        ///< the number of intervals
+        std::uint64_t chunk_size;   ///< the number of intervals in every chunk but the last
+        std::uint64_t chunk_count;  ///< the number of chunks
+        std::uint64_t table_offset; ///< the offset of the chunk table
+        std::uint8_t reserved[16];  ///< zero
+    };
+
+    /// @brief One entry of the chunk table
+    struct chunk_entry
+    {
+        std::uint64_t offset;   ///< the offset of the lower end point column; the upper one follows it
+        std::uint64_t count;    ///< the number of intervals in the chunk
+        std::uint32_t checksum; ///< CRC-32C of the lower then the upper column, without padding, or 0
+        std::uint32_t reserved; ///< zero
+    };
+
+    static_assert(sizeof(header) == 64, "the header must match the documented layout");
+    static_assert(sizeof(chunk_entry) == 24, "a chunk entry must match the documented layout");
+
+    /// @brief Computes the CRC-32C (Castagnoli) checksum of a block of bytes
+    /// @details Uses the crc32 instruction of SSE4.2 when the processor has it.
+    /// @param data the bytes
+    /// @param size the number of bytes
+    /// @param crc the checksum of the bytes before data, to checksum a block in pieces
+    /// @return the checksum
+    std::uint32_t crc32c(void const *data, std::size_t size, std::uint32_t crc = 0) noexcept;
+} // namespace interval_file
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 class declarations
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Writes intervals to a file one chunk at a time
+/// @details Appended intervals are buffered until a whole chunk is ready, so memory use is bounded by the chunk size however long the file grows. #close writes the last chunk, the chunk table and the header; a writer destroyed without #close closes itself and ignores errors.
+/// @tparam T the end point type, float or double
+/// @author George Downing
+/// @date 17-10-2026
+template <class T>
+class basic_interval_writer
+{
+public:
+    /// @brief The interval type appended
+    using interval_type = basic_interval<T>;
+
+    /// @brief The default number of intervals per chunk, 16 MB of double end points
+    static constexpr std::size_t default_chunk_size = std::size_t(1) << 20;
+
+    /// @brief Constructor that creates or truncates a file
+    /// @param path the file name
+    /// @param chunk_size the number of intervals per chunk, at least 1
+    /// @param checksums true to store a checksum of every chunk
+    /// @throws std::invalid_argument if chunk_size is 0
+    /// @throws std::system_error if the file cannot be created
+    explicit basic_interval_writer(std::string const &path, std::size_t chunk_size = default_chunk_size, bool checksums = true);
+
+    /// @brief Destructor for basic_interval_writer, closes the file if #close was not called
+    ~basic_interval_writer();
+
+    basic_interval_writer(basic_interval_writer const &) = delete;            ///< a writer cannot be copied
+    basic_interval_writer &operator=(basic_interval_writer const &) = delete; ///< a writer cannot be assigned
+
+    /// @brief Appends one interval
+    /// @param x the interval
+    /// @throws std::system_error if a full chunk cannot be written
+    void append(interval_type const &x);
+
+    /// @brief Appends every interval of a view or an array
+    /// @param v the intervals
+    /// @throws std::system_error if a full chunk cannot be written
+    void append(basic_interval_view<T> v);
+
+    /// @brief Gets the number of intervals appended so far
+    /// @return the number of intervals
+    std::size_t size() const noexcept { return Count; }
+
+    /// @brief Writes the buffered intervals, the chunk table and the header, then closes the file; later calls do nothing
+    /// @throws std::system_error if writing fails, in which case the file is left unreadable
+    void close();
+
+private:
+    /// @brief Writes the buffered intervals as one chunk and empties the buffer
+    void flush();
+
+    /// @brief Writes bytes at the end of the file, padded with zeros to #interval_file::alignment
+    /// @param data the bytes
+    /// @param size the number of bytes
+    void write_padded(void const *data, std::size_t size);
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    int Fd = -1;                                  ///< The open file, -1 once closed
+    std::uint64_t Offset = 0;                     ///< The offset of the end of the file
+    std::size_t ChunkSize;                        ///< The number of intervals per chunk
+    bool Checksums;                               ///< True to store chunk checksums
+    std::size_t Count = 0;                        ///< The number of intervals appended
+    std::vector<T> Lo;                            ///< The buffered lower end points
+    std::vector<T> Hi;                            ///< The buffered upper end points
+    std::vector<interval_file::chunk_entry> Table; ///< The entries of the chunks written so far
+};
+
+/// @brief Maps a file written by basic_interval_writer and gives read only access to its intervals without copying them
+/// @details Opening checks the header and the chunk table only. Chunk checksums are checked on request, since checking one reads the whole chunk from disk.
+/// @tparam T the end point type, float or double, which must match the file
+/// @author George Downing
+/// @date 17-10-2026
+template <class T>
+class basic_interval_reader
+{
+public:
+    /// @brief The interval type read
+    using interval_type = basic_interval<T>;
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 constructors
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Constructor that maps a file
+    /// @param path the file name
+    /// @throws std::system_error if the file cannot be opened or mapped
+    /// @throws std::runtime_error if the file is not a complete interval file of this end point type and byte order, or is of a newer version
+    explicit basic_interval_reader(std::string const &path);
+
+    /// @brief Move constructor for basic_interval_reader
+    /// @param obj the reader to take the mapping from, left empty
+    basic_interval_reader(basic_interval_reader &&obj) noexcept;
+
+    /// @brief Move assignment for basic_interval_reader
+    /// @param obj the reader to take the mapping from, left empty
+    /// @return this reader
+    basic_interval_reader &operator=(basic_interval_reader &&obj) noexcept;
+
+    /// @brief Destructor for basic_interval_reader, unmaps the file; views of it become invalid
+    ~basic_interval_reader();
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 access
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Gets the number of intervals in the file
+    /// @return the number of intervals
+    std::size_t size() const noexcept { return Count; }
+
+    /// @brief Gets the number of intervals in every chunk but the last
+    /// @return the chunk size
+    std::size_t chunk_size() const noexcept { return ChunkSize; }
+
+    /// @brief Gets the number of chunks
+    /// @return the number of chunks
+    std::size_t chunk_count() const noexcept { return ChunkCount; }
+
+    /// @brief Checks whether the chunks carry checksums
+    /// @return true if #verify can detect damage
+    bool has_checksums() const noexcept { return Checksums; }
+
+    /// @brief Gets a view of one chunk, pointing into the mapped file
+    /// @param i the chunk number, less than chunk_count()
+    /// @return the view, valid as long as this reader
+    basic_interval_view<T> chunk(std::size_t i) const noexcept;
+
+    /// @brief Gets one interval
+    /// @param i the index of the interval, less than size()
+    /// @return the interval at index i
+    interval_type operator[](std::size_t i) const noexcept { return chunk(i / ChunkSize)[i % ChunkSize]; }
+
+    /// @brief Checks the checksum of one chunk
+    /// @param i the chunk number
+    /// @return true if the chunk is intact or the file has no checksums
+    bool verify(std::size_t i) const noexcept;
+
+    /// @brief Checks the checksum of every chunk
+    /// @return true if every chunk is intact or the file has no checksums
+    bool verify() const noexcept;
+
+    /// @brief Copies every interval into an array
+    /// @return the array
+    basic_interval_array<T> to_array() const;
+
+private:
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    unsigned char const *Base = nullptr;              ///< The start of the mapping
+    std::size_t Length = 0;                           ///< The length of the mapping in bytes
+    interval_file::chunk_entry const *Table = nullptr; ///< The chunk table inside the mapping
+    std::size_t Count = 0;                            ///< The number of intervals
+    std::size_t ChunkSize = 1;                        ///< The number of intervals per chunk
+    std::size_t ChunkCount = 0;                       ///< The number of chunks
+    bool Checksums = false;                           ///< True if the chunk entries hold checksums
+};
+
+/// @brief Writer of intervals with double end points
+using interval_writer = basic_interval_writer<double>;
+
+/// @brief Writer of intervals with float end points
+using interval_writerf = basic_interval_writer<float>;
+
+/// @brief Reader of intervals with double end points
+using interval_reader = basic_interval_reader<double>;
+
+/// @brief Reader of intervals with float end points
+using interval_readerf = basic_interval_reader<float>;
+
+extern template class basic_interval_writer<float>;  ///< compiled in interval_file.cpp
+extern template class basic_interval_writer<double>; ///< compiled in interval_file.cpp
+extern template class basic_interval_reader<float>;  ///< compiled in interval_file.cpp
+extern template class basic_interval_reader<double>; ///< compiled in interval_file.cpp
@@ -0,0 +1,179 @@
+/// @file interval_graph.cpp
+/// @brief Construction and incremental re-evaluation of basic_interval_graph
+/// @author George Downing
+/// @date 17-10-2026
+/// @details The readers of every node are kept in one array in compressed rows, so passing a change on is one pass over a short contiguous list. The heap of waiting nodes and its flags live as long as the graph, so an update allocates nothing.
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                    include files
+//---------------------------------------------------------------------------------------------------------------------
+
+#include "interval_graph.h"
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+namespace
+{
+    /// @brief Checks whether a node reads a second operand
+    bool is_binary(tape_op op) noexcept { return op == tape_op::add || op == tape_op::sub || op == tape_op::mul || op == tape_op::div; }
+
+    /// @brief Checks whether two intervals have the same end points, taking NaN end points as the same
+    template <class T>
+    bool same(basic_interval<T> const &x, basic_interval<T> const &y) noexcept
+    {
+        auto eq = [](T a, T b) { return a == b || (a != a && b != b); };
+        return eq(x.min(), y.min()) && eq(x.max(), y.max());
+    }
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 construction
+//---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+basic_interval_graph<T>::basic_interval_graph(basic_tape<T> const &tape)
+    : Tape(&tape), Nodes(tape.nodes()), Constants(tape.constants()), Values(Nodes.size()), ReaderOffsets(Nodes.size() + 1, 0),
+      InputNode(tape.inputs(), none), Waiting(Nodes.size(), 0)
+{
+    // count the readers of every node, then place them
+    for (tape_detail::node const &x : Nodes)
+        if (x.op != tape_op::input && x.op != tape_op::constant)
+        {
+            ++ReaderOffsets[x.a + 1];
+            if (is_binary(x.op) && x.b != x.a)
+                ++ReaderOffsets[x.b + 1];
+        }
+    for (std::size_t k = 0; k < Nodes.size(); ++k)
+        ReaderOffsets[k + 1] += ReaderOffsets[k];
+    Readers.resize(ReaderOffsets.back());
+    std::vector<std::uint32_t> next(ReaderOffsets.begin(), ReaderOffsets.end() - 1);
+    for (std::uint32_t k = 0; k < Nodes.size(); ++k)
+    {
+        tape_detail::node const &x = Nodes[k];
+        if (x.op == tape_op::input)
+            InputNode[x.a] = k;
+        else if (x.op != tape_op::constant)
+        {
+            Readers[next[x.a]++] = k;
+            if (is_binary(x.op) && x.b != x.a)
+                Readers[next[x.b]++] = k;
+        }
+    }
+    Heap.reserve(Nodes.size());
+
+    for (std::size_t k = 0; k < Nodes.size(); ++k)
+    {
+        tape_detail::node const &x = Nodes[k];
+        if (x.op == tape_op::input)
+            Values[k] = interval_type(T(0));
+        else if (x.op == tape_op::constant)
+            Values[k] = Constants[x.a];
+        else
+            Values[k] = tape_detail::fold(x.op, Values[x.a], Values[x.b], x.n);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 updates
+//---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+graph_update basic_interval_graph<T>::evaluate(std::span<std::type_identity_t<interval_type> const> inputs)
+{
+    if (inputs.size() < this->inputs())
+        throw std::invalid_argument("basic_interval_graph::evaluate: fewer intervals than inputs");
+    graph_update result;
+    result.evaluated = size();
+    for (std::size_t k = 0; k < Nodes.size(); ++k)
+    {
+        tape_detail::node const &x = Nodes[k];
+        interval_type v;
+        if (x.op == tape_op::input)
+            v = inputs[x.a];
+        else if (x.op == tape_op::constant)
+            continue;
+        else
+            v = tape_detail::fold(x.op, Values[x.a], Values[x.b], x.n);
+        if (!same(v, Values[k]))
+        {
+            Values[k] = v;
+            ++result.changed;
+        }
+    }
+    return result;
+}
+
+template <class T>
+graph_update basic_interval_graph<T>::set(std::size_t index, interval_type const &val)
+{
+    if (index >= inputs())
+        throw std::invalid_argument("basic_interval_graph::set: the input is not in the graph");
+    graph_update result;
+    result.changed += seed(index, val);
+    drain(result);
+    return result;
+}
+
+template <class T>
+graph_update basic_interval_graph<T>::set(std::span<std::size_t const> indices, std::span<std::type_identity_t<interval_type> const> vals)
+{
+    if (indices.size() != vals.size())
+        throw std::invalid_argument("basic_interval_graph::set: a different number of inputs and intervals");
+    for (std::size_t i : indices)
+        if (i >= inputs())
+            throw std::invalid_argument("basic_interval_graph::set: an input is not in the graph");
+    graph_update result;
+    for (std::size_t k = 0; k < indices.size(); ++k)
+        result.changed += seed(indices[k], vals[k]);
+    drain(result);
+    return result;
+}
+
+template <class T>
+bool basic_interval_graph<T>::seed(std::size_t index, interval_type const &val)
+{
+    std::uint32_t k = InputNode[index];
+    if (k == none || same(val, Values[k])) // an input no node reads changes nothing
+        return false;
+    Values[k] = val;
+    push_readers(k);
+    return true;
+}
+
+template <class T>
+void basic_interval_graph<T>::push_readers(std::uint32_t node)
+{
+    for (std::uint32_t const *r = Readers.data() + ReaderOffsets[node], *last = Readers.data() + ReaderOffsets[node + 1]; r != last; ++r)
+        if (!Waiting[*r])
+        {
+            Waiting[*r] = 1;
+            Heap.push_back(*r);
+            std::push_heap(Heap.begin(), Heap.end(), std::greater<>());
+        }
+}
+
+/// @details A node is taken only when every waiting node before it in recording order has been evaluated, and its readers all come after it, so when it is taken none of its operands can change again in this update.
+template <class T>
+void basic_interval_graph<T>::drain(graph_update &result)
+{
+    while (!Heap.empty())
+    {
+        std::pop_heap(Heap.begin(), Heap.end(), std::greater<>());
+        std::uint32_t k = Heap.back();
+        Heap.pop_back();
+        Waiting[k] = 0;
+        tape_detail::node const &x = Nodes[k];
+        interval_type v = tape_detail::fold(x.op, Values[x.a], Values[x.b], x.n);
+        ++result.evaluated;
+        if (same(v, Values[k]))
+            continue; // the change stops here
+        Values[k] = v;
+        ++result.changed;
+        push_readers(k);
+    }
+}
+
+template class basic_interval_graph<float>; // the end point types of the tapes
+template class basic_interval_graph<double>;
@@ -0,0 +1,148 @@
+/// @file interval_graph.h
+/// @brief Computation graphs of interval operations that keep every result and re-evaluate only what an input change reaches
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares basic_interval_graph, which takes the nodes recorded on a tape and keeps the interval of every one of them. The graph stores, for every node, the nodes that read it, so setting an input re-evaluates only the nodes downstream of it: they are taken in recording order, which puts every operand before the nodes that read it, from a heap of the nodes waiting, so each is evaluated once, after all of its changed operands.
+/// @details A node whose new interval is the same as the one it kept, end point for end point, does not pass the change on, so propagation stops early where an operation absorbs it, such as sin of a wide argument or abs of a value changing sign. The results are always those of evaluating every node again with the interval operators and functions.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "interval.h"
+#include "interval_tape.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 results
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief The work done by one update of a graph
+struct graph_update
+{
+    std::size_t evaluated = 0; ///< the nodes evaluated again
+    std::size_t changed = 0;   ///< the nodes whose interval changed, including the inputs set
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 class declaration
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief A computation graph of interval operations that keeps the result of every node
+/// @details A graph copies the nodes of its tape when it is made, so nodes recorded afterwards are not part of it and the tape may be destroyed; handles of the tape recorded before the graph was made still name its nodes. Every input starts as [0, 0].
+/// @tparam T the end point type, float or double
+/// @author George Downing
+/// @date 17-10-2026
+template <class T>
+class basic_interval_graph
+{
+public:
+    /// @brief The interval type of the nodes
+    using interval_type = basic_interval<T>;
+
+    /// @brief The handle type of the recorded nodes
+    using value_type = basic_tape_value<T>;
+
+    /// @brief Default constructor for an empty graph
+    basic_interval_graph() = default;
+
+    /// @brief Constructor for the graph of every node recorded on a tape, evaluated with every input [0, 0]
+    /// @param tape the tape
+    explicit basic_interval_graph(basic_tape<T> const &tape);
+
+    /// @brief Gets the number of nodes
+    /// @return the number of nodes
+    std::size_t size() const noexcept { return Nodes.size(); }
+
+    /// @brief Gets the number of inputs
+    /// @return one more than the highest input index recorded
+    std::size_t inputs() const noexcept { return InputNode.size(); }
+
+    /// @brief Gets the interval of a node
+    /// @param node a handle recorded on the tape of the graph before it was made
+    /// @return the interval the node has for the current inputs
+    /// @throws std::invalid_argument if the node belongs to another tape or was recorded after the graph was made
+    interval_type const &value(value_type const &node) const
+    {
+        if (node.tape() != Tape || node.node() >= size())
+            throw std::invalid_argument("basic_interval_graph::value: the node is not in the graph");
+        return Values[node.node()];
+    }
+
+    /// @brief Gets the interval of a node by its index on the tape
+    /// @param node the index, less than size()
+    /// @return the interval the node has for the current inputs
+    interval_type const &operator[](std::size_t node) const noexcept { return Values[node]; }
+
+    /// @brief Gets the current interval of an input
+    /// @param index the input index, less than inputs()
+    /// @return the interval, [0, 0] for an index that was never recorded
+    interval_type input(std::size_t index) const noexcept { return InputNode[index] == none ? interval_type(T(0)) : Values[InputNode[index]]; }
+
+    /// @brief Sets every input and evaluates every node
+    /// @param inputs the interval of every input, by input index
+    /// @return every node evaluated, and the nodes whose interval changed
+    /// @throws std::invalid_argument if there are fewer intervals than inputs()
+    graph_update evaluate(std::span<std::type_identity_t<interval_type> const> inputs);
+
+    /// @brief Sets one input and re-evaluates the nodes its change reaches
+    /// @param index the input index
+    /// @param val the new interval of the input
+    /// @return the nodes evaluated and changed
+    /// @throws std::invalid_argument if index is not less than inputs()
+    graph_update set(std::size_t index, interval_type const &val);
+
+    /// @brief Sets several inputs and re-evaluates the nodes their changes reach, each once
+    /// @param indices the input indices
+    /// @param vals the new interval of each, in the same order
+    /// @return the nodes evaluated and changed
+    /// @throws std::invalid_argument if the spans differ in size or an index is not less than inputs()
+    graph_update set(std::span<std::size_t const> indices, std::span<std::type_identity_t<interval_type> const> vals);
+
+private:
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Functions
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief The input slot of an index that was never recorded
+    static constexpr std::uint32_t none = ~std::uint32_t(0);
+
+    /// @brief Stores a new interval in an input node and puts its readers on the heap
+    /// @return whether the interval changed
+    bool seed(std::size_t index, interval_type const &val);
+
+    /// @brief Puts the readers of a node on the heap
+    void push_readers(std::uint32_t node);
+
+    /// @brief Evaluates the nodes on the heap in recording order until it is empty
+    void drain(graph_update &result);
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    basic_tape<T> const *Tape = nullptr;        ///< The tape the nodes were copied from, to check handles against
+    std::vector<tape_detail::node> Nodes;       ///< The nodes in recording order, operands first
+    std::vector<interval_type> Constants;       ///< The constant of every constant node
+    std::vector<interval_type> Values;          ///< The interval of every node
+    std::vector<std::uint32_t> Readers;         ///< The nodes that read each node, one node after another
+    std::vector<std::uint32_t> ReaderOffsets;   ///< Where the readers of each node start in Readers, and one past the last
+    std::vector<std::uint32_t> InputNode;       ///< The node of every input index, or none
+    std::vector<std::uint32_t> Heap;            ///< The nodes waiting for evaluation, a min-heap of node indices
+    std::vector<char> Waiting;                  ///< Whether each node is on the heap
+};
+
+/// @brief Graph of intervals with double end points
+using interval_graph = basic_interval_graph<double>;
+
+/// @brief Graph of intervals with float end points
+using interval_graphf = basic_interval_graph<float>;
+
+extern template class basic_interval_graph<float>;  ///< compiled in interval_graph.cpp
+extern template class basic_interval_graph<double>; ///< compiled in interval_graph.cpp
@@ -0,0 +1,271 @@
+/// @file interval_index.cpp
+/// @brief Implementation of the interval index
+/// @author George Downing
+/// @date 17-10-2026
+/// @details This file contains the parallel build and the queries of basic_interval_index. The build sorts equal parts of the entries on the workers, then merges neighbouring parts in rounds, each round merging its pairs in parallel; entries are ordered by lower end point and then by id, a total order, so the sorted columns do not depend on how the parts fell. The Eytzinger keys and the tree have one entry per block and are built serially.
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                    include files
+//---------------------------------------------------------------------------------------------------------------------
+
+#include "interval_index.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+    /// @brief The entries each worker sorts at least, below which the build sorts on one thread
+    constexpr std::size_t sort_grain = 1 << 16;
+
+    /// @brief The queries of one chunk of a batch
+    constexpr std::size_t query_grain = 1024;
+
+    /// @brief Fills the Eytzinger layout of sorted keys by an in order walk of the implicit tree
+    /// @param sorted the keys in increasing order
+    /// @param keys the layout, from index 1
+    /// @param ranks the position in sorted of every entry of keys
+    /// @param k the node visited
+    /// @param next the next key of sorted to place
+    template <class T>
+    void eytzinger(std::vector<T> const &sorted, std::vector<T> &keys, std::vector<std::uint32_t> &ranks, std::size_t k, std::size_t &next)
+    {
+        if (k >= keys.size())
+            return;
+        eytzinger(sorted, keys, ranks, 2 * k, next);
+        keys[k] = sorted[next];
+        ranks[k] = static_cast<std::uint32_t>(next++);
+        eytzinger(sorted, keys, ranks, 2 * k + 1, next);
+    }
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 constructors
+//---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+basic_interval_index<T>::basic_interval_index(basic_interval_view<T> a, thread_pool &pool)
+{
+    if (a.size() > std::numeric_limits<id_type>::max())
+        throw std::invalid_argument("basic_interval_index: more intervals than 32 bit ids can number");
+    std::vector<entry> entries(a.size());
+    parallel_for(pool, a.size(), chunk_size<T>(a.size(), 2, pool.size()), [&](std::size_t begin, std::size_t end)
+                 {
+                     for (std::size_t i = begin; i < end; ++i)
+                         entries[i] = entry{a.lo()[i], a.hi()[i], static_cast<id_type>(i)}; });
+    build(entries, pool);
+}
+
+template <class T>
+basic_interval_index<T>::basic_interval_index(basic_interval_reader<T> const &file, thread_pool &pool)
+{
+    if (file.size() > std::numeric_limits<id_type>::max())
+        throw std::invalid_argument("basic_interval_index: more intervals than 32 bit ids can number");
+    std::vector<entry> entries(file.size());
+    pool.run(file.chunk_count(), [&](std::size_t c)
+             {
+                 basic_interval_view<T> v = file.chunk(c); // straight onto the mapped pages
+                 std::size_t base = c * file.chunk_size();
+                 for (std::size_t i = 0; i < v.size(); ++i)
+                     entries[base + i] = entry{v.lo()[i], v.hi()[i], static_cast<id_type>(base + i)}; });
+    build(entries, pool);
+}
+
+template <class T>
+void basic_interval_index<T>::build(std::vector<entry> &entries, thread_pool &pool)
+{
+    std::size_t n = entries.size();
+    auto less = [](entry const &x, entry const &y) { return x.lo < y.lo || (x.lo == y.lo && x.id < y.id); };
+
+    // sort equal parts, then merge neighbours in rounds of doubling width
+    std::size_t parts = std::max<std::size_t>(1, std::min(pool.size(), n / sort_grain));
+    std::vector<std::size_t> bounds(parts + 1);
+    for (std::size_t p = 0; p <= parts; ++p)
+        bounds[p] = n * p / parts;
+    auto at = [&](std::size_t p) { return entries.begin() + static_cast<std::ptrdiff_t>(bounds[p]); };
+    pool.run(parts, [&](std::size_t p) { std::sort(at(p), at(p + 1), less); });
+    for (std::size_t width = 1; width < parts; width *= 2)
+        pool.run((parts + 2 * width - 1) / (2 * width), [&](std::size_t k)
+                 {
+                     std::size_t l = 2 * k * width, m = std::min(l + width, parts), r = std::min(l + 2 * width, parts);
+                     if (m < r)
+                         std::inplace_merge(at(l), at(m), at(r), less); });
+
+    // the sorted columns and the largest upper end point of every block
+    Sorted = basic_interval_array<T>::for_overwrite(n);
+    Ids.resize(n);
+    std::size_t blocks = (n + index_block - 1) / index_block;
+    Leaves = blocks ? std::bit_ceil(blocks) : 0;
+    Reach.assign(2 * Leaves, -std::numeric_limits<T>::infinity()); // padding leaves are never reached
+    pool.run(blocks, [&](std::size_t b)
+             {
+                 std::size_t begin = b * index_block, end = std::min(begin + index_block, n);
+                 T reach = -std::numeric_limits<T>::infinity();
+                 for (std::size_t i = begin; i < end; ++i)
+                 {
+                     Sorted.lo()[i] = entries[i].lo;
+                     Sorted.hi()[i] = entries[i].hi;
+                     Ids[i] = entries[i].id;
+                     reach = entries[i].hi > reach ? entries[i].hi : reach;
+                 }
+                 Reach[Leaves + b] = reach; });
+    for (std::size_t k = Leaves; k-- > 1;)
+        Reach[k] = std::max(Reach[2 * k], Reach[2 * k + 1]);
+
+    // the first lower end point of every block, searched in Eytzinger order
+    std::vector<T> firsts(blocks);
+    for (std::size_t b = 0; b < blocks; ++b)
+        firsts[b] = Sorted.lo()[b * index_block];
+    Keys.assign(blocks + 1, T(0));
+    Ranks.assign(blocks + 1, 0);
+    std::size_t next = 0;
+    eytzinger(firsts, Keys, Ranks, 1, next);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 search
+//---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+std::size_t basic_interval_index<T>::prefix(T x) const noexcept
+{
+    std::size_t blocks = Keys.size() - (Keys.empty() ? 0 : 1);
+    if (blocks == 0)
+        return 0;
+
+    // the first key above x, as the node where the descent last went left
+    std::size_t k = 1;
+    while (k <= blocks)
+        k = 2 * k + (Keys[k] <= x); // no branch on the comparison
+    k >>= std::countr_one(k) + 1;
+    std::size_t reached = k ? Ranks[k] : blocks; // the blocks whose first lower end point is at most x
+    if (reached == 0)
+        return 0;
+
+    // the rest is counted in the last of those blocks, whose lower end points are sorted
+    std::size_t begin = (reached - 1) * index_block, end = std::min(begin + index_block, Sorted.size());
+    std::size_t count = 0;
+    for (std::size_t i = begin; i < end; ++i)
+        count += Sorted.lo()[i] <= x;
+    return begin + count;
+}
+
+template <class T>
+template <class Emit>
+void basic_interval_index<T>::visit(T a, T b, Emit &&emit) const
+{
+    std::size_t k = prefix(b);
+    std::size_t full = k / index_block; // the blocks wholly below the prefix end
+    T const *hi = Sorted.hi();
+
+    // the subtrees of whole blocks whose upper end points reach a, left to right
+    struct node
+    {
+        std::size_t k, first, blocks; ///< the heap index, the first block and the number of blocks covered
+    };
+    node stack[64];
+    std::size_t top = 0;
+    if (full)
+        stack[top++] = node{1, 0, Leaves};
+    while (top)
+    {
+        node x = stack[--top];
+        if (x.first >= full || !(Reach[x.k] >= a))
+            continue;
+        if (x.blocks == 1)
+        {
+            std::size_t begin = x.first * index_block;
+            for (std::size_t i = begin; i < begin + index_block; ++i)
+                if (hi[i] >= a)
+                    emit(i);
+            continue;
+        }
+        std::size_t half = x.blocks / 2;
+        stack[top++] = node{2 * x.k + 1, x.first + half, half};
+        stack[top++] = node{2 * x.k, x.first, half};
+    }
+
+    // the front of the block the prefix ends in
+    for (std::size_t i = full * index_block; i < k; ++i)
+        if (hi[i] >= a)
+            emit(i);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 single queries
+//---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+std::size_t basic_interval_index<T>::stab(T x, std::vector<id_type> &out) const
+{
+    std::size_t before = out.size();
+    visit(x, x, [&](std::size_t i) { out.push_back(Ids[i]); });
+    return out.size() - before;
+}
+
+template <class T>
+std::size_t basic_interval_index<T>::overlap(interval_type const &q, std::vector<id_type> &out) const
+{
+    std::size_t before = out.size();
+    visit(q.min(), q.max(), [&](std::size_t i) { out.push_back(Ids[i]); });
+    return out.size() - before;
+}
+
+template <class T>
+std::size_t basic_interval_index<T>::count(interval_type const &q) const
+{
+    std::size_t found = 0;
+    visit(q.min(), q.max(), [&](std::size_t) { ++found; });
+    return found;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 batched queries
+//---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+template <class Query>
+index_hits basic_interval_index<T>::batch(std::size_t m, thread_pool &pool, Query &&query) const
+{
+    index_hits hits;
+    hits.offsets.assign(m + 1, 0);
+    std::size_t chunks = (m + query_grain - 1) / query_grain;
+    std::vector<std::vector<id_type>> found(chunks); // the ids of each chunk, packed in order of query
+
+    pool.run(chunks, [&](std::size_t c)
+             {
+                 std::size_t begin = c * query_grain, end = std::min(begin + query_grain, m);
+                 for (std::size_t q = begin; q < end; ++q)
+                     hits.offsets[q + 1] = query(q, found[c]); });
+    for (std::size_t q = 0; q < m; ++q)
+        hits.offsets[q + 1] += hits.offsets[q];
+
+    hits.ids.resize(hits.offsets[m]);
+    pool.run(chunks, [&](std::size_t c)
+             {
+                 if (!found[c].empty())
+                     std::memcpy(hits.ids.data() + hits.offsets[c * query_grain], found[c].data(), found[c].size() * sizeof(id_type)); });
+    return hits;
+}
+
+template <class T>
+index_hits basic_interval_index<T>::stab(std::span<T const> points, thread_pool &pool) const
+{
+    return batch(points.size(), pool, [&](std::size_t q, std::vector<id_type> &out) { return stab(points[q], out); });
+}
+
+template <class T>
+index_hits basic_interval_index<T>::overlap(basic_interval_view<T> queries, thread_pool &pool) const
+{
+    return batch(queries.size(), pool, [&](std::size_t q, std::vector<id_type> &out) { return overlap(queries[q], out); });
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 explicit instantiations
+//---------------------------------------------------------------------------------------------------------------------
+
+template class basic_interval_index<float>; // the end point types of interval_array.h
+template class basic_interval_index<double>;
@@ -0,0 +1,174 @@
+/// @file interval_index.h
+/// @brief Immutable index of many intervals answering which of them contain a point or overlap a range
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares basic_interval_index, built once from an array, a view or a memory mapped interval file and then queried from any number of threads. The intervals are sorted by lower end point into two aligned columns and cut into blocks of #index_block. An interval overlaps [a, b] when its lower end point is at most b and its upper end point at least a; the first condition holds for a prefix of the sorted columns, found by a branch free search of the first lower end point of every block laid out in Eytzinger order, which keeps the top levels of the search in a few cache lines, and then by a count within one block. The second is answered by a complete binary tree, stored as a flat array in heap order, of the largest upper end point of every block and of every run of blocks; a query descends only into the subtrees whose largest upper end point reaches a, so it reads O(log n) nodes plus the blocks holding its results.
+/// @details The build sorts parts of the intervals on the workers of a thread_pool and merges them in parallel rounds. Intervals are identified by their position in the input, ties between equal lower end points are broken by that position, so the index and every query result are the same whatever the number of workers. Batched queries split the queries over the workers and return every result list packed into one array.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "interval.h"
+#include "interval_array.h"
+#include "interval_file.h"
+#include "parallel.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 options and results
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief The intervals per block of an index, eight cache lines of double end points
+inline constexpr std::size_t index_block = 64;
+
+/// @brief The results of a batch of queries, packed one query after another
+struct index_hits
+{
+    std::vector<std::size_t> offsets; ///< the results of query q are ids[offsets[q]] to ids[offsets[q + 1] - 1]; one more entry than queries
+    std::vector<std::uint32_t> ids;   ///< the positions in the input of the intervals found, in order of lower end point within each query
+
+    /// @brief Gets the number of queries
+    /// @return the number of queries
+    std::size_t size() const noexcept { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+    /// @brief Gets the results of one query
+    /// @param q the query
+    /// @return the ids found by the query
+    std::span<std::uint32_t const> operator[](std::size_t q) const noexcept { return {ids.data() + offsets[q], ids.data() + offsets[q + 1]}; }
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 class declaration
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief An immutable index of intervals for point stabbing and range overlap queries
+/// @details Intervals are closed: [l, h] contains x when l <= x <= h and overlaps [a, b] when l <= b and a <= h. Queries never modify the index, so any number of threads may run them at once. The index copies the end points it needs, so the array or file it was built from may be released.
+/// @tparam T the end point type, float or double
+/// @author George Downing
+/// @date 17-10-2026
+template <class T>
+class basic_interval_index
+{
+public:
+    /// @brief The interval type indexed
+    using interval_type = basic_interval<T>;
+
+    /// @brief The type of the ids of the intervals, their positions in the input
+    using id_type = std::uint32_t;
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 constructors
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Default constructor for an empty index
+    basic_interval_index() = default;
+
+    /// @brief Constructor that indexes every interval of a view or an array
+    /// @param a the intervals; interval i gets id i
+    /// @param pool the workers that build the index
+    /// @throws std::invalid_argument if there are more intervals than #id_type can number
+    explicit basic_interval_index(basic_interval_view<T> a, thread_pool &pool = default_pool());
+
+    /// @brief Constructor that indexes every interval of a memory mapped file, reading its chunks in parallel
+    /// @param file the file; interval i of the file gets id i
+    /// @param pool the workers that build the index
+    /// @throws std::invalid_argument if there are more intervals than #id_type can number
+    explicit basic_interval_index(basic_interval_reader<T> const &file, thread_pool &pool = default_pool());
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 single queries
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Gets the number of intervals indexed
+    /// @return the number of intervals
+    std::size_t size() const noexcept { return Sorted.size(); }
+
+    /// @brief Checks whether the index holds no intervals
+    /// @return true if the index is empty
+    bool empty() const noexcept { return Sorted.empty(); }
+
+    /// @brief Finds every interval containing a point
+    /// @param x the point
+    /// @param out the ids found are appended, in order of lower end point
+    /// @return the number of ids appended
+    std::size_t stab(T x, std::vector<id_type> &out) const;
+
+    /// @brief Finds every interval overlapping a range
+    /// @param q the range
+    /// @param out the ids found are appended, in order of lower end point
+    /// @return the number of ids appended
+    std::size_t overlap(interval_type const &q, std::vector<id_type> &out) const;
+
+    /// @brief Counts the intervals overlapping a range without listing them
+    /// @param q the range, a point interval for a stabbing count
+    /// @return the number of intervals overlapping q
+    std::size_t count(interval_type const &q) const;
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 batched queries
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Finds the intervals containing each of many points on the workers of a pool
+    /// @param points the points
+    /// @param pool the workers
+    /// @return the ids found for every point
+    index_hits stab(std::span<T const> points, thread_pool &pool = default_pool()) const;
+
+    /// @brief Finds the intervals overlapping each of many ranges on the workers of a pool
+    /// @param queries the ranges
+    /// @param pool the workers
+    /// @return the ids found for every range
+    index_hits overlap(basic_interval_view<T> queries, thread_pool &pool = default_pool()) const;
+
+private:
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Functions
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief One interval with its id, the unit the build sorts
+    struct entry
+    {
+        T lo;       ///< the lower end point
+        T hi;       ///< the upper end point
+        id_type id; ///< the position in the input
+    };
+
+    /// @brief Sorts the entries and builds the columns, the search keys and the tree
+    void build(std::vector<entry> &entries, thread_pool &pool);
+
+    /// @brief Counts the intervals whose lower end point is at most x
+    std::size_t prefix(T x) const noexcept;
+
+    /// @brief Calls emit with the sorted position of every interval overlapping [a, b], in increasing order
+    template <class Emit>
+    void visit(T a, T b, Emit &&emit) const;
+
+    /// @brief Runs m queries split over the workers of a pool and packs their results
+    template <class Query>
+    index_hits batch(std::size_t m, thread_pool &pool, Query &&query) const;
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    basic_interval_array<T> Sorted; ///< The intervals sorted by lower end point, then by id
+    std::vector<id_type> Ids;       ///< The id of every sorted interval
+    std::vector<T> Keys;            ///< The first lower end point of every block in Eytzinger order, from index 1
+    std::vector<id_type> Ranks;     ///< The block of every entry of Keys
+    std::vector<T> Reach;           ///< The largest upper end point of every subtree of blocks in heap order, from index 1
+    std::size_t Leaves = 0;         ///< The leaves of the tree in Reach, the number of blocks rounded up to a power of two
+};
+
+/// @brief Index of intervals with double end points
+using interval_index = basic_interval_index<double>;
+
+/// @brief Index of intervals with float end points
+using interval_indexf = basic_interval_index<float>;
+
+extern template class basic_interval_index<float>;  ///< compiled in interval_index.cpp
+extern template class basic_interval_index<double>; ///< compiled in interval_index.cpp
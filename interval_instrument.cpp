@@ -0,0 +1,321 @@
+/// @file interval_instrument.cpp
+/// @brief Implementation of the per call site operation counters
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Each thread owns a table of counters keyed by the source location of its sites, created on its first report and registered with a global registry. Only the owning thread writes its counters, with a relaxed load and store that compile to a plain increment, so no report takes a lock or a locked instruction; the counters are atomic only so that collect may read them while the thread runs. The table mutex is taken by a site looking up its counters and by collect and reset, never by a report. When a thread ends, its table is added to the counts of finished threads and unregistered.
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                    include files
+//---------------------------------------------------------------------------------------------------------------------
+
+#include "interval_instrument.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+
+namespace instrument
+{
+    /// @brief The counters of one call site on one thread
+    struct counters
+    {
+        std::array<std::atomic<std::uint64_t>, op_count> operations{};                   ///< the operations of each kind
+        std::array<std::array<std::atomic<std::uint64_t>, growth_buckets>, op_count> growth{}; ///< the growth histogram of each kind
+        std::atomic<std::uint64_t> zero_divisions{0};                                    ///< the divisions by an interval containing zero
+    };
+} // namespace instrument
+
+namespace
+{
+    using instrument::counters;
+    using instrument::site_report;
+
+    /// @brief Identifies a call site by the strings and numbers of its source location
+    /// @details The strings of one location are not always the same pointers in every translation unit, so collect merges keys by their text.
+    struct site_key
+    {
+        char const *file;     ///< std::source_location::file_name
+        char const *function; ///< std::source_location::function_name
+        std::uint32_t line;   ///< std::source_location::line
+        std::uint32_t column; ///< std::source_location::column
+
+        bool operator==(site_key const &) const = default; ///< the same pointers and numbers
+    };
+
+    /// @brief Hashes a site_key
+    struct site_hash
+    {
+        std::size_t operator()(site_key const &k) const noexcept
+        {
+            std::size_t h = std::hash<char const *>()(k.file) ^ std::hash<char const *>()(k.function) * 31;
+            return h ^ (std::size_t(k.line) << 16 ^ k.column) * 0x9e3779b97f4a7c15ull;
+        }
+    };
+
+    /// @brief Adds one to a counter only the calling thread writes
+    void bump(std::atomic<std::uint64_t> &c) noexcept { c.store(c.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed); }
+
+    /// @brief Adds the counters of one site to a report
+    void add(site_report &r, counters const &c) noexcept
+    {
+        for (std::size_t o = 0; o < instrument::op_count; ++o)
+        {
+            r.operations[o] += c.operations[o].load(std::memory_order_relaxed);
+            for (std::size_t b = 0; b < instrument::growth_buckets; ++b)
+                r.growth[o][b] += c.growth[o][b].load(std::memory_order_relaxed);
+        }
+        r.zero_divisions += c.zero_divisions.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Sets the counters of one site to zero
+    void clear(counters &c) noexcept
+    {
+        for (std::size_t o = 0; o < instrument::op_count; ++o)
+        {
+            c.operations[o].store(0, std::memory_order_relaxed);
+            for (std::size_t b = 0; b < instrument::growth_buckets; ++b)
+                c.growth[o][b].store(0, std::memory_order_relaxed);
+        }
+        c.zero_divisions.store(0, std::memory_order_relaxed);
+    }
+
+    /// @brief The key reports are merged and ordered by: file, line, column and function
+    using report_key = std::tuple<std::string, std::uint32_t, std::uint32_t, std::string>;
+
+    /// @brief Adds the counters of one site to the report of its location
+    void merge(std::map<report_key, site_report> &into, site_key const &k, counters const &c)
+    {
+        report_key key(k.file ? k.file : "", k.line, k.column, k.function ? k.function : "");
+        auto [it, inserted] = into.try_emplace(std::move(key));
+        if (inserted)
+        {
+            it->second.file = std::get<0>(it->first);
+            it->second.line = k.line;
+            it->second.column = k.column;
+            it->second.function = std::get<3>(it->first);
+        }
+        add(it->second, c);
+    }
+
+    struct table;
+
+    /// @brief The counters of the innermost site of this thread, null until the thread first reports or opens a site
+    /// @details Kept apart from the table so that a report reads a constant initialised variable, with no check that the table is constructed.
+    constinit thread_local counters *current = nullptr;
+
+    /// @brief The tables of running threads and the counts of finished ones
+    struct registry
+    {
+        std::mutex Mutex;                                  ///< guards both members
+        std::vector<table *> Tables;                       ///< the tables of running threads
+        std::map<report_key, site_report> Finished;        ///< the counts of threads that have ended
+    };
+
+    /// @brief Gets the registry, constructed before the first table so that it outlives every table
+    registry &global()
+    {
+        static registry r;
+        return r;
+    }
+
+    /// @brief The counters of one thread
+    struct table
+    {
+        std::mutex Mutex;                                         ///< guards the map against collect and reset
+        std::unordered_map<site_key, counters, site_hash> Sites;  ///< the counters of each site, stable in memory
+        counters Untagged;                                        ///< the counters of operations outside any site
+
+        /// @brief Registers the table
+        table()
+        {
+            registry &g = global();
+            std::lock_guard<std::mutex> lock(g.Mutex);
+            g.Tables.push_back(this);
+        }
+
+        /// @brief Adds the counts to those of finished threads and unregisters the table
+        ~table()
+        {
+            current = nullptr;
+            registry &g = global();
+            std::lock_guard<std::mutex> lock(g.Mutex);
+            merge_into(g.Finished);
+            g.Tables.erase(std::find(g.Tables.begin(), g.Tables.end(), this));
+        }
+
+        /// @brief Adds every counter of the table to a set of reports; the caller holds the registry mutex
+        void merge_into(std::map<report_key, site_report> &into)
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            merge(into, site_key{nullptr, nullptr, 0, 0}, Untagged);
+            for (auto const &[k, c] : Sites)
+                merge(into, k, c);
+        }
+    };
+
+    /// @brief Gets the table of this thread, constructing it on first use
+    table &this_thread()
+    {
+        thread_local table t;
+        return t;
+    }
+
+    /// @brief The width and magnitude of an interval, whose quotient is its relative width
+    struct extent
+    {
+        double width;     ///< hi - lo
+        double magnitude; ///< max(|lo|, |hi|), or 1 for [0, 0] so that its relative width is 0
+
+        /// @brief Measures [lo, hi]
+        extent(double lo, double hi) noexcept : width(hi - lo), magnitude(std::fabs(lo) > std::fabs(hi) ? std::fabs(lo) : std::fabs(hi))
+        {
+            magnitude = magnitude > 0.0 ? magnitude : 1.0;
+        }
+    };
+
+    /// @brief Finds the histogram bucket of one operation
+    /// @details The relative widths are compared by cross multiplication, so the growth costs one division.
+    std::size_t growth_bucket(double alo, double ahi, double blo, double bhi, double rlo, double rhi) noexcept
+    {
+        extent a(alo, ahi), b(blo, bhi), r(rlo, rhi);
+        extent in = a.width * b.magnitude >= b.width * a.magnitude ? a : b; // the operand of larger relative width
+        double num = r.width * in.magnitude, den = in.width * r.magnitude;  // growth = num / den
+        if (num <= den)
+            return 0;
+        double g = num / den;
+        if (!(g <= 16384.0))
+            return instrument::growth_buckets - 1; // more than 2^14, width from point operands or an unbounded interval
+        std::uint64_t bits = std::bit_cast<std::uint64_t>(g);
+        std::size_t e = std::size_t(bits >> 52) - 1023; // g = 1.m 2^e with 0 <= e < 14
+        return e + ((bits & 0xfffffffffffffull) != 0);  // the least k with g <= 2^k
+    }
+} // namespace
+
+namespace instrument
+{
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 operator hooks
+    //---------------------------------------------------------------------------------------------------------------------
+
+    void record(op o, double alo, double ahi, double blo, double bhi, double rlo, double rhi) noexcept
+    {
+        counters *p = current;
+        if (!p) // the first report of this thread
+            p = current = &this_thread().Untagged;
+        counters &c = *p;
+        std::size_t k = static_cast<std::size_t>(o);
+        bump(c.operations[k]);
+        bump(c.growth[k][growth_bucket(alo, ahi, blo, bhi, rlo, rhi)]);
+        if (o == op::div && !(blo > 0.0) && !(bhi < 0.0)) // neither strictly positive nor strictly negative
+            bump(c.zero_divisions);
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 call sites
+    //---------------------------------------------------------------------------------------------------------------------
+
+    site::site(std::source_location where)
+    {
+        table &t = this_thread();
+        site_key k{where.file_name(), where.function_name(), where.line(), where.column()};
+        std::lock_guard<std::mutex> lock(t.Mutex);
+        Previous = current ? current : &t.Untagged;
+        current = &t.Sites.try_emplace(k).first->second;
+    }
+
+    site::~site() { current = Previous; }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 collection
+    //---------------------------------------------------------------------------------------------------------------------
+
+    std::vector<site_report> collect()
+    {
+        registry &g = global();
+        std::lock_guard<std::mutex> lock(g.Mutex);
+        std::map<report_key, site_report> all = g.Finished;
+        for (table *t : g.Tables)
+            t->merge_into(all);
+
+        std::vector<site_report> reports;
+        for (auto &[k, r] : all)
+        {
+            std::uint64_t total = 0;
+            for (std::uint64_t n : r.operations)
+                total += n;
+            if (total)
+                reports.push_back(std::move(r));
+        }
+        return reports;
+    }
+
+    void reset()
+    {
+        registry &g = global();
+        std::lock_guard<std::mutex> lock(g.Mutex);
+        g.Finished.clear();
+        for (table *t : g.Tables)
+        {
+            std::lock_guard<std::mutex> table_lock(t->Mutex);
+            clear(t->Untagged);
+            for (auto &[k, c] : t->Sites)
+                clear(c);
+        }
+    }
+
+    std::string to_json(std::vector<site_report> const &reports)
+    {
+        static constexpr char const *names[op_count] = {"add", "sub", "mul", "div"};
+
+        auto quote = [](std::string &out, std::string const &s)
+        {
+            out += '"';
+            for (unsigned char ch : s)
+            {
+                if (ch == '"' || ch == '\\')
+                    (out += '\\') += char(ch);
+                else if (ch < 0x20)
+                {
+                    char buffer[8];
+                    std::snprintf(buffer, sizeof(buffer), "\\u%04x", ch);
+                    out += buffer;
+                }
+                else
+                    out += char(ch);
+            }
+            out += '"';
+        };
+
+        std::string out = "{\"sites\":[";
+        for (std::size_t i = 0; i < reports.size(); ++i)
+        {
+            site_report const &r = reports[i];
+            out += i ? ",\n{" : "\n{";
+            out += "\"file\":";
+            quote(out, r.file);
+            out += ",\"line\":" + std::to_string(r.line) + ",\"column\":" + std::to_string(r.column) + ",\"function\":";
+            quote(out, r.function);
+            out += ",\"operations\":{";
+            for (std::size_t o = 0; o < op_count; ++o)
+                ((((out += o ? ",\"" : "\"") += names[o]) += "\":") += std::to_string(r.operations[o]));
+            out += "},\"zero_divisions\":" + std::to_string(r.zero_divisions) + ",\"growth\":{";
+            for (std::size_t o = 0; o < op_count; ++o)
+            {
+                ((out += o ? ",\"" : "\"") += names[o]) += "\":[";
+                for (std::size_t b = 0; b < growth_buckets; ++b)
+                    (out += b ? "," : "") += std::to_string(r.growth[o][b]);
+                out += ']';
+            }
+            out += "}}";
+        }
+        out += "\n]}\n";
+        return out;
+    }
+} // namespace instrument
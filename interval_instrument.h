@@ -0,0 +1,165 @@
+/// @file interval_instrument.h
+/// @brief Opt in counting of interval operations and of the width they add, per call site
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details Instrumentation is chosen at compile time through the rounding policy: basic_interval<T, rounding::instrumented<P>> rounds exactly as P does and also reports every +, -, * and / to this file, and #instrumented_interval is the instrumented form of #interval. For every other policy the operators hold an empty instrument::operands whose members do nothing, so they compile to the same code as before instrumentation existed.
+/// @details Each report counts the operation, adds it to a histogram of relative width growth and counts divisions by intervals containing zero. The growth of an operation is the relative width of its result over the larger relative width of its operands, where the relative width of [a, b] is (b - a) / max(|a|, |b|). Bucket 0 counts growth up to 1, bucket k from 1 to 14 growth in (2^(k - 1), 2^k], and bucket 15 anything larger, including width created from point operands.
+/// @details Reports are tagged with the innermost instrument::site alive on the calling thread, which records its std::source_location, or go to an untagged entry. The counters live in tables owned by each thread, written without locks or atomic read-modify-writes; instrument::collect adds up the tables of every thread, living or finished, and instrument::to_json formats the result.
+/// @details The granularity is the site, not the operator: the operators take no std::source_location of their own, since an operator cannot take a defaulted argument and a wrapper operand would change overload resolution for every policy. Every operation inside a site is counted against the location of that site, so telling two expressions of a loop apart takes a nested site around each.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "rounding.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+#include <string>
+#include <vector>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 policy
+//---------------------------------------------------------------------------------------------------------------------
+
+namespace rounding
+{
+    /// @brief Rounds as the policy P and reports every arithmetic operator to interval_instrument.h
+    /// @tparam P the policy that does the rounding: fast, widen, switched or scoped
+    template <class P>
+    struct instrumented
+    {
+        static constexpr bool upward = P::upward; ///< arithmetic is done as P does it
+
+        /// @brief The guard of P
+        using guard = typename P::guard;
+
+        /// @brief The policy used inside a batch that holds one #guard for all its operations
+        using batch = instrumented<typename P::batch>;
+
+        /// @brief Lower end points are rounded as P rounds them
+        template <class T>
+        static constexpr T down(T x) noexcept { return P::down(x); }
+
+        /// @brief Upper end points are rounded as P rounds them
+        template <class T>
+        static constexpr T up(T x) noexcept { return P::up(x); }
+    };
+} // namespace rounding
+
+namespace instrument
+{
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 operator hooks
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief The operations counted
+    enum class op : std::uint8_t
+    {
+        add, ///< a + b
+        sub, ///< a - b
+        mul, ///< a * b
+        div  ///< a / b
+    };
+
+    /// @brief The number of operations counted
+    inline constexpr std::size_t op_count = 4;
+
+    /// @brief The buckets of each width growth histogram
+    inline constexpr std::size_t growth_buckets = 16;
+
+    /// @brief Reports one operation to the counters of the current site on this thread
+    /// @param o the operation
+    /// @param alo the lower end point of the left operand
+    /// @param ahi the upper end point of the left operand
+    /// @param blo the lower end point of the right operand
+    /// @param bhi the upper end point of the right operand
+    /// @param rlo the lower end point of the result
+    /// @param rhi the upper end point of the result
+    void record(op o, double alo, double ahi, double blo, double bhi, double rlo, double rhi) noexcept;
+
+    /// @brief The operands of one operator, kept until the result is known; empty for a policy that is not instrumented
+    /// @tparam Rounding the rounding policy of the interval
+    /// @tparam T the end point type
+    template <class Rounding, class T>
+    struct operands
+    {
+        /// @brief Keeps nothing
+        constexpr operands(T, T, T, T) noexcept {}
+
+        /// @brief Reports nothing
+        constexpr void report(op, T, T) const noexcept {}
+    };
+
+    /// @brief The operands of one operator of an instrumented interval
+    template <class P, class T>
+    struct operands<rounding::instrumented<P>, T>
+    {
+        T Alo, Ahi, Blo, Bhi; ///< The end points of the operands
+
+        /// @brief Keeps the end points of both operands
+        constexpr operands(T alo, T ahi, T blo, T bhi) noexcept : Alo(alo), Ahi(ahi), Blo(blo), Bhi(bhi) {}
+
+        /// @brief Reports the operation with its result
+        void report(op o, T rlo, T rhi) const noexcept { record(o, double(Alo), double(Ahi), double(Blo), double(Bhi), double(rlo), double(rhi)); }
+    };
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 call sites
+    //---------------------------------------------------------------------------------------------------------------------
+
+    struct counters;
+
+    /// @brief Tags the operations of this thread with a source location while the object is alive
+    /// @details Sites nest; each operation goes to the innermost one. Constructing a site finds its counters in a table of the thread, so a site belongs around a loop or a stage of a pipeline rather than around each operation.
+    /// @author George Downing
+    /// @date 17-10-2026
+    class site
+    {
+    public:
+        /// @brief Starts tagging the operations of this thread
+        /// @param where the location reported, by default that of the declaration of the site
+        explicit site(std::source_location where = std::source_location::current());
+
+        /// @brief Restores the site that was current on construction
+        ~site();
+
+        site(site const &) = delete;            ///< a site is tied to a scope, so it cannot be copied
+        site &operator=(site const &) = delete; ///< a site is tied to a scope, so it cannot be assigned
+
+    private:
+        counters *Previous; ///< The counters current before this site
+    };
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 collection
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief The counts of one call site over every thread
+    struct site_report
+    {
+        std::string file;                                                   ///< the source file, empty for operations outside any site
+        std::string function;                                               ///< the enclosing function
+        std::uint32_t line = 0;                                             ///< the line
+        std::uint32_t column = 0;                                           ///< the column
+        std::array<std::uint64_t, op_count> operations{};                   ///< the operations of each kind, indexed by op
+        std::array<std::array<std::uint64_t, growth_buckets>, op_count> growth{}; ///< the width growth histogram of each kind
+        std::uint64_t zero_divisions = 0;                                   ///< the divisions by an interval containing zero
+    };
+
+    /// @brief Adds up the counters of every thread
+    /// @details The counts of threads that are still running are read as they stand.
+    /// @return one report per call site that has counted an operation, ordered by file and line
+    std::vector<site_report> collect();
+
+    /// @brief Sets every counter of every thread to zero
+    /// @details Operations counted by other threads while the reset runs may survive it.
+    void reset();
+
+    /// @brief Formats reports as a JSON object with a "sites" array
+    /// @param reports the reports, usually from #collect
+    /// @return the JSON text, one site per line
+    std::string to_json(std::vector<site_report> const &reports);
+} // namespace instrument
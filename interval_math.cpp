@@ -0,0 +1,357 @@
+/// @file interval_math.cpp
+/// @brief SIMD kernels of the batch interval functions
+/// @author George Downing
+/// @date 17-10-2026
+/// @details This file contains the kernels behind the batch functions of interval_math.h. Each kernel loads the end points of W intervals into two vectors of doubles, evaluates the same math_detail bounds as the scalar functions and stores the results, so float columns are widened to double on loading and rounded outward on storing. Like the arithmetic kernels they are compiled for SSE2, AVX2 and AVX-512 and picked with #active_simd_level; the AVX2 kernels also use FMA, since the polynomials are chains of multiply-adds.
+/// @details The last block of an array is padded with ones instead of being finished one interval at a time, so every element of an array goes through the same code. sin and cos hand a block holding an end point beyond #math_detail::poly::trig_limit, an infinity or a NaN to the scalar function lane by lane.
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                    include files
+//---------------------------------------------------------------------------------------------------------------------
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define INTERVAL_MATH_X86 1 ///< the x86 kernels are available
+#else
+#define INTERVAL_MATH_X86 0 ///< only the scalar kernels are available
+#endif
+
+#if INTERVAL_MATH_X86
+// The kernels pass vector types between always_inline helpers of interval_math.h that are compiled without AVX. They are
+// always inlined into a function built for the right instruction set, so the ABI note GCC emits for them does not apply.
+// The note is reported where the helpers are defined, so it is silenced before the header is included.
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+#include "interval_math.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    using namespace math_detail;
+
+    /// @brief The batch functions, indexing each kernel table
+    enum class func
+    {
+        sqrt,     ///< square root
+        exp,      ///< e^x
+        log,      ///< natural logarithm
+        sin,      ///< sine
+        cos,      ///< cosine
+        atan,     ///< arc tangent
+        abs,      ///< absolute value
+        pow_int,  ///< integer power, sqr being the power 2
+        pow_real, ///< interval power
+        count     ///< the number of functions
+    };
+
+    /// @brief The exponent of pow, unused by the other functions
+    struct exponent
+    {
+        int n;         ///< the integer exponent
+        double lo, hi; ///< the interval exponent
+    };
+
+    /// @brief Signature shared by every compiled kernel of one end point type
+    template <class T>
+    using kernel_fn = void (*)(T const *alo, T const *ahi, T *olo, T *ohi, std::size_t n, exponent const &e);
+
+    /// @brief W lanes of type T, a plain T for one lane
+    template <class T, std::size_t W>
+    struct lanes
+    {
+        typedef T type __attribute__((vector_size(W * sizeof(T)))); ///< the vector type
+    };
+
+    template <class T>
+    struct lanes<T, 1>
+    {
+        using type = T; ///< a scalar
+    };
+
+    /// @brief Converts the lanes of x to the element type of To
+    template <class To, class From>
+    [[gnu::always_inline]] inline To convert(From const &x) noexcept
+    {
+        if constexpr (std::is_arithmetic_v<From>)
+            return To(x);
+        else
+            return __builtin_convertvector(x, To);
+    }
+
+    /// @brief Applies one function to W intervals held in lanes
+    template <func F, class V>
+    [[gnu::always_inline]] inline void apply(V const &a, V const &b, V &lo, V &hi, exponent const &e) noexcept
+    {
+        if constexpr (F == func::sqrt)
+            sqrt_bounds(poly{}, a, b, lo, hi);
+        else if constexpr (F == func::exp)
+            exp_bounds(poly{}, a, b, lo, hi);
+        else if constexpr (F == func::log)
+            log_bounds(poly{}, a, b, lo, hi);
+        else if constexpr (F == func::atan)
+            atan_bounds(poly{}, a, b, lo, hi);
+        else if constexpr (F == func::abs)
+        {
+            lo = select(a >= 0, a, select(b <= 0, -b, V{}));
+            hi = select(a >= 0, b, select(b <= 0, -a, vmax(-a, b)));
+        }
+        else if constexpr (F == func::pow_int)
+            pow_int_bounds(a, b, e.n < 0 ? 0u - unsigned(e.n) : unsigned(e.n), e.n < 0, lo, hi); // |n| without overflow
+        else if constexpr (F == func::pow_real)
+            pow_bounds(poly{}, a, b, splat<V>(e.lo), splat<V>(e.hi), lo, hi);
+        else
+        {
+            int shift = F == func::cos;
+            if constexpr (std::is_arithmetic_v<V>)
+                sin_bounds(poly{}, a, b, shift, lo, hi); // the scalar overload checks the range itself
+            else
+            {
+                sin_bounds<poly, V>(poly{}, a, b, shift, lo, hi);
+                V limit = splat<V>(poly::trig_limit);
+                if (any((vabs(a) > limit) | (vabs(b) > limit) | (a != a) | (b != b)))
+                    for (std::size_t i = 0; i < sizeof(V) / sizeof(double); ++i)
+                    {
+                        double l, h;
+                        sin_bounds(poly{}, a[i], b[i], shift, l, h);
+                        lo[i] = l;
+                        hi[i] = h;
+                    }
+            }
+        }
+    }
+
+    /// @brief Rounds double lanes outward to float lanes
+    template <class VF, class V>
+    [[gnu::always_inline]] inline void narrow(V const &lo, V const &hi, VF &flo, VF &fhi) noexcept
+    {
+        if constexpr (std::is_arithmetic_v<V>)
+        {
+            flo = rounding::convert_down<float>(lo);
+            fhi = rounding::convert_up<float>(hi);
+        }
+        else
+        {
+            using M = bits_t<VF>;
+            flo = convert<VF>(lo);
+            fhi = convert<VF>(hi);
+            flo = select(convert<M>(convert<V>(flo) > lo), step_down(flo), flo); // rounded above the lower end point
+            fhi = select(convert<M>(convert<V>(fhi) < hi), step_up(fhi), fhi);   // rounded below the upper end point
+        }
+    }
+
+    /// @brief Runs one function over n elements, W at a time
+    template <class T, std::size_t W, func F>
+    [[gnu::always_inline]] inline void kernel(T const *alo, T const *ahi, T *olo, T *ohi, std::size_t n, exponent const &e) noexcept
+    {
+        using V = typename lanes<double, W>::type; // the lanes everything is computed in
+        using VT = typename lanes<T, W>::type;     // the same lanes in the end point type
+        for (std::size_t i = 0; i < n; i += W)
+        {
+            std::size_t m = std::min(W, n - i); // W except in the last block
+            VT ta, tb;
+            if (m == W)
+            {
+                std::memcpy(&ta, alo + i, sizeof(VT)); // load W lower end points
+                std::memcpy(&tb, ahi + i, sizeof(VT)); // load W upper end points
+            }
+            else
+            {
+                ta = tb = VT{} + T(1); // ones fill the lanes past the end
+                std::memcpy(&ta, alo + i, m * sizeof(T));
+                std::memcpy(&tb, ahi + i, m * sizeof(T));
+            }
+            V lo, hi;
+            VT tlo, thi;
+            apply<F>(convert<V>(ta), convert<V>(tb), lo, hi, e);
+            if constexpr (std::is_same_v<T, double>)
+            {
+                tlo = lo;
+                thi = hi;
+            }
+            else
+                narrow(lo, hi, tlo, thi);
+            if (m == W)
+            {
+                std::memcpy(olo + i, &tlo, sizeof(VT)); // store W lower end points
+                std::memcpy(ohi + i, &thi, sizeof(VT)); // store W upper end points
+            }
+            else
+            {
+                std::memcpy(olo + i, &tlo, m * sizeof(T));
+                std::memcpy(ohi + i, &thi, m * sizeof(T));
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 per instruction set entry points
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Kernel compiled for the default target, used as the scalar fallback
+    template <class T, func F>
+    void kernel_scalar(T const *alo, T const *ahi, T *olo, T *ohi, std::size_t n, exponent const &e) noexcept
+    {
+        kernel<T, 1, F>(alo, ahi, olo, ohi, n, e);
+    }
+
+#if INTERVAL_MATH_X86
+    /// @brief Kernel using 128 bit registers of doubles, the x86-64 baseline
+    template <class T, func F>
+    __attribute__((target("sse2"))) void kernel_sse2(T const *alo, T const *ahi, T *olo, T *ohi, std::size_t n, exponent const &e) noexcept
+    {
+        kernel<T, 2, F>(alo, ahi, olo, ohi, n, e);
+    }
+
+    /// @brief Kernel using 256 bit registers of doubles and fused multiply-adds, which every AVX2 processor but a few early ones has
+    template <class T, func F>
+    __attribute__((target("avx2,fma"))) void kernel_avx2(T const *alo, T const *ahi, T *olo, T *ohi, std::size_t n, exponent const &e) noexcept
+    {
+        kernel<T, 4, F>(alo, ahi, olo, ohi, n, e);
+    }
+
+    /// @brief Kernel using 512 bit registers of doubles
+    template <class T, func F>
+    __attribute__((target("avx512f"))) void kernel_avx512(T const *alo, T const *ahi, T *olo, T *ohi, std::size_t n, exponent const &e) noexcept
+    {
+        kernel<T, 8, F>(alo, ahi, olo, ohi, n, e);
+    }
+#endif
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 dispatch tables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Every kernel compiled for one instruction set and end point type, indexed by function
+    template <class T>
+    struct kernel_table
+    {
+        kernel_fn<T> fn[static_cast<int>(func::count)]; ///< the kernels
+    };
+
+    /// @brief Builds the table of one instruction set from its entry point template
+#define INTERVAL_MATH_TABLE(entry)                                                                                \
+    kernel_table<T>                                                                                               \
+    {                                                                                                             \
+        {                                                                                                         \
+            entry<T, func::sqrt>, entry<T, func::exp>, entry<T, func::log>, entry<T, func::sin>, entry<T, func::cos>,       \
+                entry<T, func::atan>, entry<T, func::abs>, entry<T, func::pow_int>, entry<T, func::pow_real>,             \
+        }                                                                                                         \
+    }
+
+    template <class T>
+    kernel_table<T> const scalar_table = INTERVAL_MATH_TABLE(kernel_scalar); ///< the scalar fallback
+#if INTERVAL_MATH_X86
+    template <class T>
+    kernel_table<T> const sse2_table = INTERVAL_MATH_TABLE(kernel_sse2); ///< the SSE2 kernels
+    template <class T>
+    kernel_table<T> const avx2_table = INTERVAL_MATH_TABLE(kernel_avx2); ///< the AVX2 kernels
+    template <class T>
+    kernel_table<T> const avx512_table = INTERVAL_MATH_TABLE(kernel_avx512); ///< the AVX-512 kernels
+#endif
+#undef INTERVAL_MATH_TABLE
+
+    /// @brief Gets the table of kernels for the active instruction set
+    /// @return the active table
+    template <class T>
+    kernel_table<T> const &active_table() noexcept
+    {
+        switch (active_simd_level())
+        {
+#if INTERVAL_MATH_X86
+        case simd_level::avx512:
+            return avx512_table<T>;
+        case simd_level::avx2:
+            if (__builtin_cpu_supports("fma"))
+                return avx2_table<T>;
+            [[fallthrough]]; // AVX2 without FMA runs the SSE2 kernels
+        case simd_level::sse2:
+            return sse2_table<T>;
+#endif
+        default:
+            return scalar_table<T>;
+        }
+    }
+
+    /// @brief Sizes the result and runs the selected kernel
+    /// @param f the function
+    /// @param a the arguments
+    /// @param out the result array
+    /// @param e the exponent of pow
+    template <class T>
+    void run(func f, basic_interval_array<T> const &a, basic_interval_array<T> &out, exponent const &e = {})
+    {
+        out.resize(a.size()); // no-op when out is a
+        if (a.size() != 0)
+            active_table<T>().fn[static_cast<int>(f)](a.lo(), a.hi(), out.lo(), out.hi(), a.size(), e);
+    }
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 batch interval functions
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details Each element is computed as by sqrt(basic_interval const &), with a vector square root in the SIMD kernels.
+template <class T>
+void sqrt(basic_interval_array<T> const &a, basic_interval_array<T> &out) { run(func::sqrt, a, out); }
+
+/// @details Each element is computed as by exp(basic_interval const &).
+template <class T>
+void exp(basic_interval_array<T> const &a, basic_interval_array<T> &out) { run(func::exp, a, out); }
+
+/// @details Each element is computed as by log(basic_interval const &).
+template <class T>
+void log(basic_interval_array<T> const &a, basic_interval_array<T> &out) { run(func::log, a, out); }
+
+/// @details Each element is computed as by sin(basic_interval const &).
+template <class T>
+void sin(basic_interval_array<T> const &a, basic_interval_array<T> &out) { run(func::sin, a, out); }
+
+/// @details Each element is computed as by cos(basic_interval const &).
+template <class T>
+void cos(basic_interval_array<T> const &a, basic_interval_array<T> &out) { run(func::cos, a, out); }
+
+/// @details Each element is computed as by atan(basic_interval const &).
+template <class T>
+void atan(basic_interval_array<T> const &a, basic_interval_array<T> &out) { run(func::atan, a, out); }
+
+/// @details Each element is computed as by abs(basic_interval const &).
+template <class T>
+void abs(basic_interval_array<T> const &a, basic_interval_array<T> &out) { run(func::abs, a, out); }
+
+/// @details Each element is computed as by sqr(basic_interval const &).
+template <class T>
+void sqr(basic_interval_array<T> const &a, basic_interval_array<T> &out) { run(func::pow_int, a, out, {2, 0.0, 0.0}); }
+
+/// @details Each element is computed as by pow(basic_interval const &, int).
+template <class T>
+void pow(basic_interval_array<T> const &a, int n, basic_interval_array<T> &out) { run(func::pow_int, a, out, {n, 0.0, 0.0}); }
+
+/// @details Each element is computed as by pow(basic_interval const &, basic_interval const &).
+template <class T>
+void pow(basic_interval_array<T> const &a, std::type_identity_t<basic_interval<T>> const &y, basic_interval_array<T> &out)
+{
+    run(func::pow_real, a, out, {0, double(y.min()), double(y.max())});
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 explicit instantiations
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Instantiates every batch function for one end point type
+#define INTERVAL_MATH_INSTANTIATE(T)                                                                                   \
+    template void sqrt(basic_interval_array<T> const &, basic_interval_array<T> &);                                    \
+    template void exp(basic_interval_array<T> const &, basic_interval_array<T> &);                                     \
+    template void log(basic_interval_array<T> const &, basic_interval_array<T> &);                                     \
+    template void sin(basic_interval_array<T> const &, basic_interval_array<T> &);                                     \
+    template void cos(basic_interval_array<T> const &, basic_interval_array<T> &);                                     \
+    template void atan(basic_interval_array<T> const &, basic_interval_array<T> &);                                    \
+    template void abs(basic_interval_array<T> const &, basic_interval_array<T> &);                                     \
+    template void sqr(basic_interval_array<T> const &, basic_interval_array<T> &);                                     \
+    template void pow(basic_interval_array<T> const &, int, basic_interval_array<T> &);                                \
+    template void pow(basic_interval_array<T> const &, std::type_identity_t<basic_interval<T>> const &, basic_interval_array<T> &);
+
+INTERVAL_MATH_INSTANTIATE(float)
+INTERVAL_MATH_INSTANTIATE(double)
+#undef INTERVAL_MATH_INSTANTIATE
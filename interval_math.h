@@ -0,0 +1,767 @@
+/// @file interval_math.h
+/// @brief Elementary functions of intervals and of whole interval arrays
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares sqrt, exp, log, sin, cos, atan, pow, abs and sqr for single intervals and the batch versions that act on whole interval arrays. Every result encloses the image of its argument: monotone functions are evaluated at the end points, while sin, cos and the even powers also take the extrema that fall inside the argument, so sqr(x) is never negative where x * x would be.
+/// @details The double end points come from polynomial approximations written once over math_detail lanes, a double or a GCC vector of doubles, so the scalar functions here and the SIMD kernels in interval_math.cpp share one definition. Each approximation is moved outward by a relative 2^-48 plus a tiny absolute term, several times its error in any rounding mode, which makes the enclosures hold under every rounding policy. Float end points are computed in double and rounded outward; long double end points use the C library moved outward by 2^-58.
+/// @details abs is exact. sqr and integer powers round outward under the policies that round upward and are moved outward by their error bound under the others.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "interval.h"
+#include "interval_array.h"
+
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <type_traits>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 implementation details
+//---------------------------------------------------------------------------------------------------------------------
+
+namespace math_detail
+{
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 lane helpers
+    //---------------------------------------------------------------------------------------------------------------------
+
+    // A lane type V is either a floating point scalar or a GCC vector of them. Comparisons of lanes give a mask, a bool or
+    // an integer vector, and select(mask, a, b) blends with the ?: operator, so one function body serves both.
+
+    /// @brief The element type and same sized integer type of a scalar lane
+    template <class V, bool = std::is_arithmetic_v<V>>
+    struct lane_of
+    {
+        using element = V;                                                                    ///< the end point type
+        using bits = std::conditional_t<sizeof(V) == 8, std::int64_t, std::int32_t>;          ///< the integer of the same size
+    };
+
+    /// @brief The element type and integer vector of the same shape of a vector lane
+    template <class V>
+    struct lane_of<V, false>
+    {
+        using element = std::remove_cvref_t<decltype(std::declval<V &>()[0])>;              ///< the end point type
+        using int_element = std::conditional_t<sizeof(element) == 8, long long, int>;        ///< an integer of the same size
+        typedef int_element bits __attribute__((vector_size(sizeof(V))));                    ///< the integer vector
+    };
+
+    /// @brief The end point type held by each lane
+    template <class V>
+    using element_t = typename lane_of<V>::element;
+
+    /// @brief The integer lane type with the layout of V
+    template <class V>
+    using bits_t = typename lane_of<V>::bits;
+
+    /// @brief Copies one value into every lane
+    template <class V>
+    [[gnu::always_inline]] inline V splat(element_t<V> c) noexcept { return V{} + c; }
+
+    /// @brief Picks a where mask is set and b elsewhere
+    template <class M, class V>
+    [[gnu::always_inline]] inline V select(M const &mask, V const &a, V const &b) noexcept { return mask ? a : b; }
+
+    /// @brief Tells whether any lane of a mask is set
+    template <class M>
+    [[gnu::always_inline]] inline bool any(M const &mask) noexcept
+    {
+        if constexpr (std::is_arithmetic_v<M>)
+            return mask;
+        else
+        {
+            for (std::size_t i = 0; i < sizeof(M) / sizeof(mask[0]); ++i)
+                if (mask[i])
+                    return true;
+            return false;
+        }
+    }
+
+    /// @brief Absolute value of every lane
+    template <class V>
+    [[gnu::always_inline]] inline V vabs(V const &x) noexcept { return select(x < 0, -x, x); }
+
+    /// @brief Raises every lane below c to c, keeping NaN
+    template <class V>
+    [[gnu::always_inline]] inline V at_least(V const &x, element_t<V> c) noexcept { return select(x < c, splat<V>(c), x); }
+
+    /// @brief Lowers every lane above c to c, keeping NaN
+    template <class V>
+    [[gnu::always_inline]] inline V at_most(V const &x, element_t<V> c) noexcept { return select(x > c, splat<V>(c), x); }
+
+    /// @brief Element wise minimum
+    template <class V>
+    [[gnu::always_inline]] inline V vmin(V const &a, V const &b) noexcept { return select(a < b, a, b); }
+
+    /// @brief Element wise maximum
+    template <class V>
+    [[gnu::always_inline]] inline V vmax(V const &a, V const &b) noexcept { return select(a > b, a, b); }
+
+    /// @brief Gets the next representable value towards +inf in every lane
+    /// @return the smallest value greater than x, or x itself if it is +inf or NaN
+    template <class V>
+    [[gnu::always_inline]] inline V step_up(V const &x) noexcept
+    {
+        using E = element_t<V>;
+        if constexpr (!std::is_same_v<E, double> && !std::is_same_v<E, float>)
+            return std::nextafter(x, std::numeric_limits<E>::infinity());
+        else
+        {
+            using I = bits_t<V>;
+            I b = std::bit_cast<I>(x) + select(x >= 0, I{} + 1, I{} - 1);                // one step away from or towards zero
+            V r = select(x == 0, splat<V>(std::numeric_limits<E>::denorm_min()), std::bit_cast<V>(b)); // either zero steps to the smallest subnormal
+            return select((x == std::numeric_limits<E>::infinity()) | (x != x), x, r);
+        }
+    }
+
+    /// @brief Gets the next representable value towards -inf in every lane
+    template <class V>
+    [[gnu::always_inline]] inline V step_down(V const &x) noexcept { return -step_up<V>(-x); }
+
+    /// @brief Moves an approximation below the exact value it approximates
+    /// @param r the approximation
+    /// @param eps the relative error bound
+    /// @param tiny the absolute error bound, which matters near zero and for subnormal results
+    /// @return a lower bound, the largest finite value if r is +inf
+    template <class V>
+    [[gnu::always_inline]] inline V widen_down(V const &r, element_t<V> eps, element_t<V> tiny) noexcept
+    {
+        using E = element_t<V>;
+        V lo = r - (vabs(r) * eps + tiny);
+        return select(r == std::numeric_limits<E>::infinity(), splat<V>(std::numeric_limits<E>::max()), lo);
+    }
+
+    /// @brief Moves an approximation above the exact value it approximates
+    /// @return an upper bound, the lowest finite value if r is -inf
+    template <class V>
+    [[gnu::always_inline]] inline V widen_up(V const &r, element_t<V> eps, element_t<V> tiny) noexcept
+    {
+        using E = element_t<V>;
+        V hi = r + (vabs(r) * eps + tiny);
+        return select(r == -std::numeric_limits<E>::infinity(), splat<V>(std::numeric_limits<E>::lowest()), hi);
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 polynomial approximations
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Double approximations built from + - * / and bit operations only, so that they vectorise
+    /// @details Each reduces its argument with split constants whose products with the reduction index are exact, then sums a Taylor series far enough that truncation stays below 2^-57. The results are within a few ulps of the exact values in any rounding mode, and integers are rounded with a magic constant whose error is corrected afterwards, so no function depends on the current rounding mode.
+    struct poly
+    {
+        static constexpr double eps = 0x1p-48;       ///< relative error bound used for widening, about 16 ulps
+        static constexpr double tiny = 0x1p-1022;    ///< absolute error bound, the smallest normal number so that widening never computes with subnormals
+        static constexpr double trig_tiny = 0x1p-90; ///< absolute error bound of sin and cos, from the reduction near their zeros
+        static constexpr double trig_limit = 0x1p20; ///< largest argument sin and cos reduce; larger ones go to the C library
+
+        /// @brief Adds 1 where mask is set
+        template <class V, class M>
+        [[gnu::always_inline]] static V plus_one(V const &x, M const &mask) noexcept { return x + select(mask, splat<V>(1.0), V{}); }
+
+        /// @brief Rounds every lane to the nearest integer, |y| < 2^51
+        /// @details The magic constant rounds in the current mode, so a result more than one half away is moved back by one.
+        template <class V>
+        [[gnu::always_inline]] static V nearest(V const &y) noexcept
+        {
+            constexpr double magic = 0x1.8p52; // adding it leaves no fraction bits
+            V k = (y + magic) - magic;
+            return plus_one(k, y - k > 0.5) - select(k - y > 0.5, splat<V>(1.0), V{});
+        }
+
+        /// @brief Rounds every lane down to an integer, |y| < 2^51
+        template <class V>
+        [[gnu::always_inline]] static V floor(V const &y) noexcept
+        {
+            V k = nearest(y);
+            return k - select(k > y, splat<V>(1.0), V{});
+        }
+
+        /// @brief Converts integer lanes in [0, 2^52) to double exactly
+        template <class V>
+        [[gnu::always_inline]] static V to_double(bits_t<V> const &n) noexcept
+        {
+            return std::bit_cast<V>(n | std::bit_cast<bits_t<V>>(splat<V>(0x1p52))) - 0x1p52;
+        }
+
+        /// @brief Builds 2^k for integer lanes k in [-1022, 1023]
+        template <class V>
+        [[gnu::always_inline]] static V pow2(V const &k) noexcept
+        {
+            return std::bit_cast<V>(std::bit_cast<bits_t<V>>(k + (0x1p52 + 1023)) << 52); // the biased exponent sits in the low bits
+        }
+
+        /// @brief Evaluates c[I] + c[I + S] x + c[I + 2 S] x^2 + ... by Horner's rule
+        template <std::size_t I, std::size_t S, class V, std::size_t N>
+        [[gnu::always_inline]] static V series(V const &x, double const (&c)[N]) noexcept
+        {
+            if constexpr (I + S >= N)
+                return splat<V>(c[I]);
+            else
+                return series<I + S, S>(x, c) * x + c[I];
+        }
+
+        /// @brief Evaluates c[0] + c[1] x + c[2] x^2 + ... as four interleaved series in x^4
+        /// @details The four Horner chains are independent, so the latency is about a quarter of one chain over every coefficient, which is what limits these functions.
+        template <class V, std::size_t N>
+        [[gnu::always_inline]] static V polynomial(V const &x, double const (&c)[N]) noexcept
+        {
+            static_assert(N >= 4, "four chains need four coefficients");
+            V x2 = x * x, x4 = x2 * x2;
+            return (series<0, 4>(x4, c) + x * series<1, 4>(x4, c)) + x2 * (series<2, 4>(x4, c) + x * series<3, 4>(x4, c));
+        }
+
+        /// @brief 1 / n! for n = 0 ... 13
+        static constexpr double exp_coeffs[] = {1.0, 1.0, 1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120, 1.0 / 720, 1.0 / 5040, 1.0 / 40320,
+                                                1.0 / 362880, 1.0 / 3628800, 1.0 / 39916800, 1.0 / 479001600, 1.0 / 6227020800.0};
+
+        /// @brief 1 / (2n + 1) for n = 1 ... 10, the series of atanh
+        static constexpr double log_coeffs[] = {1.0 / 3, 1.0 / 5, 1.0 / 7, 1.0 / 9, 1.0 / 11, 1.0 / 13, 1.0 / 15, 1.0 / 17, 1.0 / 19, 1.0 / 21};
+
+        /// @brief (-1)^n / (2n + 1)! for n = 1 ... 8
+        static constexpr double sin_coeffs[] = {-1.0 / 6, 1.0 / 120, -1.0 / 5040, 1.0 / 362880, -1.0 / 39916800, 1.0 / 6227020800.0,
+                                                -1.0 / 1307674368000.0, 1.0 / 355687428096000.0};
+
+        /// @brief (-1)^n / (2n)! for n = 2 ... 9
+        static constexpr double cos_coeffs[] = {1.0 / 24, -1.0 / 720, 1.0 / 40320, -1.0 / 3628800, 1.0 / 479001600, -1.0 / 87178291200.0,
+                                                1.0 / 20922789888000.0, -1.0 / 6402373705728000.0};
+
+        /// @brief (-1)^n / (2n + 1) for n = 1 ... 22
+        static constexpr double atan_coeffs[] = {-1.0 / 3, 1.0 / 5, -1.0 / 7, 1.0 / 9, -1.0 / 11, 1.0 / 13, -1.0 / 15, 1.0 / 17,
+                                                 -1.0 / 19, 1.0 / 21, -1.0 / 23, 1.0 / 25, -1.0 / 27, 1.0 / 29, -1.0 / 31, 1.0 / 33,
+                                                 -1.0 / 35, 1.0 / 37, -1.0 / 39, 1.0 / 41, -1.0 / 43, 1.0 / 45};
+
+        /// @brief Approximates e^x
+        /// @details x = k ln2 + r with |r| <= ln2 / 2, and 2^k is applied as two factors so that results near overflow and in the subnormal range are rounded once.
+        template <class V>
+        [[gnu::always_inline]] static V exp(V x) noexcept
+        {
+            constexpr double ln2_hi = 0x1.62e42fee00000p-1; // ln 2 to 32 bits, k ln2_hi is exact
+            constexpr double ln2_lo = 0x1.a39ef35793c76p-33;
+            x = at_least(at_most(x, 710.0), -746.0); // beyond these exp overflows or underflows to zero
+            V k = nearest(x * std::numbers::log2e);
+            V r = (x - k * ln2_hi) - k * ln2_lo;
+            V p = polynomial(r, exp_coeffs);
+            V k1 = nearest(k * 0.5);
+            return p * pow2(k1) * pow2(k - k1);
+        }
+
+        /// @brief Approximates the natural logarithm, -inf at zero and NaN below it
+        /// @details x = 2^e m with m in [sqrt(1/2), sqrt(2)), and log m = 2 atanh((m - 1) / (m + 1)). Subnormals are scaled by 2^54 first.
+        template <class V>
+        [[gnu::always_inline]] static V log(V const &x) noexcept
+        {
+            using I = bits_t<V>;
+            constexpr double ln2_hi = 0x1.62e42fee00000p-1; // e ln2_hi is exact for every exponent
+            constexpr double ln2_lo = 0x1.a39ef35793c76p-33;
+            auto sub = x < std::numeric_limits<double>::min();
+            V xs = select(sub, x * 0x1p54, x);
+            I b = std::bit_cast<I>(xs);
+            V e = to_double<V>((b >> 52) & 0x7ff) - select(sub, splat<V>(1023.0 + 54), splat<V>(1023.0));
+            V m = std::bit_cast<V>((b & 0x000fffffffffffffLL) | 0x3ff0000000000000LL); // the mantissa in [1, 2)
+            auto big = m > std::numbers::sqrt2;
+            m = select(big, m * 0.5, m);
+            e = plus_one(e, big);
+            V s = (m - 1.0) / (m + 1.0), s2 = s * s;
+            V lm = 2.0 * s + (2.0 * s) * s2 * polynomial(s2, log_coeffs);
+            V r = e * ln2_hi + (e * ln2_lo + lm);
+            r = select(x == 0, splat<V>(-std::numeric_limits<double>::infinity()), r);
+            r = select(x < 0, splat<V>(std::numeric_limits<double>::quiet_NaN()), r);
+            return select((x == std::numeric_limits<double>::infinity()) | (x != x), x, r);
+        }
+
+        /// @brief Approximates the square root, NaN below zero
+        /// @details A scalar uses the correctly rounded hardware root. A vector refines the bit pattern estimate of 1 / sqrt(x) by four Newton steps and corrects the root once, because GCC does not vectorise the hardware root from generic vector code.
+        template <class V>
+        [[gnu::always_inline]] static V sqrt(V const &x) noexcept
+        {
+            if constexpr (std::is_arithmetic_v<V>)
+                return std::sqrt(x);
+            else
+            {
+                using I = bits_t<V>;
+                auto sub = x < 0x1p-900;                                  // the estimate needs a normal argument
+                V xs = select(sub, x * 0x1p200, x), half = 0.5 * xs;
+                V y = std::bit_cast<V>(0x5fe6eb50c7b537a9LL - (std::bit_cast<I>(xs) >> 1)); // 1 / sqrt(xs) to about 3.5%
+                for (int i = 0; i < 4; ++i)
+                    y = y * (1.5 - half * y * y); // each step squares the relative error
+                V s = xs * y;
+                s = s + (0.5 * y) * (xs - s * s);
+                s = select(sub, s * 0x1p-100, s);
+                s = select((x == 0) | (x == std::numeric_limits<double>::infinity()) | (x != x), x, s);
+                return select(x < 0, splat<V>(std::numeric_limits<double>::quiet_NaN()), s);
+            }
+        }
+
+        /// @brief Approximates sin(x + shift pi / 2), so shift 0 gives sin and shift 1 gives cos; |x| <= #trig_limit
+        /// @details x = k pi / 2 + r with pi / 2 split into four parts whose first three have exact products with k, then the quadrant of k + shift picks sin r or cos r and its sign.
+        template <class V>
+        [[gnu::always_inline]] static V sin(V const &x, int shift) noexcept
+        {
+            constexpr double pio2_1 = 0x1.921fb544p+0, pio2_2 = 0x1.0b4611a6p-34, pio2_3 = 0x1.3198a2ep-69, pio2_3t = 0x1.b839a252049c1p-104;
+            V k = nearest(x * std::numbers::inv_pi * 2.0);
+            V r = (((x - k * pio2_1) - k * pio2_2) - k * pio2_3) - k * pio2_3t;
+            V r2 = r * r;
+            V s = r + (r * r2) * polynomial(r2, sin_coeffs);
+            V c = (1.0 - 0.5 * r2) + (r2 * r2) * polynomial(r2, cos_coeffs);
+            V q = k + double(shift);
+            V n = q - 4.0 * floor(q * 0.25); // quadrant in 0 ... 3
+            return select(n == 0.0, s, select(n == 1.0, c, select(n == 2.0, -s, -c)));
+        }
+
+        /// @brief Approximates the arc tangent
+        /// @details |x| > 1 uses atan x = pi / 2 - atan(1 / x), and t > tan(pi / 8) uses atan t = pi / 4 + atan((t - 1) / (t + 1)), leaving a series argument of at most tan(pi / 8).
+        template <class V>
+        [[gnu::always_inline]] static V atan(V const &x) noexcept
+        {
+            constexpr double pio4_hi = 0x1.921fb54442d18p-1, pio4_lo = 0x1.1a62633145c07p-55;
+            constexpr double pio2_hi = 0x1.921fb54442d18p+0, pio2_lo = 0x1.1a62633145c07p-54;
+            V ax = vabs(x);
+            auto inv = ax > 1.0;
+            V t = select(inv, 1.0 / ax, ax);
+            auto mid = t > 0x1.a827999fcef32p-2; // tan(pi / 8)
+            V u = select(mid, (t - 1.0) / (t + 1.0), t), u2 = u * u;
+            V p = u + (u * u2) * polynomial(u2, atan_coeffs);
+            p = select(mid, pio4_hi + (pio4_lo + p), p);
+            p = select(inv, pio2_hi - (p - pio2_lo), p);
+            return select(x < 0, -p, p);
+        }
+    };
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 C library approximations
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Scalar approximations from the C library, for long double and for double sin and cos beyond #poly::trig_limit
+    /// @details The C library is accurate to a few ulps over the whole range, including the argument reduction of sin and cos.
+    template <class E>
+    struct libm
+    {
+        static constexpr E eps = std::is_same_v<E, long double> ? E(0x1p-58L) : E(0x1p-48); ///< relative error bound, about 32 and 16 ulps
+        static constexpr E tiny = std::numeric_limits<E>::min();                         ///< absolute error bound, the smallest normal number
+        static constexpr E trig_tiny = tiny;                                             ///< absolute error bound of sin and cos
+
+        static E floor(E y) noexcept { return std::floor(y); }                          ///< rounds down to an integer
+        static E exp(E x) noexcept { return std::exp(x); }                              ///< e^x
+        static E log(E x) noexcept { return std::log(x); }                              ///< natural logarithm
+        static E sqrt(E x) noexcept { return std::sqrt(x); }                            ///< square root
+        static E sin(E x, int shift) noexcept { return shift ? std::cos(x) : std::sin(x); } ///< sin(x + shift pi / 2)
+        static E atan(E x) noexcept { return std::atan(x); }                            ///< arc tangent
+    };
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 interval bounds
+    //---------------------------------------------------------------------------------------------------------------------
+
+    // Each function encloses the image of [a, b] in [lo, hi], lane by lane, using the approximations of A.
+
+    /// @brief Encloses sqrt over [a, b]; the part below zero is ignored and an argument wholly below zero gives NaN
+    template <class A, class V>
+    [[gnu::always_inline]] inline void sqrt_bounds(A, V const &a, V const &b, V &lo, V &hi) noexcept
+    {
+        lo = at_least(widen_down(A::sqrt(at_least(a, 0)), A::eps, A::tiny), 0);
+        hi = widen_up(A::sqrt(b), A::eps, A::tiny);
+        lo = select(b < 0, hi, lo); // both NaN
+    }
+
+    /// @brief Encloses exp over [a, b]
+    template <class A, class V>
+    [[gnu::always_inline]] inline void exp_bounds(A, V const &a, V const &b, V &lo, V &hi) noexcept
+    {
+        lo = at_least(widen_down(A::exp(a), A::eps, A::tiny), 0); // exp is never negative
+        hi = widen_up(A::exp(b), A::eps, A::tiny);
+    }
+
+    /// @brief Encloses log over [a, b]; the part below zero is ignored and an argument wholly below zero gives NaN
+    template <class A, class V>
+    [[gnu::always_inline]] inline void log_bounds(A, V const &a, V const &b, V &lo, V &hi) noexcept
+    {
+        lo = widen_down(A::log(at_least(a, 0)), A::eps, A::tiny);
+        hi = widen_up(A::log(b), A::eps, A::tiny);
+        lo = select(b < 0, hi, lo); // both NaN
+    }
+
+    /// @brief Encloses atan over [a, b]
+    template <class A, class V>
+    [[gnu::always_inline]] inline void atan_bounds(A, V const &a, V const &b, V &lo, V &hi) noexcept
+    {
+        lo = widen_down(A::atan(a), A::eps, A::tiny);
+        hi = widen_up(A::atan(b), A::eps, A::tiny);
+    }
+
+    /// @brief Encloses sin (shift 0) or cos (shift 1) over [a, b]
+    /// @details The end point values are widened, then an extremum is added for every multiple j pi / 2 inside [a, b] where sin(x + shift pi / 2) has one: a maximum when j + shift = 1 mod 4 and a minimum when j + shift = 3 mod 4. The quotients x 2 / pi are moved outward by 2^-48 relative before rounding down, so a multiple is never missed; at worst a tight bound becomes 1 or -1.
+    template <class A, class V>
+    [[gnu::always_inline]] inline void sin_bounds(A, V const &a, V const &b, int shift, V &lo, V &hi) noexcept
+    {
+        using E = element_t<V>;
+        V fa = A::sin(a, shift), fb = A::sin(b, shift);
+        lo = vmin(widen_down(fa, A::eps, A::trig_tiny), widen_down(fb, A::eps, A::trig_tiny));
+        hi = vmax(widen_up(fa, A::eps, A::trig_tiny), widen_up(fb, A::eps, A::trig_tiny));
+
+        constexpr E two_over_pi = 2 * std::numbers::inv_pi_v<E>, slack = E(0x1p-48);
+        V ya = a * two_over_pi, yb = b * two_over_pi;
+        V qa = A::floor(ya - (vabs(ya) * slack + slack)); // every multiple inside is in (qa, qb]
+        V qb = A::floor(yb + (vabs(yb) * slack + slack));
+        E top = E(1 - shift), bottom = E(3 - shift); // j mod 4 of the maxima and minima
+        auto has_max = A::floor((qb - top) * E(0.25)) > A::floor((qa - top) * E(0.25));
+        auto has_min = A::floor((qb - bottom) * E(0.25)) > A::floor((qa - bottom) * E(0.25));
+        hi = select(has_max, splat<V>(1), at_most(hi, 1));
+        lo = select(has_min, splat<V>(-1), at_least(lo, -1));
+    }
+
+    /// @brief Encloses sin (shift 0) or cos (shift 1) over [a, b] for double end points, using the C library beyond #poly::trig_limit
+    inline void sin_bounds(poly, double a, double b, int shift, double &lo, double &hi) noexcept
+    {
+        if (std::abs(a) <= poly::trig_limit && std::abs(b) <= poly::trig_limit)
+            sin_bounds<poly, double>(poly{}, a, b, shift, lo, hi);
+        else
+            sin_bounds<libm<double>, double>(libm<double>{}, a, b, shift, lo, hi); // also takes infinite and NaN end points
+    }
+
+    /// @brief Multiplies, taking 0 * inf as 0
+    template <class V>
+    [[gnu::always_inline]] inline V mul0(V const &x, V const &y) noexcept { return select((x == 0) | (y == 0), V{}, x * y); }
+
+    /// @brief Encloses x^y = exp(y log x) over x in [a, b] and y in [ya, yb]; the part of x below zero is ignored
+    /// @details The extremes of y log x are among the four corner products, which are moved one ulp outward before exp. 0^0 is taken as 1.
+    template <class A, class V>
+    [[gnu::always_inline]] inline void pow_bounds(A approx, V const &a, V const &b, V const &ya, V const &yb, V &lo, V &hi) noexcept
+    {
+        V la, lb;
+        log_bounds(approx, a, b, la, lb);
+        V p = mul0(la, ya), q = mul0(la, yb), r = mul0(lb, ya), s = mul0(lb, yb); // all permutations of the end points
+        exp_bounds(approx, step_down(vmin(vmin(p, q), vmin(r, s))), step_up(vmax(vmax(p, q), vmax(r, s))), lo, hi);
+        lo = select(b < 0, lb, lo); // NaN when x lies below zero
+        hi = select(b < 0, lb, hi);
+    }
+
+    /// @brief Raises x >= 0 to the power m rounding down, by repeated squaring
+    template <class R, class T, class U>
+    constexpr T power_down(T x, U m) noexcept
+    {
+        T r = T(1);
+        for (; m != 0; m >>= 1)
+        {
+            if (m & 1)
+                r = rounding::mul_down<R>(r, x);
+            if (m > 1)
+                x = rounding::mul_down<R>(x, x);
+        }
+        return R::down(r);
+    }
+
+    /// @brief Raises x >= 0 to the power m rounding up, by repeated squaring
+    template <class R, class T, class U>
+    constexpr T power_up(T x, U m) noexcept
+    {
+        T r = T(1);
+        for (; m != 0; m >>= 1)
+        {
+            if (m & 1)
+                r = rounding::mul_up<R>(r, x);
+            if (m > 1)
+                x = rounding::mul_up<R>(x, x);
+        }
+        return R::up(r);
+    }
+
+    /// @brief Raises the lanes of x >= 0 to the power m by repeated squaring, rounding each product to nearest
+    template <class V, class U>
+    [[gnu::always_inline]] inline V power(V x, U m) noexcept
+    {
+        V r = splat<V>(1);
+        for (; m != 0; m >>= 1)
+        {
+            if (m & 1)
+                r = r * x;
+            if (m > 1)
+                x = x * x;
+        }
+        return r;
+    }
+
+    /// @brief Encloses [a, b]^n lane by lane, n being m or -m, for the policies that round to nearest
+    /// @details Repeated squaring takes fewer than 2 bit_width(m) products, each within half an ulp, so the powers are moved outward by a relative bit_width(m) + 1 epsilons plus the smallest normal number, as the approximations above are. A negative power is the reciprocal of the moved bounds, moved again by one epsilon.
+    template <class V, class U>
+    [[gnu::always_inline]] inline void pow_int_bounds(V const &a, V const &b, U m, bool negative, V &lo, V &hi) noexcept
+    {
+        using E = element_t<V>;
+        if (m == 0)
+        {
+            lo = hi = splat<V>(1);
+            return;
+        }
+        E eps = std::numeric_limits<E>::epsilon() * E(std::bit_width(m) + 1), tiny = std::numeric_limits<E>::min();
+        if (m % 2 == 1) // odd powers keep the sign and order of the end points
+        {
+            lo = select(a >= 0, at_least(widen_down(power(a, m), eps, tiny), 0), -widen_up(power(-a, m), eps, tiny));
+            hi = select(b >= 0, widen_up(power(b, m), eps, tiny), -at_least(widen_down(power(-b, m), eps, tiny), 0));
+        }
+        else
+        {
+            V near = select(a > 0, a, select(b < 0, -b, V{})); // the end point nearest zero, or zero inside
+            V far = vmax(-a, b);                               // the end point farthest from zero
+            lo = at_least(widen_down(power(near, m), eps, tiny), 0); // x^m is never below zero
+            hi = widen_up(power(far, m), eps, tiny);
+        }
+        if (negative) // 1 / [lo, hi], entire when it contains zero
+        {
+            auto zero = (lo <= 0) & (hi >= 0);
+            V inf = splat<V>(std::numeric_limits<E>::infinity());
+            E one = std::numeric_limits<E>::epsilon();
+            V rlo = select(zero, -inf, widen_down(E(1) / hi, one, tiny));
+            hi = select(zero, inf, widen_up(E(1) / lo, one, tiny));
+            lo = rlo;
+        }
+    }
+
+    /// @brief Evaluates a bounds function for the end point type of an interval
+    /// @details float and double end points use #poly, float results being rounded outward by the converting constructor; long double end points use #libm.
+    /// @param x the argument
+    /// @param fn called as fn(approximations, a, b, lo, hi)
+    /// @return the enclosure
+    template <class T, class R, class F>
+    basic_interval<T, R> evaluate(basic_interval<T, R> const &x, F &&fn) noexcept
+    {
+        if constexpr (std::is_same_v<T, long double>)
+        {
+            long double lo, hi;
+            fn(libm<long double>{}, x.min(), x.max(), lo, hi);
+            return basic_interval<T, R>(lo, hi);
+        }
+        else
+        {
+            double lo, hi;
+            fn(poly{}, double(x.min()), double(x.max()), lo, hi);
+            return basic_interval<T, R>(basic_interval<double, R>(lo, hi));
+        }
+    }
+} // namespace math_detail
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 interval functions
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Encloses the square root of an interval
+/// @details The part of x below zero is ignored; an interval wholly below zero gives [NaN, NaN].
+/// @param x the argument
+/// @return the enclosure
+template <class T, class R>
+basic_interval<T, R> sqrt(basic_interval<T, R> const &x) noexcept
+{
+    return math_detail::evaluate(x, [](auto approx, auto a, auto b, auto &lo, auto &hi) { math_detail::sqrt_bounds(approx, a, b, lo, hi); });
+}
+
+/// @brief Encloses e raised to an interval
+/// @param x the argument
+/// @return the enclosure, never below zero
+template <class T, class R>
+basic_interval<T, R> exp(basic_interval<T, R> const &x) noexcept
+{
+    return math_detail::evaluate(x, [](auto approx, auto a, auto b, auto &lo, auto &hi) { math_detail::exp_bounds(approx, a, b, lo, hi); });
+}
+
+/// @brief Encloses the natural logarithm of an interval
+/// @details The part of x below zero is ignored, so x containing zero gives a lower end point of -inf; an interval wholly below zero gives [NaN, NaN].
+/// @param x the argument
+/// @return the enclosure
+template <class T, class R>
+basic_interval<T, R> log(basic_interval<T, R> const &x) noexcept
+{
+    return math_detail::evaluate(x, [](auto approx, auto a, auto b, auto &lo, auto &hi) { math_detail::log_bounds(approx, a, b, lo, hi); });
+}
+
+/// @brief Encloses the sine of an interval
+/// @details An interval holding a maximum or minimum of sin gets 1 or -1 as its end point; one at least 2 pi wide gives [-1, 1].
+/// @param x the argument in radians
+/// @return the enclosure, within [-1, 1]
+template <class T, class R>
+basic_interval<T, R> sin(basic_interval<T, R> const &x) noexcept
+{
+    return math_detail::evaluate(x, [](auto approx, auto a, auto b, auto &lo, auto &hi) { math_detail::sin_bounds(approx, a, b, 0, lo, hi); });
+}
+
+/// @brief Encloses the cosine of an interval
+/// @details An interval holding a maximum or minimum of cos gets 1 or -1 as its end point; one at least 2 pi wide gives [-1, 1].
+/// @param x the argument in radians
+/// @return the enclosure, within [-1, 1]
+template <class T, class R>
+basic_interval<T, R> cos(basic_interval<T, R> const &x) noexcept
+{
+    return math_detail::evaluate(x, [](auto approx, auto a, auto b, auto &lo, auto &hi) { math_detail::sin_bounds(approx, a, b, 1, lo, hi); });
+}
+
+/// @brief Encloses the arc tangent of an interval
+/// @param x the argument
+/// @return the enclosure, in radians
+template <class T, class R>
+basic_interval<T, R> atan(basic_interval<T, R> const &x) noexcept
+{
+    return math_detail::evaluate(x, [](auto approx, auto a, auto b, auto &lo, auto &hi) { math_detail::atan_bounds(approx, a, b, lo, hi); });
+}
+
+/// @brief Encloses x^y for every x in an interval and y in another, as exp(y log x)
+/// @details The part of x below zero is ignored and 0^0 is taken as 1; an x wholly below zero gives [NaN, NaN]. Use the integer overload for negative bases.
+/// @param x the base
+/// @param y the exponent, a scalar converts to the interval enclosing it
+/// @return the enclosure
+template <class T, class R>
+basic_interval<T, R> pow(basic_interval<T, R> const &x, std::type_identity_t<basic_interval<T, R>> const &y) noexcept
+{
+    return math_detail::evaluate(x, [&y](auto approx, auto a, auto b, auto &lo, auto &hi)
+                                 {
+                                     using E = decltype(a);
+                                     math_detail::pow_bounds(approx, a, b, E(y.min()), E(y.max()), lo, hi); });
+}
+
+/// @brief Encloses an interval raised to an integer power
+/// @details The end points are raised by repeated squaring. Under a policy that rounds upward every product is rounded outward; under rounding::fast and rounding::widen the products are rounded to nearest and the bounds moved outward by their error bound, as the other functions of this file are, so the result encloses x^n under every policy. Odd powers are increasing; even powers take their minimum at the end point nearer zero, or at zero when x contains it, so the result is never negative. A negative n gives 1 / x^-n, which is #basic_interval::entire when x^-n contains zero. Float end points are computed in double.
+/// @param x the base
+/// @param n the exponent, of an integer type so that a floating point exponent picks the interval overload; pow(x, 0) is [1, 1]
+/// @return the enclosure
+template <class T, class R, std::integral N>
+basic_interval<T, R> pow(basic_interval<T, R> const &x, N n) noexcept
+{
+    using I = basic_interval<T, R>;
+    using U = std::make_unsigned_t<N>;
+    U m = n < 0 ? U(0) - U(n) : U(n); // |n| without overflow
+    if constexpr (std::is_same_v<T, float>)
+        return I(pow(basic_interval<double, R>(x), n)); // exact products are rounded once, outward
+    else if constexpr (!R::upward)
+    {
+        T lo, hi;
+        math_detail::pow_int_bounds(x.min(), x.max(), m, n < 0, lo, hi);
+        return I(lo, hi);
+    }
+    else
+    {
+        using math_detail::power_down, math_detail::power_up;
+        T a = x.min(), b = x.max();
+        I p;
+        {
+            [[maybe_unused]] typename R::guard guard; // set the rounding mode if the policy needs it
+            if (m % 2 == 1)                           // odd powers keep the sign and order of the end points
+                p = I(a >= 0 ? power_down<R>(a, m) : -power_up<R>(-a, m), b >= 0 ? power_up<R>(b, m) : -power_down<R>(-b, m));
+            else
+            {
+                T near = a > 0 ? a : b < 0 ? -b : T(0); // the end point nearest zero, or zero inside
+                T far = -a > b ? -a : b;                 // the end point farthest from zero
+                p = I(power_down<R>(near, m), power_up<R>(far, m));
+            }
+        }
+        return n < 0 ? I(T(1)) / p : p;
+    }
+}
+
+/// @brief Encloses the square of an interval, tighter than x * x
+/// @details x * x takes four products of independent end points, so [-1, 2] * [-1, 2] = [-2, 4]; sqr([-1, 2]) = [0, 4].
+/// @param x the argument
+/// @return the enclosure, never below zero
+template <class T, class R>
+basic_interval<T, R> sqr(basic_interval<T, R> const &x) noexcept
+{
+    return pow(x, 2);
+}
+
+/// @brief Gets the absolute value of an interval
+/// @param x the argument
+/// @return {|t| : t in x}, exact
+template <class T, class R>
+constexpr basic_interval<T, R> abs(basic_interval<T, R> const &x) noexcept
+{
+    T a = x.min(), b = x.max();
+    if (a >= 0)
+        return x;
+    if (b <= 0)
+        return basic_interval<T, R>(-b, -a);
+    return basic_interval<T, R>(T(0), -a > b ? -a : b); // zero lies inside
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 batch interval functions
+//---------------------------------------------------------------------------------------------------------------------
+
+// Each function is compiled in interval_math.cpp for float and double and gives, element by element, an enclosure of the
+// function over every interval of a. At simd_level::sse2 and below the results equal those of the interval functions
+// above under rounding::fast, except for sqrt, whose vector root differs from the hardware one in the last bits. The AVX2
+// and AVX-512 kernels evaluate the polynomials of exp, log, sin, cos, atan and pow with fused multiply-adds, so their end
+// points may differ from the scalar ones in the last bits, for a few elements in a thousand. Every one of these results
+// is an enclosure. out is resized to the size of a and may be a.
+
+/// @brief Encloses the square root of every element, see sqrt(basic_interval const &)
+/// @param a the arguments
+/// @param out the enclosures
+template <class T>
+void sqrt(basic_interval_array<T> const &a, basic_interval_array<T> &out);
+
+/// @brief Encloses e raised to every element
+/// @param a the arguments
+/// @param out the enclosures
+template <class T>
+void exp(basic_interval_array<T> const &a, basic_interval_array<T> &out);
+
+/// @brief Encloses the natural logarithm of every element
+/// @param a the arguments
+/// @param out the enclosures
+template <class T>
+void log(basic_interval_array<T> const &a, basic_interval_array<T> &out);
+
+/// @brief Encloses the sine of every element
+/// @param a the arguments in radians
+/// @param out the enclosures
+template <class T>
+void sin(basic_interval_array<T> const &a, basic_interval_array<T> &out);
+
+/// @brief Encloses the cosine of every element
+/// @param a the arguments in radians
+/// @param out the enclosures
+template <class T>
+void cos(basic_interval_array<T> const &a, basic_interval_array<T> &out);
+
+/// @brief Encloses the arc tangent of every element
+/// @param a the arguments
+/// @param out the enclosures
+template <class T>
+void atan(basic_interval_array<T> const &a, basic_interval_array<T> &out);
+
+/// @brief Gets the absolute value of every element
+/// @param a the arguments
+/// @param out the results
+template <class T>
+void abs(basic_interval_array<T> const &a, basic_interval_array<T> &out);
+
+/// @brief Encloses the square of every element, never below zero
+/// @param a the arguments
+/// @param out the enclosures
+template <class T>
+void sqr(basic_interval_array<T> const &a, basic_interval_array<T> &out);
+
+/// @brief Encloses every element raised to an integer power
+/// @param a the bases
+/// @param n the exponent shared by every element
+/// @param out the enclosures
+template <class T>
+void pow(basic_interval_array<T> const &a, int n, basic_interval_array<T> &out);
+
+/// @brief Encloses every element raised to the powers in one interval
+/// @param a the bases
+/// @param y the exponent shared by every element
+/// @param out the enclosures
+template <class T>
+void pow(basic_interval_array<T> const &a, std::type_identity_t<basic_interval<T>> const &y, basic_interval_array<T> &out);
+
+/// @brief Encloses every element raised to a floating point power, which would otherwise convert to int
+/// @param a the bases
+/// @param y the exponent shared by every element, enclosed in an interval
+/// @param out the enclosures
+template <class T, std::floating_point S>
+void pow(basic_interval_array<T> const &a, S y, basic_interval_array<T> &out)
+{
+    pow(a, basic_interval<T>(y), out);
+}
@@ -0,0 +1,544 @@
+/// @file interval_matrix.cpp
+/// @brief Blocked kernels of the interval matrix product
+/// @author George Downing
+/// @date 17-10-2026
+/// @details This file contains matmul. The result is cut into tiles of #tile_rows rows; each tile walks the inner dimension in panels, packs the panel of A into strips of a few rows and the panel of B into strips of a few vectors, and runs a micro kernel that keeps a block of the result in registers for the whole panel. Packing pads the strips with zeros, so the micro kernels never test for the edge of a matrix inside their loops.
+/// @details The interval kernel runs inside a rounding_scope and takes the larger of four end point products for each upper end point and the larger of four products with a negated end point of B for each negated lower end point. The negated end points are packed into B, so the compiler never sees a negation it could fold away. The real kernel behind matmul_mode::midrad runs in any rounding mode; the bounds of #midrad_bounds hold for every faithful rounding. This file is compiled with -frounding-math.
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                    include files
+//---------------------------------------------------------------------------------------------------------------------
+
+#include "interval_matrix.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define INTERVAL_MATRIX_X86 1 ///< the x86 kernels are available
+#else
+#define INTERVAL_MATRIX_X86 0 ///< only the scalar kernels are available
+#endif
+
+#if INTERVAL_MATRIX_X86
+// The micro kernels pass vector types between always_inline helpers that are compiled without AVX. They are always inlined
+// into a function built for the right instruction set, so the ABI note GCC emits for them does not apply.
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+namespace
+{
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 block sizes
+    //---------------------------------------------------------------------------------------------------------------------
+
+    constexpr std::size_t tile_rows = 96;       ///< rows of the result per tile, a multiple of both strip heights
+    constexpr std::size_t real_rows = 6;        ///< rows of a strip of A in the real kernel
+    constexpr std::size_t real_panel = 256;     ///< inner dimension of one packed panel of the real kernel
+    constexpr std::size_t real_cols = 256;      ///< columns of the result per tile of the real kernel
+    constexpr std::size_t interval_rows = 4;    ///< rows of a strip of A in the interval kernel
+    constexpr std::size_t interval_panel = 128; ///< inner dimension of one packed panel of the interval kernel
+    constexpr std::size_t interval_cols = 128;  ///< columns of the result per tile of the interval kernel
+
+    /// @brief End points in the packing buffer of one worker, enough for either kernel
+    constexpr std::size_t buffer_size = std::max(tile_rows * real_panel + real_panel * real_cols,
+                                                 2 * tile_rows * interval_panel + 4 * interval_panel * interval_cols);
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 product descriptions
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief One real product C = A B or C += A B of row major matrices, with |A| in place of A on request
+    template <class T>
+    struct real_gemm
+    {
+        T const *a;      ///< A, m by k
+        T const *b;      ///< B, k by n
+        T *c;            ///< C, m by n
+        std::size_t m;   ///< the rows of A and C
+        std::size_t n;   ///< the columns of B and C
+        std::size_t k;   ///< the inner dimension
+        bool abs_a;      ///< multiply by |A| instead of A
+        bool accumulate; ///< add to C instead of overwriting it
+    };
+
+    /// @brief One interval product C = A B of row major matrices; the kernel leaves -lo(C) in clo
+    template <class T>
+    struct interval_gemm
+    {
+        T const *alo, *ahi; ///< A, m by k
+        T const *blo, *bhi; ///< B, k by n
+        T *clo, *chi;       ///< C, m by n
+        std::size_t m;      ///< the rows of A and C
+        std::size_t n;      ///< the columns of B and C
+        std::size_t k;      ///< the inner dimension
+    };
+
+    /// @brief Computes the tile of a real product at row i0 and column j0
+    template <class T>
+    using real_tile_fn = void (*)(real_gemm<T> const &g, std::size_t i0, std::size_t j0, T *buffer);
+
+    /// @brief Computes the tile of an interval product at row i0 and column j0
+    template <class T>
+    using interval_tile_fn = void (*)(interval_gemm<T> const &g, std::size_t i0, std::size_t j0, T *buffer);
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 micro kernels
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief W lanes of type T, a plain T for one lane
+    template <class T, std::size_t W>
+    struct lanes
+    {
+        typedef T type __attribute__((vector_size(W * sizeof(T)))); ///< the vector type
+    };
+
+    template <class T>
+    struct lanes<T, 1>
+    {
+        using type = T; ///< a scalar
+    };
+
+    /// @brief Larger of two lanes, compiles to a single max instruction
+    /// @details A NaN b is dropped, as by #basic_interval::max2.
+    template <class V>
+    [[gnu::always_inline]] inline V vmax(V const &a, V const &b) noexcept { return b > a ? b : a; }
+
+    /// @brief Takes the NaN lanes of an end point product as zero, as #basic_interval::times0 does
+    template <class V>
+    [[gnu::always_inline]] inline V times0(V const &product) noexcept { return product == product ? product : V{}; }
+
+    /// @brief Multiplies a packed strip of A by a packed strip of B into an m by n corner of C
+    /// @details The strip of A holds #real_rows values per step of the inner dimension and the strip of B two vectors; the real_rows by 2W block of C stays in registers.
+    template <class T, std::size_t W>
+    [[gnu::always_inline]] inline void real_micro(std::size_t kc, T const *a, T const *b, T *c, std::size_t ldc,
+                                                  std::size_t m, std::size_t n, bool accumulate) noexcept
+    {
+        using V = typename lanes<T, W>::type;
+        constexpr std::size_t mr = real_rows, nr = 2 * W;
+        V acc[mr][2] = {};
+        for (std::size_t p = 0; p < kc; ++p, a += mr, b += nr)
+        {
+            V b0, b1;
+            std::memcpy(&b0, b, sizeof(V));
+            std::memcpy(&b1, b + W, sizeof(V));
+            for (std::size_t r = 0; r < mr; ++r)
+            {
+                V ar = V{} + a[r]; // broadcast one entry of A
+                acc[r][0] += ar * b0;
+                acc[r][1] += ar * b1;
+            }
+        }
+        T block[mr][nr];
+        std::memcpy(block, acc, sizeof(block));
+        for (std::size_t r = 0; r < m; ++r, c += ldc)
+            for (std::size_t j = 0; j < n; ++j)
+                c[j] = accumulate ? c[j] + block[r][j] : block[r][j];
+    }
+
+    /// @brief Multiplies a packed strip of interval A by a packed strip of interval B into an m by n corner of C, rounding upward
+    /// @details Each step of the strip of A holds lo and hi of #interval_rows entries and each step of the strip of B four vectors: lo, hi, -lo and -hi. The upper end point adds the largest of the four end point products and the negated lower end point the largest of the four products with a negated end point of B.
+    /// @details Only an unbounded end point times a zero one gives a NaN product. Operands with an unbounded end point run the Unbounded kernel, which counts such a product as zero as #basic_interval::operator*= does, at the cost of a select and a longer chain of maximums.
+    template <class T, std::size_t W, bool Unbounded>
+    [[gnu::always_inline]] inline void interval_micro(std::size_t kc, T const *a, T const *b, T *clo, T *chi, std::size_t ldc,
+                                                      std::size_t m, std::size_t n, bool accumulate) noexcept
+    {
+        using V = typename lanes<T, W>::type;
+        constexpr std::size_t mr = interval_rows;
+        V up[mr] = {}, down[mr] = {}; // the upper and the negated lower end points
+        for (std::size_t p = 0; p < kc; ++p, a += 2 * mr, b += 4 * W)
+        {
+            V b0, b1, nb0, nb1;
+            std::memcpy(&b0, b, sizeof(V));
+            std::memcpy(&b1, b + W, sizeof(V));
+            std::memcpy(&nb0, b + 2 * W, sizeof(V));
+            std::memcpy(&nb1, b + 3 * W, sizeof(V));
+            for (std::size_t r = 0; r < mr; ++r)
+            {
+                V a0 = V{} + a[2 * r], a1 = V{} + a[2 * r + 1];
+                if constexpr (Unbounded) // reduced as in basic_interval::operator*=, dropping every NaN after the first product
+                {
+                    up[r] += vmax(vmax(vmax(times0(a0 * b0), a0 * b1), a1 * b0), a1 * b1);
+                    down[r] += vmax(vmax(vmax(times0(a0 * nb0), a0 * nb1), a1 * nb0), a1 * nb1);
+                }
+                else
+                {
+                    up[r] += vmax(vmax(a0 * b0, a0 * b1), vmax(a1 * b0, a1 * b1));         // the largest product rounded up
+                    down[r] += vmax(vmax(a0 * nb0, a0 * nb1), vmax(a1 * nb0, a1 * nb1)); // minus the smallest rounded down
+                }
+            }
+        }
+        T hi[mr][W], nlo[mr][W];
+        std::memcpy(hi, up, sizeof(hi));
+        std::memcpy(nlo, down, sizeof(nlo));
+        for (std::size_t r = 0; r < m; ++r, clo += ldc, chi += ldc)
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                clo[j] = accumulate ? clo[j] + nlo[r][j] : nlo[r][j];
+                chi[j] = accumulate ? chi[j] + hi[r][j] : hi[r][j];
+            }
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 tiles
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Computes one tile of a real product, packing each panel of A and B before running the micro kernel over it
+    template <class T, std::size_t W>
+    [[gnu::always_inline]] inline void real_tile(real_gemm<T> const &g, std::size_t i0, std::size_t j0, T *buffer) noexcept
+    {
+        constexpr std::size_t mr = real_rows, nr = 2 * W;
+        std::size_t rows = std::min(tile_rows, g.m - i0), cols = std::min(real_cols, g.n - j0);
+        std::size_t strips_a = (rows + mr - 1) / mr, strips_b = (cols + nr - 1) / nr;
+        T *pa = buffer, *pb = buffer + tile_rows * real_panel;
+        for (std::size_t p0 = 0; p0 < g.k; p0 += real_panel)
+        {
+            std::size_t kc = std::min(real_panel, g.k - p0);
+            for (std::size_t s = 0; s < strips_a; ++s) // A in strips of mr rows, one column of the strip per step
+                for (std::size_t p = 0; p < kc; ++p)
+                    for (std::size_t r = 0; r < mr; ++r)
+                    {
+                        std::size_t i = s * mr + r;
+                        T v = i < rows ? g.a[(i0 + i) * g.k + p0 + p] : T(0); // zero rows pad the last strip
+                        pa[(s * kc + p) * mr + r] = g.abs_a ? std::fabs(v) : v;
+                    }
+            for (std::size_t s = 0; s < strips_b; ++s) // B in strips of nr columns, one row of the strip per step
+                for (std::size_t p = 0; p < kc; ++p)
+                {
+                    T const *row = g.b + (p0 + p) * g.n + j0 + s * nr;
+                    T *dst = pb + (s * kc + p) * nr;
+                    std::size_t n = std::min(nr, cols - s * nr);
+                    std::copy_n(row, n, dst);
+                    std::fill(dst + n, dst + nr, T(0)); // zero columns pad the last strip
+                }
+            bool accumulate = g.accumulate || p0 != 0;
+            for (std::size_t sb = 0; sb < strips_b; ++sb)
+                for (std::size_t sa = 0; sa < strips_a; ++sa)
+                    real_micro<T, W>(kc, pa + sa * kc * mr, pb + sb * kc * nr, g.c + (i0 + sa * mr) * g.n + j0 + sb * nr, g.n,
+                                     std::min(mr, rows - sa * mr), std::min(nr, cols - sb * nr), accumulate);
+        }
+    }
+
+    /// @brief Computes one tile of an interval product, which must run while the FPU rounds upward
+    template <class T, std::size_t W, bool Unbounded>
+    [[gnu::always_inline]] inline void interval_tile(interval_gemm<T> const &g, std::size_t i0, std::size_t j0, T *buffer) noexcept
+    {
+        constexpr std::size_t mr = interval_rows, nr = W;
+        std::size_t rows = std::min(tile_rows, g.m - i0), cols = std::min(interval_cols, g.n - j0);
+        std::size_t strips_a = (rows + mr - 1) / mr, strips_b = (cols + nr - 1) / nr;
+        T *pa = buffer, *pb = buffer + 2 * tile_rows * interval_panel;
+        for (std::size_t p0 = 0; p0 < g.k; p0 += interval_panel)
+        {
+            std::size_t kc = std::min(interval_panel, g.k - p0);
+            for (std::size_t s = 0; s < strips_a; ++s)
+                for (std::size_t p = 0; p < kc; ++p)
+                    for (std::size_t r = 0; r < mr; ++r)
+                    {
+                        std::size_t i = s * mr + r, at = (i0 + i) * g.k + p0 + p;
+                        T *dst = pa + ((s * kc + p) * mr + r) * 2;
+                        dst[0] = i < rows ? g.alo[at] : T(0); // [0, 0] rows pad the last strip
+                        dst[1] = i < rows ? g.ahi[at] : T(0);
+                    }
+            for (std::size_t s = 0; s < strips_b; ++s)
+                for (std::size_t p = 0; p < kc; ++p)
+                {
+                    std::size_t at = (p0 + p) * g.n + j0 + s * nr, n = std::min(nr, cols - s * nr);
+                    T *dst = pb + (s * kc + p) * 4 * nr;
+                    for (std::size_t j = 0; j < nr; ++j)
+                    {
+                        T lo = j < n ? g.blo[at + j] : T(0), hi = j < n ? g.bhi[at + j] : T(0);
+                        dst[j] = lo;
+                        dst[nr + j] = hi;
+                        dst[2 * nr + j] = -lo; // negation is exact
+                        dst[3 * nr + j] = -hi;
+                    }
+                }
+            for (std::size_t sb = 0; sb < strips_b; ++sb)
+                for (std::size_t sa = 0; sa < strips_a; ++sa)
+                {
+                    std::size_t at = (i0 + sa * mr) * g.n + j0 + sb * nr;
+                    interval_micro<T, W, Unbounded>(kc, pa + sa * kc * 2 * mr, pb + sb * kc * 4 * nr, g.clo + at, g.chi + at, g.n,
+                                         std::min(mr, rows - sa * mr), std::min(nr, cols - sb * nr), p0 != 0);
+                }
+        }
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 per instruction set entry points
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Real tile compiled for the default target, used as the scalar fallback
+    template <class T>
+    void real_scalar(real_gemm<T> const &g, std::size_t i0, std::size_t j0, T *buffer) noexcept { real_tile<T, 1>(g, i0, j0, buffer); }
+
+    /// @brief Interval tile compiled for the default target, used as the scalar fallback
+    template <class T, bool Unbounded>
+    void interval_scalar(interval_gemm<T> const &g, std::size_t i0, std::size_t j0, T *buffer) noexcept { interval_tile<T, 1, Unbounded>(g, i0, j0, buffer); }
+
+#if INTERVAL_MATRIX_X86
+    /// @brief Real tile using 128 bit registers, the x86-64 baseline
+    template <class T>
+    __attribute__((target("sse2"))) void real_sse2(real_gemm<T> const &g, std::size_t i0, std::size_t j0, T *buffer) noexcept
+    {
+        real_tile<T, 16 / sizeof(T)>(g, i0, j0, buffer);
+    }
+
+    /// @brief Interval tile using 128 bit registers
+    template <class T, bool Unbounded>
+    __attribute__((target("sse2"))) void interval_sse2(interval_gemm<T> const &g, std::size_t i0, std::size_t j0, T *buffer) noexcept
+    {
+        interval_tile<T, 16 / sizeof(T), Unbounded>(g, i0, j0, buffer);
+    }
+
+    /// @brief Real tile using 256 bit registers and fused multiply-adds
+    template <class T>
+    __attribute__((target("avx2,fma"))) void real_avx2(real_gemm<T> const &g, std::size_t i0, std::size_t j0, T *buffer) noexcept
+    {
+        real_tile<T, 32 / sizeof(T)>(g, i0, j0, buffer);
+    }
+
+    /// @brief Interval tile using 256 bit registers
+    template <class T, bool Unbounded>
+    __attribute__((target("avx2,fma"))) void interval_avx2(interval_gemm<T> const &g, std::size_t i0, std::size_t j0, T *buffer) noexcept
+    {
+        interval_tile<T, 32 / sizeof(T), Unbounded>(g, i0, j0, buffer);
+    }
+
+    /// @brief Real tile using 512 bit registers
+    template <class T>
+    __attribute__((target("avx512f"))) void real_avx512(real_gemm<T> const &g, std::size_t i0, std::size_t j0, T *buffer) noexcept
+    {
+        real_tile<T, 64 / sizeof(T)>(g, i0, j0, buffer);
+    }
+
+    /// @brief Interval tile using 512 bit registers
+    template <class T, bool Unbounded>
+    __attribute__((target("avx512f"))) void interval_avx512(interval_gemm<T> const &g, std::size_t i0, std::size_t j0, T *buffer) noexcept
+    {
+        interval_tile<T, 64 / sizeof(T), Unbounded>(g, i0, j0, buffer);
+    }
+#endif
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 dispatch
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief The tiles compiled for one instruction set and end point type
+    template <class T>
+    struct tile_table
+    {
+        real_tile_fn<T> real;                   ///< the real tile
+        interval_tile_fn<T> interval;           ///< the interval tile for bounded operands
+        interval_tile_fn<T> interval_unbounded; ///< the interval tile for operands with an unbounded end point
+    };
+
+    /// @brief Gets the tiles for the active instruction set
+    /// @return the active table
+    template <class T>
+    tile_table<T> active_tiles() noexcept
+    {
+        switch (active_simd_level())
+        {
+#if INTERVAL_MATRIX_X86
+        case simd_level::avx512:
+            return {real_avx512<T>, interval_avx512<T, false>, interval_avx512<T, true>};
+        case simd_level::avx2:
+            if (__builtin_cpu_supports("fma"))
+                return {real_avx2<T>, interval_avx2<T, false>, interval_avx2<T, true>};
+            [[fallthrough]]; // AVX2 without FMA runs the SSE2 tiles
+        case simd_level::sse2:
+            return {real_sse2<T>, interval_sse2<T, false>, interval_sse2<T, true>};
+#endif
+        default:
+            return {real_scalar<T>, interval_scalar<T, false>, interval_scalar<T, true>};
+        }
+    }
+
+    /// @brief Runs fn(i0, j0, buffer) for every tile of an m by n result on the workers of a pool
+    /// @param cols the columns per tile
+    template <class T, class Fn>
+    void for_each_tile(thread_pool &pool, std::size_t m, std::size_t n, std::size_t cols, Fn &&fn)
+    {
+        std::size_t across = (n + cols - 1) / cols, down = (m + tile_rows - 1) / tile_rows;
+        pool.run(across * down, [&](std::size_t tile)
+                 {
+                     thread_local std::vector<T> buffer(buffer_size); // one packing buffer per thread, kept between products
+                     fn(tile / across * tile_rows, tile % across * cols, buffer.data()); });
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 midpoint and radius
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Moves a sum or difference one ulp up unless it is zero, which a sum only rounds to when it is exactly zero
+    template <class T>
+    T up(T x) noexcept { return x == T(0) ? x : rounding::next_up(x); }
+
+    /// @brief The constants that bound the rounding errors of the midpoint and radius product with inner dimension k
+    /// @details Every real product here sums at most 2 k + 2 terms in some order, with or without fused multiply-adds, so with e the machine epsilon of T, which bounds the relative error of any faithful rounding, and h = k + 2 the sums of nonnegative terms lose at most a factor 1 - 4 h e and the midpoint product errs by at most g |mid(A)| |mid(B)| with g = 2 h e, plus an absolute term below one smallest subnormal per product. These bounds need 8 h e <= 1.
+    template <class T>
+    struct midrad_bounds
+    {
+        T g;        ///< the relative error of mid(A) mid(B), folded into the radius of B
+        T widen;    ///< the factor 1 + 4 h e covering the rounding of the radius product
+        T absolute; ///< the absolute term 16 h times the smallest subnormal, rounded up
+
+        /// @brief Checks whether the bounds hold for an inner dimension
+        static bool apply(std::size_t k) noexcept { return 8 * (double(k) + 2) * double(std::numeric_limits<T>::epsilon()) <= 1.0; }
+
+        /// @brief Computes the constants for an inner dimension for which #apply holds
+        explicit midrad_bounds(std::size_t k) noexcept
+        {
+            T h = T(k + 2), e = std::numeric_limits<T>::epsilon();
+            g = 2 * h * e;                                                              // exact, a small integer times a power of two
+            widen = 1 + 4 * h * e;                                                      // exact while 4 h is below 2^digits
+            absolute = rounding::next_up(16 * h * std::numeric_limits<T>::denorm_min()); // may round once it is normal
+        }
+    };
+
+    /// @brief Splits the rows [begin, end) of a matrix into midpoints and radii
+    /// @param a the matrix
+    /// @param mid set to the midpoints
+    /// @param rad set to radii with [mid - rad, mid + rad] containing each entry
+    /// @return false if an end point is infinite or NaN
+    template <class T>
+    bool split(basic_interval_matrix<T> const &a, T *mid, T *rad, std::size_t begin, std::size_t end) noexcept
+    {
+        bool finite = true;
+        for (std::size_t i = begin * a.cols(); i < end * a.cols(); ++i)
+        {
+            T lo = a.lo()[i], hi = a.hi()[i];
+            T m = lo * T(0.5) + hi * T(0.5); // between lo and hi in every rounding mode, without overflow
+            mid[i] = m;
+            rad[i] = up(std::max(m - lo, hi - m));
+            finite = finite && rad[i] <= std::numeric_limits<T>::max();
+        }
+        return finite;
+    }
+
+    /// @brief Encloses a product through midpoints and radii
+    /// @details C lies in P +- (Q f + t) where P = mid(A) mid(B), Q = |mid(A)| (rad(B) + g |mid(B)|) + rad(A) (|mid(B)| + rad(B)) and f, t are the widening of midrad_bounds. Each tile computes P into lo(C) and Q into hi(C) and then forms the end points.
+    /// @return false if an operand has an unbounded entry, leaving out for the infimum supremum product
+    template <class T>
+    bool midrad_product(basic_interval_matrix<T> const &a, basic_interval_matrix<T> const &b, basic_interval_matrix<T> &out, thread_pool &pool)
+    {
+        std::size_t m = a.rows(), n = b.cols(), k = a.cols();
+        std::vector<T> mid_a(m * k), rad_a(m * k), mid_b(k * n), rad_b(k * n), sum_b(k * n);
+        std::atomic<bool> finite{true};
+        parallel_for(pool, m, 64, [&](std::size_t begin, std::size_t end)
+                     {
+                         if (!split(a, mid_a.data(), rad_a.data(), begin, end))
+                             finite.store(false, std::memory_order_relaxed); });
+        parallel_for(pool, k, 64, [&](std::size_t begin, std::size_t end)
+                     {
+                         if (!split(b, mid_b.data(), rad_b.data(), begin, end))
+                             finite.store(false, std::memory_order_relaxed); });
+        if (!finite.load())
+            return false;
+
+        midrad_bounds<T> e(k);
+        parallel_for(pool, k, 64, [&](std::size_t begin, std::size_t end)
+                     {
+                         for (std::size_t i = begin * n; i < end * n; ++i)
+                         {
+                             T abs_mid = std::fabs(mid_b[i]);
+                             T error = abs_mid == T(0) ? T(0) : rounding::next_up(e.g * abs_mid); // a product may underflow to zero, so only a zero factor keeps zero
+                             sum_b[i] = up(abs_mid + rad_b[i]);
+                             rad_b[i] = up(rad_b[i] + error);
+                         } });
+
+        tile_table<T> tiles = active_tiles<T>();
+        for_each_tile<T>(pool, m, n, real_cols, [&](std::size_t i0, std::size_t j0, T *buffer)
+                         {
+                             tiles.real({mid_a.data(), mid_b.data(), out.lo(), m, n, k, false, false}, i0, j0, buffer);
+                             tiles.real({mid_a.data(), rad_b.data(), out.hi(), m, n, k, true, false}, i0, j0, buffer);
+                             tiles.real({rad_a.data(), sum_b.data(), out.hi(), m, n, k, false, true}, i0, j0, buffer);
+                             T const inf = std::numeric_limits<T>::infinity();
+                             for (std::size_t i = i0; i < std::min(i0 + tile_rows, m); ++i)
+                                 for (std::size_t j = j0; j < std::min(j0 + real_cols, n); ++j)
+                                 {
+                                     T p = out.lo()[i * n + j], q = out.hi()[i * n + j];
+                                     T r = rounding::next_up(rounding::next_up(q * e.widen) + e.absolute);
+                                     bool bounded = r <= std::numeric_limits<T>::max() && std::fabs(p) <= std::numeric_limits<T>::max();
+                                     out.lo()[i * n + j] = bounded ? rounding::next_down(p - r) : -inf;
+                                     out.hi()[i * n + j] = bounded ? rounding::next_up(p + r) : inf;
+                                 } });
+        return true;
+    }
+
+    /// @brief Checks whether a matrix has an unbounded end point
+    template <class T>
+    bool unbounded(basic_interval_matrix<T> const &a) noexcept
+    {
+        constexpr T inf = std::numeric_limits<T>::infinity();
+        bool found = false;
+        for (std::size_t i = 0; i < a.rows() * a.cols(); ++i)
+            found |= a.lo()[i] == -inf || a.hi()[i] == inf;
+        return found;
+    }
+
+    /// @brief Encloses a product by sums of end point products rounded outward
+    template <class T>
+    void infsup_product(basic_interval_matrix<T> const &a, basic_interval_matrix<T> const &b, basic_interval_matrix<T> &out, thread_pool &pool)
+    {
+        std::size_t m = a.rows(), n = b.cols(), k = a.cols();
+        interval_gemm<T> g{a.lo(), a.hi(), b.lo(), b.hi(), out.lo(), out.hi(), m, n, k};
+        tile_table<T> tiles = active_tiles<T>();
+        interval_tile_fn<T> tile = unbounded(a) || unbounded(b) ? tiles.interval_unbounded : tiles.interval; // a scan of both operands, small beside the product
+        for_each_tile<T>(pool, m, n, interval_cols, [&](std::size_t i0, std::size_t j0, T *buffer)
+                         {
+                             {
+                                 rounding_scope upward; // each worker sets its own rounding mode
+                                 tile(g, i0, j0, buffer);
+                             }
+                             for (std::size_t i = i0; i < std::min(i0 + tile_rows, m); ++i)
+                                 for (std::size_t j = j0; j < std::min(j0 + interval_cols, n); ++j)
+                                     out.lo()[i * n + j] = -out.lo()[i * n + j]; // the kernel summed -lo
+                         });
+    }
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 matrix product
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details A product written into one of its operands is computed into a new matrix first. An inner dimension of zero gives a matrix of [0, 0].
+template <class T>
+void matmul(basic_interval_matrix<T> const &a, basic_interval_matrix<T> const &b, basic_interval_matrix<T> &out, matmul_mode mode, thread_pool &pool)
+{
+    if (a.cols() != b.rows())
+        throw std::invalid_argument("matmul: the columns of a are not the rows of b");
+    if (&out == &a || &out == &b)
+    {
+        basic_interval_matrix<T> product;
+        matmul(a, b, product, mode, pool);
+        out = std::move(product);
+        return;
+    }
+    std::size_t m = a.rows(), n = b.cols();
+    if (out.rows() != m || out.cols() != n)
+        out = basic_interval_matrix<T>::for_overwrite(m, n);
+    if (out.empty())
+        return;
+    if (a.cols() == 0)
+    {
+        std::fill_n(out.lo(), m * n, T(0));
+        std::fill_n(out.hi(), m * n, T(0));
+        return;
+    }
+    if (mode == matmul_mode::midrad && midrad_bounds<T>::apply(a.cols()) && midrad_product(a, b, out, pool))
+        return;
+    infsup_product(a, b, out, pool);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 explicit instantiations
+//---------------------------------------------------------------------------------------------------------------------
+
+template void matmul(basic_interval_matrix<float> const &, basic_interval_matrix<float> const &, basic_interval_matrix<float> &, matmul_mode, thread_pool &);
+template void matmul(basic_interval_matrix<double> const &, basic_interval_matrix<double> const &, basic_interval_matrix<double> &, matmul_mode, thread_pool &);
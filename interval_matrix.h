@@ -0,0 +1,244 @@
+/// @file interval_matrix.h
+/// @brief Dense and sparse matrices of intervals and the cache blocked, SIMD, multithreaded dense product
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.1
+/// @details This file declares the basic_interval_matrix class, the compressed sparse row basic_sparse_interval_matrix class and matmul, which multiplies two dense interval matrices. The product is cut into tiles of the result that the workers of a thread_pool share; each tile packs panels of both operands into contiguous buffers sized for the caches and runs a register blocked kernel compiled for SSE2, AVX2 or AVX-512 and picked with #active_simd_level.
+/// @details matmul_mode::infsup computes every end point as a sum of end point products with the FPU rounding upward, lower end points by negation as rounding::scoped does, so each entry is as tight as the interval operators under a directed rounding policy. matmul_mode::midrad converts both operands to midpoint and radius and encloses the product with two real matrix products, mid(A) mid(B) and [|mid(A)|, rad(A)] [rad(B) + g |mid(B)|; |mid(B)| + rad(B)], where the term g |mid(B)| and a final relative and absolute widening bound every rounding error of the real products a priori. It runs at the speed of real matrix products and overestimates the radius of the exact interval product by at most a factor 1.5, apart from the rounding terms. Both modes enclose the exact product whatever the rounding mode of the caller.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "interval_array.h"
+#include "parallel.h"
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 class declaration
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief A dense matrix of intervals stored row major as two end point columns
+/// @details The end points live in a basic_interval_array of rows() * cols() elements, entry (i, j) at index i * cols() + j, so every batch operator of interval_array.h applies to the entries of a matrix through #array.
+/// @tparam T the end point type, float or double
+/// @author George Downing
+/// @date 17-10-2026
+template <class T>
+class basic_interval_matrix
+{
+public:
+    /// @brief The end point type of the entries
+    using value_type = T;
+
+    /// @brief The interval type read from and written to the matrix
+    using interval_type = basic_interval<T>;
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 constructors
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Default constructor for an empty matrix
+    basic_interval_matrix() noexcept = default;
+
+    /// @brief Constructor for a matrix of [0, 0] entries
+    /// @param rows the number of rows
+    /// @param cols the number of columns
+    basic_interval_matrix(std::size_t rows, std::size_t cols) : Data(rows * cols), Rows(rows), Cols(cols) {}
+
+    /// @brief Constructor for a matrix whose entries are all one interval
+    /// @param rows the number of rows
+    /// @param cols the number of columns
+    /// @param fill the interval to copy into every entry
+    basic_interval_matrix(std::size_t rows, std::size_t cols, interval_type const &fill) : Data(rows * cols, fill), Rows(rows), Cols(cols) {}
+
+    /// @brief Makes a matrix whose end points are left unwritten
+    /// @details Every entry must be written before it is read.
+    /// @param rows the number of rows
+    /// @param cols the number of columns
+    /// @return the matrix
+    static basic_interval_matrix for_overwrite(std::size_t rows, std::size_t cols)
+    {
+        return basic_interval_matrix(basic_interval_array<T>::for_overwrite(rows * cols), rows, cols);
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 element access
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Gets the number of rows
+    /// @return the number of rows
+    std::size_t rows() const noexcept { return Rows; }
+
+    /// @brief Gets the number of columns
+    /// @return the number of columns
+    std::size_t cols() const noexcept { return Cols; }
+
+    /// @brief Checks whether the matrix has no entries
+    /// @return true if rows() or cols() is zero
+    bool empty() const noexcept { return Data.empty(); }
+
+    /// @brief Gets the lower end points, row major
+    /// @return a pointer to rows() * cols() lower end points
+    T *lo() noexcept { return Data.lo(); }
+
+    /// @brief Gets the lower end points, row major
+    /// @return a pointer to rows() * cols() lower end points
+    T const *lo() const noexcept { return Data.lo(); }
+
+    /// @brief Gets the upper end points, row major
+    /// @return a pointer to rows() * cols() upper end points
+    T *hi() noexcept { return Data.hi(); }
+
+    /// @brief Gets the upper end points, row major
+    /// @return a pointer to rows() * cols() upper end points
+    T const *hi() const noexcept { return Data.hi(); }
+
+    /// @brief Gets the entries as one array in row major order
+    /// @return the array of rows() * cols() intervals
+    basic_interval_array<T> const &array() const noexcept { return Data; }
+
+    /// @brief Gets one entry
+    /// @param i the row
+    /// @param j the column
+    /// @return the interval at row i and column j
+    interval_type operator()(std::size_t i, std::size_t j) const noexcept { return Data[i * Cols + j]; }
+
+    /// @brief Sets one entry
+    /// @param i the row
+    /// @param j the column
+    /// @param val the interval to store at row i and column j
+    void set(std::size_t i, std::size_t j, interval_type const &val) noexcept { Data.set(i * Cols + j, val); }
+
+private:
+    /// @brief Constructor for for_overwrite, takes an array of the right size
+    /// @param data the entries
+    /// @param rows the number of rows
+    /// @param cols the number of columns
+    basic_interval_matrix(basic_interval_array<T> &&data, std::size_t rows, std::size_t cols) noexcept
+        : Data(std::move(data)), Rows(rows), Cols(cols) {}
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    basic_interval_array<T> Data; ///< The entries in row major order
+    std::size_t Rows = 0;         ///< The number of rows
+    std::size_t Cols = 0;         ///< The number of columns
+};
+
+/// @brief Matrix of intervals with double end points
+using interval_matrix = basic_interval_matrix<double>;
+
+/// @brief Matrix of intervals with float end points
+using interval_matrixf = basic_interval_matrix<float>;
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 sparse matrix
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief A sparse matrix of intervals in compressed sparse row form
+/// @details Row i holds the entries row_offsets()[i] to row_offsets()[i + 1] - 1 of col_index() and values(); columns need not be sorted within a row, and entries that are not stored are [0, 0]. The class only holds the three arrays; the solvers of interval_solve.h read them directly.
+/// @tparam T the end point type, float or double
+/// @author George Downing
+/// @date 17-10-2026
+template <class T>
+class basic_sparse_interval_matrix
+{
+public:
+    /// @brief The end point type of the entries
+    using value_type = T;
+
+    /// @brief The interval type of the entries
+    using interval_type = basic_interval<T>;
+
+    /// @brief Default constructor for an empty matrix
+    basic_sparse_interval_matrix() = default;
+
+    /// @brief Constructor from the three arrays of compressed sparse row form
+    /// @param rows the number of rows
+    /// @param cols the number of columns
+    /// @param row_offsets rows + 1 non decreasing offsets into col_index and values, starting at 0
+    /// @param col_index the column of every stored entry
+    /// @param values the stored entries, as many as col_index
+    /// @throws std::invalid_argument if the arrays do not describe a rows by cols matrix
+    basic_sparse_interval_matrix(std::size_t rows, std::size_t cols, std::vector<std::size_t> row_offsets,
+                                 std::vector<std::size_t> col_index, basic_interval_array<T> values)
+        : Offsets(std::move(row_offsets)), Columns(std::move(col_index)), Values(std::move(values)), Rows(rows), Cols(cols)
+    {
+        if (Offsets.size() != Rows + 1 || Offsets.front() != 0 || Offsets.back() != Columns.size() || Columns.size() != Values.size())
+            throw std::invalid_argument("sparse_interval_matrix: offsets, columns and values do not match");
+        for (std::size_t i = 0; i < Rows; ++i)
+            if (Offsets[i] > Offsets[i + 1])
+                throw std::invalid_argument("sparse_interval_matrix: row offsets decrease");
+        for (std::size_t j : Columns)
+            if (j >= Cols)
+                throw std::invalid_argument("sparse_interval_matrix: column index out of range");
+    }
+
+    /// @brief Gets the number of rows
+    /// @return the number of rows
+    std::size_t rows() const noexcept { return Rows; }
+
+    /// @brief Gets the number of columns
+    /// @return the number of columns
+    std::size_t cols() const noexcept { return Cols; }
+
+    /// @brief Gets the number of stored entries
+    /// @return the length of col_index() and values()
+    std::size_t nonzeros() const noexcept { return Columns.size(); }
+
+    /// @brief Gets the offset of the first entry of every row, and the number of entries at index rows()
+    /// @return a pointer to rows() + 1 offsets
+    std::size_t const *row_offsets() const noexcept { return Offsets.data(); }
+
+    /// @brief Gets the column of every stored entry
+    /// @return a pointer to nonzeros() column indices
+    std::size_t const *col_index() const noexcept { return Columns.data(); }
+
+    /// @brief Gets the stored entries
+    /// @return the array of nonzeros() intervals
+    basic_interval_array<T> const &values() const noexcept { return Values; }
+
+private:
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    std::vector<std::size_t> Offsets; ///< The first entry of every row, then the number of entries
+    std::vector<std::size_t> Columns; ///< The column of every entry
+    basic_interval_array<T> Values;   ///< The entries, row by row
+    std::size_t Rows = 0;             ///< The number of rows
+    std::size_t Cols = 0;             ///< The number of columns
+};
+
+/// @brief Sparse matrix of intervals with double end points
+using sparse_interval_matrix = basic_sparse_interval_matrix<double>;
+
+/// @brief Sparse matrix of intervals with float end points
+using sparse_interval_matrixf = basic_sparse_interval_matrix<float>;
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 matrix product
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief How matmul encloses the product
+enum class matmul_mode
+{
+    infsup, ///< sums of end point products rounded outward, the tightest enclosure
+    midrad  ///< midpoint and radius through real matrix products, the fastest enclosure
+};
+
+/// @brief Multiplies two interval matrices on the workers of a pool
+/// @details matmul_mode::midrad needs finite end points and an inner dimension below 1 / (8 epsilon) of T; other operands are multiplied as by matmul_mode::infsup. Under infsup an end point product 0 * inf counts as zero, as in the interval operators.
+/// @param a the left operand, m by k
+/// @param b the right operand, k by n
+/// @param out the product, made m by n; may be a or b
+/// @param mode the enclosure to compute
+/// @param pool the workers
+/// @throws std::invalid_argument if the columns of a are not the rows of b
+template <class T>
+void matmul(basic_interval_matrix<T> const &a, basic_interval_matrix<T> const &b, basic_interval_matrix<T> &out,
+            matmul_mode mode = matmul_mode::infsup, thread_pool &pool = default_pool());
@@ -0,0 +1,605 @@
+/// @file interval_reduce.cpp
+/// @brief SIMD kernels and fixed reduction trees of the interval reductions
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Each kernel reduces one leaf into a fixed number of lanes, 64 / sizeof(T), held in 64 / sizeof(T) / W registers of W lanes, and the lanes that do not fill a whole group at the end of the leaf are updated one by one with the same operation. Every lane sees the same operations in the same order for any W, so the kernels compiled for SSE2, AVX2 and AVX-512 and the scalar fallback give the same bits. The lanes are then combined in a pairwise tree inside the kernel and the leaves in a pairwise tree on the calling thread.
+/// @details Outward sums and dot products run with the FPU rounding upward and add the upper end points and the negated lower end points. Compensated sums run in round to nearest; a compensated dot product first forms the products of a leaf rounded outward into a buffer of the worker and then sums the buffer. This file is compiled with -frounding-math, which keeps the compiler from turning (-a) * b into -(a * b).
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                    include files
+//---------------------------------------------------------------------------------------------------------------------
+
+#include "interval_reduce.h"
+
+#include <algorithm>
+#include <cfenv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define INTERVAL_REDUCE_X86 1 ///< the x86 kernels are available
+#else
+#define INTERVAL_REDUCE_X86 0 ///< only the scalar kernels are available
+#endif
+
+#if INTERVAL_REDUCE_X86
+// The kernels pass vector types between always_inline helpers that are compiled without AVX. They are always inlined into
+// a function built for the right instruction set, so the ABI note GCC emits for them does not apply.
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+namespace
+{
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 partial results
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief The lanes of every kernel for end point type T
+    template <class T>
+    constexpr std::size_t lane_count = 64 / sizeof(T);
+
+    /// @brief The partial result of an outward sum, both end points rounded upward
+    template <class T>
+    struct outward_part
+    {
+        T hi;  ///< the sum of the upper end points
+        T nlo; ///< the sum of the negated lower end points
+    };
+
+    /// @brief The partial result of a compensated sum of one column
+    template <class T>
+    struct compensated_column
+    {
+        T s; ///< the sum rounded to nearest
+        T c; ///< the sum of the rounding errors of s
+        T e; ///< the sum of the magnitudes of those errors
+    };
+
+    /// @brief The partial result of a compensated sum of both columns
+    template <class T>
+    struct compensated_part
+    {
+        compensated_column<T> hi;  ///< the upper end points
+        compensated_column<T> nlo; ///< the negated lower end points
+    };
+
+    /// @brief The partial result of the lattice reductions
+    template <class T>
+    struct extrema_part
+    {
+        T min_lo; ///< the least lower end point
+        T max_lo; ///< the greatest lower end point
+        T min_hi; ///< the least upper end point
+        T max_hi; ///< the greatest upper end point
+    };
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 lane operations
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief W lanes of type T, or T itself for one lane
+    template <class T, std::size_t W>
+    struct lanes
+    {
+        typedef T type __attribute__((vector_size(W * sizeof(T)))); ///< the vector type
+    };
+
+    /// @brief One lane is the scalar type, so the fallback compiles to plain scalar code
+    template <class T>
+    struct lanes<T, 1>
+    {
+        using type = T; ///< the scalar type
+    };
+
+    /// @brief Loads W consecutive values
+    template <class V, class T>
+    [[gnu::always_inline]] inline V load(T const *p) noexcept
+    {
+        V v;
+        std::memcpy(&v, p, sizeof(V));
+        return v;
+    }
+
+    /// @brief The smaller of two lanes, as #basic_interval::min2
+    template <class V>
+    [[gnu::always_inline]] inline V min2(V a, V b) noexcept { return b < a ? b : a; }
+
+    /// @brief The larger of two lanes, as #basic_interval::max2
+    template <class V>
+    [[gnu::always_inline]] inline V max2(V a, V b) noexcept { return b > a ? b : a; }
+
+    /// @brief Adds x to a column with TwoSum, which needs round to nearest
+    /// @details s + t equals the old s plus x exactly; t is added to the errors and |t| to their magnitudes.
+    template <class V>
+    [[gnu::always_inline]] inline void two_sum(V &s, V &c, V &e, V x) noexcept
+    {
+        V sum = s + x, z = sum - s;
+        V t = (s - (sum - z)) + (x - z);
+        s = sum;
+        c = c + t;
+        e = e + (t < 0 ? -t : t);
+    }
+
+    /// @brief Combines two partial compensated sums of one column
+    template <class T>
+    compensated_column<T> merge(compensated_column<T> a, compensated_column<T> const &b) noexcept
+    {
+        a.c = a.c + b.c;
+        a.e = a.e + b.e;
+        two_sum(a.s, a.c, a.e, b.s);
+        return a;
+    }
+
+    /// @brief Combines lanes or leaves in a pairwise tree whose shape depends only on their number
+    /// @param parts the partial results, overwritten
+    /// @param n the number of partial results, at least one
+    /// @param combine the callable joining two partial results
+    /// @return the combination of all of them
+    template <class Part, class Combine>
+    Part tree(Part *parts, std::size_t n, Combine &&combine)
+    {
+        for (std::size_t step = 1; step < n; step *= 2)
+            for (std::size_t i = 0; i + step < n; i += 2 * step)
+                parts[i] = combine(parts[i], parts[i + step]);
+        return parts[0];
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 leaf kernels
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Sums both columns of a leaf, which must run while the FPU rounds upward
+    template <class T, std::size_t W>
+    [[gnu::always_inline]] inline outward_part<T> outward_sum(T const *lo, T const *hi, std::size_t n) noexcept
+    {
+        using V = typename lanes<T, W>::type;
+        constexpr std::size_t L = lane_count<T>, G = L / W;
+        V up[G], down[G];
+        for (std::size_t g = 0; g < G; ++g)
+            up[g] = down[g] = V{} + T(0);
+        std::size_t i = 0;
+        for (; i + L <= n; i += L)
+            for (std::size_t g = 0; g < G; ++g)
+            {
+                up[g] = up[g] + load<V>(hi + i + g * W);
+                down[g] = down[g] + -load<V>(lo + i + g * W);
+            }
+        outward_part<T> parts[L];
+        for (std::size_t k = 0; k < L; ++k)
+        {
+            std::memcpy(&parts[k].hi, reinterpret_cast<T const *>(up) + k, sizeof(T));
+            std::memcpy(&parts[k].nlo, reinterpret_cast<T const *>(down) + k, sizeof(T));
+        }
+        for (std::size_t k = 0; i + k < n; ++k) // the last partial group, lane by lane
+        {
+            parts[k].hi = parts[k].hi + hi[i + k];
+            parts[k].nlo = parts[k].nlo + -lo[i + k];
+        }
+        return tree(parts, L, [](outward_part<T> a, outward_part<T> const &b) { return outward_part<T>{a.hi + b.hi, a.nlo + b.nlo}; });
+    }
+
+    /// @brief Encloses the products of W pairs of intervals as the interval operator * does while rounding upward
+    template <class V>
+    [[gnu::always_inline]] inline void product(V al, V ah, V bl, V bh, V &nlo, V &hi) noexcept
+    {
+        hi = max2(max2(al * bl, al * bh), max2(ah * bl, ah * bh));
+        V nal = -al, nah = -ah; // negation is exact
+        nlo = max2(max2(nal * bl, nal * bh), max2(nah * bl, nah * bh));
+    }
+
+    /// @brief Sums the products of a leaf of two views, which must run while the FPU rounds upward
+    template <class T, std::size_t W>
+    [[gnu::always_inline]] inline outward_part<T> outward_dot(T const *alo, T const *ahi, T const *blo, T const *bhi, std::size_t n) noexcept
+    {
+        using V = typename lanes<T, W>::type;
+        constexpr std::size_t L = lane_count<T>, G = L / W;
+        V up[G], down[G];
+        for (std::size_t g = 0; g < G; ++g)
+            up[g] = down[g] = V{} + T(0);
+        std::size_t i = 0;
+        for (; i + L <= n; i += L)
+            for (std::size_t g = 0; g < G; ++g)
+            {
+                std::size_t at = i + g * W;
+                V nlo, hi;
+                product(load<V>(alo + at), load<V>(ahi + at), load<V>(blo + at), load<V>(bhi + at), nlo, hi);
+                up[g] = up[g] + hi;
+                down[g] = down[g] + nlo;
+            }
+        outward_part<T> parts[L];
+        for (std::size_t k = 0; k < L; ++k)
+        {
+            std::memcpy(&parts[k].hi, reinterpret_cast<T const *>(up) + k, sizeof(T));
+            std::memcpy(&parts[k].nlo, reinterpret_cast<T const *>(down) + k, sizeof(T));
+        }
+        for (std::size_t k = 0; i + k < n; ++k)
+        {
+            T nlo, hi;
+            product(alo[i + k], ahi[i + k], blo[i + k], bhi[i + k], nlo, hi);
+            parts[k].hi = parts[k].hi + hi;
+            parts[k].nlo = parts[k].nlo + nlo;
+        }
+        return tree(parts, L, [](outward_part<T> a, outward_part<T> const &b) { return outward_part<T>{a.hi + b.hi, a.nlo + b.nlo}; });
+    }
+
+    /// @brief Writes the products of a leaf of two views, which must run while the FPU rounds upward
+    /// @param lo set to the lower end points of the products
+    /// @param hi set to the upper end points of the products
+    template <class T, std::size_t W>
+    [[gnu::always_inline]] inline void products(T const *alo, T const *ahi, T const *blo, T const *bhi, std::size_t n, T *lo, T *hi) noexcept
+    {
+        using V = typename lanes<T, W>::type;
+        std::size_t i = 0;
+        for (; i + W <= n; i += W)
+        {
+            V nl, h;
+            product(load<V>(alo + i), load<V>(ahi + i), load<V>(blo + i), load<V>(bhi + i), nl, h);
+            V l = -nl;
+            std::memcpy(lo + i, &l, sizeof(V));
+            std::memcpy(hi + i, &h, sizeof(V));
+        }
+        for (; i < n; ++i)
+        {
+            T nl, h;
+            product(alo[i], ahi[i], blo[i], bhi[i], nl, h);
+            lo[i] = -nl;
+            hi[i] = h;
+        }
+    }
+
+    /// @brief Sums both columns of a leaf with TwoSum, which must run while the FPU rounds to nearest
+    template <class T, std::size_t W>
+    [[gnu::always_inline]] inline compensated_part<T> compensated_sum(T const *lo, T const *hi, std::size_t n) noexcept
+    {
+        using V = typename lanes<T, W>::type;
+        constexpr std::size_t L = lane_count<T>, G = L / W;
+        V s[2][G], c[2][G], e[2][G]; // index 0 is the upper column and 1 the negated lower one
+        for (std::size_t j = 0; j < 2; ++j)
+            for (std::size_t g = 0; g < G; ++g)
+                s[j][g] = c[j][g] = e[j][g] = V{} + T(0);
+        std::size_t i = 0;
+        for (; i + L <= n; i += L)
+            for (std::size_t g = 0; g < G; ++g)
+            {
+                two_sum(s[0][g], c[0][g], e[0][g], load<V>(hi + i + g * W));
+                two_sum(s[1][g], c[1][g], e[1][g], -load<V>(lo + i + g * W));
+            }
+        compensated_column<T> parts[2][L];
+        for (std::size_t j = 0; j < 2; ++j)
+        {
+            for (std::size_t k = 0; k < L; ++k)
+            {
+                std::memcpy(&parts[j][k].s, reinterpret_cast<T const *>(s[j]) + k, sizeof(T));
+                std::memcpy(&parts[j][k].c, reinterpret_cast<T const *>(c[j]) + k, sizeof(T));
+                std::memcpy(&parts[j][k].e, reinterpret_cast<T const *>(e[j]) + k, sizeof(T));
+            }
+            for (std::size_t k = 0; i + k < n; ++k)
+                two_sum(parts[j][k].s, parts[j][k].c, parts[j][k].e, j == 0 ? hi[i + k] : -lo[i + k]);
+        }
+        auto join = [](compensated_column<T> const &a, compensated_column<T> const &b) { return merge(a, b); };
+        return {tree(parts[0], L, join), tree(parts[1], L, join)};
+    }
+
+    /// @brief Finds the least and greatest end points of a leaf
+    template <class T, std::size_t W>
+    [[gnu::always_inline]] inline extrema_part<T> extrema(T const *lo, T const *hi, std::size_t n) noexcept
+    {
+        using V = typename lanes<T, W>::type;
+        constexpr std::size_t L = lane_count<T>, G = L / W;
+        constexpr T inf = std::numeric_limits<T>::infinity();
+        V min_lo[G], max_lo[G], min_hi[G], max_hi[G];
+        for (std::size_t g = 0; g < G; ++g)
+        {
+            min_lo[g] = min_hi[g] = V{} + inf;
+            max_lo[g] = max_hi[g] = V{} - inf;
+        }
+        std::size_t i = 0;
+        for (; i + L <= n; i += L)
+            for (std::size_t g = 0; g < G; ++g)
+            {
+                V l = load<V>(lo + i + g * W), h = load<V>(hi + i + g * W);
+                min_lo[g] = min2(min_lo[g], l);
+                max_lo[g] = max2(max_lo[g], l);
+                min_hi[g] = min2(min_hi[g], h);
+                max_hi[g] = max2(max_hi[g], h);
+            }
+        extrema_part<T> parts[L];
+        for (std::size_t k = 0; k < L; ++k)
+        {
+            std::memcpy(&parts[k].min_lo, reinterpret_cast<T const *>(min_lo) + k, sizeof(T));
+            std::memcpy(&parts[k].max_lo, reinterpret_cast<T const *>(max_lo) + k, sizeof(T));
+            std::memcpy(&parts[k].min_hi, reinterpret_cast<T const *>(min_hi) + k, sizeof(T));
+            std::memcpy(&parts[k].max_hi, reinterpret_cast<T const *>(max_hi) + k, sizeof(T));
+        }
+        for (std::size_t k = 0; i + k < n; ++k)
+            parts[k] = {min2(parts[k].min_lo, lo[i + k]), max2(parts[k].max_lo, lo[i + k]), min2(parts[k].min_hi, hi[i + k]),
+                        max2(parts[k].max_hi, hi[i + k])};
+        return tree(parts, L, [](extrema_part<T> const &a, extrema_part<T> const &b)
+                    { return extrema_part<T>{min2(a.min_lo, b.min_lo), max2(a.max_lo, b.max_lo), min2(a.min_hi, b.min_hi), max2(a.max_hi, b.max_hi)}; });
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 per instruction set entry points
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Every leaf kernel compiled for one instruction set and end point type
+    template <class T>
+    struct kernel_table
+    {
+        outward_part<T> (*sum)(T const *lo, T const *hi, std::size_t n) noexcept;                                         ///< outward_sum
+        outward_part<T> (*dot)(T const *alo, T const *ahi, T const *blo, T const *bhi, std::size_t n) noexcept;           ///< outward_dot
+        void (*products)(T const *alo, T const *ahi, T const *blo, T const *bhi, std::size_t n, T *lo, T *hi) noexcept;   ///< products
+        compensated_part<T> (*compensated)(T const *lo, T const *hi, std::size_t n) noexcept;                             ///< compensated_sum
+        extrema_part<T> (*extrema)(T const *lo, T const *hi, std::size_t n) noexcept;                                     ///< extrema
+    };
+
+    /// @brief Defines the entry points of one instruction set and its table
+#define INTERVAL_REDUCE_ENTRIES(isa, attributes, width)                                                                             \
+    template <class T>                                                                                                              \
+    attributes outward_part<T> sum_##isa(T const *lo, T const *hi, std::size_t n) noexcept                                          \
+    {                                                                                                                               \
+        return outward_sum<T, width>(lo, hi, n);                                                                                    \
+    }                                                                                                                               \
+    template <class T>                                                                                                              \
+    attributes outward_part<T> dot_##isa(T const *alo, T const *ahi, T const *blo, T const *bhi, std::size_t n) noexcept            \
+    {                                                                                                                               \
+        return outward_dot<T, width>(alo, ahi, blo, bhi, n);                                                                        \
+    }                                                                                                                               \
+    template <class T>                                                                                                              \
+    attributes void products_##isa(T const *alo, T const *ahi, T const *blo, T const *bhi, std::size_t n, T *lo, T *hi) noexcept    \
+    {                                                                                                                               \
+        products<T, width>(alo, ahi, blo, bhi, n, lo, hi);                                                                          \
+    }                                                                                                                               \
+    template <class T>                                                                                                              \
+    attributes compensated_part<T> compensated_##isa(T const *lo, T const *hi, std::size_t n) noexcept                              \
+    {                                                                                                                               \
+        return compensated_sum<T, width>(lo, hi, n);                                                                                \
+    }                                                                                                                               \
+    template <class T>                                                                                                              \
+    attributes extrema_part<T> extrema_##isa(T const *lo, T const *hi, std::size_t n) noexcept                                      \
+    {                                                                                                                               \
+        return extrema<T, width>(lo, hi, n);                                                                                        \
+    }                                                                                                                               \
+    template <class T>                                                                                                              \
+    kernel_table<T> const isa##_table = {sum_##isa<T>, dot_##isa<T>, products_##isa<T>, compensated_##isa<T>, extrema_##isa<T>};
+
+    INTERVAL_REDUCE_ENTRIES(scalar, , 1) // the scalar fallback
+#if INTERVAL_REDUCE_X86
+    INTERVAL_REDUCE_ENTRIES(sse2, __attribute__((target("sse2"))), 16 / sizeof(T))        // 128 bit registers, the x86-64 baseline
+    INTERVAL_REDUCE_ENTRIES(avx2, __attribute__((target("avx2"))), 32 / sizeof(T))        // 256 bit registers
+    INTERVAL_REDUCE_ENTRIES(avx512, __attribute__((target("avx512f"))), 64 / sizeof(T))   // 512 bit registers
+#endif
+#undef INTERVAL_REDUCE_ENTRIES
+
+    /// @brief Gets the kernels for the active instruction set
+    /// @return the active table
+    template <class T>
+    kernel_table<T> const &active_table() noexcept
+    {
+        switch (active_simd_level())
+        {
+#if INTERVAL_REDUCE_X86
+        case simd_level::avx512:
+            return avx512_table<T>;
+        case simd_level::avx2:
+            return avx2_table<T>;
+        case simd_level::sse2:
+            return sse2_table<T>;
+#endif
+        default:
+            return scalar_table<T>;
+        }
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 leaves
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Sets the FPU rounding mode for the lifetime of the object and restores the previous mode afterwards
+    class mode_scope
+    {
+    public:
+        /// @brief Saves the current rounding mode and switches to another
+        explicit mode_scope(int mode) noexcept : Saved(std::fegetround()) { std::fesetround(mode); }
+
+        /// @brief Restores the rounding mode that was active on construction
+        ~mode_scope() { std::fesetround(Saved); }
+
+        mode_scope(mode_scope const &) = delete;            ///< a scope cannot be copied
+        mode_scope &operator=(mode_scope const &) = delete; ///< a scope cannot be assigned
+
+    private:
+        int Saved; ///< The rounding mode to restore
+    };
+
+    /// @brief Runs fn(first, count) for every leaf of n intervals on the workers of a pool, each in the given rounding mode
+    /// @param arrays the interval arrays read per element, for the chunk size
+    /// @return the partial result of every leaf, in leaf order
+    template <class T, class Part, class Fn>
+    std::vector<Part> leaves(thread_pool &pool, std::size_t n, std::size_t arrays, int mode, Fn &&fn)
+    {
+        std::vector<Part> parts((n + reduce_leaf - 1) / reduce_leaf);
+        std::size_t grain = std::max<std::size_t>(1, chunk_size<T>(n, arrays, pool.size()) / reduce_leaf); // leaves per chunk
+        parallel_for(pool, parts.size(), grain, [&](std::size_t begin, std::size_t end)
+                     {
+                         mode_scope scope(mode); // each worker sets its own rounding mode
+                         for (std::size_t leaf = begin; leaf < end; ++leaf)
+                         {
+                             std::size_t first = leaf * reduce_leaf;
+                             parts[leaf] = fn(first, std::min(reduce_leaf, n - first));
+                         } });
+        return parts;
+    }
+
+    /// @brief Finishes an outward sum from the partial results of its leaves
+    template <class T>
+    basic_interval<T> finish(std::vector<outward_part<T>> &parts)
+    {
+        rounding_scope upward;
+        outward_part<T> all = tree(parts.data(), parts.size(), [](outward_part<T> a, outward_part<T> const &b)
+                                   { return outward_part<T>{a.hi + b.hi, a.nlo + b.nlo}; });
+        return basic_interval<T>(-all.nlo, all.hi);
+    }
+
+    /// @brief Bounds the number of TwoSums of a compensated sum: one per term and fewer than lane_count per leaf to join
+    template <class T>
+    std::size_t two_sums(std::size_t n) noexcept { return n + (n + reduce_leaf - 1) / reduce_leaf * lane_count<T>; }
+
+    /// @brief Checks whether the error bound of a compensated sum of n terms holds, which needs K u <= 1/4
+    template <class T>
+    bool compensable(std::size_t n) noexcept { return T(two_sums<T>(n)) * std::numeric_limits<T>::epsilon() <= T(0.5); }
+
+    /// @brief Bounds the exact sum of a column from its compensated sum
+    /// @details The errors t_k of the K TwoSums satisfy exact = s + sum t_k. c and e are sums in round to nearest of the t_k and of the |t_k|, so with K u <= 1/4, u half the machine epsilon, |c - sum t_k| <= 2 K u e. The result is computed while rounding upward.
+    /// @param x the compensated sum
+    /// @param k the number of TwoSums, or an upper bound on it
+    /// @param bound set to a number no less than the exact sum
+    /// @return false if the bound does not hold because of overflow
+    template <class T>
+    bool upper_bound(compensated_column<T> const &x, std::size_t k, T &bound) noexcept
+    {
+        constexpr T eps = std::numeric_limits<T>::epsilon();
+        if (!std::isfinite(x.s) || !std::isfinite(x.c) || !std::isfinite(x.e))
+            return false;
+        bound = (x.s + x.c) + (T(2) * T(k) * eps) * x.e; // 2 k eps is 4 k u, twice the bound, rounded upward
+        return std::isfinite(bound);
+    }
+
+    /// @brief Finishes a compensated sum from the partial results of its leaves
+    /// @param n the number of terms
+    /// @return false if the sum must be recomputed outward
+    template <class T>
+    bool finish(std::vector<compensated_part<T>> &parts, std::size_t n, basic_interval<T> &out)
+    {
+        compensated_part<T> all;
+        {
+            mode_scope nearest(FE_TONEAREST);
+            all = tree(parts.data(), parts.size(), [](compensated_part<T> const &a, compensated_part<T> const &b)
+                       { return compensated_part<T>{merge(a.hi, b.hi), merge(a.nlo, b.nlo)}; });
+        }
+        std::size_t k = two_sums<T>(n);
+        rounding_scope upward;
+        T hi, nlo;
+        if (!upper_bound(all.hi, k, hi) || !upper_bound(all.nlo, k, nlo))
+            return false;
+        out = basic_interval<T>(-nlo, hi);
+        return true;
+    }
+
+    /// @brief Runs the lattice kernel over a view
+    template <class T>
+    extrema_part<T> reduce_extrema(basic_interval_view<T> a, thread_pool &pool, char const *name)
+    {
+        if (a.size() == 0)
+            throw std::invalid_argument(std::string(name) + ": the view is empty");
+        auto kernel = active_table<T>().extrema;
+        auto parts = leaves<T, extrema_part<T>>(pool, a.size(), 1, std::fegetround(), [&](std::size_t first, std::size_t count)
+                                                { return kernel(a.lo() + first, a.hi() + first, count); });
+        return tree(parts.data(), parts.size(), [](extrema_part<T> const &x, extrema_part<T> const &y)
+                    { return extrema_part<T>{min2(x.min_lo, y.min_lo), max2(x.max_lo, y.max_lo), min2(x.min_hi, y.min_hi), max2(x.max_hi, y.max_hi)}; });
+    }
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 sums
+//---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+basic_interval<T> sum(basic_interval_view<T> a, sum_mode mode, thread_pool &pool)
+{
+    std::size_t n = a.size();
+    if (n == 0)
+        return basic_interval<T>(T(0));
+    kernel_table<T> const &k = active_table<T>();
+    if (mode == sum_mode::compensated && compensable<T>(n))
+    {
+        auto parts = leaves<T, compensated_part<T>>(pool, n, 1, FE_TONEAREST, [&](std::size_t first, std::size_t count)
+                                                    { return k.compensated(a.lo() + first, a.hi() + first, count); });
+        basic_interval<T> out;
+        if (finish(parts, n, out))
+            return out;
+    }
+    auto parts = leaves<T, outward_part<T>>(pool, n, 1, FE_UPWARD, [&](std::size_t first, std::size_t count)
+                                            { return k.sum(a.lo() + first, a.hi() + first, count); });
+    return finish(parts);
+}
+
+template <class T>
+basic_interval<T> dot(basic_interval_view<T> a, std::type_identity_t<basic_interval_view<T>> b, sum_mode mode, thread_pool &pool)
+{
+    if (a.size() != b.size())
+        throw std::invalid_argument("dot: operands have different sizes");
+    std::size_t n = a.size();
+    if (n == 0)
+        return basic_interval<T>(T(0));
+    kernel_table<T> const &k = active_table<T>();
+    if (mode == sum_mode::compensated && compensable<T>(n))
+    {
+        auto parts = leaves<T, compensated_part<T>>(pool, n, 3, FE_TONEAREST, [&](std::size_t first, std::size_t count)
+                                                    {
+                                                        thread_local std::vector<T> buffer(2 * reduce_leaf); // the products of one leaf
+                                                        {
+                                                            rounding_scope upward;
+                                                            k.products(a.lo() + first, a.hi() + first, b.lo() + first, b.hi() + first, count,
+                                                                       buffer.data(), buffer.data() + reduce_leaf);
+                                                        }
+                                                        return k.compensated(buffer.data(), buffer.data() + reduce_leaf, count); });
+        basic_interval<T> out;
+        if (finish(parts, n, out))
+            return out;
+    }
+    auto parts = leaves<T, outward_part<T>>(pool, n, 2, FE_UPWARD, [&](std::size_t first, std::size_t count)
+                                            { return k.dot(a.lo() + first, a.hi() + first, b.lo() + first, b.hi() + first, count); });
+    return finish(parts);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 lattice reductions
+//---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+basic_interval<T> hull(basic_interval_view<T> a, thread_pool &pool)
+{
+    extrema_part<T> x = reduce_extrema(a, pool, "hull");
+    return basic_interval<T>(x.min_lo, x.max_hi);
+}
+
+template <class T>
+std::optional<basic_interval<T>> intersect(basic_interval_view<T> a, thread_pool &pool)
+{
+    extrema_part<T> x = reduce_extrema(a, pool, "intersect");
+    if (x.max_lo > x.min_hi)
+        return std::nullopt; // two intervals are disjoint
+    return basic_interval<T>(x.max_lo, x.min_hi);
+}
+
+template <class T>
+basic_interval<T> min(basic_interval_view<T> a, thread_pool &pool)
+{
+    extrema_part<T> x = reduce_extrema(a, pool, "min");
+    return basic_interval<T>(x.min_lo, x.min_hi);
+}
+
+template <class T>
+basic_interval<T> max(basic_interval_view<T> a, thread_pool &pool)
+{
+    extrema_part<T> x = reduce_extrema(a, pool, "max");
+    return basic_interval<T>(x.max_lo, x.max_hi);
+}
+
+template basic_interval<float> sum(basic_interval_view<float>, sum_mode, thread_pool &);
+template basic_interval<double> sum(basic_interval_view<double>, sum_mode, thread_pool &);
+template basic_interval<float> dot(basic_interval_view<float>, basic_interval_view<float>, sum_mode, thread_pool &);
+template basic_interval<double> dot(basic_interval_view<double>, basic_interval_view<double>, sum_mode, thread_pool &);
+template basic_interval<float> hull(basic_interval_view<float>, thread_pool &);
+template basic_interval<double> hull(basic_interval_view<double>, thread_pool &);
+template std::optional<basic_interval<float>> intersect(basic_interval_view<float>, thread_pool &);
+template std::optional<basic_interval<double>> intersect(basic_interval_view<double>, thread_pool &);
+template basic_interval<float> min(basic_interval_view<float>, thread_pool &);
+template basic_interval<double> min(basic_interval_view<double>, thread_pool &);
+template basic_interval<float> max(basic_interval_view<float>, thread_pool &);
+template basic_interval<double> max(basic_interval_view<double>, thread_pool &);
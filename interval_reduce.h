@@ -0,0 +1,141 @@
+/// @file interval_reduce.h
+/// @brief Reproducible parallel reductions of interval arrays: sums, dot products, hulls, intersections and extrema
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares sum, dot, hull, intersect, min and max over a whole view or array. Each is computed over leaves of #reduce_leaf intervals. Within a leaf, interval i goes to lane i mod 64 / sizeof(T), a fixed number of lanes that fills one AVX-512 register and is split over several narrower registers on older processors. The lanes of a leaf and then the leaves are combined in fixed pairwise trees. The order of every operation therefore depends only on the number of intervals, and the result is the same bit for bit whatever the number of workers, whichever worker runs each leaf and whichever instruction set is active.
+/// @details Sums and dot products are rounded outward: the kernels run with the FPU rounding upward inside a rounding_scope on every worker, and obtain lower end points by negation as rounding::scoped does, so the result encloses the exact sum whatever the rounding mode of the caller. sum_mode::compensated instead sums each end point column in round to nearest with TwoSum, which gives the rounding error of every addition exactly. It carries those errors and their magnitudes alongside the sums and widens the corrected sum by an a posteriori bound on the error of summing them. The result is usually as tight as the end points allow, where the outward sum gains a few ulps of width for every thousand terms. interval_reduce.cpp is compiled with -frounding-math.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "interval.h"
+#include "interval_array.h"
+#include "parallel.h"
+
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 options
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief The intervals summed by one leaf of a reduction, a multiple of every lane count
+inline constexpr std::size_t reduce_leaf = 4096;
+
+/// @brief How sum and dot add up their terms
+enum class sum_mode
+{
+    outward,    ///< every addition rounded outward, the fastest
+    compensated ///< TwoSum in round to nearest with the error bounded at the end, the tightest
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 sums
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Encloses the sum of every interval of a view
+/// @details A compensated sum that overflows, or whose error bound no longer holds because the view has about 1 / (4 epsilon) intervals, is recomputed outward.
+/// @param a the intervals
+/// @param mode outward or compensated
+/// @param pool the workers
+/// @return an interval containing every sum of one point from each interval, [0, 0] for an empty view
+template <class T>
+basic_interval<T> sum(basic_interval_view<T> a, sum_mode mode = sum_mode::outward, thread_pool &pool = default_pool());
+
+/// @brief Encloses the sum of every interval of an array
+/// @param a the intervals
+/// @param mode outward or compensated
+/// @param pool the workers
+/// @return an interval containing every sum of one point from each interval, [0, 0] for an empty array
+template <class T>
+basic_interval<T> sum(basic_interval_array<T> const &a, sum_mode mode = sum_mode::outward, thread_pool &pool = default_pool())
+{
+    return sum(basic_interval_view<T>(a), mode, pool); // the view overload cannot deduce T from an array
+}
+
+/// @brief Encloses the dot product of two views
+/// @details Each product is enclosed as the interval operator * does under a rounding policy that rounds upward; the compensated mode forms the products of a leaf rounded outward and then sums them as sum does.
+/// @param a the left factors
+/// @param b the right factors, the same size as a
+/// @param mode outward or compensated
+/// @param pool the workers
+/// @return an interval containing the sum of a[i] * b[i], [0, 0] for empty views
+/// @throws std::invalid_argument if the views differ in size
+template <class T>
+basic_interval<T> dot(basic_interval_view<T> a, std::type_identity_t<basic_interval_view<T>> b, sum_mode mode = sum_mode::outward,
+                      thread_pool &pool = default_pool());
+
+/// @brief Encloses the dot product of two arrays
+/// @param a the left factors
+/// @param b the right factors, the same size as a
+/// @param mode outward or compensated
+/// @param pool the workers
+/// @return an interval containing the sum of a[i] * b[i], [0, 0] for empty arrays
+/// @throws std::invalid_argument if the arrays differ in size
+template <class T>
+basic_interval<T> dot(basic_interval_array<T> const &a, basic_interval_array<T> const &b, sum_mode mode = sum_mode::outward,
+                      thread_pool &pool = default_pool())
+{
+    return dot(basic_interval_view<T>(a), basic_interval_view<T>(b), mode, pool);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 lattice reductions
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Finds the smallest interval containing every interval of a view
+/// @param a the intervals
+/// @param pool the workers
+/// @return [min of the lower end points, max of the upper end points]
+/// @throws std::invalid_argument if the view is empty
+template <class T>
+basic_interval<T> hull(basic_interval_view<T> a, thread_pool &pool = default_pool());
+
+/// @brief Finds the smallest interval containing every interval of an array
+/// @throws std::invalid_argument if the array is empty
+template <class T>
+basic_interval<T> hull(basic_interval_array<T> const &a, thread_pool &pool = default_pool()) { return hull(basic_interval_view<T>(a), pool); }
+
+/// @brief Finds the interval common to every interval of a view
+/// @param a the intervals
+/// @param pool the workers
+/// @return [max of the lower end points, min of the upper end points], or std::nullopt if two intervals are disjoint
+/// @throws std::invalid_argument if the view is empty
+template <class T>
+std::optional<basic_interval<T>> intersect(basic_interval_view<T> a, thread_pool &pool = default_pool());
+
+/// @brief Finds the interval common to every interval of an array
+/// @throws std::invalid_argument if the array is empty
+template <class T>
+std::optional<basic_interval<T>> intersect(basic_interval_array<T> const &a, thread_pool &pool = default_pool())
+{
+    return intersect(basic_interval_view<T>(a), pool);
+}
+
+/// @brief Encloses the least element of every choice of one point from each interval of a view
+/// @param a the intervals
+/// @param pool the workers
+/// @return [min of the lower end points, min of the upper end points]
+/// @throws std::invalid_argument if the view is empty
+template <class T>
+basic_interval<T> min(basic_interval_view<T> a, thread_pool &pool = default_pool());
+
+/// @brief Encloses the least element of every choice of one point from each interval of an array
+/// @throws std::invalid_argument if the array is empty
+template <class T>
+basic_interval<T> min(basic_interval_array<T> const &a, thread_pool &pool = default_pool()) { return min(basic_interval_view<T>(a), pool); }
+
+/// @brief Encloses the greatest element of every choice of one point from each interval of a view
+/// @param a the intervals
+/// @param pool the workers
+/// @return [max of the lower end points, max of the upper end points]
+/// @throws std::invalid_argument if the view is empty
+template <class T>
+basic_interval<T> max(basic_interval_view<T> a, thread_pool &pool = default_pool());
+
+/// @brief Encloses the greatest element of every choice of one point from each interval of an array
+/// @throws std::invalid_argument if the array is empty
+template <class T>
+basic_interval<T> max(basic_interval_array<T> const &a, thread_pool &pool = default_pool()) { return max(basic_interval_view<T>(a), pool); }
@@ -0,0 +1,498 @@
+/// @file interval_solve.cpp
+/// @brief Implementation of the verified dense and sparse linear system solvers
+/// @author George Downing
+/// @date 17-10-2026
+/// @details The floating point parts, the LU factorisation, the approximate inverse and the approximate solution, run in the rounding mode of the caller and need no care. Every enclosure, the residual, z, G and each Krawczyk or Gauss-Seidel step, is computed with basic_interval under rounding::scoped inside a rounding_scope that each worker sets up for its own chunk. The two paths differ only in how the rows of G are stored, so the iterations are written once over a row accessor. This file is compiled with -frounding-math.
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                    include files
+//---------------------------------------------------------------------------------------------------------------------
+
+#include "interval_solve.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    /// @brief Interval arithmetic rounded outward while a rounding_scope is active
+    template <class T>
+    using up = basic_interval<T, rounding::scoped>;
+
+    /// @brief An interval vector of the iterations
+    template <class T>
+    using box = std::vector<up<T>>;
+
+    /// @brief Gets the seconds since a time point
+    double seconds_since(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /// @brief Chooses the rows per chunk of a loop whose rows each cost about per_row entries
+    std::size_t row_grain(std::size_t per_row) noexcept { return std::max<std::size_t>(1, 16384 / std::max<std::size_t>(1, per_row)); }
+
+    /// @brief Gets the midpoint of an interval in any rounding mode without overflow
+    template <class T>
+    T midpoint(T lo, T hi) noexcept { return lo * T(0.5) + hi * T(0.5); }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 rows of the preconditioned matrix
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief The rows of a dense G = R A
+    template <class T>
+    struct dense_rows
+    {
+        basic_interval_matrix<T> const &g; ///< the matrix
+
+        /// @brief Calls fn(j, g_ij) for every entry of row i off the diagonal
+        template <class Fn>
+        void row(std::size_t i, Fn &&fn) const
+        {
+            std::size_t n = g.cols();
+            T const *lo = g.lo() + i * n, *hi = g.hi() + i * n;
+            for (std::size_t j = 0; j < n; ++j)
+                if (j != i)
+                    fn(j, up<T>(lo[j], hi[j]));
+        }
+
+        /// @brief Gets the diagonal entry of row i
+        up<T> diag(std::size_t i) const { return up<T>(g.lo()[i * g.cols() + i], g.hi()[i * g.cols() + i]); }
+    };
+
+    /// @brief The rows of a sparse G = R A, with the position of each diagonal entry
+    template <class T>
+    struct sparse_rows
+    {
+        basic_sparse_interval_matrix<T> const &g; ///< the matrix
+        std::vector<std::size_t> const &diag_at;  ///< the index of the diagonal entry of every row, or nonzeros() if none is stored
+
+        /// @brief Calls fn(j, g_ij) for every stored entry of row i but the diagonal one
+        template <class Fn>
+        void row(std::size_t i, Fn &&fn) const
+        {
+            T const *lo = g.values().lo(), *hi = g.values().hi();
+            for (std::size_t k = g.row_offsets()[i]; k < g.row_offsets()[i + 1]; ++k)
+                if (k != diag_at[i])
+                    fn(g.col_index()[k], up<T>(lo[k], hi[k]));
+        }
+
+        /// @brief Gets the diagonal entry of row i, [0, 0] when none is stored
+        up<T> diag(std::size_t i) const
+        {
+            std::size_t k = diag_at[i];
+            return k < g.nonzeros() ? up<T>(g.values().lo()[k], g.values().hi()[k]) : up<T>(T(0));
+        }
+    };
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 iterations
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Applies the Krawczyk operator, k = z + (I - G) e
+    /// @details The diagonal is taken as (1 - g_ii) e_i rather than e_i - g_ii e_i, which would double the width of every step.
+    template <class T, class Rows>
+    void krawczyk_step(Rows const &g, box<T> const &z, box<T> const &e, box<T> &k, std::size_t per_row, thread_pool &pool)
+    {
+        parallel_for(pool, z.size(), row_grain(per_row), [&](std::size_t begin, std::size_t end)
+                     {
+                         rounding_scope scope;
+                         for (std::size_t i = begin; i < end; ++i)
+                         {
+                             up<T> s = z[i] + (up<T>(T(1)) - g.diag(i)) * e[i];
+                             g.row(i, [&](std::size_t j, up<T> const &gij) { s -= gij * e[j]; });
+                             k[i] = s;
+                         }
+                     });
+    }
+
+    /// @brief Runs one interval Gauss-Seidel sweep on G e = z, narrowing e in place
+    /// @details Each chunk of rows sweeps in order and uses the new components of its own rows at once and the components of other chunks as they were before the sweep, so no worker reads what another writes. A component only changes by intersection, so every solution inside e stays inside.
+    template <class T, class Rows>
+    void gauss_seidel_step(Rows const &g, box<T> const &z, box<T> const &old, box<T> &e, std::size_t per_row, thread_pool &pool)
+    {
+        parallel_for(pool, z.size(), row_grain(per_row), [&](std::size_t begin, std::size_t end)
+                     {
+                         rounding_scope scope;
+                         for (std::size_t i = begin; i < end; ++i)
+                         {
+                             up<T> s = z[i];
+                             g.row(i, [&](std::size_t j, up<T> const &gij) { s -= gij * (j >= begin && j < end ? e[j] : old[j]); });
+                             up<T> d = g.diag(i);
+                             if (!(d.min() > 0 || d.max() < 0)) // the quotient is unbounded and narrows nothing
+                                 continue;
+                             up<T> q = s / d;
+                             T lo = std::max(q.min(), e[i].min()), hi = std::min(q.max(), e[i].max());
+                             if (lo <= hi) // an empty intersection cannot hold a solution; keep e[i] rather than trust it
+                                 e[i] = up<T>(lo, hi);
+                         }
+                     });
+    }
+
+    /// @brief Sums the widths of the components of a box
+    template <class T>
+    double total_width(box<T> const &e) noexcept
+    {
+        double w = 0.0;
+        for (up<T> const &c : e)
+            w += double(c.max()) - double(c.min());
+        return w;
+    }
+
+    /// @brief Encloses the error x - x~ by inflated Krawczyk steps, then narrows it
+    /// @param g the rows of G = R A
+    /// @param z the enclosure of R (b - A x~)
+    /// @param e set to the enclosure of the error when the system is verified
+    /// @param per_row the entries in a row of G, for the chunk size
+    /// @param options the method and iteration limits
+    /// @param result updated with the iteration counts
+    /// @param pool the workers
+    /// @return true if an inflated step landed strictly inside its box
+    template <class T, class Rows>
+    bool verify(Rows const &g, box<T> const &z, box<T> &e, std::size_t per_row, solve_options const &options, solve_result &result, thread_pool &pool)
+    {
+        std::size_t n = z.size();
+        box<T> y(n), k(n);
+        e = z;
+        bool verified = false;
+        for (int it = 1; it <= options.max_iterations && !verified; ++it)
+        {
+            result.iterations = it;
+            for (std::size_t i = 0; i < n; ++i) // epsilon inflation; any box is a valid candidate, so no rounding care is needed
+            {
+                T w = T(options.inflation) * (e[i].max() - e[i].min()) + std::numeric_limits<T>::min();
+                y[i] = up<T>(e[i].min() - w, e[i].max() + w);
+            }
+            krawczyk_step<T>(g, z, y, k, per_row, pool);
+            verified = true;
+            for (std::size_t i = 0; i < n && verified; ++i)
+                verified = y[i].min() < k[i].min() && k[i].max() < y[i].max(); // false also for NaN
+            e.swap(k);
+        }
+        if (!verified)
+            return false;
+
+        box<T> old(n);
+        for (int r = 1; r <= options.max_refinements; ++r)
+        {
+            result.refinements = r;
+            double before = total_width(e);
+            if (options.method == solve_method::krawczyk)
+            {
+                krawczyk_step<T>(g, z, e, k, per_row, pool);
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    T lo = std::max(k[i].min(), e[i].min()), hi = std::min(k[i].max(), e[i].max());
+                    if (lo <= hi)
+                        e[i] = up<T>(lo, hi);
+                }
+            }
+            else
+            {
+                old = e;
+                gauss_seidel_step<T>(g, z, old, e, per_row, pool);
+            }
+            if (!(total_width(e) < 0.99 * before)) // less than 1% narrower: converged
+                break;
+        }
+        return true;
+    }
+
+    /// @brief Writes x = x~ + e, or the whole line everywhere if the system was not verified
+    template <class T>
+    void finish(std::vector<T> const &approx, box<T> const &e, bool verified, basic_interval_array<T> &x)
+    {
+        std::size_t n = approx.size();
+        x.resize(n);
+        rounding_scope scope;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            up<T> s = verified ? up<T>(approx[i]) + e[i] : up<T>::entire();
+            x.set(i, basic_interval<T>(s.min(), s.max()));
+        }
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 dense preconditioning
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief An LU factorisation with partial pivoting of a real matrix, P M = L U
+    template <class T>
+    struct lu_factors
+    {
+        std::vector<T> m;              ///< L below the diagonal, with an implicit unit diagonal, and U on and above it, row major
+        std::vector<std::size_t> swap; ///< the row exchanged with row k at step k
+        std::size_t n = 0;             ///< the order
+
+        /// @brief Factorises in place with the trailing update of every step spread over the pool
+        /// @return false if a pivot is zero or not finite
+        bool factor(thread_pool &pool)
+        {
+            swap.resize(n);
+            for (std::size_t k = 0; k < n; ++k)
+            {
+                std::size_t p = k;
+                for (std::size_t i = k + 1; i < n; ++i)
+                    if (std::fabs(m[i * n + k]) > std::fabs(m[p * n + k]))
+                        p = i;
+                T pivot = m[p * n + k];
+                if (!(std::fabs(pivot) > 0 && std::fabs(pivot) <= std::numeric_limits<T>::max()))
+                    return false;
+                swap[k] = p;
+                if (p != k)
+                    std::swap_ranges(m.begin() + p * n, m.begin() + (p + 1) * n, m.begin() + k * n);
+                T inv = T(1) / pivot;
+                T const *top = m.data() + k * n;
+                parallel_for(pool, n - k - 1, row_grain(n - k), [&](std::size_t begin, std::size_t end)
+                             {
+                                 for (std::size_t i = k + 1 + begin; i < k + 1 + end; ++i)
+                                 {
+                                     T *row = m.data() + i * n;
+                                     T l = row[k] *= inv;
+                                     for (std::size_t j = k + 1; j < n; ++j)
+                                         row[j] -= l * top[j];
+                                 }
+                             });
+            }
+            return true;
+        }
+
+        /// @brief Solves M v = rhs in place
+        void solve(T *v) const noexcept
+        {
+            for (std::size_t k = 0; k < n; ++k)
+                std::swap(v[k], v[swap[k]]);
+            for (std::size_t i = 1; i < n; ++i) // forward substitution with L
+            {
+                T s = v[i];
+                for (std::size_t j = 0; j < i; ++j)
+                    s -= m[i * n + j] * v[j];
+                v[i] = s;
+            }
+            for (std::size_t i = n; i-- > 0;) // back substitution with U
+            {
+                T s = v[i];
+                for (std::size_t j = i + 1; j < n; ++j)
+                    s -= m[i * n + j] * v[j];
+                v[i] = s / m[i * n + i];
+            }
+        }
+    };
+
+    /// @brief Builds x~, z and G for a dense system
+    /// @return false if mid(A) is singular to working precision
+    template <class T>
+    bool precondition(basic_interval_matrix<T> const &a, basic_interval_array<T> const &b, std::vector<T> &approx, box<T> &z,
+                      basic_interval_matrix<T> &g, thread_pool &pool)
+    {
+        std::size_t n = a.rows();
+        lu_factors<T> lu;
+        lu.n = n;
+        lu.m.resize(n * n);
+        parallel_for(pool, n, row_grain(n), [&](std::size_t begin, std::size_t end)
+                     {
+                         for (std::size_t i = begin * n; i < end * n; ++i)
+                             lu.m[i] = midpoint(a.lo()[i], a.hi()[i]);
+                     });
+        if (!lu.factor(pool))
+            return false;
+
+        // R = mid(A)^-1 a column at a time, stored as a matrix of point intervals for matmul
+        basic_interval_matrix<T> r = basic_interval_matrix<T>::for_overwrite(n, n);
+        parallel_for(pool, n, 16, [&](std::size_t begin, std::size_t end)
+                     {
+                         std::vector<T> col(n);
+                         for (std::size_t c = begin; c < end; ++c)
+                         {
+                             std::fill(col.begin(), col.end(), T(0));
+                             col[c] = T(1);
+                             lu.solve(col.data());
+                             for (std::size_t i = 0; i < n; ++i)
+                                 r.lo()[i * n + c] = r.hi()[i * n + c] = col[i];
+                         }
+                     });
+
+        // x~ from the factors, improved by one step of refinement with the residual in working precision
+        approx.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+            approx[i] = midpoint(b.lo()[i], b.hi()[i]);
+        lu.solve(approx.data());
+        std::vector<T> residual(n);
+        parallel_for(pool, n, row_grain(n), [&](std::size_t begin, std::size_t end)
+                     {
+                         for (std::size_t i = begin; i < end; ++i)
+                         {
+                             T s = midpoint(b.lo()[i], b.hi()[i]);
+                             for (std::size_t j = 0; j < n; ++j)
+                                 s -= midpoint(a.lo()[i * n + j], a.hi()[i * n + j]) * approx[j];
+                             residual[i] = s;
+                         }
+                     });
+        lu.solve(residual.data());
+        for (std::size_t i = 0; i < n; ++i)
+            approx[i] += residual[i];
+
+        // z = R (b - A x~), enclosed
+        box<T> d(n);
+        parallel_for(pool, n, row_grain(n), [&](std::size_t begin, std::size_t end)
+                     {
+                         rounding_scope scope;
+                         for (std::size_t i = begin; i < end; ++i)
+                         {
+                             up<T> s(b.lo()[i], b.hi()[i]);
+                             for (std::size_t j = 0; j < n; ++j)
+                                 s -= up<T>(a.lo()[i * n + j], a.hi()[i * n + j]) * approx[j];
+                             d[i] = s;
+                         }
+                     });
+        z.assign(n, up<T>());
+        parallel_for(pool, n, row_grain(n), [&](std::size_t begin, std::size_t end)
+                     {
+                         rounding_scope scope;
+                         for (std::size_t i = begin; i < end; ++i)
+                         {
+                             up<T> s;
+                             for (std::size_t j = 0; j < n; ++j)
+                                 s += d[j] * r.lo()[i * n + j];
+                             z[i] = s;
+                         }
+                     });
+
+        matmul(r, a, g, matmul_mode::midrad, pool); // G = R A, enclosed
+        return true;
+    }
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 solvers
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details An empty system is verified at once.
+template <class T>
+solve_result solve(basic_interval_matrix<T> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &x,
+                   solve_options const &options, thread_pool &pool)
+{
+    if (a.rows() != a.cols() || b.size() != a.rows())
+        throw std::invalid_argument("solve: the matrix is not square or the right hand side does not match it");
+    auto start = std::chrono::steady_clock::now();
+    solve_result result;
+    std::size_t n = a.rows();
+    std::vector<T> approx(n);
+    box<T> z, e;
+    basic_interval_matrix<T> g;
+    bool regular = precondition(a, b, approx, z, g, pool);
+    result.precondition_seconds = seconds_since(start);
+    result.verified = regular && verify<T>(dense_rows<T>{g}, z, e, n, options, result, pool);
+    finish(approx, e, result.verified, x);
+    result.seconds = seconds_since(start);
+    return result;
+}
+
+/// @details x~ comes from Jacobi iterations on mid(A), stopped when a step moves no component by more than 4 eps of the largest or after 1000 steps; a poor x~ only widens the enclosure.
+template <class T>
+solve_result solve(basic_sparse_interval_matrix<T> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &x,
+                   solve_options const &options, thread_pool &pool)
+{
+    if (a.rows() != a.cols() || b.size() != a.rows())
+        throw std::invalid_argument("solve: the matrix is not square or the right hand side does not match it");
+    auto start = std::chrono::steady_clock::now();
+    solve_result result;
+    std::size_t n = a.rows(), nnz = a.nonzeros();
+    std::size_t const *offsets = a.row_offsets(), *cols = a.col_index();
+    T const *alo = a.values().lo(), *ahi = a.values().hi();
+    std::size_t per_row = n ? nnz / n + 1 : 1;
+
+    // R = diag(mid(A))^-1, 1 where a diagonal entry is missing or its midpoint is zero
+    std::vector<std::size_t> diag_at(n, nnz);
+    std::vector<T> r(n, T(1)), mids(nnz), mid_b(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        for (std::size_t k = offsets[i]; k < offsets[i + 1] && diag_at[i] == nnz; ++k)
+            if (cols[k] == i)
+                diag_at[i] = k;
+        if (diag_at[i] < nnz)
+        {
+            T m = midpoint(alo[diag_at[i]], ahi[diag_at[i]]);
+            if (m != 0 && std::fabs(m) <= std::numeric_limits<T>::max())
+                r[i] = T(1) / m;
+        }
+        mid_b[i] = midpoint(b.lo()[i], b.hi()[i]);
+    }
+    for (std::size_t k = 0; k < nnz; ++k)
+        mids[k] = midpoint(alo[k], ahi[k]);
+
+    // x~ by Jacobi iterations, x <- x + R (mid(b) - mid(A) x)
+    std::vector<T> approx(n), next(n);
+    for (std::size_t i = 0; i < n; ++i)
+        approx[i] = r[i] * mid_b[i];
+    for (int it = 0; it < 1000; ++it)
+    {
+        parallel_for(pool, n, row_grain(per_row), [&](std::size_t begin, std::size_t end)
+                     {
+                         for (std::size_t i = begin; i < end; ++i)
+                         {
+                             T s = mid_b[i];
+                             for (std::size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+                                 s -= mids[k] * approx[cols[k]];
+                             next[i] = approx[i] + r[i] * s;
+                         }
+                     });
+        T step = 0, size = 0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            step = std::max(step, std::fabs(next[i] - approx[i]));
+            size = std::max(size, std::fabs(next[i]));
+        }
+        approx.swap(next);
+        if (!(step > 4 * std::numeric_limits<T>::epsilon() * size)) // converged, or diverged to NaN
+            break;
+    }
+    for (T &v : approx)
+        if (!(std::fabs(v) <= std::numeric_limits<T>::max()))
+            v = T(0); // a diverged x~ is still a valid centre
+
+    // z = R (b - A x~) and G = R A, enclosed
+    box<T> z(n), e;
+    basic_interval_array<T> gv = basic_interval_array<T>::for_overwrite(nnz);
+    parallel_for(pool, n, row_grain(per_row), [&](std::size_t begin, std::size_t end)
+                 {
+                     rounding_scope scope;
+                     for (std::size_t i = begin; i < end; ++i)
+                     {
+                         up<T> s(b.lo()[i], b.hi()[i]);
+                         for (std::size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+                         {
+                             up<T> aij(alo[k], ahi[k]);
+                             s -= aij * approx[cols[k]];
+                             up<T> gij = aij * r[i];
+                             gv.set(k, basic_interval<T>(gij.min(), gij.max()));
+                         }
+                         z[i] = s * r[i];
+                     }
+                 });
+    basic_sparse_interval_matrix<T> g(n, n, std::vector<std::size_t>(offsets, offsets + n + 1), std::vector<std::size_t>(cols, cols + nnz), std::move(gv));
+    result.precondition_seconds = seconds_since(start);
+
+    result.verified = verify<T>(sparse_rows<T>{g, diag_at}, z, e, per_row, options, result, pool);
+    finish(approx, e, result.verified, x);
+    result.seconds = seconds_since(start);
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 explicit instantiations
+//---------------------------------------------------------------------------------------------------------------------
+
+template solve_result solve(basic_interval_matrix<float> const &, basic_interval_array<float> const &, basic_interval_array<float> &,
+                            solve_options const &, thread_pool &);
+template solve_result solve(basic_interval_matrix<double> const &, basic_interval_array<double> const &, basic_interval_array<double> &,
+                            solve_options const &, thread_pool &);
+template solve_result solve(basic_sparse_interval_matrix<float> const &, basic_interval_array<float> const &, basic_interval_array<float> &,
+                            solve_options const &, thread_pool &);
+template solve_result solve(basic_sparse_interval_matrix<double> const &, basic_interval_array<double> const &, basic_interval_array<double> &,
+                            solve_options const &, thread_pool &);
@@ -0,0 +1,76 @@
+/// @file interval_solve.h
+/// @brief Verified solution of linear systems with interval coefficients
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares solve, which encloses the solutions x of A x = b for every real matrix A and vector b within an interval matrix and an interval vector. It follows the usual verification scheme: a floating point approximate inverse R of mid(A) and an approximate solution x~ are computed in plain arithmetic; then z = R (b - A x~) and G = R A are enclosed rigorously, and the error x - x~ is enclosed by iterating the Krawczyk operator E -> z + (I - G) E from z with epsilon inflation. Once an iterate lands strictly inside the box it came from, Brouwer's fixed point theorem proves that every A is regular and that every solution lies in x~ + E; further iterations of the Krawczyk operator, or sweeps of interval Gauss-Seidel on G e = z, then narrow E while keeping every solution.
+/// @details The dense path takes R as the inverse of an LU factorisation of mid(A) and forms G with matmul_mode::midrad. The sparse path keeps the pattern of A by taking R as the inverse of the diagonal of mid(A), so it verifies systems whose preconditioned matrix is close enough to I, such as diagonally dominant ones and M-matrices; x~ comes from Jacobi iterations. Both paths compute their enclosures with the FPU rounding upward inside a rounding_scope on every worker, so the result holds whatever the rounding mode of the caller; interval_solve.cpp is compiled with -frounding-math.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "interval_array.h"
+#include "interval_matrix.h"
+#include "parallel.h"
+
+#include <cstddef>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 options and results
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief How solve narrows the enclosure once the system is verified
+enum class solve_method
+{
+    krawczyk,    ///< iterate E -> (z + (I - G) E) intersected with E, every row at once
+    gauss_seidel ///< sweep e_i -> (z_i - sum over j != i of G_ij e_j) / G_ii intersected with e_i, using new components at once
+};
+
+/// @brief Iteration limits of solve
+struct solve_options
+{
+    solve_method method = solve_method::krawczyk; ///< the narrowing iteration
+    int max_iterations = 20;                      ///< the most inflated Krawczyk steps tried before giving up verification
+    int max_refinements = 10;                     ///< the most narrowing steps after verification
+    double inflation = 0.1;                       ///< each inflated box is widened by this fraction of its width on both sides
+};
+
+/// @brief The outcome of solve
+struct solve_result
+{
+    bool verified = false;             ///< true if every system is proven regular and x encloses all solutions; x is entire otherwise
+    int iterations = 0;                ///< the inflated Krawczyk steps taken, including the successful one
+    int refinements = 0;               ///< the narrowing steps taken after verification
+    double precondition_seconds = 0.0; ///< the wall clock time of R, x~, z and G
+    double seconds = 0.0;              ///< the wall clock time of the whole solve
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 solvers
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Encloses the solutions of a dense interval linear system
+/// @details The approximate inverse takes about 4/3 n^3 floating point operations and G = R A an interval matrix product, both spread over the pool; each Krawczyk or Gauss-Seidel step takes n^2 interval multiply-adds. Verification fails when mid(A) is singular to working precision or the system is too wide for R A to be close to I.
+/// @param a the n by n coefficient matrix
+/// @param b the n right hand sides
+/// @param x set to n intervals enclosing every solution, or to basic_interval::entire if verification fails
+/// @param options the method and iteration limits
+/// @param pool the workers
+/// @return whether the system was verified, the iteration counts and the times taken
+/// @throws std::invalid_argument if a is not square or b does not match it
+template <class T>
+solve_result solve(basic_interval_matrix<T> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &x,
+                   solve_options const &options = {}, thread_pool &pool = default_pool());
+
+/// @brief Encloses the solutions of a sparse interval linear system
+/// @details Preconditioning by the diagonal keeps every step at one interval multiply-add per stored entry. Verification fails when a diagonal entry is missing or the preconditioned matrix is too far from I, which is the case for most systems that are not diagonally dominant.
+/// @param a the n by n coefficient matrix
+/// @param b the n right hand sides
+/// @param x set to n intervals enclosing every solution, or to basic_interval::entire if verification fails
+/// @param options the method and iteration limits
+/// @param pool the workers
+/// @return whether the system was verified, the iteration counts and the times taken
+/// @throws std::invalid_argument if a is not square or b does not match it
+template <class T>
+solve_result solve(basic_sparse_interval_matrix<T> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &x,
+                   solve_options const &options = {}, thread_pool &pool = default_pool());
@@ -0,0 +1,335 @@
+/// @file interval_tape.cpp
+/// @brief Recording, compilation and block evaluation of interval tapes
+/// @author George Downing
+/// @date 17-10-2026
+/// @details Registers are allocated in one pass over the live nodes in recording order, which is already an order in which operands come first. A register is released after the instruction that reads it last, before that instruction's own register is chosen, so an instruction may write over its operand; every batch function allows its result to be one of its arguments.
+/// @details The last block of a batch is padded with [1, 1] instead of being finished one box at a time, so every box goes through the same kernels.
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                    include files
+//---------------------------------------------------------------------------------------------------------------------
+
+#include "interval_tape.h"
+#include "interval_math.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace
+{
+    /// @brief Checks whether an operation takes two operands
+    bool is_binary(tape_op op) noexcept { return op == tape_op::add || op == tape_op::sub || op == tape_op::mul || op == tape_op::div; }
+
+    /// @brief Checks whether an operation reads other nodes, unlike an input or a constant
+    bool reads_nodes(tape_op op) noexcept { return op != tape_op::input && op != tape_op::constant; }
+
+    /// @brief Gets the bits of an end point, for keying constants
+    template <class T>
+    std::uint64_t bits(T x) noexcept
+    {
+        if constexpr (sizeof(T) == 8)
+            return std::bit_cast<std::uint64_t>(x);
+        else
+            return std::bit_cast<std::uint32_t>(x);
+    }
+
+    /// @brief Runs every instruction of a program over one block of boxes
+    /// @param program the program
+    /// @param inputs the input columns
+    /// @param reg the registers, each of #tape_block intervals
+    /// @param first the index of the first box of the block
+    /// @param m the boxes in the block; the rest of each loaded register is padded
+    template <class T>
+    void run_block(basic_tape_program<T> const &program, std::span<basic_interval_view<T> const> inputs,
+                   std::vector<basic_interval_array<T>> &reg, std::size_t first, std::size_t m)
+    {
+        using form = typename basic_tape_program<T>::form;
+        std::vector<basic_interval<T>> const &constants = program.constants();
+        for (auto const &in : program.code())
+        {
+            basic_interval_array<T> &d = reg[in.dst];
+            auto binary = [&](auto &&fn)
+            {
+                if (in.from == form::registers)
+                    fn(reg[in.a], reg[in.b], d);
+                else if (in.from == form::right_constant)
+                    fn(reg[in.a], constants[in.b], d);
+                else
+                    fn(constants[in.a], reg[in.b], d);
+            };
+            switch (in.op)
+            {
+            case tape_op::input:
+                std::copy_n(inputs[in.a].lo() + first, m, d.lo());
+                std::copy_n(inputs[in.a].hi() + first, m, d.hi());
+                std::fill(d.lo() + m, d.lo() + tape_block, T(1)); // pad a short block with [1, 1]
+                std::fill(d.hi() + m, d.hi() + tape_block, T(1));
+                break;
+            case tape_op::constant:
+                std::fill_n(d.lo(), tape_block, constants[in.a].min());
+                std::fill_n(d.hi(), tape_block, constants[in.a].max());
+                break;
+            case tape_op::add:
+                binary([](auto const &a, auto const &b, auto &out) { add(a, b, out); });
+                break;
+            case tape_op::sub:
+                binary([](auto const &a, auto const &b, auto &out) { sub(a, b, out); });
+                break;
+            case tape_op::mul:
+                binary([](auto const &a, auto const &b, auto &out) { mul(a, b, out); });
+                break;
+            case tape_op::div:
+                binary([](auto const &a, auto const &b, auto &out) { div(a, b, out); });
+                break;
+            case tape_op::neg:
+                sub(basic_interval<T>(T(0)), reg[in.a], d); // 0 - [a, b] is [-b, -a] exactly
+                break;
+            case tape_op::sqr:
+                sqr(reg[in.a], d);
+                break;
+            case tape_op::pow:
+                pow(reg[in.a], in.n, d);
+                break;
+            case tape_op::sqrt:
+                sqrt(reg[in.a], d);
+                break;
+            case tape_op::exp:
+                exp(reg[in.a], d);
+                break;
+            case tape_op::log:
+                log(reg[in.a], d);
+                break;
+            case tape_op::sin:
+                sin(reg[in.a], d);
+                break;
+            case tape_op::cos:
+                cos(reg[in.a], d);
+                break;
+            case tape_op::atan:
+                atan(reg[in.a], d);
+                break;
+            case tape_op::abs:
+                abs(reg[in.a], d);
+                break;
+            }
+        }
+    }
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 node evaluation
+//---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+basic_interval<T> tape_detail::fold(tape_op op, basic_interval<T> const &a, basic_interval<T> const &b, int n) noexcept
+{
+    switch (op)
+    {
+    case tape_op::add:
+        return a + b;
+    case tape_op::sub:
+        return a - b;
+    case tape_op::mul:
+        return a * b;
+    case tape_op::div:
+        return a / b;
+    case tape_op::neg:
+        return basic_interval<T>(-a.max(), -a.min());
+    case tape_op::sqr:
+        return sqr(a);
+    case tape_op::pow:
+        return pow(a, n);
+    case tape_op::sqrt:
+        return sqrt(a);
+    case tape_op::exp:
+        return exp(a);
+    case tape_op::log:
+        return log(a);
+    case tape_op::sin:
+        return sin(a);
+    case tape_op::cos:
+        return cos(a);
+    case tape_op::atan:
+        return atan(a);
+    case tape_op::abs:
+        return abs(a);
+    default:
+        return a; // inputs and constants have no operands
+    }
+}
+
+template basic_interval<float> tape_detail::fold(tape_op, basic_interval<float> const &, basic_interval<float> const &, int) noexcept;
+template basic_interval<double> tape_detail::fold(tape_op, basic_interval<double> const &, basic_interval<double> const &, int) noexcept;
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 recording
+//---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+typename basic_tape<T>::value_type basic_tape<T>::input(std::size_t index)
+{
+    Inputs = std::max(Inputs, index + 1);
+    return intern({tape_op::input, std::uint32_t(index), 0, 0});
+}
+
+template <class T>
+typename basic_tape<T>::value_type basic_tape<T>::constant(interval_type const &val)
+{
+    auto [it, added] = ConstantIndex.try_emplace({bits(val.min()), bits(val.max())}, std::uint32_t(Nodes.size()));
+    if (added)
+    {
+        Nodes.push_back({tape_op::constant, std::uint32_t(Constants.size()), 0, 0});
+        Constants.push_back(val);
+    }
+    return value_type(this, it->second);
+}
+
+/// @details The operands of + and * are put in node order, so a + b and b + a are one node. An operation whose operands are all constants is computed at once and becomes a constant.
+template <class T>
+typename basic_tape<T>::value_type basic_tape<T>::record(tape_op op, value_type const &a, value_type const &b, int n)
+{
+    bool binary = is_binary(op);
+    if (a.Tape != this || (binary && b.Tape != this))
+        throw std::invalid_argument("tape: an operand belongs to another tape");
+    tape_detail::node const &x = Nodes[a.Node];
+    bool fixed_a = x.op == tape_op::constant, fixed_b = binary && Nodes[b.Node].op == tape_op::constant;
+    if (fixed_a && (!binary || fixed_b))
+        return constant(tape_detail::fold(op, Constants[x.a], binary ? Constants[Nodes[b.Node].a] : interval_type(), n));
+    std::uint32_t l = a.Node, r = binary ? b.Node : 0;
+    if ((op == tape_op::add || op == tape_op::mul) && l > r)
+        std::swap(l, r);
+    return intern({op, l, r, op == tape_op::pow ? std::int32_t(n) : 0});
+}
+
+template <class T>
+typename basic_tape<T>::value_type basic_tape<T>::intern(tape_detail::node const &x)
+{
+    auto [it, added] = Index.try_emplace(x, std::uint32_t(Nodes.size()));
+    if (added)
+        Nodes.push_back(x);
+    return value_type(this, it->second);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 compilation
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details Constants are not given registers: an instruction reads them from the constant table through its form, unless the whole result is a constant, which is loaded like an input.
+template <class T>
+basic_tape_program<T> basic_tape<T>::compile(value_type const &result) const
+{
+    if (result.Tape != this)
+        throw std::invalid_argument("tape: the result belongs to another tape");
+    using program = basic_tape_program<T>;
+    using form = typename program::form;
+    std::uint32_t root = result.Node;
+
+    // mark the nodes the result depends on and the last node that reads each
+    std::vector<char> live(root + 1, 0);
+    std::vector<std::uint32_t> last(root + 1, 0);
+    live[root] = 1;
+    last[root] = root + 1; // read after the last instruction
+    for (std::uint32_t i = root + 1; i-- > 0;)
+    {
+        tape_detail::node const &x = Nodes[i];
+        if (!live[i] || !reads_nodes(x.op))
+            continue;
+        live[x.a] = 1;
+        last[x.a] = std::max(last[x.a], i);
+        if (is_binary(x.op))
+        {
+            live[x.b] = 1;
+            last[x.b] = std::max(last[x.b], i);
+        }
+    }
+
+    program p;
+    p.Inputs = Inputs;
+    std::vector<std::uint32_t> reg(root + 1, 0), constant_at(root + 1, 0), free;
+    auto is_constant = [&](std::uint32_t i) { return Nodes[i].op == tape_op::constant; };
+    auto release = [&](std::uint32_t node, std::uint32_t i)
+    {
+        if (!is_constant(node) && last[node] == i)
+            free.push_back(reg[node]);
+    };
+    for (std::uint32_t i = 0; i <= root; ++i)
+    {
+        tape_detail::node const &x = Nodes[i];
+        if (!live[i])
+            continue;
+        if (is_constant(i))
+        {
+            constant_at[i] = std::uint32_t(p.Constants.size());
+            p.Constants.push_back(Constants[x.a]);
+            if (i != root)
+                continue;
+        }
+        typename program::instruction in{x.op, form::registers, 0, 0, 0, x.n};
+        if (x.op == tape_op::input)
+            in.a = x.a;
+        else if (x.op == tape_op::constant)
+            in.a = constant_at[i];
+        else if (is_binary(x.op))
+        {
+            in.from = is_constant(x.a) ? form::left_constant : is_constant(x.b) ? form::right_constant : form::registers;
+            in.a = is_constant(x.a) ? constant_at[x.a] : reg[x.a];
+            in.b = is_constant(x.b) ? constant_at[x.b] : reg[x.b];
+            release(x.a, i);
+            if (x.b != x.a)
+                release(x.b, i);
+        }
+        else
+        {
+            in.a = reg[x.a];
+            release(x.a, i);
+        }
+        if (free.empty())
+            free.push_back(std::uint32_t(p.Registers++));
+        in.dst = reg[i] = free.back();
+        free.pop_back();
+        p.Code.push_back(in);
+    }
+    p.Result = reg[root];
+    return p;
+}
+
+template class basic_tape<float>; // the end point types the batch kernels are compiled for
+template class basic_tape<double>;
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 evaluation
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details Each chunk of the pool is eight blocks, and each chunk allocates its own registers, a few pages that are reused for all its blocks.
+template <class T>
+void evaluate(basic_tape_program<T> const &program, std::span<std::type_identity_t<basic_interval_view<T>> const> inputs, basic_interval_array<T> &out,
+              thread_pool &pool)
+{
+    if (program.code().empty())
+        throw std::invalid_argument("evaluate: the program is empty");
+    if (inputs.size() < program.inputs())
+        throw std::invalid_argument("evaluate: fewer inputs than the program reads");
+    std::size_t n = inputs.empty() ? 0 : inputs[0].size();
+    for (basic_interval_view<T> const &v : inputs)
+        if (v.size() != n)
+            throw std::invalid_argument("evaluate: the inputs differ in size");
+    if (out.size() != n)
+        out = basic_interval_array<T>::for_overwrite(n);
+
+    std::size_t blocks = (n + tape_block - 1) / tape_block;
+    parallel_for(pool, blocks, 8, [&](std::size_t begin, std::size_t end)
+                 {
+                     std::vector<basic_interval_array<T>> reg;
+                     for (std::size_t r = 0; r < program.registers(); ++r)
+                         reg.push_back(basic_interval_array<T>::for_overwrite(tape_block));
+                     for (std::size_t block = begin; block < end; ++block)
+                     {
+                         std::size_t first = block * tape_block, m = std::min(tape_block, n - first);
+                         run_block(program, inputs, reg, first, m);
+                         std::copy_n(reg[program.result()].lo(), m, out.lo() + first);
+                         std::copy_n(reg[program.result()].hi(), m, out.hi() + first);
+                     } });
+}
+
+template void evaluate(basic_tape_program<float> const &, std::span<basic_interval_view<float> const>, basic_interval_array<float> &, thread_pool &);
+template void evaluate(basic_tape_program<double> const &, std::span<basic_interval_view<double> const>, basic_interval_array<double> &, thread_pool &);
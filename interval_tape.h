@@ -0,0 +1,418 @@
+/// @file interval_tape.h
+/// @brief Recorded interval formulas compiled to a register bytecode that runs over blocks of boxes
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares basic_tape, which records a formula once by running it on basic_tape_value handles instead of intervals, and basic_tape_program, the bytecode it compiles to. Recording merges every repeated subexpression into one node and folds operations on constants, so a formula written as a C++ function of its inputs becomes a graph of distinct operations; compiling keeps the nodes the result depends on and gives them registers, reusing a register as soon as its last reader has run.
+/// @details evaluate() runs a program over any number of boxes. Each worker of a thread_pool takes blocks of #tape_block boxes and runs every instruction over a whole block with the batch kernels of interval_array.h and interval_math.h, so the dispatch of one instruction is paid once per block and the operation itself runs several boxes per SIMD register. A register is one block of intervals, small enough that the live registers of a formula stay in the cache.
+/// @details Results are those of the batch functions: the arithmetic operators give the end points of the interval operators bit for bit, and the elementary functions those of the batch functions of interval_math.h.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "interval.h"
+#include "interval_array.h"
+#include "parallel.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 operations
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief The boxes each instruction of a program processes at once
+inline constexpr std::size_t tape_block = 512;
+
+/// @brief The operations a tape records and a program runs
+enum class tape_op : std::uint8_t
+{
+    input,    ///< one of the inputs of the formula
+    constant, ///< an interval that is the same for every box
+    add,      ///< a + b
+    sub,      ///< a - b
+    mul,      ///< a * b
+    div,      ///< a / b
+    neg,      ///< -a
+    sqr,      ///< a^2
+    pow,      ///< a^n for an integer n
+    sqrt,     ///< square root
+    exp,      ///< e^a
+    log,      ///< natural logarithm
+    sin,      ///< sine
+    cos,      ///< cosine
+    atan,     ///< arc tangent
+    abs       ///< absolute value
+};
+
+namespace tape_detail
+{
+    /// @brief One recorded operation
+    struct node
+    {
+        tape_op op;      ///< the operation
+        std::uint32_t a; ///< the first operand node, the input index of an input or the constant index of a constant
+        std::uint32_t b; ///< the second operand node of a binary operation
+        std::int32_t n;  ///< the exponent of pow
+
+        /// @brief Compares every field, for merging repeated operations
+        friend bool operator==(node const &, node const &) = default;
+    };
+
+    /// @brief Hashes a node for the map of recorded operations
+    struct node_hash
+    {
+        /// @brief Mixes every field into one word
+        std::size_t operator()(node const &x) const noexcept
+        {
+            std::uint64_t h = (std::uint64_t(x.a) << 32 | x.b) * 0x9E3779B97F4A7C15ull;
+            return std::size_t(h ^ (h >> 29) ^ (std::uint64_t(std::uint32_t(x.n)) << 8 | std::uint64_t(x.op)));
+        }
+    };
+
+    /// @brief Applies an operation to intervals with the interval operators and functions, as recording folds constants
+    /// @details Compiled in interval_tape.cpp for float and double. An input or a constant gives a back.
+    /// @param op the operation
+    /// @param a the operand, or the first operand
+    /// @param b the second operand of a binary operation
+    /// @param n the exponent of pow
+    /// @return the result
+    template <class T>
+    basic_interval<T> fold(tape_op op, basic_interval<T> const &a, basic_interval<T> const &b, int n) noexcept;
+} // namespace tape_detail
+
+template <class T>
+class basic_tape;
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 recorded values
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief A handle to one node of a tape, used in place of an interval while a formula is recorded
+/// @details Every operator and function records one node, or finds the node that already computes the same thing, and returns its handle. A value and an interval or scalar combine with the constant as a node of its own. Values of different tapes cannot be combined.
+/// @tparam T the end point type, float or double
+/// @author George Downing
+/// @date 17-10-2026
+template <class T>
+class basic_tape_value
+{
+public:
+    /// @brief The interval type of the constants
+    using interval_type = basic_interval<T>;
+
+    /// @brief Default constructor for a handle to no node, which must be assigned before it is used
+    basic_tape_value() noexcept = default;
+
+    /// @brief Gets the tape the node belongs to
+    /// @return the tape, or nullptr for a default constructed handle
+    basic_tape<T> *tape() const noexcept { return Tape; }
+
+    /// @brief Gets the index of the node on its tape
+    /// @return the index
+    std::uint32_t node() const noexcept { return Node; }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 operators
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Records the negation of a value
+    basic_tape_value operator-() const { return Tape->record(tape_op::neg, *this); }
+
+    /// @brief Records the sum of two values
+    friend basic_tape_value operator+(basic_tape_value const &a, basic_tape_value const &b) { return a.Tape->record(tape_op::add, a, b); }
+
+    /// @brief Records the difference of two values
+    friend basic_tape_value operator-(basic_tape_value const &a, basic_tape_value const &b) { return a.Tape->record(tape_op::sub, a, b); }
+
+    /// @brief Records the product of two values
+    friend basic_tape_value operator*(basic_tape_value const &a, basic_tape_value const &b) { return a.Tape->record(tape_op::mul, a, b); }
+
+    /// @brief Records the quotient of two values
+    friend basic_tape_value operator/(basic_tape_value const &a, basic_tape_value const &b) { return a.Tape->record(tape_op::div, a, b); }
+
+    /// @brief Records the sum of a value and a constant
+    friend basic_tape_value operator+(basic_tape_value const &a, interval_type const &b) { return a + a.Tape->constant(b); }
+
+    /// @brief Records the difference of a value and a constant
+    friend basic_tape_value operator-(basic_tape_value const &a, interval_type const &b) { return a - a.Tape->constant(b); }
+
+    /// @brief Records the product of a value and a constant
+    friend basic_tape_value operator*(basic_tape_value const &a, interval_type const &b) { return a * a.Tape->constant(b); }
+
+    /// @brief Records the quotient of a value and a constant
+    friend basic_tape_value operator/(basic_tape_value const &a, interval_type const &b) { return a / a.Tape->constant(b); }
+
+    /// @brief Records the sum of a constant and a value
+    friend basic_tape_value operator+(interval_type const &a, basic_tape_value const &b) { return b.Tape->constant(a) + b; }
+
+    /// @brief Records the difference of a constant and a value
+    friend basic_tape_value operator-(interval_type const &a, basic_tape_value const &b) { return b.Tape->constant(a) - b; }
+
+    /// @brief Records the product of a constant and a value
+    friend basic_tape_value operator*(interval_type const &a, basic_tape_value const &b) { return b.Tape->constant(a) * b; }
+
+    /// @brief Records the quotient of a constant and a value
+    friend basic_tape_value operator/(interval_type const &a, basic_tape_value const &b) { return b.Tape->constant(a) / b; }
+
+    /// @brief Records the sum and makes this handle refer to it
+    basic_tape_value &operator+=(basic_tape_value const &obj) { return *this = *this + obj; }
+
+    /// @brief Records the difference and makes this handle refer to it
+    basic_tape_value &operator-=(basic_tape_value const &obj) { return *this = *this - obj; }
+
+    /// @brief Records the product and makes this handle refer to it
+    basic_tape_value &operator*=(basic_tape_value const &obj) { return *this = *this * obj; }
+
+    /// @brief Records the quotient and makes this handle refer to it
+    basic_tape_value &operator/=(basic_tape_value const &obj) { return *this = *this / obj; }
+
+private:
+    friend class basic_tape<T>;
+
+    /// @brief Constructor for a handle, used by the tape
+    basic_tape_value(basic_tape<T> *tape, std::uint32_t node) noexcept : Tape(tape), Node(node) {}
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    basic_tape<T> *Tape = nullptr; ///< The tape holding the node
+    std::uint32_t Node = 0;        ///< The index of the node
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 compiled programs
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief A compiled formula: instructions over registers that each hold one block of intervals
+/// @details A program is made by basic_tape::compile and run by evaluate; it does not refer to its tape.
+/// @tparam T the end point type, float or double
+/// @author George Downing
+/// @date 17-10-2026
+template <class T>
+class basic_tape_program
+{
+public:
+    /// @brief Where an instruction takes its operands from
+    enum class form : std::uint8_t
+    {
+        registers,      ///< a and b are registers; a unary instruction reads a only
+        right_constant, ///< a is a register and b a constant
+        left_constant   ///< a is a constant and b a register
+    };
+
+    /// @brief One instruction
+    struct instruction
+    {
+        tape_op op;        ///< the operation; input loads input a and constant fills with constant a
+        form from;         ///< the kinds of the operands
+        std::uint32_t dst; ///< the register written
+        std::uint32_t a;   ///< the first operand
+        std::uint32_t b;   ///< the second operand
+        std::int32_t n;    ///< the exponent of pow
+    };
+
+    /// @brief Default constructor for an empty program, which cannot be evaluated
+    basic_tape_program() = default;
+
+    /// @brief Gets the instructions
+    /// @return the instructions in the order they run
+    std::vector<instruction> const &code() const noexcept { return Code; }
+
+    /// @brief Gets the constants the instructions refer to
+    /// @return the constants
+    std::vector<basic_interval<T>> const &constants() const noexcept { return Constants; }
+
+    /// @brief Gets the number of inputs the program reads
+    /// @return one more than the highest input index of the tape
+    std::size_t inputs() const noexcept { return Inputs; }
+
+    /// @brief Gets the number of registers the program needs
+    /// @return the most registers live at once
+    std::size_t registers() const noexcept { return Registers; }
+
+    /// @brief Gets the register holding the result after the last instruction
+    /// @return the register index
+    std::uint32_t result() const noexcept { return Result; }
+
+private:
+    friend class basic_tape<T>;
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    std::vector<instruction> Code;            ///< The instructions
+    std::vector<basic_interval<T>> Constants; ///< The constants
+    std::size_t Inputs = 0;                   ///< The inputs read
+    std::size_t Registers = 0;                ///< The registers needed
+    std::uint32_t Result = 0;                 ///< The register of the result
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 class declaration
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Records a formula as a graph of distinct operations and compiles it
+/// @details A tape is filled by calling the formula on the handles of #input; the handles refer to the tape, so it must outlive them and must not be copied while they are used. A tape may record several formulas that share subexpressions and compile each.
+/// @tparam T the end point type, float or double
+/// @author George Downing
+/// @date 17-10-2026
+template <class T>
+class basic_tape
+{
+public:
+    /// @brief The interval type of the constants
+    using interval_type = basic_interval<T>;
+
+    /// @brief The handle type of the recorded nodes
+    using value_type = basic_tape_value<T>;
+
+    /// @brief Default constructor for an empty tape
+    basic_tape() = default;
+
+    basic_tape(basic_tape const &) = delete;            ///< handles refer to the tape, so it cannot be copied
+    basic_tape &operator=(basic_tape const &) = delete; ///< handles refer to the tape, so it cannot be assigned
+
+    /// @brief Gets the handle of one input of the formula
+    /// @param index the index of the input, the position of its array in the inputs of evaluate
+    /// @return the handle
+    value_type input(std::size_t index);
+
+    /// @brief Gets the handle of a constant
+    /// @param val the constant; equal constants share one node
+    /// @return the handle
+    value_type constant(interval_type const &val);
+
+    /// @brief Gets the number of distinct nodes recorded
+    /// @return the number of nodes
+    std::size_t size() const noexcept { return Nodes.size(); }
+
+    /// @brief Gets the number of inputs
+    /// @return one more than the highest input index recorded
+    std::size_t inputs() const noexcept { return Inputs; }
+
+    /// @brief Gets the recorded nodes, for passes over the graph such as those of basic_contractor and basic_interval_graph
+    /// @return the nodes in the order recorded, operands first
+    std::vector<tape_detail::node> const &nodes() const noexcept { return Nodes; }
+
+    /// @brief Gets the constants of the constant nodes
+    /// @return the constants, indexed by the operand a of a constant node
+    std::vector<interval_type> const &constants() const noexcept { return Constants; }
+
+    /// @brief Compiles the nodes one result depends on
+    /// @param result the handle of the result, from this tape
+    /// @return the program
+    /// @throws std::invalid_argument if result belongs to another tape
+    basic_tape_program<T> compile(value_type const &result) const;
+
+    /// @brief Records one operation, or finds the node that already computes it, folding operations on constants
+    /// @param op the operation
+    /// @param a the operand, or the first operand
+    /// @param b the second operand of a binary operation
+    /// @param n the exponent of pow
+    /// @return the handle of the node
+    /// @throws std::invalid_argument if an operand belongs to another tape
+    value_type record(tape_op op, value_type const &a, value_type const &b = {}, int n = 0);
+
+private:
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Functions
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Finds or appends a node
+    value_type intern(tape_detail::node const &x);
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    std::vector<tape_detail::node> Nodes;                                               ///< The nodes in the order recorded, operands first
+    std::vector<interval_type> Constants;                                               ///< The constant of every constant node
+    std::unordered_map<tape_detail::node, std::uint32_t, tape_detail::node_hash> Index; ///< The node of every recorded operation
+    std::map<std::pair<std::uint64_t, std::uint64_t>, std::uint32_t> ConstantIndex;     ///< The node of every constant, by the bits of its end points
+    std::size_t Inputs = 0;                                                             ///< One more than the highest input index
+};
+
+/// @brief Tape of formulas over intervals with double end points
+using tape = basic_tape<double>;
+
+/// @brief Tape of formulas over intervals with float end points
+using tapef = basic_tape<float>;
+
+/// @brief Handle to a node of a #tape
+using tape_value = basic_tape_value<double>;
+
+/// @brief Handle to a node of a #tapef
+using tape_valuef = basic_tape_value<float>;
+
+/// @brief Program compiled from a #tape
+using tape_program = basic_tape_program<double>;
+
+/// @brief Program compiled from a #tapef
+using tape_programf = basic_tape_program<float>;
+
+extern template class basic_tape<float>;  ///< compiled in interval_tape.cpp
+extern template class basic_tape<double>; ///< compiled in interval_tape.cpp
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 recorded functions
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Records the square root of a value
+template <class T>
+basic_tape_value<T> sqrt(basic_tape_value<T> const &x) { return x.tape()->record(tape_op::sqrt, x); }
+
+/// @brief Records e raised to a value
+template <class T>
+basic_tape_value<T> exp(basic_tape_value<T> const &x) { return x.tape()->record(tape_op::exp, x); }
+
+/// @brief Records the natural logarithm of a value
+template <class T>
+basic_tape_value<T> log(basic_tape_value<T> const &x) { return x.tape()->record(tape_op::log, x); }
+
+/// @brief Records the sine of a value
+template <class T>
+basic_tape_value<T> sin(basic_tape_value<T> const &x) { return x.tape()->record(tape_op::sin, x); }
+
+/// @brief Records the cosine of a value
+template <class T>
+basic_tape_value<T> cos(basic_tape_value<T> const &x) { return x.tape()->record(tape_op::cos, x); }
+
+/// @brief Records the arc tangent of a value
+template <class T>
+basic_tape_value<T> atan(basic_tape_value<T> const &x) { return x.tape()->record(tape_op::atan, x); }
+
+/// @brief Records the absolute value of a value
+template <class T>
+basic_tape_value<T> abs(basic_tape_value<T> const &x) { return x.tape()->record(tape_op::abs, x); }
+
+/// @brief Records the square of a value, tighter than x * x
+template <class T>
+basic_tape_value<T> sqr(basic_tape_value<T> const &x) { return x.tape()->record(tape_op::sqr, x); }
+
+/// @brief Records a value raised to an integer power
+template <class T>
+basic_tape_value<T> pow(basic_tape_value<T> const &x, int n) { return x.tape()->record(tape_op::pow, x, {}, n); }
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 evaluation
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Evaluates a program over every box of a batch
+/// @details Box k is (inputs[0][k], inputs[1][k], ...). The boxes are cut into blocks of #tape_block that the workers of the pool take in chunks; each worker keeps its own registers, so the result is the same whatever the number of workers.
+/// @param program the compiled formula
+/// @param inputs one view per input of the program, all the same size
+/// @param out the result for every box, made the size of the inputs
+/// @param pool the workers
+/// @throws std::invalid_argument if there are fewer views than program.inputs() or they differ in size
+template <class T>
+void evaluate(basic_tape_program<T> const &program, std::span<std::type_identity_t<basic_interval_view<T>> const> inputs, basic_interval_array<T> &out,
+              thread_pool &pool = default_pool());
@@ -0,0 +1,596 @@
+/// @file interval_text.cpp
+/// @brief Implementation of the outward rounding interval parser and formatter
+/// @author George Downing
+/// @date 17-10-2026
+/// @details This file contains from_chars, to_chars, parse_intervals and format_intervals, compiled for float and double end points. std::from_chars and std::to_chars round to nearest; the functions here decide from the decimal digits whether that nearest value is exact and step one unit in the last place outward when it is not.
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                    include files
+//---------------------------------------------------------------------------------------------------------------------
+
+#include "interval_text.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(_MSC_VER)
+#define INTERVAL_TEXT_X87 1 // long double is the 64 bit significand format of the x87 unit
+#else
+#define INTERVAL_TEXT_X87 0
+#endif
+
+namespace
+{
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 exact decimals
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief The powers of five that fit in 64 bits, 5^0 to 5^27
+    constexpr auto pow5 = []
+    {
+        std::array<std::uint64_t, 28> p{};
+        p[0] = 1;
+        for (std::size_t k = 1; k < p.size(); ++k)
+            p[k] = p[k - 1] * 5;
+        return p;
+    }();
+
+    /// @brief Checks whether m * 10^e is a value of T
+    /// @details m * 10^e = m * 5^e * 2^e, so the decimal is a binary number when, after taking out the powers of two, the rest fits in the significand of T. Exponents beyond 5^27 are reported inexact, which only costs one unit in the last place.
+    /// @param m the decimal significand
+    /// @param e the decimal exponent
+    /// @return true if the decimal is exactly a normal value of T or zero
+    template <class T>
+    bool exact_binary(std::uint64_t m, int e) noexcept
+    {
+        if (m == 0)
+            return true;
+        while (m % 10 == 0) // trailing zeros belong in the exponent
+        {
+            m /= 10;
+            ++e;
+        }
+        constexpr std::uint64_t limit = std::uint64_t(1) << std::numeric_limits<T>::digits;
+        if (e < 0 && m % 5 != 0)
+            return false; // the usual case, settled without a division by a variable
+        if (e >= 0)
+        {
+            if (e >= int(pow5.size()))
+                return false;
+            std::uint64_t odd = m >> std::countr_zero(m);
+            return odd <= (limit - 1) / pow5[e]; // odd * 5^e fits in the significand
+        }
+        if (-e >= int(pow5.size()) || m % pow5[-e] != 0)
+            return false; // 5^-e must divide m for the quotient by 10^-e to be binary
+        std::uint64_t q = m / pow5[-e];
+        return q >> std::countr_zero(q) < limit;
+    }
+
+    /// @brief Checks for the white space that separates intervals
+    constexpr bool is_space(char c) noexcept { return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f'; }
+
+    /// @brief Checks for a decimal digit
+    constexpr bool is_digit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+    /// @brief Skips white space
+    char const *skip_space(char const *p, char const *last) noexcept
+    {
+        while (p != last && is_space(*p))
+            ++p;
+        return p;
+    }
+
+    /// @brief Finds the end of a run of decimal digits
+    /// @details Eight characters are tested at once, so the length of the run, which changes from literal to literal, costs no mispredicted branch per digit. A byte of c ^ '0' above 9 either has its top bit set or sets it when 0x76 is added; a carry out of a byte only reaches later bytes, past the first non digit.
+    char const *digit_run(char const *p, char const *last) noexcept
+    {
+        if constexpr (std::endian::native == std::endian::little)
+            for (; last - p >= 8; p += 8)
+            {
+                std::uint64_t w;
+                std::memcpy(&w, p, 8);
+                w ^= 0x3030303030303030u;
+                std::uint64_t other = (w | (w + 0x7676767676767676u)) & 0x8080808080808080u; // top bit of every non digit
+                if (other != 0)
+                    return p + std::countr_zero(other) / 8;
+            }
+        while (p != last && is_digit(*p))
+            ++p;
+        return p;
+    }
+
+    /// @brief Appends a run of decimal digits to an integer, eight at a time where the run allows
+    /// @details Eight digits loaded as one little endian word are combined in three multiplications, pairing neighbours at each step, which shortens the chain of dependent multiply-adds of the digit by digit loop eightfold.
+    /// @param m the digits before the run
+    /// @param p the start of the run
+    /// @param end the end of the run
+    /// @return m followed by the digits of the run, which must fit in 64 bits
+    std::uint64_t accumulate(std::uint64_t m, char const *p, char const *end) noexcept
+    {
+        if constexpr (std::endian::native == std::endian::little)
+            for (; end - p >= 8; p += 8)
+            {
+                std::uint64_t w;
+                std::memcpy(&w, p, 8);
+                w -= 0x3030303030303030u;                                          // '0' to 0 in every byte
+                w = (w * 10 + (w >> 8)) & 0x00ff00ff00ff00ffu;                     // pairs of digits
+                w = (w * 100 + (w >> 16)) & 0x0000ffff0000ffffu;                   // groups of four
+                m = m * 100000000 + ((w * 10000 + (w >> 32)) & 0xffffffffu); // all eight
+            }
+        for (; p != end; ++p)
+            m = m * 10 + std::uint64_t(*p - '0');
+        return m;
+    }
+
+#if INTERVAL_TEXT_X87
+    /// @brief Steps a nonzero value one unit in the last place towards -inf or +inf, or leaves it
+    /// @details The step is added to the bit pattern without a branch, since whether the conversion of a parsed literal rounded up or down is as good as random. Infinities step to the largest finite value.
+    /// @tparam Up true to step towards +inf
+    /// @param t the value
+    /// @param step true to step
+    /// @return t or its neighbour
+    template <bool Up, class T>
+    T step_out(T t, bool step) noexcept
+    {
+        using bits_t = std::conditional_t<sizeof(T) == 8, std::uint64_t, std::uint32_t>;
+        bits_t b = std::bit_cast<bits_t>(t);
+        bits_t negative = b >> (8 * sizeof(T) - 1);
+        bits_t one = Up ? 1 - 2 * negative : 2 * negative - 1; // +1 or -1 modulo 2^n, moving the magnitude up or down
+        return std::bit_cast<T>(b + (one & -bits_t(step)));
+    }
+
+    /// @brief The smallest and largest power of ten kept by #pow10
+    constexpr int pow10_range = 350;
+
+    /// @brief Gets 10^j for |j| <= #pow10_range, each rounded to nearest in long double, so exact up to 10^27
+    /// @param j the exponent
+    /// @return 10^j
+    long double pow10(int j) noexcept
+    {
+        static std::array<long double, 2 * pow10_range + 1> const table = []
+        {
+            std::array<long double, 2 * pow10_range + 1> t{};
+            char literal[8];
+            for (int k = -pow10_range; k <= pow10_range; ++k)
+            {
+                literal[0] = '1';
+                literal[1] = 'e';
+                *std::to_chars(literal + 2, literal + sizeof(literal) - 1, k).ptr = '\0';
+                t[k + pow10_range] = std::strtold(literal, nullptr); // correctly rounded, unlike repeated products
+            }
+            return t;
+        }();
+        return table[j + pow10_range];
+    }
+#endif
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 parsing
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Parses one end point, rounded down or up unless the literal is exactly a value of T
+    /// @details A plain decimal of at most 19 significant digits and a decimal exponent of at most 27 is m * 10^e or m / 10^-e with both operands exact in long double, so one long double operation gives a value within one long double unit of the literal in any rounding mode. Converting that outward to T is tighter than stepping from the nearest T and needs no call of std::from_chars. Longer literals, inf, nan and targets without an x87 unit go through std::from_chars.
+    /// @param p the start of the literal
+    /// @param last the end of the text
+    /// @tparam Up true for an upper end point
+    /// @param out the end point
+    /// @return one past the literal, or nullptr if there is none or it is NaN
+    template <bool Up, class T>
+    char const *parse_end(char const *p, char const *last, T &out) noexcept
+    {
+        if (p != last && *p == '+' && last - p > 1 && p[1] != '-')
+            ++p; // std::from_chars rejects a plus sign
+        char const *q = p;
+        bool negative = q != last && *q == '-';
+        q += negative;
+
+        char const *int_end = digit_run(q, last); // the integer digits are [q, int_end)
+        char const *frac = int_end, *frac_end = int_end;
+        if (int_end != last && *int_end == '.')
+            frac_end = digit_run(frac = int_end + 1, last); // the fraction digits are [frac, frac_end)
+        bool any = int_end != q || frac_end != frac;
+
+        std::uint64_t m = 0;  // the leading significant digits
+        int e = 0;            // the decimal exponent of the last digit kept in m
+        int kept = 0;         // the number of digits in m, leading zeros aside
+        bool dropped = false; // true if a nonzero digit did not fit in m
+        if ((int_end - q) + (frac_end - frac) <= 19) // 10^19 fits in 64 bits, the usual case
+        {
+            m = accumulate(accumulate(0, q, int_end), frac, frac_end);
+            e = -int(frac_end - frac);
+        }
+        else
+        {
+            auto digit = [&](char c, bool fraction)
+            {
+                if (kept < 19)
+                {
+                    m = m * 10 + std::uint64_t(c - '0');
+                    kept += m != 0;
+                    e -= fraction;
+                }
+                else
+                {
+                    dropped |= c != '0';
+                    e += !fraction;
+                }
+            };
+            for (char const *c = q; c != int_end; ++c)
+                digit(*c, false);
+            for (char const *c = frac; c != frac_end; ++c)
+                digit(*c, true);
+        }
+        q = frac_end;
+        if (!any) // inf, nan or not a number at all
+        {
+            T v;
+            auto [end, ec] = std::from_chars(p, last, v);
+            if (ec != std::errc{} || v != v)
+                return nullptr;
+            out = v;
+            return end;
+        }
+        if (q != last && (*q == 'e' || *q == 'E'))
+        {
+            char const *r = q + 1;
+            bool down = r != last && *r == '-';
+            r += r != last && (*r == '-' || *r == '+');
+            if (r != last && is_digit(*r)) // otherwise the 'e' is not part of the literal
+            {
+                int x = 0;
+                for (; r != last && is_digit(*r); ++r)
+                    x = std::min(x * 10 + (*r - '0'), 100000); // far beyond the range of T
+                e += down ? -x : x;
+                q = r;
+            }
+        }
+        bool exact = !dropped && exact_binary<T>(m, e);
+
+#if INTERVAL_TEXT_X87
+        if (!dropped && e >= -27 && e <= 27)
+        {
+            long double y = e < 0 ? static_cast<long double>(m) / pow10(-e) : static_cast<long double>(m) * pow10(e);
+            y = negative ? -y : y;
+            T t = static_cast<T>(y);
+            // a literal that is not a T lies within a long double unit of y, so on the far side of t unless t is strictly beyond y
+            bool step = !exact && (Up ? static_cast<long double>(t) <= y : static_cast<long double>(t) >= y);
+            out = step_out<Up>(t, step);
+            return q;
+        }
+#endif
+        T v;
+        auto [end, ec] = std::from_chars(p, last, v);
+        if (ec == std::errc::result_out_of_range) // std::from_chars leaves v unset
+        {
+            int leading = e - 1; // the leading digit of m is at 10^leading
+            for (std::uint64_t t = m; t != 0; t /= 10)
+                ++leading;
+            bool overflow = leading >= 0;
+            T big = overflow ? std::numeric_limits<T>::max() : T(0);
+            T small = overflow ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::denorm_min();
+            out = negative ? (Up ? -big : -small) : (Up ? small : big); // the magnitude lies between big and small
+            return end;
+        }
+        if (exact)
+            out = v;
+        else
+            out = Up ? rounding::next_up(v) : rounding::next_down(v); // v is within half a unit of the literal
+        return end;
+    }
+
+    /// @brief Parses one interval in "[a, b]", "a b" or "a,b" form
+    /// @param p the start of the text, white space is skipped
+    /// @param last the end of the text
+    /// @param lo the lower end point
+    /// @param hi the upper end point
+    /// @return one past the interval, or nullptr if it is malformed
+    template <class T>
+    char const *parse_interval(char const *p, char const *last, T &lo, T &hi) noexcept
+    {
+        p = skip_space(p, last);
+        bool bracket = p != last && *p == '[';
+        if (bracket)
+            p = skip_space(p + 1, last);
+        if (p == last || !(p = parse_end<false>(p, last, lo)))
+            return nullptr;
+        char const *sep = p;
+        p = skip_space(p, last);
+        if (p != last && *p == ',')
+            p = skip_space(p + 1, last);
+        if (p == sep || p == last || !(p = parse_end<true>(p, last, hi)))
+            return nullptr; // the end points must be separated
+        if (bracket)
+        {
+            p = skip_space(p, last);
+            if (p == last || *p != ']')
+                return nullptr;
+            ++p;
+        }
+        return lo <= hi ? p : nullptr;
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 formatting
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief The longest end point written with some number of digits: sign, digits, point, and "e+308"
+    constexpr int end_chars(int digits) noexcept { return digits + 8; }
+
+    /// @brief The longest interval written: brackets, comma and space around two end points
+    constexpr int interval_chars(int digits) noexcept { return 2 * end_chars(digits) + 4; }
+
+    /// @brief Finds the leading significant digits of a positive value with std::to_chars
+    /// @details std::to_chars rounds to nearest. Printing two more digits than kept shows on which side of the kept digits the value lies, except when the two extra digits are 00: then the value is either exactly the printed decimal, which exact_binary confirms, or so close to it that only the exact expansion decides.
+    /// @param a the magnitude, positive and finite
+    /// @param digits the significant digits
+    /// @param d set to the digits, at least digits + 2 long
+    /// @param x set to the decimal exponent of the first digit
+    /// @param tail set to true if the value lies strictly above the digits
+    template <class T>
+    void guard_digits(T a, int digits, char *d, int &x, bool &tail) noexcept
+    {
+        char s[40];
+        char *e = std::to_chars(s, s + sizeof(s), a, std::chars_format::scientific, digits + 1).ptr;
+        char *mark = std::find(s, e, 'e');
+        x = 0;
+        std::from_chars(mark + 1 + (mark[1] == '+'), e, x);
+        d[0] = s[0];
+        std::memcpy(d + 1, s + 2, digits + 1); // the kept and the two extra digits
+        if (d[digits] != '0' || d[digits + 1] != '0')
+            tail = true;
+        else
+        {
+            std::uint64_t m = 0;
+            for (int i = 0; i < digits + 2; ++i)
+                m = m * 10 + std::uint64_t(d[i] - '0');
+            T back;
+            std::from_chars(s, e, back);
+            if (back == a && exact_binary<T>(m, x - digits - 1))
+                tail = false; // the printed decimal is the value
+            else
+            {
+                char big[800]; // every float and double expands exactly in fewer than 770 digits
+                char *be = std::to_chars(big, big + sizeof(big), a, std::chars_format::scientific, 780).ptr;
+                char *bmark = std::find(big, be, 'e');
+                x = 0;
+                std::from_chars(bmark + 1 + (bmark[1] == '+'), be, x);
+                d[0] = big[0];
+                std::memcpy(d + 1, big + 2, digits - 1);
+                tail = std::find_if(big + 1 + digits, bmark, [](char c) { return c != '0'; }) != bmark;
+            }
+        }
+    }
+
+#if INTERVAL_TEXT_X87
+    /// @brief "00" to "99", written two digits at a time
+    constexpr char digit_pairs[] = "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+                                   "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+                                   "8081828384858687888990919293949596979899";
+
+    /// @brief Finds the leading significant digits of a positive normal value from one long double product
+    /// @details a * 10^j for the j that leaves digits figures before the point carries two roundings of at most 2^-64 each, far less than a unit of a 17 digit integer. A fraction clear of the error bound shows the digits and that the value lies above them; a product within the bound of an integer that exact_binary finds to be the value shows an exact decimal. Anything else is left to the exact expansion.
+    /// @param a the magnitude, positive, finite and normal
+    /// @param digits the significant digits, at most 17
+    /// @param d set to the digits
+    /// @param x set to the decimal exponent of the first digit
+    /// @param tail set to true if the value lies strictly above the digits
+    /// @return false if the product could not decide
+    template <class T>
+    bool product_digits(T a, int digits, char *d, int &x, bool &tail) noexcept
+    {
+        using bits_t = std::conditional_t<sizeof(T) == 8, std::uint64_t, std::uint32_t>;
+        constexpr int mantissa = std::numeric_limits<T>::digits - 1;
+        int b = int(std::bit_cast<bits_t>(a) >> mantissa) - (std::numeric_limits<T>::max_exponent - 1); // ilogb of a normal value
+        int k = (b * 78913) >> 18; // floor(b * log10(2)), so 10^k <= a < 10^(k+2)
+        int j = digits - 1 - k;
+        std::uint64_t const lowest = pow5[digits - 1] << (digits - 1); // 10^(digits - 1)
+        long double s = static_cast<long double>(a) * pow10(j);
+        if (s >= static_cast<long double>(10 * lowest))
+        {
+            ++k;
+            --j;
+            s = static_cast<long double>(a) * pow10(j);
+        }
+        long double margin = s * 0x1p-62L; // twice the error of the two roundings
+        std::uint64_t n = static_cast<std::uint64_t>(s);
+        long double frac = s - static_cast<long double>(n);
+        if (frac > margin && frac < 1.0L - margin)
+            tail = true;
+        else
+        {
+            n += frac >= 0.5L;
+            if (!exact_binary<T>(n, -j))
+                return false; // too close to a decimal that is not the value to tell the side
+            tail = false;
+        }
+        if (n < lowest || n >= 10 * lowest)
+            return false; // the exponent estimate was off at a power of ten
+        int i = digits;
+        for (; i >= 2; i -= 2) // two digits per division
+        {
+            std::memcpy(d + i - 2, digit_pairs + 2 * (n % 100), 2);
+            n /= 100;
+        }
+        if (i)
+            d[0] = char('0' + n);
+        x = k;
+        return true;
+    }
+#endif
+
+    /// @brief Writes one end point rounded to a number of significant digits towards -inf or +inf
+    /// @details On x87 one long double product finds the digits of nearly every normal value; the rest go through std::to_chars.
+    /// @param p the buffer, at least end_chars(digits) long
+    /// @param v the end point
+    /// @param digits the significant digits
+    /// @param up true to round towards +inf
+    /// @return one past the text written
+    template <class T>
+    char *format_end(char *p, T v, int digits, bool up) noexcept
+    {
+        if (v == T(0) || !(v - v == T(0))) // zero and infinities are printed as they are
+            return std::to_chars(p, p + end_chars(digits), v, std::chars_format::scientific, digits - 1).ptr;
+        bool negative = std::signbit(v);
+        bool away = up != negative; // round the magnitude up
+        T a = negative ? -v : v;
+
+        int x = 0;
+        char d[24]; // the significant digits without the point
+        bool tail;  // true if the value lies strictly above the kept digits
+#if INTERVAL_TEXT_X87
+        if (!std::isnormal(a) || !product_digits(a, digits, d, x, tail))
+#endif
+            guard_digits(a, digits, d, x, tail);
+        if (away && tail) // add one unit in the last kept place
+        {
+            int i = digits - 1;
+            while (i >= 0 && d[i] == '9')
+                d[i--] = '0';
+            if (i >= 0)
+                ++d[i];
+            else
+            {
+                d[0] = '1'; // 9.99 became 10.0
+                ++x;
+            }
+        }
+
+        *p++ = '-';
+        p -= !negative;
+        *p++ = d[0];
+        if (digits > 1)
+        {
+            *p++ = '.';
+            std::memcpy(p, d + 1, digits - 1);
+            p += digits - 1;
+        }
+        *p++ = 'e';
+        *p++ = x < 0 ? '-' : '+';
+        int ax = x < 0 ? -x : x;
+        if (ax < 10)
+            *p++ = '0'; // at least two exponent digits, as std::to_chars
+        return std::to_chars(p, p + 4, ax).ptr;
+    }
+
+    /// @brief Writes one interval as "[a, b]"
+    /// @param p the buffer, at least interval_chars(digits) long
+    template <class T>
+    char *format_interval(char *p, T lo, T hi, int digits) noexcept
+    {
+        *p++ = '[';
+        p = format_end(p, lo, digits, false);
+        *p++ = ',';
+        *p++ = ' ';
+        p = format_end(p, hi, digits, true);
+        *p++ = ']';
+        return p;
+    }
+
+    /// @brief Checks a number of significant digits
+    template <class T>
+    constexpr bool valid_digits(int digits) noexcept { return digits >= 1 && digits <= std::numeric_limits<T>::max_digits10; }
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 single intervals
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details The interval is built from end points already rounded outward, so the rounding policy plays no part.
+template <class T, class Rounding>
+std::from_chars_result from_chars(char const *first, char const *last, basic_interval<T, Rounding> &x) noexcept
+{
+    T lo, hi;
+    char const *p = parse_interval(first, last, lo, hi);
+    if (!p)
+        return {first, std::errc::invalid_argument};
+    x = basic_interval<T, Rounding>(lo, hi);
+    return {p, std::errc{}};
+}
+
+/// @details The text is built in a local buffer, so nothing is written past last when the buffer is too short.
+template <class T, class Rounding>
+std::to_chars_result to_chars(char *first, char *last, basic_interval<T, Rounding> const &x, int digits) noexcept
+{
+    if (!valid_digits<T>(digits))
+        return {first, std::errc::invalid_argument};
+    char buf[interval_chars(std::numeric_limits<double>::max_digits10)];
+    char *end = format_interval(buf, x.min(), x.max(), digits);
+    if (end - buf > last - first)
+        return {last, std::errc::value_too_large};
+    std::memcpy(first, buf, end - buf);
+    return {first + (end - buf), std::errc{}};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 whole buffers
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details The array is sized from the number of lines before parsing, so one interval per line is read without reallocating.
+template <class T>
+void parse_intervals(std::string_view text, basic_interval_array<T> &out)
+{
+    char const *p = text.data(), *last = p + text.size();
+    out = basic_interval_array<T>::for_overwrite(std::size_t(std::count(p, last, '\n')) + 1);
+    std::size_t n = 0;
+    while ((p = skip_space(p, last)) != last)
+    {
+        if (n == out.size())
+            out.resize(2 * n); // more than one interval on some line
+        T lo, hi;
+        char const *q = parse_interval(p, last, lo, hi);
+        if (!q || (q != last && !is_space(*q)))
+            throw std::invalid_argument("parse_intervals: malformed interval on line " + std::to_string(1 + std::count(text.data(), p, '\n')));
+        out.lo()[n] = lo;
+        out.hi()[n] = hi;
+        ++n;
+        p = q;
+    }
+    out.resize(n);
+}
+
+/// @details The string grows once by the longest possible text and is then cut to what was written.
+template <class T>
+void format_intervals(basic_interval_view<T> v, std::string &out, int digits)
+{
+    if (!valid_digits<T>(digits))
+        throw std::invalid_argument("format_intervals: digits out of range");
+    std::size_t start = out.size();
+    out.resize(start + v.size() * (interval_chars(digits) + 1));
+    char *p = out.data() + start;
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        p = format_interval(p, v.lo()[i], v.hi()[i], digits);
+        *p++ = '\n';
+    }
+    out.resize(std::size_t(p - out.data()));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 explicit instantiations
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Instantiates from_chars and to_chars for one end point type and rounding policy
+#define INTERVAL_TEXT_INSTANTIATE_POLICY(T, P)                                                                      \
+    template std::from_chars_result from_chars(char const *, char const *, basic_interval<T, rounding::P> &) noexcept; \
+    template std::to_chars_result to_chars(char *, char *, basic_interval<T, rounding::P> const &, int) noexcept;
+
+/// @brief Instantiates every function for one end point type
+#define INTERVAL_TEXT_INSTANTIATE(T)                                                   \
+    INTERVAL_TEXT_INSTANTIATE_POLICY(T, fast)                                          \
+    INTERVAL_TEXT_INSTANTIATE_POLICY(T, widen)                                         \
+    INTERVAL_TEXT_INSTANTIATE_POLICY(T, switched)                                      \
+    INTERVAL_TEXT_INSTANTIATE_POLICY(T, scoped)                                        \
+    template void parse_intervals(std::string_view, basic_interval_array<T> &);        \
+    template void format_intervals(basic_interval_view<T>, std::string &, int);
+
+INTERVAL_TEXT_INSTANTIATE(float)
+INTERVAL_TEXT_INSTANTIATE(double)
+
+#undef INTERVAL_TEXT_INSTANTIATE
+#undef INTERVAL_TEXT_INSTANTIATE_POLICY
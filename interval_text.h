@@ -0,0 +1,70 @@
+/// @file interval_text.h
+/// @brief Fast text parsing and formatting of intervals, rounded outward, built on std::from_chars and std::to_chars
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares from_chars and to_chars for single intervals and parse_intervals and format_intervals for whole buffers of them. Unlike the stream operators of interval.h they ignore the locale, take no locks and never allocate per interval.
+/// @details A decimal end point is rarely a binary number, so a parsed lower end point is rounded down and an upper one up, and the interval always contains the written values. Literals that are exact binary numbers, such as 0.5, 3 or 1e10, are stored exactly. A formatted lower end point is likewise rounded down to the requested number of significant digits and an upper one up, so that parsing the text again gives an interval containing the original.
+/// @details Both forms written by people and tools are accepted: "[a, b]" as printed by operator<<, and "a b" or "a,b" as read by operator>> and found in CSV files. Intervals are separated by any white space, usually one per line.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "interval_array.h"
+
+#include <charconv>
+#include <limits>
+#include <string>
+#include <string_view>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 single intervals
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Parses one interval from the start of a character range
+/// @details White space before the interval is skipped. Each end point is any literal std::from_chars accepts in general format, optionally preceded by '+'.
+/// @param first the start of the text
+/// @param last the end of the text
+/// @param x set to the interval enclosing the written end points, unchanged on error
+/// @return one past the interval read and std::errc{}, or first and std::errc::invalid_argument if the text is not an interval, has a NaN end point or a lower end point above the upper one
+template <class T, class Rounding>
+std::from_chars_result from_chars(char const *first, char const *last, basic_interval<T, Rounding> &x) noexcept;
+
+/// @brief Writes one interval as "[a, b]" with each end point rounded outward to a number of significant digits
+/// @param first the start of the buffer
+/// @param last the end of the buffer
+/// @param x the interval
+/// @param digits the significant digits of each end point, 1 to std::numeric_limits<T>::max_digits10
+/// @return one past the text written and std::errc{}, last and std::errc::value_too_large if the buffer is too short, or first and std::errc::invalid_argument if digits is out of range
+template <class T, class Rounding>
+std::to_chars_result to_chars(char *first, char *last, basic_interval<T, Rounding> const &x, int digits = std::numeric_limits<T>::max_digits10) noexcept;
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 whole buffers
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Parses every interval of a buffer into an array
+/// @param text the intervals separated by white space
+/// @param out replaced by the intervals, in order
+/// @throws std::invalid_argument naming the line of the first malformed interval, in which case out is unspecified
+template <class T>
+void parse_intervals(std::string_view text, basic_interval_array<T> &out);
+
+/// @brief Appends every interval of a view or an array to a string, one "[a, b]" per line
+/// @param v the intervals
+/// @param out the string to append to
+/// @param digits the significant digits of each end point, 1 to std::numeric_limits<T>::max_digits10
+/// @throws std::invalid_argument if digits is out of range
+template <class T>
+void format_intervals(basic_interval_view<T> v, std::string &out, int digits = std::numeric_limits<T>::max_digits10);
+
+/// @brief Appends every interval of an array to a string, one "[a, b]" per line
+/// @param a the intervals
+/// @param out the string to append to
+/// @param digits the significant digits of each end point, 1 to std::numeric_limits<T>::max_digits10
+/// @throws std::invalid_argument if digits is out of range
+template <class T>
+void format_intervals(basic_interval_array<T> const &a, std::string &out, int digits = std::numeric_limits<T>::max_digits10)
+{
+    format_intervals(basic_interval_view<T>(a), out, digits); // the view overload cannot deduce T from an array
+}
@@ -0,0 +1,368 @@
+/// @file optimize.h
+/// @brief Parallel branch and bound global minimisation over interval boxes
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares minimize, which encloses the global minimum of a function over a box by evaluating the function in interval arithmetic. A box whose lower bound exceeds the best upper bound found so far, the incumbent, cannot hold the minimum and is discarded; every other box is bisected along its widest side until it is narrower than a tolerance.
+/// @details The workers of a thread_pool share the search. Each worker keeps its boxes in its own heap ordered by lower bound and takes the best box of another worker when its heap is empty. The incumbent is one atomic value that every worker lowers with a compare and swap. Boxes are carved out of slabs by a box_pool per worker, so the search makes no allocation per box.
+/// @details The enclosure is rigorous when the interval type rounds outward, as under rounding::widen, switched or scoped; under rounding::fast it is only as good as round to nearest.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 box allocation
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief A free list allocator for boxes of a fixed number of intervals
+/// @details Boxes are cut from slabs of many boxes and released boxes are reused before a new one is cut. The pool is not thread safe: each worker owns one. A box may be released to a different pool than the one it came from, since all memory is kept until every pool of a search is destroyed.
+/// @tparam I the interval type of each side of a box
+/// @author George Downing
+/// @date 17-10-2026
+template <class I>
+class box_pool
+{
+public:
+    /// @brief Constructor for a pool of boxes
+    /// @param dim the number of intervals per box, at least one
+    /// @param per_slab the number of boxes cut from each slab
+    explicit box_pool(std::size_t dim, std::size_t per_slab = 4096) : Dim(dim), PerSlab(per_slab) {}
+
+    box_pool(box_pool const &) = delete;            ///< a pool cannot be copied
+    box_pool &operator=(box_pool const &) = delete; ///< a pool cannot be assigned
+
+    /// @brief Gets a box, reusing a released one when there is one
+    /// @return dim() uninitialised intervals
+    I *allocate()
+    {
+        if (Free)
+        {
+            std::byte *box = Free;
+            Free = *std::launder(reinterpret_cast<std::byte **>(box)); // the next free box is stored in the first bytes
+            return std::launder(reinterpret_cast<I *>(box));
+        }
+        if (Used == PerSlab || Slabs.empty())
+        {
+            Slabs.push_back(std::make_unique_for_overwrite<std::byte[]>(Dim * PerSlab * sizeof(I))); // one allocation per slab
+            Used = 0;
+        }
+        return std::launder(reinterpret_cast<I *>(Slabs.back().get() + Dim * sizeof(I) * Used++));
+    }
+
+    /// @brief Releases a box for reuse
+    /// @param box a box from any pool of the same search
+    void deallocate(I *box) noexcept
+    {
+        std::byte *raw = reinterpret_cast<std::byte *>(box);
+        ::new (static_cast<void *>(raw)) std::byte *(Free); // link the box in front of the free list
+        Free = raw;
+    }
+
+    /// @brief Gets the number of intervals per box
+    /// @return the dimension
+    std::size_t dim() const noexcept { return Dim; }
+
+    /// @brief Gets the number of slabs allocated so far
+    /// @return the number of slabs
+    std::size_t slabs() const noexcept { return Slabs.size(); }
+
+private:
+    static_assert(sizeof(I) >= sizeof(std::byte *) && std::is_trivially_copyable_v<I>, "a free box must have room for the link");
+    static_assert(alignof(I) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "a slab of bytes must be aligned for the intervals");
+
+    std::size_t Dim;                                 ///< The number of intervals per box
+    std::size_t PerSlab;                             ///< The number of boxes per slab
+    std::size_t Used = 0;                            ///< The number of boxes cut from the last slab
+    std::byte *Free = nullptr;                       ///< The most recently released box, whose first bytes hold the link to the next
+    std::vector<std::unique_ptr<std::byte[]>> Slabs; ///< Every slab, raw storage released with the pool
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 options and results
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Stopping rules of minimize
+struct minimize_options
+{
+    double x_tolerance = 1e-6;          ///< a box whose every side is narrower is not bisected
+    double f_tolerance = 1e-9;          ///< a box whose lower bound is this close to the best upper bound is not bisected
+    std::size_t max_boxes = 100000000;  ///< the search stops after this many evaluations over boxes
+};
+
+/// @brief The outcome of minimize
+/// @tparam I the interval type
+template <class I>
+struct minimize_result
+{
+    I minimum;                                     ///< encloses the global minimum of f over the box
+    std::vector<typename I::value_type> argmin;    ///< the point with the lowest upper bound of f found
+    std::size_t boxes = 0;                         ///< the number of evaluations of f over a box
+    std::size_t candidates = 0;                    ///< the boxes left at the tolerance that may hold the minimum
+    double seconds = 0.0;                          ///< the wall clock time of the search
+    bool complete = true;                          ///< false if max_boxes stopped the search early
+
+    /// @brief Gets the search throughput
+    /// @return boxes evaluated per second
+    double boxes_per_second() const noexcept { return seconds > 0 ? double(boxes) / seconds : 0.0; }
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 search
+//---------------------------------------------------------------------------------------------------------------------
+
+namespace optimize_detail
+{
+    /// @brief Lowers an atomic value to x if x is smaller
+    /// @param target the value to lower
+    /// @param x the candidate value
+    /// @return true if target was lowered
+    template <class T>
+    bool lower_to(std::atomic<T> &target, T x) noexcept
+    {
+        T current = target.load(std::memory_order_relaxed);
+        while (x < current)
+            if (target.compare_exchange_weak(current, x, std::memory_order_relaxed))
+                return true;
+        return false;
+    }
+
+    /// @brief A box waiting in a heap, ordered by the lower bound of f over it
+    template <class I>
+    struct entry
+    {
+        typename I::value_type lower; ///< the lower bound of f over the box
+        I *box;                       ///< the sides of the box, from a box_pool
+
+        /// @brief Orders a max heap so that its top holds the smallest lower bound
+        friend bool operator<(entry const &a, entry const &b) noexcept { return a.lower > b.lower; }
+    };
+
+    /// @brief The heap of one worker, on its own cache lines
+    template <class I>
+    struct alignas(64) shard
+    {
+        std::mutex Mutex;             ///< Guards Heap
+        std::vector<entry<I>> Heap;   ///< The boxes of this worker, best first
+    };
+
+    /// @brief State shared by the workers of one search
+    template <class I>
+    struct search
+    {
+        using T = typename I::value_type;
+
+        std::size_t dim;                                 ///< the number of sides of a box
+        minimize_options options;                        ///< the stopping rules
+        std::unique_ptr<shard<I>[]> shards;              ///< one heap per worker
+        std::size_t workers;                             ///< the number of shards
+        std::atomic<T> incumbent{std::numeric_limits<T>::infinity()}; ///< the lowest upper bound of f found
+        std::atomic<T> candidate_lower{std::numeric_limits<T>::infinity()}; ///< the lowest lower bound of f over a candidate box
+        std::atomic<std::size_t> outstanding{0};         ///< boxes in a heap or being bisected
+        std::atomic<std::size_t> boxes{0};               ///< evaluations of f over a box
+        std::atomic<std::size_t> candidates{0};          ///< boxes left at the tolerance
+        std::atomic<bool> stop{false};                   ///< set once max_boxes is reached
+        std::mutex argmin_mutex;                         ///< Guards argmin
+        std::vector<T> argmin;                           ///< the point that gave the incumbent
+
+        /// @brief Pushes a box onto the heap of a worker
+        void push(std::size_t w, entry<I> e)
+        {
+            std::lock_guard<std::mutex> lock(shards[w].Mutex);
+            shards[w].Heap.push_back(e);
+            std::push_heap(shards[w].Heap.begin(), shards[w].Heap.end());
+        }
+
+        /// @brief Pops the best box of a worker's heap
+        /// @return false if the heap is empty
+        bool pop(std::size_t w, entry<I> &e)
+        {
+            std::lock_guard<std::mutex> lock(shards[w].Mutex);
+            std::vector<entry<I>> &heap = shards[w].Heap;
+            if (heap.empty())
+                return false;
+            std::pop_heap(heap.begin(), heap.end());
+            e = heap.back();
+            heap.pop_back();
+            return true;
+        }
+
+        /// @brief Pops a box from the worker's own heap or else from the next non empty one
+        /// @return false if every heap is empty
+        bool next(std::size_t w, entry<I> &e)
+        {
+            for (std::size_t k = 0; k < workers; ++k)
+                if (pop((w + k) % workers, e))
+                    return true;
+            return false;
+        }
+    };
+
+    /// @brief Evaluates f over a box and at its midpoint, lowering the incumbent with the midpoint value
+    /// @param s the search
+    /// @param f the function
+    /// @param box the box
+    /// @param point scratch space of dim intervals
+    /// @return the enclosure of f over the box
+    template <class I, class F>
+    I bound(search<I> &s, F &f, I const *box, I *point)
+    {
+        using T = typename I::value_type;
+        std::span<I const> sides(box, s.dim);
+        I range = f(sides);
+        s.boxes.fetch_add(1, std::memory_order_relaxed);
+        for (std::size_t k = 0; k < s.dim; ++k)
+            point[k] = I(box[k].min() + (box[k].max() - box[k].min()) / 2); // any point of the box gives an upper bound
+        T upper = f(std::span<I const>(point, s.dim)).max();
+        if (lower_to(s.incumbent, upper))
+        {
+            std::lock_guard<std::mutex> lock(s.argmin_mutex);
+            if (upper <= s.incumbent.load(std::memory_order_relaxed)) // still the best after taking the lock
+                for (std::size_t k = 0; k < s.dim; ++k)
+                    s.argmin[k] = point[k].min();
+        }
+        return range;
+    }
+
+    /// @brief Files a bounded box: discards it, records it as a candidate, or queues it for bisection
+    /// @param s the search
+    /// @param pool the pool of the calling worker
+    /// @param w the calling worker
+    /// @param box the box, owned by the search from here on
+    /// @param range the enclosure of f over it
+    template <class I>
+    void file(search<I> &s, box_pool<I> &pool, std::size_t w, I *box, I const &range)
+    {
+        using T = typename I::value_type;
+        if (range.min() > s.incumbent.load(std::memory_order_relaxed))
+        {
+            pool.deallocate(box); // cannot hold the minimum
+            return;
+        }
+        T width = 0;
+        for (std::size_t k = 0; k < s.dim; ++k)
+            width = std::max(width, box[k].max() - box[k].min());
+        if (width <= s.options.x_tolerance || range.min() >= s.incumbent.load(std::memory_order_relaxed) - s.options.f_tolerance)
+        {
+            lower_to(s.candidate_lower, range.min()); // small enough, its lower bound joins the enclosure
+            s.candidates.fetch_add(1, std::memory_order_relaxed);
+            pool.deallocate(box);
+            return;
+        }
+        s.outstanding.fetch_add(1, std::memory_order_relaxed);
+        s.push(w, {range.min(), box});
+    }
+
+    /// @brief The loop of one worker: pops the best box, bisects it along its widest side and files both halves
+    /// @param s the search
+    /// @param f the function, called concurrently by every worker
+    /// @param pool the pool of this worker
+    /// @param w the worker number
+    template <class I, class F>
+    void worker(search<I> &s, F &f, box_pool<I> &pool, std::size_t w)
+    {
+        std::vector<I> point(s.dim);
+        entry<I> e;
+        while (!s.stop.load(std::memory_order_relaxed))
+        {
+            if (!s.next(w, e))
+            {
+                if (s.outstanding.load(std::memory_order_acquire) == 0)
+                    return; // no heap holds a box and no worker is bisecting one
+                std::this_thread::yield(); // another worker is about to push halves
+                continue;
+            }
+            if (e.lower > s.incumbent.load(std::memory_order_relaxed))
+            {
+                pool.deallocate(e.box); // the incumbent dropped below it while it waited
+                s.outstanding.fetch_sub(1, std::memory_order_release);
+                continue;
+            }
+
+            std::size_t split = 0; // the widest side
+            for (std::size_t k = 1; k < s.dim; ++k)
+                if (e.box[k].max() - e.box[k].min() > e.box[split].max() - e.box[split].min())
+                    split = k;
+            I side = e.box[split];
+            auto mid = side.min() + (side.max() - side.min()) / 2;
+
+            I *left = pool.allocate(), *right = pool.allocate();
+            std::copy_n(e.box, s.dim, left);
+            std::copy_n(e.box, s.dim, right);
+            left[split] = I(side.min(), mid);
+            right[split] = I(mid, side.max());
+            pool.deallocate(e.box);
+            file(s, pool, w, left, bound(s, f, left, point.data()));
+            file(s, pool, w, right, bound(s, f, right, point.data()));
+            s.outstanding.fetch_sub(1, std::memory_order_release); // after the halves are counted, so the count never falsely reaches zero
+
+            if (s.boxes.load(std::memory_order_relaxed) >= s.options.max_boxes)
+                s.stop.store(true, std::memory_order_relaxed);
+        }
+    }
+} // namespace optimize_detail
+
+/// @brief Encloses the global minimum of f over a box by parallel branch and bound
+/// @details f is called concurrently from every worker of the pool with a std::span of the sides of a box and must return an enclosure of its range over that box. A point is passed as a box of single point intervals.
+/// @param f the function to minimise
+/// @param box the sides of the search box, one interval per variable
+/// @param options the stopping rules
+/// @param pool the workers
+/// @return the enclosure of the minimum, the best point found and search statistics
+template <class I, class F>
+minimize_result<I> minimize(F &&f, std::vector<I> const &box, minimize_options const &options = {}, thread_pool &pool = default_pool())
+{
+    using T = typename I::value_type;
+    if (box.empty())
+        throw std::invalid_argument("minimize: the box has no sides");
+    auto start = std::chrono::steady_clock::now();
+
+    optimize_detail::search<I> s;
+    s.dim = box.size();
+    s.options = options;
+    s.workers = pool.size();
+    s.shards = std::make_unique<optimize_detail::shard<I>[]>(s.workers);
+    s.argmin.resize(s.dim);
+    for (std::size_t i = 0; i < s.dim; ++i)
+        s.argmin[i] = box[i].min() + (box[i].max() - box[i].min()) / 2; // the midpoint of each side until a point improves on it
+    std::vector<std::unique_ptr<box_pool<I>>> pools(s.workers);
+    for (auto &p : pools)
+        p = std::make_unique<box_pool<I>>(s.dim);
+
+    std::vector<I> point(s.dim);
+    I *root = pools[0]->allocate();
+    std::copy(box.begin(), box.end(), root);
+    optimize_detail::file(s, *pools[0], 0, root, optimize_detail::bound(s, f, root, point.data()));
+
+    pool.run(s.workers, [&](std::size_t w)
+             { optimize_detail::worker(s, f, *pools[w], w); },
+             false); // one long running chunk per worker
+
+    minimize_result<I> result;
+    T lower = s.candidate_lower.load();
+    for (std::size_t w = 0; w < s.workers; ++w)
+        for (optimize_detail::entry<I> const &e : s.shards[w].Heap)
+            lower = std::min(lower, e.lower); // boxes left by an early stop may still hold the minimum
+    result.minimum = I(std::min(lower, s.incumbent.load()), s.incumbent.load());
+    result.argmin = std::move(s.argmin);
+    result.boxes = s.boxes.load();
+    result.candidates = s.candidates.load();
+    result.complete = !s.stop.load();
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
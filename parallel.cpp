@@ -0,0 +1,240 @@
+/// @file parallel.cpp
+/// @brief Implementation of the work stealing thread pool
+/// @author George Downing
+/// @date 17-10-2026
+/// @details This file contains the thread_pool class. Each worker owns a range of chunk numbers packed into one 64 bit atomic, so taking a chunk from the front and stealing half of the range from the back are both a single compare and swap, and no lock is held while chunks run.
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                    include files
+//---------------------------------------------------------------------------------------------------------------------
+
+#include "parallel.h"
+
+#include <limits>
+#include <utility>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    /// @brief Set while the thread is running a chunk, so that a nested loop runs on this thread
+    thread_local bool inside_chunk = false;
+
+    /// @brief Packs a range of chunks into the value of a slot
+    /// @param begin the first chunk
+    /// @param end one past the last chunk
+    /// @return the packed range
+    std::uint64_t pack(std::uint64_t begin, std::uint64_t end) noexcept { return begin | end << 32; }
+
+    /// @brief Gets the first chunk of a packed range
+    std::uint64_t first(std::uint64_t range) noexcept { return range & 0xffffffffu; }
+
+    /// @brief Gets one past the last chunk of a packed range
+    std::uint64_t last(std::uint64_t range) noexcept { return range >> 32; }
+
+    /// @brief Binds the calling thread to one of the processors the process may run on
+    /// @param index the worker number, wrapped around the allowed processors
+    void pin_thread(std::size_t index) noexcept
+    {
+#if defined(__linux__)
+        cpu_set_t allowed;
+        if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+            return;
+        int count = CPU_COUNT(&allowed);
+        if (count == 0)
+            return;
+        int target = static_cast<int>(index % static_cast<std::size_t>(count)); // the target-th allowed processor
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+            if (CPU_ISSET(cpu, &allowed) && target-- == 0)
+            {
+                cpu_set_t one;
+                CPU_ZERO(&one);
+                CPU_SET(cpu, &one);
+                pthread_setaffinity_np(pthread_self(), sizeof(one), &one);
+                return;
+            }
+#else
+        (void)index; // placement is left to the operating system
+#endif
+    }
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 constructors
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details This constructor starts threads - 1 threads that sleep until the first loop is published.
+thread_pool::thread_pool(std::size_t threads, bool pin)
+{
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency()); // one worker per hardware thread
+    Slots = std::make_unique<slot[]>(threads);
+    Threads.reserve(threads - 1);
+    for (std::size_t id = 1; id < threads; ++id)
+        Threads.emplace_back([this, id, pin] { worker_main(id, pin); });
+}
+
+/// @details This destructor wakes every thread with the stop flag set and joins them.
+thread_pool::~thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Stop = true;
+    }
+    Wake.notify_all();
+    for (std::thread &t : Threads)
+        t.join();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 loops
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details This function hands every worker its starting range, wakes the threads, works as worker 0 and then waits until every thread has left the loop, so that no thread still holds a stale view of the slots when the next loop starts.
+void thread_pool::dispatch(std::size_t chunks, task_fn fn, void *context, bool steal)
+{
+    if (chunks == 0)
+        return;
+    if (inside_chunk || Threads.empty())
+    {
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+            fn(context, chunk); // nested or single worker loops run here
+        return;
+    }
+    if (chunks > std::numeric_limits<std::uint32_t>::max())
+        throw std::length_error("thread_pool: too many chunks");
+
+    std::lock_guard<std::mutex> run_lock(RunMutex);
+    std::size_t workers = size();
+    for (std::size_t w = 0; w < workers; ++w)
+        Slots[w].Range.store(pack(w * chunks / workers, (w + 1) * chunks / workers), std::memory_order_relaxed); // published by the lock below
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Task = fn;
+        Context = context;
+        Steal = steal;
+        Error = nullptr;
+        Busy = Threads.size();
+        ++Generation;
+    }
+    Wake.notify_all();
+    work(0); // the calling thread is worker 0
+
+    std::unique_lock<std::mutex> lock(Mutex);
+    Done.wait(lock, [this] { return Busy == 0; });
+    if (Error)
+        std::rethrow_exception(std::exchange(Error, nullptr));
+}
+
+/// @details This function sleeps until a new loop is published, works on it and reports back, until the pool is destroyed.
+void thread_pool::worker_main(std::size_t id, bool pin)
+{
+    if (pin)
+        pin_thread(id);
+    std::uint64_t seen = 0; // the last loop this thread worked on
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(Mutex);
+            Wake.wait(lock, [&] { return Stop || Generation != seen; });
+            if (Stop)
+                return;
+            seen = Generation;
+        }
+        work(id);
+        std::lock_guard<std::mutex> lock(Mutex);
+        if (--Busy == 0)
+            Done.notify_one(); // the last thread out wakes the caller
+    }
+}
+
+/// @details This function runs chunks from its own range, then steals from the others, until every range is empty. If a chunk throws, the exception is kept and every range is emptied so that the other workers stop early.
+void thread_pool::work(std::size_t id) noexcept
+{
+    inside_chunk = true;
+    std::size_t chunk;
+    try
+    {
+        while (take(id, chunk) || (Steal && steal(id, chunk)))
+            Task(Context, chunk);
+    }
+    catch (...)
+    {
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            if (!Error)
+                Error = std::current_exception(); // keep the first exception
+        }
+        for (std::size_t w = 0; w < size(); ++w)
+            Slots[w].Range.store(0, std::memory_order_relaxed); // cancel the chunks not yet taken
+    }
+    inside_chunk = false;
+}
+
+/// @details This function advances the front of the range by one with a compare and swap, which only fails when a thief changed the range at the same time.
+bool thread_pool::take(std::size_t id, std::size_t &chunk) noexcept
+{
+    std::atomic<std::uint64_t> &range = Slots[id].Range;
+    std::uint64_t r = range.load(std::memory_order_relaxed);
+    while (first(r) < last(r))
+        if (range.compare_exchange_weak(r, pack(first(r) + 1, last(r)), std::memory_order_relaxed))
+        {
+            chunk = first(r);
+            return true;
+        }
+    return false;
+}
+
+/// @details This function visits the other workers in turn starting with the next one, so that thieves spread over different victims. The victim keeps the front half of its range, which holds the chunks it is about to run and whose pages it touched first.
+bool thread_pool::steal(std::size_t id, std::size_t &chunk) noexcept
+{
+    std::size_t workers = size();
+    for (std::size_t k = 1; k < workers; ++k)
+    {
+        std::atomic<std::uint64_t> &victim = Slots[(id + k) % workers].Range;
+        std::uint64_t r = victim.load(std::memory_order_relaxed);
+        while (first(r) < last(r))
+        {
+            std::uint64_t mid = first(r) + (last(r) - first(r)) / 2; // the thief takes [mid, last)
+            if (victim.compare_exchange_weak(r, pack(first(r), mid), std::memory_order_relaxed))
+            {
+                chunk = mid;
+                if (mid + 1 < last(r))
+                    Slots[id].Range.store(pack(mid + 1, last(r)), std::memory_order_relaxed); // the rest becomes this worker's range
+                Steals.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 chunk sizes
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @details This function starts the pool on first use; it lives until the program exits.
+thread_pool &default_pool()
+{
+    static thread_pool pool;
+    return pool;
+}
+
+/// @details This function asks the C library once and caches the answer.
+std::size_t l2_cache_bytes() noexcept
+{
+    static std::size_t const bytes = []
+    {
+#if defined(__linux__) && defined(_SC_LEVEL2_CACHE_SIZE)
+        long reported = sysconf(_SC_LEVEL2_CACHE_SIZE);
+        if (reported > 0)
+            return static_cast<std::size_t>(reported);
+#endif
+        return std::size_t(1) << 20; // a common size when the system does not say
+    }();
+    return bytes;
+}
@@ -0,0 +1,293 @@
+/// @file parallel.h
+/// @brief Work stealing thread pool and parallel loops over interval arrays
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares the thread_pool class and the parallel_for, parallel_array and parallel_transform functions that spread batch interval work over every core. A loop is cut into chunks sized to stay in the L2 cache; each thread starts with an equal contiguous block of chunks and idle threads steal the back half of a busy thread's block.
+/// @details Every chunk writes only its own elements, so the results are the same bit for bit whatever the number of threads and whichever thread runs each chunk. Arrays made by parallel_array are first written by the threads that will later process each part of them, which places their pages on the memory node of those threads.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include "interval_array.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 class declaration
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief A fixed set of threads that run the chunks of one loop at a time, balancing them by work stealing
+/// @details The thread that calls #run takes part as worker 0, so a pool of n workers starts n - 1 threads. A call of #run from inside a running chunk runs its chunks on the calling thread, so nested loops cannot deadlock.
+/// @author George Downing
+/// @date 17-10-2026
+class thread_pool
+{
+public:
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 constructors
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Constructor for a pool of worker threads
+    /// @param threads the number of workers including the calling thread, 0 for one per hardware thread
+    /// @param pin true to bind each started thread to its own processor, which keeps first touch placement valid
+    explicit thread_pool(std::size_t threads = 0, bool pin = false);
+
+    /// @brief Destructor for thread_pool, waits for the threads to finish
+    ~thread_pool();
+
+    thread_pool(thread_pool const &) = delete;            ///< a pool cannot be copied
+    thread_pool &operator=(thread_pool const &) = delete; ///< a pool cannot be assigned
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 loops
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Gets the number of workers, counting the thread that calls #run
+    /// @return the number of workers
+    std::size_t size() const noexcept { return Threads.size() + 1; }
+
+    /// @brief Runs fn(chunk) for every chunk in [0, chunks) and waits for all of them
+    /// @details Worker w starts with chunks [w * chunks / size(), (w + 1) * chunks / size()). The first exception thrown by a chunk stops the chunks not yet started and is rethrown here.
+    /// @param chunks the number of chunks, below 2^32
+    /// @param fn the callable run for each chunk
+    /// @param steal false to keep every chunk on the worker it starts with
+    template <class Fn>
+    void run(std::size_t chunks, Fn &&fn, bool steal = true)
+    {
+        using F = std::remove_reference_t<Fn>;
+        auto call = [](void *context, std::size_t chunk) { (*static_cast<F *>(context))(chunk); };
+        dispatch(chunks, call, const_cast<void *>(static_cast<void const *>(std::addressof(fn))), steal);
+    }
+
+    /// @brief Gets the number of chunk ranges taken from another worker since construction
+    /// @return the number of successful steals
+    std::size_t steals() const noexcept { return Steals.load(std::memory_order_relaxed); }
+
+private:
+    /// @brief Type erased chunk function
+    using task_fn = void (*)(void *context, std::size_t chunk);
+
+    /// @brief The chunks a worker still owns, aligned so that no two workers share a cache line
+    struct alignas(64) slot
+    {
+        std::atomic<std::uint64_t> Range{0}; ///< the first chunk in the low 32 bits, one past the last in the high 32 bits
+    };
+
+    /// @brief Publishes a loop to the workers, runs worker 0 on the calling thread and waits
+    void dispatch(std::size_t chunks, task_fn fn, void *context, bool steal);
+
+    /// @brief The loop of a started thread
+    /// @param id the worker number, from 1
+    /// @param pin true to bind the thread to a processor
+    void worker_main(std::size_t id, bool pin);
+
+    /// @brief Runs chunks of the current loop until none are left
+    /// @param id the worker number
+    void work(std::size_t id) noexcept;
+
+    /// @brief Takes the next chunk from the front of a worker's own range
+    /// @param id the worker number
+    /// @param chunk set to the chunk taken
+    /// @return false if the range is empty
+    bool take(std::size_t id, std::size_t &chunk) noexcept;
+
+    /// @brief Takes the back half of another worker's range, keeps its first chunk and stores the rest as its own range
+    /// @param id the worker number
+    /// @param chunk set to the chunk taken
+    /// @return false if every other range is empty
+    bool steal(std::size_t id, std::size_t &chunk) noexcept;
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 Private Variables
+    //---------------------------------------------------------------------------------------------------------------------
+
+    std::unique_ptr<slot[]> Slots;        ///< The chunk range of every worker
+    std::vector<std::thread> Threads;     ///< The started threads, workers 1 to size() - 1
+    std::mutex RunMutex;                  ///< Serialises calls of #run from different threads
+    std::mutex Mutex;                     ///< Guards the variables from Generation to Error
+    std::condition_variable Wake;         ///< Signals a new loop or shutdown to the threads
+    std::condition_variable Done;         ///< Signals the caller that the last thread left the loop
+    std::uint64_t Generation = 0;         ///< The number of loops published
+    std::size_t Busy = 0;                 ///< The started threads still working on the current loop
+    bool Stop = false;                    ///< Set by the destructor
+    task_fn Task = nullptr;               ///< The chunk function of the current loop
+    void *Context = nullptr;              ///< The argument of Task
+    bool Steal = true;                    ///< Whether the current loop balances by stealing
+    std::exception_ptr Error;             ///< The first exception thrown by a chunk of the current loop
+    std::atomic<std::size_t> Steals{0};   ///< The number of successful steals
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 chunk sizes
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Gets a pool with one worker per hardware thread, started on first use
+/// @return the shared pool
+thread_pool &default_pool();
+
+/// @brief Gets the size of the L2 cache of one core
+/// @return the size in bytes, 1 MiB if the operating system does not report it
+std::size_t l2_cache_bytes() noexcept;
+
+/// @brief Chooses the number of intervals per chunk of a loop over interval arrays
+/// @details The columns touched by one chunk fill half the L2 cache, leaving room for the hardware prefetcher, and there are at least eight chunks per worker so that stealing can even out the load. Chunks are whole cache lines of each column so that no two chunks write to the same line.
+/// @tparam T the end point type
+/// @param n the number of intervals in the loop
+/// @param arrays the number of interval arrays read or written per element
+/// @param workers the number of workers sharing the loop
+/// @return the number of intervals per chunk
+template <class T>
+std::size_t chunk_size(std::size_t n, std::size_t arrays, std::size_t workers) noexcept
+{
+    constexpr std::size_t line = basic_interval_array<T>::alignment / sizeof(T); // end points per cache line
+    std::size_t cache = l2_cache_bytes() / 2 / (arrays * 2 * sizeof(T));        // intervals whose columns fill half of L2
+    std::size_t balance = (n + 8 * workers - 1) / (8 * workers);                 // intervals giving eight chunks per worker
+    std::size_t size = std::min(cache, balance);
+    return std::max(line, (size + line - 1) / line * line); // whole cache lines, at least one
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 parallel loops
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Runs fn(begin, end) over [0, n) in chunks of grain elements spread over the workers of a pool
+/// @param pool the workers
+/// @param n the number of elements
+/// @param grain the number of elements per chunk, the last chunk may be shorter
+/// @param fn the callable run for each chunk
+template <class Fn>
+void parallel_for(thread_pool &pool, std::size_t n, std::size_t grain, Fn &&fn)
+{
+    grain = std::max<std::size_t>(grain, 1);
+    pool.run((n + grain - 1) / grain, [&](std::size_t chunk)
+             {
+                 std::size_t begin = chunk * grain;
+                 fn(begin, std::min(begin + grain, n)); });
+}
+
+/// @brief Makes an array of n intervals whose pages are first written by the workers that will process them
+/// @details The chunks run without stealing, so worker w writes the w-th of size() equal parts. Loops run later on the same pool start each worker on the same part.
+/// @param pool the workers
+/// @param n the number of intervals
+/// @param fill the interval to copy into every element
+/// @return the array
+template <class T>
+basic_interval_array<T> parallel_array(thread_pool &pool, std::size_t n, basic_interval<T> const &fill = basic_interval<T>())
+{
+    basic_interval_array<T> out = basic_interval_array<T>::for_overwrite(n);
+    std::size_t grain = chunk_size<T>(n, 1, pool.size());
+    T lo = fill.min(), hi = fill.max();
+    pool.run((n + grain - 1) / grain, [&](std::size_t chunk)
+             {
+                 std::size_t begin = chunk * grain, end = std::min(begin + grain, n);
+                 std::fill(out.lo() + begin, out.lo() + end, lo); // first touch of these pages
+                 std::fill(out.hi() + begin, out.hi() + end, hi); },
+             false);
+    return out;
+}
+
+namespace parallel_detail
+{
+    /// @brief Checks whether a function object is one of the standard arithmetic operators with a batch kernel
+    template <class Fn>
+    inline constexpr bool is_batch_op = std::is_same_v<Fn, std::plus<>> || std::is_same_v<Fn, std::minus<>> ||
+                                        std::is_same_v<Fn, std::multiplies<>> || std::is_same_v<Fn, std::divides<>>;
+
+    /// @brief Maps a standard arithmetic operator to its batch operation
+    /// @return the batch operation
+    template <class Fn>
+    constexpr batch_op batch_op_of() noexcept
+    {
+        if constexpr (std::is_same_v<Fn, std::plus<>>)
+            return batch_op::add;
+        else if constexpr (std::is_same_v<Fn, std::minus<>>)
+            return batch_op::sub;
+        else if constexpr (std::is_same_v<Fn, std::multiplies<>>)
+            return batch_op::mul;
+        else
+            return batch_op::div;
+    }
+
+    /// @brief Gives out the right size without writing it, so that the workers touch its pages first
+    template <class T>
+    void prepare(basic_interval_array<T> &out, std::size_t n)
+    {
+        if (out.size() != n)
+            out = basic_interval_array<T>::for_overwrite(n); // out cannot be an operand, they have n elements
+    }
+} // namespace parallel_detail
+
+/// @brief Applies fn to every pair of elements of two arrays on the workers of a pool
+/// @details std::plus<>, std::minus<>, std::multiplies<> and std::divides<> run the SIMD batch kernels on each chunk; any other callable is called once per element with two intervals and must return an interval.
+/// @param pool the workers
+/// @param a the left operands
+/// @param b the right operands, the same size as a
+/// @param out the results, resized to the size of a; may be a or b
+/// @param fn the operation
+template <class T, class Fn>
+void parallel_transform(thread_pool &pool, basic_interval_array<T> const &a, basic_interval_array<T> const &b, basic_interval_array<T> &out, Fn &&fn)
+{
+    if (a.size() != b.size())
+        throw std::invalid_argument("parallel_transform: operands have different sizes");
+    std::size_t n = a.size();
+    parallel_detail::prepare(out, n);
+    parallel_for(pool, n, chunk_size<T>(n, 3, pool.size()), [&](std::size_t begin, std::size_t end)
+                 {
+                     using F = std::remove_cvref_t<Fn>;
+                     if constexpr (parallel_detail::is_batch_op<F>)
+                         apply_range(parallel_detail::batch_op_of<F>(), a, b, out, begin, end - begin);
+                     else
+                         for (std::size_t i = begin; i < end; ++i)
+                             out.set(i, fn(a[i], b[i])); });
+}
+
+/// @brief Applies fn to every element of an array and one interval on the workers of a pool
+/// @param pool the workers
+/// @param a the left operands
+/// @param b the right operand shared by every element, a scalar converts to the interval enclosing it
+/// @param out the results, resized to the size of a; may be a
+/// @param fn the operation, as for the two array form
+template <class T, class Fn>
+void parallel_transform(thread_pool &pool, basic_interval_array<T> const &a, std::type_identity_t<basic_interval<T>> const &b,
+                        basic_interval_array<T> &out, Fn &&fn)
+{
+    std::size_t n = a.size();
+    parallel_detail::prepare(out, n);
+    parallel_for(pool, n, chunk_size<T>(n, 2, pool.size()), [&](std::size_t begin, std::size_t end)
+                 {
+                     using F = std::remove_cvref_t<Fn>;
+                     if constexpr (parallel_detail::is_batch_op<F>)
+                         apply_range(parallel_detail::batch_op_of<F>(), a, b, out, begin, end - begin);
+                     else
+                         for (std::size_t i = begin; i < end; ++i)
+                             out.set(i, fn(a[i], b)); });
+}
+
+/// @brief Applies fn to every element of an array on the workers of a pool
+/// @param pool the workers
+/// @param a the operands
+/// @param out the results, resized to the size of a; may be a
+/// @param fn the callable taking one interval and returning an interval
+template <class T, class Fn>
+void parallel_transform(thread_pool &pool, basic_interval_array<T> const &a, basic_interval_array<T> &out, Fn &&fn)
+{
+    std::size_t n = a.size();
+    parallel_detail::prepare(out, n);
+    parallel_for(pool, n, chunk_size<T>(n, 2, pool.size()), [&](std::size_t begin, std::size_t end)
+                 {
+                     for (std::size_t i = begin; i < end; ++i)
+                         out.set(i, fn(a[i])); });
+}
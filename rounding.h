@@ -0,0 +1,351 @@
+/// @file rounding.h
+/// @brief Rounding policies for the interval arithmetic class
+/// @author George Downing
+/// @date 17-10-2026
+/// @version 1.0
+/// @details This file declares the policies that decide how basic_interval rounds its end points, and the rounding_scope class that switches the FPU to round upward for a whole batch of operations.
+/// @details rounding::fast rounds to nearest and is not rigorous. rounding::widen moves every end point one ulp outward after rounding to nearest. rounding::switched and rounding::scoped compute with the FPU rounding upward and obtain lower end points by negation, -((-a) op b); switched changes the rounding mode around every operation while scoped relies on a rounding_scope being active.
+/// @details Code using the switched or scoped policies should be compiled with -frounding-math so that the compiler does not move arithmetic across the mode changes.
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 #includes
+//---------------------------------------------------------------------------------------------------------------------
+#pragma once
+#include <bit>
+#include <cfenv>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+//---------------------------------------------------------------------------------------------------------------------
+//                                                 rounding mode scope
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Sets the FPU to round upward for the lifetime of the object and restores the previous mode afterwards
+/// @details One scope around a batch amortises the cost of the mode change over every operation in the batch. It is required by rounding::scoped and harmless for the other policies.
+/// @author George Downing
+/// @date 17-10-2026
+class rounding_scope
+{
+public:
+    /// @brief Saves the current rounding mode and switches to rounding upward
+    rounding_scope() noexcept : Saved(std::fegetround()) { std::fesetround(FE_UPWARD); }
+
+    /// @brief Restores the rounding mode that was active on construction
+    ~rounding_scope() { std::fesetround(Saved); }
+
+    rounding_scope(rounding_scope const &) = delete;            ///< a scope cannot be copied
+    rounding_scope &operator=(rounding_scope const &) = delete; ///< a scope cannot be assigned
+
+private:
+    int Saved; ///< The rounding mode to restore
+};
+
+namespace rounding
+{
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 floating point helpers
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Gets the next representable value towards +inf
+    /// @details float and double step through their bit patterns and stay constexpr; other types use std::nextafter.
+    /// @param x the value to step from
+    /// @return the smallest value greater than x, or x itself if it is +inf or NaN
+    template <class T>
+    constexpr T next_up(T x) noexcept
+    {
+        if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>)
+        {
+            using bits_t = std::conditional_t<std::is_same_v<T, double>, std::uint64_t, std::uint32_t>; // same size as T
+            using sbits_t = std::make_signed_t<bits_t>;
+            if (!(x < std::numeric_limits<T>::infinity())) // +inf and NaN stay as they are
+                return x;
+            if (x == T(0)) // both signed zeros step to the smallest subnormal
+                return std::numeric_limits<T>::denorm_min();
+            bits_t bits = std::bit_cast<bits_t>(x);
+            bits += static_cast<sbits_t>(bits) < 0 ? bits_t(-1) : bits_t(1); // magnitude down if negative, up if positive
+            return std::bit_cast<T>(bits);
+        }
+        else
+            return std::nextafter(x, std::numeric_limits<T>::infinity());
+    }
+
+    /// @brief Gets the next representable value towards -inf
+    /// @param x the value to step from
+    /// @return the largest value less than x, or x itself if it is -inf or NaN
+    template <class T>
+    constexpr T next_down(T x) noexcept
+    {
+        return -next_up(-x); // stepping is symmetric about zero
+    }
+
+    /// @brief Checks whether every value of the arithmetic type S is exactly representable in T
+    template <class S, class T>
+    inline constexpr bool exact_conversion =
+        std::is_same_v<S, T> ||
+        (std::numeric_limits<S>::is_specialized && std::numeric_limits<T>::is_specialized &&
+         std::numeric_limits<S>::digits <= std::numeric_limits<T>::digits &&
+         (std::numeric_limits<S>::is_integer ||
+          (std::numeric_limits<S>::max_exponent <= std::numeric_limits<T>::max_exponent &&
+           std::numeric_limits<S>::min_exponent >= std::numeric_limits<T>::min_exponent)));
+
+    /// @brief Converts a value to T rounding towards -inf, whatever the current rounding mode
+    /// @details The conversion is compared with x in the type S, where it is exact: a floating point S is the wider type, and an integer T value below the largest S converts back without loss. A conversion that reached the largest S or beyond has rounded up.
+    /// @param x the value to convert
+    /// @return the largest T not greater than x
+    template <class T, class S>
+    constexpr T convert_down(S x) noexcept
+    {
+        T t = static_cast<T>(x);
+        if constexpr (exact_conversion<S, T>)
+            return t;
+        else if constexpr (std::is_floating_point_v<S>)
+            return static_cast<S>(t) > x ? next_down(t) : t; // the conversion rounded up
+        else if (t >= static_cast<T>(std::numeric_limits<S>::max()))
+            return next_down(t); // past every S, so above x
+        else
+            return static_cast<S>(t) > x ? next_down(t) : t;
+    }
+
+    /// @brief Converts a value to T rounding towards +inf, whatever the current rounding mode
+    /// @param x the value to convert
+    /// @return the smallest T not less than x
+    template <class T, class S>
+    constexpr T convert_up(S x) noexcept
+    {
+        T t = static_cast<T>(x);
+        if constexpr (exact_conversion<S, T>)
+            return t;
+        else if constexpr (std::is_floating_point_v<S>)
+            return static_cast<S>(t) < x ? next_up(t) : t; // the conversion rounded down
+        else if (t >= static_cast<T>(std::numeric_limits<S>::max()))
+            return t; // past every S, so above x
+        else
+            return static_cast<S>(t) < x ? next_up(t) : t;
+    }
+
+    /// @brief Hides a value from the optimiser so that expressions such as -((-a) * b) are not folded into a * b
+    /// @details The barrier is volatile so it also stays between the fesetround calls of rounding::switched; GCC will otherwise move plain arithmetic across them even with -frounding-math.
+    /// @param x the value to hide
+    /// @return x unchanged
+    template <class T>
+    constexpr T opaque(T x) noexcept
+    {
+        if (!std::is_constant_evaluated())
+        {
+#if defined(__GNUC__) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2_MATH__)))
+            if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>)
+                asm volatile("" : "+x"(x)); // keep x in an SSE register
+            else
+                asm volatile("" : "+m"(x)); // keep x in memory, long double lives on the x87 stack
+#elif defined(__GNUC__)
+            asm volatile("" : "+m"(x)); // keep x in memory
+#endif
+        }
+        return x;
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 rounding policies
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Round to nearest with no widening; fast but the result may not enclose the exact one
+    struct fast
+    {
+        static constexpr bool upward = false; ///< arithmetic is done in the current rounding mode
+
+        /// @brief Nothing needs to be set up around an operation
+        struct guard
+        {
+        };
+
+        /// @brief The policy used inside a batch that holds one #guard for all its operations
+        using batch = fast;
+
+        /// @brief Lower end points are used as computed
+        template <class T>
+        static constexpr T down(T x) noexcept { return x; }
+
+        /// @brief Upper end points are used as computed
+        template <class T>
+        static constexpr T up(T x) noexcept { return x; }
+    };
+
+    /// @brief Round to nearest then move each end point one ulp outward
+    /// @details A correctly rounded result lies within half an ulp of the exact one, so one step outward always encloses it. The result may be one ulp wider than directed rounding would give.
+    struct widen
+    {
+        static constexpr bool upward = false; ///< arithmetic is done in the current rounding mode
+
+        /// @brief Nothing needs to be set up around an operation
+        struct guard
+        {
+        };
+
+        /// @brief The policy used inside a batch that holds one #guard for all its operations
+        using batch = widen;
+
+        /// @brief Lower end points step towards -inf
+        template <class T>
+        static constexpr T down(T x) noexcept { return next_down(x); }
+
+        /// @brief Upper end points step towards +inf
+        template <class T>
+        static constexpr T up(T x) noexcept { return next_up(x); }
+    };
+
+    struct scoped;
+
+    /// @brief Switch the FPU to round upward around every operation; rigorous and self contained but slow
+    struct switched
+    {
+        static constexpr bool upward = true; ///< arithmetic is done while rounding upward
+
+        /// @brief Switches to rounding upward for one operation and back afterwards
+        struct guard
+        {
+            int Saved = std::fegetround();            ///< The rounding mode to restore
+            guard() noexcept { std::fesetround(FE_UPWARD); } ///< switch to rounding upward
+            ~guard() { std::fesetround(Saved); }      ///< restore the previous mode
+            guard(guard const &) = delete;            ///< a guard cannot be copied
+            guard &operator=(guard const &) = delete; ///< a guard cannot be assigned
+        };
+
+        /// @brief Inside a batch the mode is already upward, so operations need no guard of their own
+        using batch = scoped;
+
+        /// @brief Lower end points are already rounded down by negation
+        template <class T>
+        static constexpr T down(T x) noexcept { return x; }
+
+        /// @brief Upper end points are already rounded up by the FPU
+        template <class T>
+        static constexpr T up(T x) noexcept { return x; }
+    };
+
+    /// @brief Assume the FPU already rounds upward because a rounding_scope is active; rigorous and fast in batches
+    struct scoped
+    {
+        static constexpr bool upward = true; ///< arithmetic is done while rounding upward
+
+        /// @brief The enclosing rounding_scope has already set the mode
+        struct guard
+        {
+        };
+
+        /// @brief The policy used inside a batch that holds one #guard for all its operations
+        using batch = scoped;
+
+        /// @brief Lower end points are already rounded down by negation
+        template <class T>
+        static constexpr T down(T x) noexcept { return x; }
+
+        /// @brief Upper end points are already rounded up by the FPU
+        template <class T>
+        static constexpr T up(T x) noexcept { return x; }
+    };
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //                                                 directed operations
+    //---------------------------------------------------------------------------------------------------------------------
+
+    /// @brief Computes a + b rounded towards -inf under policy P
+    template <class P, class T>
+    constexpr T add_down(T a, T b) noexcept
+    {
+        if constexpr (P::upward)
+            return -opaque(opaque(-a) - b); // -((-a) - b) rounded up is a + b rounded down
+        else
+            return P::down(a + b);
+    }
+
+    /// @brief Computes a + b rounded towards +inf under policy P
+    template <class P, class T>
+    constexpr T add_up(T a, T b) noexcept
+    {
+        if constexpr (P::upward)
+            return opaque(opaque(a) + b); // computed while the FPU rounds upward
+        else
+            return P::up(a + b);
+    }
+
+    /// @brief Computes a - b rounded towards -inf under policy P
+    template <class P, class T>
+    constexpr T sub_down(T a, T b) noexcept
+    {
+        if constexpr (P::upward)
+            return -opaque(opaque(b) - a); // -(b - a) rounded up is a - b rounded down
+        else
+            return P::down(a - b);
+    }
+
+    /// @brief Computes a - b rounded towards +inf under policy P
+    template <class P, class T>
+    constexpr T sub_up(T a, T b) noexcept
+    {
+        if constexpr (P::upward)
+            return opaque(opaque(a) - b); // computed while the FPU rounds upward
+        else
+            return P::up(a - b);
+    }
+
+    /// @brief Computes a * b rounded towards -inf under policy P
+    template <class P, class T>
+    constexpr T mul_down(T a, T b) noexcept
+    {
+        if constexpr (P::upward)
+            return -opaque(opaque(-a) * b); // -((-a) * b) rounded up is a * b rounded down
+        else
+            return P::down(a * b);
+    }
+
+    /// @brief Computes a * b rounded towards +inf under policy P
+    template <class P, class T>
+    constexpr T mul_up(T a, T b) noexcept
+    {
+        if constexpr (P::upward)
+            return opaque(opaque(a) * b); // computed while the FPU rounds upward
+        else
+            return P::up(a * b);
+    }
+
+    /// @brief Computes a / b rounded towards -inf under policy P
+    template <class P, class T>
+    constexpr T div_down(T a, T b) noexcept
+    {
+        if constexpr (P::upward)
+            return -opaque(opaque(-a) / b); // -((-a) / b) rounded up is a / b rounded down
+        else
+            return P::down(a / b);
+    }
+
+    /// @brief Computes a / b rounded towards +inf under policy P
+    template <class P, class T>
+    constexpr T div_up(T a, T b) noexcept
+    {
+        if constexpr (P::upward)
+            return opaque(opaque(a) / b); // computed while the FPU rounds upward
+        else
+            return P::up(a / b);
+    }
+
+    /// @brief Computes a * b + c with a single rounding towards -inf under policy P
+    template <class P, class T>
+    inline T fma_down(T a, T b, T c) noexcept
+    {
+        if constexpr (P::upward)
+            return -opaque(std::fma(opaque(-a), b, -c)); // -((-a) * b - c) rounded up is a * b + c rounded down
+        else
+            return P::down(std::fma(a, b, c));
+    }
+
+    /// @brief Computes a * b + c with a single rounding towards +inf under policy P
+    template <class P, class T>
+    inline T fma_up(T a, T b, T c) noexcept
+    {
+        if constexpr (P::upward)
+            return opaque(std::fma(opaque(a), b, c)); // computed while the FPU rounds upward
+        else
+            return P::up(std::fma(a, b, c));
+    }
+} // namespace rounding